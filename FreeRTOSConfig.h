@@ -100,7 +100,17 @@
 #define configIDLE_SHOULD_YIELD         1
 #define configUSE_MUTEXES               1
 #define configQUEUE_REGISTRY_SIZE       8
-#define configCHECK_FOR_STACK_OVERFLOW  0
+/* Check the task stacks for overflow on every switch away from a task.  Debug
+builds also check that the last 16 words of the stack still hold the pattern
+they were filled with (method 2), which catches an overflow that has already
+unwound; release builds only check the stack pointer (method 1), which costs
+next to nothing.  vApplicationStackOverflowHook() in enet_io.c is called when
+either finds one. */
+#ifdef DEBUG
+#define configCHECK_FOR_STACK_OVERFLOW  2
+#else
+#define configCHECK_FOR_STACK_OVERFLOW  1
+#endif
 #define configUSE_RECURSIVE_MUTEXES     1
 #define configUSE_MALLOC_FAILED_HOOK    0
 #define configUSE_APPLICATION_TASK_TAG  0
@@ -125,6 +135,8 @@ to exclude the API function. */
 #define INCLUDE_vTaskSuspend            1
 #define INCLUDE_vTaskDelayUntil         1
 #define INCLUDE_vTaskDelay              1
+#define INCLUDE_xTaskGetSchedulerState  1
+#define INCLUDE_xTaskGetCurrentTaskHandle 1
 
 
 /* The highest interrupt priority that can be used by any interrupt service
@@ -0,0 +1,300 @@
+//*****************************************************************************
+//
+// analog.c - Sampling of the speed potentiometer on ADC0.
+//
+// Timer 0A triggers sample sequencer 0, which converts AIN0 with 16 times
+// hardware averaging into its FIFO and interrupts once it has all its
+// samples; nothing polls the ADC.  The interrupt handler moves the samples
+// into one half of a ping-pong buffer, and once that half holds a block it
+// switches to the other half and notifies the task.  The task averages the
+// block down to a single reading, filters it and turns it into a speed in
+// percent, while the interrupt handler fills the other half.
+//
+// The engine only touches the ADC0 and Timer 0 registers, so
+// tools/analog_test.c can run it against a model of them on the host.  The
+// pin is set up and the interrupt enabled in the NVIC by the application.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include "tm4c1294ncpdt.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "filter.h"
+#include "analog.h"
+
+//*****************************************************************************
+//
+// The system clock frequency.
+//
+//*****************************************************************************
+extern uint32_t g_ui32SysClock;
+
+//*****************************************************************************
+//
+// The mask of a sample in the FIFO.
+//
+//*****************************************************************************
+#define ANALOG_SAMPLE_M         0x00000FFF
+
+//*****************************************************************************
+//
+// The ping-pong buffer, written by the interrupt handler: it fills the half
+// g_ui32Blocks & 1 up to g_ui32Index, and counts the blocks it completes.
+// The task to notify of each block, and the overflows of the sequencer.
+//
+//*****************************************************************************
+static uint16_t g_ppui16Buffer[2][ANALOG_BLOCK_SIZE];
+static uint32_t g_ui32Index;
+static volatile uint32_t g_ui32Blocks;
+static volatile uint32_t g_ui32Overflows;
+static TaskHandle_t g_hTask;
+
+//*****************************************************************************
+//
+// The task's side: the blocks it has taken, the blocks it missed, the
+// filter and the speed in percent.
+//
+//*****************************************************************************
+static uint32_t g_ui32Taken;
+static uint32_t g_ui32Missed;
+static tFilter g_sFilter;
+static uint32_t g_ui32Percent;
+
+//*****************************************************************************
+//
+//! Starts sampling the potentiometer.
+//!
+//! \param hTask is the task to notify when a block of samples is ready, or
+//! NULL for none.
+//!
+//! This must be called once the system clock is set up, before the ADC0
+//! sequence 0 interrupt is enabled in the NVIC.  The PE3 pin must be set up
+//! for AIN0.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Analog_Init(TaskHandle_t hTask)
+{
+    g_ui32Index = 0;
+    g_ui32Blocks = 0;
+    g_ui32Overflows = 0;
+    g_hTask = hTask;
+    g_ui32Taken = 0;
+    g_ui32Missed = 0;
+    g_ui32Percent = 0;
+    Filter_Init(&g_sFilter, FILTER_EMA, ANALOG_FILTER_SHIFT);
+
+    SYSCTL_RCGCADC_R |= SYSCTL_RCGCADC_R0;
+    SYSCTL_RCGCTIMER_R |= SYSCTL_RCGCTIMER_R0;
+    while(!(SYSCTL_PRADC_R & SYSCTL_PRADC_R0) ||
+          !(SYSCTL_PRTIMER_R & SYSCTL_PRTIMER_R0))
+    {
+    }
+
+    //
+    // The ADC runs from the 16 MHz PIOSC at its full rate of 1 Msps, so a
+    // trigger takes 128 conversions, or 128 us.
+    //
+    ADC0_CC_R = ADC_CC_CS_PIOSC;
+    ADC0_PC_R = ADC_PC_MCR_FULL;
+
+    //
+    // All eight steps of sequencer 0 take AIN0, and the last one ends the
+    // sequence and interrupts.  Timer 0A triggers it.
+    //
+    ADC0_ACTSS_R &= ~ADC_ACTSS_ASEN0;
+    ADC0_EMUX_R = (ADC0_EMUX_R & ~ADC_EMUX_EM0_M) | ADC_EMUX_EM0_TIMER;
+    ADC0_SSMUX0_R = 0;
+    ADC0_SSEMUX0_R = 0;
+    ADC0_SSCTL0_R = ADC_SSCTL0_END7 | ADC_SSCTL0_IE7;
+    ADC0_SAC_R = ADC_SAC_AVG_16X;
+    ADC0_ISC_R = ADC_ISC_IN0;
+    ADC0_OSTAT_R = ADC_OSTAT_OV0;
+    ADC0_IM_R |= ADC_IM_MASK0;
+    ADC0_ACTSS_R |= ADC_ACTSS_ASEN0;
+
+    //
+    // Timer 0A times out ANALOG_TRIGGER_HZ times a second and triggers the
+    // ADC each time.
+    //
+    TIMER0_CTL_R &= ~TIMER_CTL_TAEN;
+    TIMER0_CFG_R = TIMER_CFG_32_BIT_TIMER;
+    TIMER0_TAMR_R = TIMER_TAMR_TAMR_PERIOD;
+    TIMER0_TAILR_R = (g_ui32SysClock / ANALOG_TRIGGER_HZ) - 1;
+    TIMER0_ADCEV_R = TIMER_ADCEV_TATOADCEN;
+    TIMER0_CTL_R |= TIMER_CTL_TAOTE | TIMER_CTL_TAEN;
+}
+
+//*****************************************************************************
+//
+//! The ADC0 sequence 0 interrupt handler, which moves the samples into the
+//! ping-pong buffer.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Analog_IntHandler(void)
+{
+    BaseType_t xWoken;
+    uint32_t ui32Half;
+
+    ADC0_ISC_R = ADC_ISC_IN0;
+
+    //
+    // Samples were lost if the sequencer was triggered again before the
+    // last ones were read.
+    //
+    if(ADC0_OSTAT_R & ADC_OSTAT_OV0)
+    {
+        ADC0_OSTAT_R = ADC_OSTAT_OV0;
+        g_ui32Overflows++;
+    }
+
+    xWoken = pdFALSE;
+    ui32Half = g_ui32Blocks & 1;
+
+    while(!(ADC0_SSFSTAT0_R & ADC_SSFSTAT0_EMPTY))
+    {
+        g_ppui16Buffer[ui32Half][g_ui32Index++] =
+            ADC0_SSFIFO0_R & ANALOG_SAMPLE_M;
+
+        if(g_ui32Index == ANALOG_BLOCK_SIZE)
+        {
+            //
+            // Hand the block over and go on in the other half.
+            //
+            g_ui32Index = 0;
+            g_ui32Blocks++;
+            ui32Half ^= 1;
+
+            if(g_hTask)
+            {
+                vTaskNotifyGiveFromISR(g_hTask, &xWoken);
+            }
+        }
+    }
+
+    portYIELD_FROM_ISR(xWoken);
+}
+
+//*****************************************************************************
+//
+//! Takes the latest block of samples, if there is one.
+//!
+//! This averages the block down to a single reading and filters it.  Only
+//! the latest block is taken; any before it that the task did not take in
+//! time are counted as missed.  It must be called from a single task, at
+//! least once a block.
+//!
+//! \return \b true if a block was taken.
+//
+//*****************************************************************************
+bool
+Analog_Process(void)
+{
+    const uint16_t *pui16Block;
+    uint32_t ui32Blocks, ui32Idx, ui32Sum, ui32Value, ui32Percent;
+    uint64_t ui64Scaled;
+
+    ui32Blocks = g_ui32Blocks;
+    if(ui32Blocks == g_ui32Taken)
+    {
+        return(false);
+    }
+
+    g_ui32Missed += ui32Blocks - g_ui32Taken - 1;
+    g_ui32Taken = ui32Blocks;
+
+    pui16Block = g_ppui16Buffer[(ui32Blocks - 1) & 1];
+    ui32Sum = 0;
+    for(ui32Idx = 0; ui32Idx < ANALOG_BLOCK_SIZE; ui32Idx++)
+    {
+        ui32Sum += pui16Block[ui32Idx];
+    }
+
+    //
+    // The interrupt handler starts on this half again once it finishes the
+    // other, so if it did while the block was summed the sum is spoilt.
+    //
+    if(g_ui32Blocks != ui32Blocks)
+    {
+        g_ui32Missed++;
+        return(false);
+    }
+
+    ui32Value = (((ui32Sum << ANALOG_FRAC_BITS) + (ANALOG_BLOCK_SIZE / 2)) /
+                 ANALOG_BLOCK_SIZE);
+    ui32Value = Filter_Add(&g_sFilter, ui32Value);
+
+    //
+    // The speed moves to the nearest percent only once the reading is three
+    // quarters of a percent away from the speed, so that noise on the
+    // boundary of two does not make it flicker between them.
+    //
+    ui32Percent = ((ui32Value * 100) + (ANALOG_FULL_SCALE / 2)) /
+                  ANALOG_FULL_SCALE;
+    ui64Scaled = (uint64_t)ui32Value * 100;
+    if(ui64Scaled < ((uint64_t)g_ui32Percent * ANALOG_FULL_SCALE))
+    {
+        ui64Scaled = ((uint64_t)g_ui32Percent * ANALOG_FULL_SCALE) -
+                     ui64Scaled;
+    }
+    else
+    {
+        ui64Scaled -= (uint64_t)g_ui32Percent * ANALOG_FULL_SCALE;
+    }
+    if((ui64Scaled * 4) > ((uint64_t)ANALOG_FULL_SCALE * 3))
+    {
+        g_ui32Percent = ui32Percent;
+    }
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Returns the filtered reading of the potentiometer.
+//!
+//! \return The reading, from 0 to \b ANALOG_FULL_SCALE, with
+//! \b ANALOG_FRAC_BITS fractional bits.
+//
+//*****************************************************************************
+uint32_t
+Analog_Get_Value(void)
+{
+    return(Filter_Get(&g_sFilter));
+}
+
+//*****************************************************************************
+//
+//! Returns the speed set on the potentiometer.
+//!
+//! \return The speed in percent, from 0 to 100.
+//
+//*****************************************************************************
+uint32_t
+Analog_Get_Percent(void)
+{
+    return(g_ui32Percent);
+}
+
+//*****************************************************************************
+//
+//! Returns the counts of blocks and lost samples.
+//!
+//! \param psStats receives the counts since Analog_Init().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Analog_Get_Stats(tAnalogStats *psStats)
+{
+    psStats->ui32Blocks = g_ui32Blocks;
+    psStats->ui32Missed = g_ui32Missed;
+    psStats->ui32Overflows = g_ui32Overflows;
+}
@@ -0,0 +1,72 @@
+//*****************************************************************************
+//
+// analog.h - Prototypes for the sampling of the speed potentiometer.
+//
+//*****************************************************************************
+
+#ifndef __ANALOG_H__
+#define __ANALOG_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// Timer 0A triggers sample sequencer 0 of ADC0 ANALOG_TRIGGER_HZ times a
+// second.  Each trigger takes ANALOG_STEPS samples of AIN0, each the average
+// of 16 conversions in hardware.  The samples are collected in blocks of
+// ANALOG_BLOCK_TRIGGERS triggers, 20 ms, which averaged come to a reading
+// with no ripple from 50 Hz mains hum or its harmonics.
+//
+//*****************************************************************************
+#define ANALOG_TRIGGER_HZ       1000
+#define ANALOG_STEPS            8
+#define ANALOG_BLOCK_TRIGGERS   20
+#define ANALOG_BLOCK_SIZE       (ANALOG_STEPS * ANALOG_BLOCK_TRIGGERS)
+
+//*****************************************************************************
+//
+// The readings are kept with ANALOG_FRAC_BITS fractional bits below the 12
+// bits of the ADC, and filtered by an exponential moving average with a
+// weight of 1/2^ANALOG_FILTER_SHIFT per block.
+//
+//*****************************************************************************
+#define ANALOG_FRAC_BITS        4
+#define ANALOG_FULL_SCALE       (4095 << ANALOG_FRAC_BITS)
+#define ANALOG_FILTER_SHIFT     1
+
+//*****************************************************************************
+//
+// The blocks completed by the interrupt handler, those the task missed or
+// lost to the interrupt handler while it read them, and the times samples
+// were lost because the interrupt handler did not empty the sequencer
+// before the next trigger.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Blocks;
+    uint32_t ui32Missed;
+    uint32_t ui32Overflows;
+}
+tAnalogStats;
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.
+//
+//*****************************************************************************
+extern void Analog_Init(TaskHandle_t hTask);
+extern void Analog_IntHandler(void);
+extern bool Analog_Process(void);
+extern uint32_t Analog_Get_Value(void);
+extern uint32_t Analog_Get_Percent(void);
+extern void Analog_Get_Stats(tAnalogStats *psStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ANALOG_H__
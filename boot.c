@@ -0,0 +1,148 @@
+//*****************************************************************************
+//
+// boot.c - The boot trace: the time each stage of the boot was reached at.
+//
+// The stages are marked by whatever brings them up, once each; later marks
+// of a stage are ignored, so the network code can mark the link and the
+// first HTTP response every time it sees them.  The trace is printed on the
+// UART as it fills and served as /boot.json.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_types.h"
+#include "driverlib/interrupt.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timing.h"
+#include "boot.h"
+
+//*****************************************************************************
+//
+// The trace.
+//
+//*****************************************************************************
+static tBootTrace g_sTrace;
+
+//*****************************************************************************
+//
+// The names of the stages, as printed and served.
+//
+//*****************************************************************************
+static const char * const g_ppcStageNames[BOOT_NUM_STAGES] =
+{
+    "clock",
+    "ethernet",
+    "scheduler",
+    "display",
+    "link",
+    "ip",
+    "http",
+};
+
+//*****************************************************************************
+//
+// Return the time since TimingInit() in microseconds.  The FreeRTOS tick
+// count starts at zero with the scheduler, so it gives the time since
+// TimingInit() once the scheduler stage has been marked.
+//
+//*****************************************************************************
+static uint32_t
+Boot_Now(void)
+{
+    uint32_t ui32Ms;
+
+    if((xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED) &&
+       (g_sTrace.ui32Reached & (1 << BOOT_STAGE_SCHEDULER)))
+    {
+        ui32Ms = (g_sTrace.pui32Us[BOOT_STAGE_SCHEDULER] / 1000) +
+                 (xTaskGetTickCount() * portTICK_PERIOD_MS);
+        if(ui32Ms >= BOOT_CYCLE_LIMIT_MS)
+        {
+            return(ui32Ms * 1000);
+        }
+    }
+
+    return(TimingCyclesToUs(TimingNow()));
+}
+
+//*****************************************************************************
+//
+//! Records that a stage of the boot has been reached.
+//!
+//! \param ui32Stage is the stage, one of the \b BOOT_STAGE_ values.
+//!
+//! Only the first call for each stage is recorded.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Boot_Mark(uint32_t ui32Stage)
+{
+    uint32_t ui32Us;
+    bool bIntsOff;
+
+    if((ui32Stage >= BOOT_NUM_STAGES) ||
+       (g_sTrace.ui32Reached & (1 << ui32Stage)))
+    {
+        return;
+    }
+
+    ui32Us = Boot_Now();
+
+    //
+    // Two tasks may reach a stage at the same time; keep the first.
+    //
+    bIntsOff = IntMasterDisable();
+
+    if(!(g_sTrace.ui32Reached & (1 << ui32Stage)))
+    {
+        g_sTrace.pui32Us[ui32Stage] = ui32Us;
+        g_sTrace.ui32Reached |= 1 << ui32Stage;
+    }
+
+    if(!bIntsOff)
+    {
+        IntMasterEnable();
+    }
+}
+
+//*****************************************************************************
+//
+//! Reads the boot trace.
+//!
+//! \param psTrace receives the trace.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Boot_Get_Trace(tBootTrace *psTrace)
+{
+    bool bIntsOff;
+
+    bIntsOff = IntMasterDisable();
+
+    *psTrace = g_sTrace;
+
+    if(!bIntsOff)
+    {
+        IntMasterEnable();
+    }
+}
+
+//*****************************************************************************
+//
+//! Returns the name of a stage of the boot.
+//!
+//! \param ui32Stage is the stage, one of the \b BOOT_STAGE_ values.
+//!
+//! \return The name, or NULL if there is no such stage.
+//
+//*****************************************************************************
+const char *
+Boot_Stage_Name(uint32_t ui32Stage)
+{
+    return((ui32Stage < BOOT_NUM_STAGES) ? g_ppcStageNames[ui32Stage] : NULL);
+}
@@ -0,0 +1,69 @@
+//*****************************************************************************
+//
+// boot.h - Prototypes for the boot trace.
+//
+//*****************************************************************************
+
+#ifndef __BOOT_H__
+#define __BOOT_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The stages of the boot, in the order they are usually reached.  The
+// display and the network come up at the same time, so the display may come
+// after the link.
+//
+//*****************************************************************************
+#define BOOT_STAGE_CLOCK        0   // The system clock runs from the PLL
+#define BOOT_STAGE_ETHERNET     1   // The MAC and PHY are set up and the PHY
+                                    // negotiates the link
+#define BOOT_STAGE_SCHEDULER    2   // The tasks are about to start
+#define BOOT_STAGE_DISPLAY      3   // The splash screen is on the display
+#define BOOT_STAGE_LINK         4   // The Ethernet link is up
+#define BOOT_STAGE_IP           5   // DHCP has given an IP address
+#define BOOT_STAGE_HTTP         6   // The first HTTP response has been sent
+#define BOOT_NUM_STAGES         7
+
+//*****************************************************************************
+//
+// The time the cycle counter is trusted for, in milliseconds since
+// TimingInit().  It wraps after about 35 s at 120 MHz; stages reached later
+// are timed with the FreeRTOS tick count, to the millisecond.
+//
+//*****************************************************************************
+#define BOOT_CYCLE_LIMIT_MS     30000
+
+//*****************************************************************************
+//
+// The time each stage was reached at, in microseconds since TimingInit(),
+// which is called right after the system clock is set up.  Bit n of
+// ui32Reached is set if stage n has been reached.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Reached;
+    uint32_t pui32Us[BOOT_NUM_STAGES];
+}
+tBootTrace;
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.  They may be called from
+// any task, before or after the scheduler is started.
+//
+//*****************************************************************************
+extern void Boot_Mark(uint32_t ui32Stage);
+extern void Boot_Get_Trace(tBootTrace *psTrace);
+extern const char *Boot_Stage_Name(uint32_t ui32Stage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __BOOT_H__
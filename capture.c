@@ -0,0 +1,237 @@
+//*****************************************************************************
+//
+// capture.c - Flow sensor input capture engine on Timer 1A.
+//
+// The flow sensor drives the T1CCP0 input, where Timer 1A latches the cycle
+// count at every falling edge.  The time of an edge so does not depend on
+// how long its interrupt takes to run, only on the edge itself.  The
+// interrupt handler extends the captured counts with the wraps of the timer
+// and puts them in a sample ring, which the task measuring the flow empties
+// with Capture_Measure().
+//
+// The engine only touches the Timer 1 registers, so tools/capture_sim.c can
+// run it against a model of the timer on the host.  The pin is set up and
+// the interrupt enabled in the NVIC by the application.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include "tm4c1294ncpdt.h"
+#include "sample_ring.h"
+#include "capture.h"
+
+//*****************************************************************************
+//
+// The system clock frequency.
+//
+//*****************************************************************************
+extern uint32_t g_ui32SysClock;
+
+//*****************************************************************************
+//
+// The mask of a captured count and the number of wraps counted by the
+// interrupt handler.
+//
+//*****************************************************************************
+#define CAPTURE_COUNT_M         ((1 << CAPTURE_WRAP_SHIFT) - 1)
+
+static volatile uint32_t g_ui32Wraps;
+
+//*****************************************************************************
+//
+// The ring of edge times, written by the interrupt handler, and the last
+// edge time it stored.
+//
+//*****************************************************************************
+static volatile uint32_t g_pui32Edges[CAPTURE_RING_SIZE];
+static tSampleRing g_sEdges;
+static uint32_t g_ui32LastEdge;
+
+//*****************************************************************************
+//
+// The measurement in progress, which only the reader uses: whether it has
+// its first edge, the times of its first and last edges, the periods
+// between them and the wraps counted when it started.
+//
+//*****************************************************************************
+static struct
+{
+    bool bOpen;
+    uint32_t ui32First;
+    uint32_t ui32Last;
+    uint32_t ui32Periods;
+    uint32_t ui32Wraps;
+}
+g_sGate;
+
+//*****************************************************************************
+//
+//! Starts the capture engine.
+//!
+//! This must be called once the system clock is set up, before the capture
+//! interrupt is enabled in the NVIC.  The PA2 pin must be given to T1CCP0.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Capture_Init(void)
+{
+    g_ui32Wraps = 0;
+    Sample_Ring_Init(&g_sEdges, g_pui32Edges, CAPTURE_RING_SIZE);
+    g_ui32LastEdge = 0;
+    g_sGate.bOpen = false;
+
+    SYSCTL_RCGCTIMER_R |= SYSCTL_RCGCTIMER_R1;
+    while(!(SYSCTL_PRTIMER_R & SYSCTL_PRTIMER_R1))
+    {
+    }
+
+    //
+    // A 16-bit edge-time capture of the falling edges, counting up through
+    // the prescaler to the full 24 bits.
+    //
+    TIMER1_CTL_R &= ~TIMER_CTL_TAEN;
+    TIMER1_CFG_R = TIMER_CFG_16_BIT;
+    TIMER1_TAMR_R = (TIMER_TAMR_TAMR_CAP | TIMER_TAMR_TACMR |
+                     TIMER_TAMR_TACDIR);
+    TIMER1_CTL_R = ((TIMER1_CTL_R & ~TIMER_CTL_TAEVENT_M) |
+                    TIMER_CTL_TAEVENT_NEG);
+    TIMER1_TAILR_R = 0xFFFF;
+    TIMER1_TAPR_R = 0xFF;
+    TIMER1_ICR_R = TIMER_ICR_CAECINT | TIMER_ICR_TATOCINT;
+    TIMER1_IMR_R = TIMER_IMR_CAEIM | TIMER_IMR_TATOIM;
+    TIMER1_CTL_R |= TIMER_CTL_TAEN;
+}
+
+//*****************************************************************************
+//
+//! The Timer 1A interrupt handler, which stores the edge times and counts
+//! the wraps of the timer.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Capture_IntHandler(void)
+{
+    uint32_t ui32Status, ui32Count, ui32Edge;
+
+    ui32Status = TIMER1_MIS_R;
+
+    if(ui32Status & TIMER_MIS_CAEMIS)
+    {
+        TIMER1_ICR_R = TIMER_ICR_CAECINT;
+        ui32Count = TIMER1_TAR_R & CAPTURE_COUNT_M;
+
+        //
+        // A wrap not counted yet came before the edge if the count is low.
+        //
+        ui32Edge = ((g_ui32Wraps +
+                     (((TIMER1_RIS_R & TIMER_RIS_TATORIS) &&
+                       (ui32Count < (CAPTURE_COUNT_M / 2))) ? 1 : 0)) <<
+                    CAPTURE_WRAP_SHIFT) + ui32Count;
+
+        //
+        // An edge right after the interrupt was cleared shows up again with
+        // the same count; store it once.
+        //
+        if(ui32Edge != g_ui32LastEdge)
+        {
+            g_ui32LastEdge = ui32Edge;
+            Sample_Ring_Put(&g_sEdges, ui32Edge);
+        }
+    }
+
+    if(ui32Status & TIMER_MIS_TATOMIS)
+    {
+        TIMER1_ICR_R = TIMER_ICR_TATOCINT;
+        g_ui32Wraps++;
+    }
+}
+
+//*****************************************************************************
+//
+//! Measures the frequency of the input.
+//!
+//! \param ui32GateCycles is the shortest time to measure over, in system
+//! clock cycles.
+//! \param psPeriod receives the measurement if there is one.
+//!
+//! This reads the edges captured since the last call and counts the periods
+//! between them until they span at least the gate.  The next measurement
+//! starts at the last edge of this one, so no period is lost between them.
+//! It should be called often enough for the ring not to fill up, from a
+//! single task.
+//!
+//! \return \b true if a measurement was completed, in which case the latest
+//! one is in \e psPeriod.
+//
+//*****************************************************************************
+bool
+Capture_Measure(uint32_t ui32GateCycles, tCapturePeriod *psPeriod)
+{
+    uint32_t ui32Edge;
+    bool bMeasured, bGap;
+
+    //
+    // Give up a measurement that would not fit in the timestamps.
+    //
+    if(g_sGate.bOpen &&
+       ((g_ui32Wraps - g_sGate.ui32Wraps) >= CAPTURE_MAX_WRAPS))
+    {
+        g_sGate.bOpen = false;
+    }
+
+    bMeasured = false;
+
+    while(Sample_Ring_Get(&g_sEdges, &ui32Edge, &bGap))
+    {
+        //
+        // Start at the first edge, and again after lost edges, across which
+        // the periods are unknown.
+        //
+        if(!g_sGate.bOpen || bGap)
+        {
+            g_sGate.bOpen = true;
+            g_sGate.ui32First = ui32Edge;
+            g_sGate.ui32Periods = 0;
+            g_sGate.ui32Wraps = g_ui32Wraps;
+            continue;
+        }
+
+        g_sGate.ui32Last = ui32Edge;
+        g_sGate.ui32Periods++;
+
+        if((g_sGate.ui32Last - g_sGate.ui32First) >= ui32GateCycles)
+        {
+            psPeriod->ui32Periods = g_sGate.ui32Periods;
+            psPeriod->ui32Cycles = g_sGate.ui32Last - g_sGate.ui32First;
+            psPeriod->ui32MilliHz =
+                (uint32_t)((((uint64_t)psPeriod->ui32Periods *
+                             g_ui32SysClock * 1000) +
+                            (psPeriod->ui32Cycles / 2)) /
+                           psPeriod->ui32Cycles);
+            bMeasured = true;
+
+            g_sGate.ui32First = g_sGate.ui32Last;
+            g_sGate.ui32Periods = 0;
+            g_sGate.ui32Wraps = g_ui32Wraps;
+        }
+    }
+
+    return(bMeasured);
+}
+
+//*****************************************************************************
+//
+//! Returns the number of edges lost because the ring was full.
+//!
+//! \return The number of edges lost since Capture_Init().
+//
+//*****************************************************************************
+uint32_t
+Capture_Get_Overruns(void)
+{
+    return(Sample_Ring_Lost(&g_sEdges));
+}
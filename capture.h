@@ -0,0 +1,73 @@
+//*****************************************************************************
+//
+// capture.h - Prototypes for the flow sensor input capture engine.
+//
+//*****************************************************************************
+
+#ifndef __CAPTURE_H__
+#define __CAPTURE_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The capture timer counts system clock cycles in 16 bits with its 8-bit
+// prescaler as an extension, so it wraps every 2^CAPTURE_WRAP_SHIFT cycles
+// (about 140 ms at 120 MHz).  The wraps it counts make the upper bits of the
+// timestamps, which so wrap every 2^32 cycles (about 35.8 s).
+//
+//*****************************************************************************
+#define CAPTURE_WRAP_SHIFT      24
+
+//*****************************************************************************
+//
+// The number of timestamps the ring holds between two calls to
+// Capture_Measure().  It must be a power of two.
+//
+//*****************************************************************************
+#define CAPTURE_RING_SIZE       32
+
+//*****************************************************************************
+//
+// A measurement is given up after this many wraps of the timer without
+// reaching the gate, which keeps its span well inside the 32-bit
+// timestamps.  It is 2^31 cycles, about 17.9 s at 120 MHz.
+//
+//*****************************************************************************
+#define CAPTURE_MAX_WRAPS       (1 << (31 - CAPTURE_WRAP_SHIFT))
+
+//*****************************************************************************
+//
+// A measurement of the input: a number of whole periods, the system clock
+// cycles they took, and so the frequency in millihertz.  The frequency is
+// the average over all the periods, which resolves it to a fraction of a
+// cycle per period.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Periods;
+    uint32_t ui32Cycles;
+    uint32_t ui32MilliHz;
+}
+tCapturePeriod;
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.
+//
+//*****************************************************************************
+extern void Capture_Init(void);
+extern void Capture_IntHandler(void);
+extern bool Capture_Measure(uint32_t ui32GateCycles,
+                            tCapturePeriod *psPeriod);
+extern uint32_t Capture_Get_Overruns(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __CAPTURE_H__
@@ -0,0 +1,723 @@
+//*****************************************************************************
+//
+// display.c - A queued drawing service for the OLED display.
+//
+// Tasks that want to show something post drawing commands to a queue, which
+// takes constant time and never waits for the I2C bus.  The display task
+// (oledTask) takes the commands off the queue, draws them into the
+// framebuffer and flushes it once the queue is empty, so a burst of commands
+// costs a single flush.
+//
+// The strings of text commands are kept in a few slots rather than in the
+// queue.  A text posted at the position of one still waiting replaces its
+// string instead of queueing another command, so a value updated faster than
+// the display can follow only shows its latest state.
+//
+// The lines drawn and the frames flushed are also recorded in the display
+// mirror, which the web server reads.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "task.h"
+#include "i2c.h"
+#include "oled_fb.h"
+#include "display.h"
+#include "display_mirror.h"
+
+//*****************************************************************************
+//
+// The drawing commands.
+//
+//*****************************************************************************
+#define CMD_TEXT                0
+#define CMD_FILL_RECT           1
+#define CMD_LINE                2
+#define CMD_BAR                 3
+#define CMD_BLIT                4
+#define CMD_PROGRESS            5
+#define CMD_SCROLL              6
+#define CMD_SCROLL_STOP         7
+
+//*****************************************************************************
+//
+// A command in the queue.  Lines keep their end in i16Width and i16Height,
+// and text commands the index of their slot in ui32Value.  Progress bars
+// keep their duration in ticks in ui32Max.  Scrolls keep their direction in
+// ui8Color, their pages in i16Y and i16Height, their interval in ui32Value
+// and their vertical offset in ui32Max.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint8_t ui8Command;
+    uint8_t ui8Color;
+    int16_t i16X;
+    int16_t i16Y;
+    int16_t i16Width;
+    int16_t i16Height;
+    uint32_t ui32Value;
+    uint32_t ui32Max;
+    const uint8_t *pui8Image;
+}
+tDisplayCommand;
+
+//*****************************************************************************
+//
+// A slot holding the string of a queued text command.
+//
+//*****************************************************************************
+typedef struct
+{
+    bool bPending;
+    int16_t i16X;
+    int16_t i16Y;
+
+    //
+    // The font, scale and box of the text.
+    //
+    const tFont *psFont;
+    uint8_t ui8Scale;
+    int16_t i16Width;
+
+    //
+    // The sequence number of the command, which tells whether other
+    // commands were queued after it.
+    //
+    uint32_t ui32Sequence;
+
+    char pcText[DISPLAY_TEXT_LEN + 1];
+}
+tDisplayText;
+
+//*****************************************************************************
+//
+// The queue, the text slots and the counters.  The sequence number counts the
+// commands queued; the barrier is the sequence number of the last command
+// that is not text.  A text command can only be replaced while no such
+// command follows it, since that command could draw over the text.  Texts at
+// different positions are expected not to overlap.
+//
+//*****************************************************************************
+static QueueHandle_t g_xQueue;
+static tDisplayText g_psTexts[DISPLAY_TEXT_SLOTS];
+static uint32_t g_ui32Sequence;
+static uint32_t g_ui32Barrier;
+static tDisplayStats g_sStats;
+
+//*****************************************************************************
+//
+// The pages the display is scrolling on its own, if any.  Only the display
+// task uses these.
+//
+//*****************************************************************************
+static bool g_bScrolling;
+static uint8_t g_ui8ScrollFirst;
+static uint8_t g_ui8ScrollLast;
+
+//*****************************************************************************
+//
+// Queue a command.  This must be called in a critical section.
+//
+//*****************************************************************************
+static bool
+Display_Enqueue(const tDisplayCommand *psCommand)
+{
+    if(xQueueSendToBack(g_xQueue, psCommand, 0) != pdPASS)
+    {
+        g_sStats.ui32Dropped++;
+        return(false);
+    }
+
+    g_sStats.ui32Queued++;
+    g_ui32Sequence++;
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Queue a command other than text.
+//
+//*****************************************************************************
+static bool
+Display_Post(const tDisplayCommand *psCommand)
+{
+    bool bQueued;
+
+    taskENTER_CRITICAL();
+    bQueued = Display_Enqueue(psCommand);
+    if(bQueued)
+    {
+        g_ui32Barrier = g_ui32Sequence;
+    }
+    taskEXIT_CRITICAL();
+
+    return(bQueued);
+}
+
+//*****************************************************************************
+//
+// Send what changed to the display and publish it to the mirror.
+//
+//*****************************************************************************
+static void
+Display_Flush(void)
+{
+    uint32_t ui32Bytes;
+
+    ui32Bytes = OLED_FB_Flush();
+    Display_Mirror_Frame(OLED_FB_Buffer());
+
+    taskENTER_CRITICAL();
+    g_sStats.ui32Flushes++;
+    g_sStats.ui32Bytes += ui32Bytes;
+    taskEXIT_CRITICAL();
+}
+
+//*****************************************************************************
+//
+// Stop the scroll engine, if it runs, and have the pages it moved sent again
+// by the next flush.
+//
+//*****************************************************************************
+static void
+Display_Stop_Scroll(void)
+{
+    if(!g_bScrolling)
+    {
+        return;
+    }
+
+    I2C_OLED_Stop_Scroll();
+    OLED_FB_Invalidate(g_ui8ScrollFirst, g_ui8ScrollLast);
+    g_bScrolling = false;
+}
+
+//*****************************************************************************
+//
+// Fill a progress bar over a duration, a frame at a time.  Only the columns
+// filled since the previous frame change, so a frame costs a few bytes on
+// the bus.
+//
+//*****************************************************************************
+static void
+Display_Animate_Progress(const tDisplayCommand *psCommand)
+{
+    TickType_t xElapsed;
+
+    for(xElapsed = 0; ; xElapsed += DISPLAY_FRAME_TICKS)
+    {
+        if(xElapsed > psCommand->ui32Max)
+        {
+            xElapsed = psCommand->ui32Max;
+        }
+
+        OLED_FB_Bar(psCommand->i16X, psCommand->i16Y, psCommand->i16Width,
+                    psCommand->i16Height, xElapsed, psCommand->ui32Max);
+        Display_Flush();
+
+        if(xElapsed == psCommand->ui32Max)
+        {
+            break;
+        }
+        vTaskDelay(DISPLAY_FRAME_TICKS);
+    }
+}
+
+//*****************************************************************************
+//
+// Draw a command into the framebuffer.
+//
+//*****************************************************************************
+static void
+Display_Execute(const tDisplayCommand *psCommand)
+{
+    tDisplayText *psText;
+    char pcText[DISPLAY_TEXT_LEN + 1];
+    const tFont *psFont;
+    uint32_t ui32Scale;
+    int32_t i32Width;
+
+    switch(psCommand->ui8Command)
+    {
+        case CMD_TEXT:
+        {
+            //
+            // Take the latest string out of the slot and free it.
+            //
+            psText = &g_psTexts[psCommand->ui32Value];
+            taskENTER_CRITICAL();
+            strcpy(pcText, psText->pcText);
+            psFont = psText->psFont;
+            ui32Scale = psText->ui8Scale;
+            i32Width = psText->i16Width;
+            psText->bPending = false;
+            taskEXIT_CRITICAL();
+
+            OLED_FB_Text_Font(psCommand->i16X, psCommand->i16Y, i32Width,
+                              psFont, ui32Scale, pcText);
+            Display_Mirror_Line(psCommand->i16X, psCommand->i16Y, pcText);
+            break;
+        }
+
+        case CMD_FILL_RECT:
+        {
+            OLED_FB_Fill_Rect(psCommand->i16X, psCommand->i16Y,
+                              psCommand->i16Width, psCommand->i16Height,
+                              psCommand->ui8Color);
+            break;
+        }
+
+        case CMD_LINE:
+        {
+            OLED_FB_Line(psCommand->i16X, psCommand->i16Y,
+                         psCommand->i16Width, psCommand->i16Height,
+                         psCommand->ui8Color);
+            break;
+        }
+
+        case CMD_BAR:
+        {
+            OLED_FB_Bar(psCommand->i16X, psCommand->i16Y,
+                        psCommand->i16Width, psCommand->i16Height,
+                        psCommand->ui32Value, psCommand->ui32Max);
+            break;
+        }
+
+        case CMD_BLIT:
+        {
+            OLED_FB_Blit(psCommand->i16X, psCommand->i16Y,
+                         psCommand->pui8Image, psCommand->i16Width,
+                         psCommand->i16Height);
+            break;
+        }
+
+        case CMD_PROGRESS:
+        {
+            Display_Animate_Progress(psCommand);
+            break;
+        }
+
+        case CMD_SCROLL:
+        {
+            //
+            // The display memory must hold the framebuffer before it starts
+            // scrolling.
+            //
+            Display_Stop_Scroll();
+            Display_Flush();
+
+            I2C_OLED_Scroll(psCommand->ui8Color, psCommand->i16Y,
+                            psCommand->i16Height, psCommand->ui32Value,
+                            psCommand->ui32Max);
+            g_bScrolling = true;
+            g_ui8ScrollFirst = psCommand->i16Y;
+            g_ui8ScrollLast = psCommand->i16Height;
+
+            //
+            // The diagonal scrolls move every page.
+            //
+            if((psCommand->ui8Color ==
+                SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL) ||
+               (psCommand->ui8Color ==
+                SSD1306_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL))
+            {
+                g_ui8ScrollFirst = 0;
+                g_ui8ScrollLast = OLED_FB_PAGES - 1;
+            }
+            break;
+        }
+
+        case CMD_SCROLL_STOP:
+        {
+            Display_Stop_Scroll();
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Initializes the display service.
+//!
+//! This creates the command queue, and must be called before any command is
+//! posted.  The framebuffer must already be initialized.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Display_Init(void)
+{
+    g_xQueue = xQueueCreate(DISPLAY_QUEUE_LEN, sizeof(tDisplayCommand));
+}
+
+//*****************************************************************************
+//
+//! Draws a string with font_default.
+//!
+//! \param i32X is the left column of the string.
+//! \param i32Y is the top row of the string.
+//! \param pcString is the string, of which the first DISPLAY_TEXT_LEN
+//! characters are drawn.
+//!
+//! If a string posted earlier at the same position has not been drawn yet,
+//! this one replaces it.
+//!
+//! \return true if the string will be drawn.
+//
+//*****************************************************************************
+bool
+Display_Text(int32_t i32X, int32_t i32Y, const char *pcString)
+{
+    return(Display_Text_Font(i32X, i32Y, 0, &FONT_FIXED, 1, pcString));
+}
+
+//*****************************************************************************
+//
+//! Draws a string with any font, at its own size or larger.
+//!
+//! \param i32X is the left column of the string, or of its box.
+//! \param i32Y is the top row of the string.
+//! \param i32Width is the width of the box the string is centered in, or 0.
+//! \param psFont is the font.
+//! \param ui32Scale is the scale, 1 or 2.
+//! \param pcString is the string, of which the first DISPLAY_TEXT_LEN
+//! characters are drawn.
+//!
+//! This takes the arguments of OLED_FB_Text_Font().  If a string posted
+//! earlier at the same position has not been drawn yet, this one replaces it,
+//! font and all.
+//!
+//! \return true if the string will be drawn.
+//
+//*****************************************************************************
+bool
+Display_Text_Font(int32_t i32X, int32_t i32Y, int32_t i32Width,
+                  const tFont *psFont, uint32_t ui32Scale,
+                  const char *pcString)
+{
+    tDisplayCommand sCommand;
+    tDisplayText *psText, *psFree;
+    bool bQueued;
+
+    psFree = 0;
+    bQueued = false;
+
+    taskENTER_CRITICAL();
+
+    for(psText = g_psTexts; psText < (g_psTexts + DISPLAY_TEXT_SLOTS);
+        psText++)
+    {
+        if(!psText->bPending)
+        {
+            if(!psFree)
+            {
+                psFree = psText;
+            }
+        }
+        else if((psText->i16X == i32X) && (psText->i16Y == i32Y) &&
+                (psText->ui32Sequence > g_ui32Barrier))
+        {
+            //
+            // Replace the string still waiting at this position.
+            //
+            strncpy(psText->pcText, pcString, DISPLAY_TEXT_LEN);
+            psText->psFont = psFont;
+            psText->ui8Scale = ui32Scale;
+            psText->i16Width = i32Width;
+            g_sStats.ui32Coalesced++;
+            bQueued = true;
+            break;
+        }
+    }
+
+    if(!bQueued)
+    {
+        if(!psFree)
+        {
+            g_sStats.ui32Dropped++;
+        }
+        else
+        {
+            sCommand.ui8Command = CMD_TEXT;
+            sCommand.i16X = i32X;
+            sCommand.i16Y = i32Y;
+            sCommand.ui32Value = psFree - g_psTexts;
+            bQueued = Display_Enqueue(&sCommand);
+            if(bQueued)
+            {
+                psFree->bPending = true;
+                psFree->i16X = i32X;
+                psFree->i16Y = i32Y;
+                psFree->ui32Sequence = g_ui32Sequence;
+                psFree->psFont = psFont;
+                psFree->ui8Scale = ui32Scale;
+                psFree->i16Width = i32Width;
+                strncpy(psFree->pcText, pcString, DISPLAY_TEXT_LEN);
+                psFree->pcText[DISPLAY_TEXT_LEN] = '\0';
+            }
+        }
+    }
+
+    taskEXIT_CRITICAL();
+
+    return(bQueued);
+}
+
+//*****************************************************************************
+//
+//! Clears the display.
+//!
+//! \return true if the command was queued.
+//
+//*****************************************************************************
+bool
+Display_Clear(void)
+{
+    return(Display_Fill_Rect(0, 0, OLED_FB_WIDTH, OLED_FB_HEIGHT, BLACK));
+}
+
+//*****************************************************************************
+//
+//! Fills a rectangle.
+//!
+//! \return true if the command was queued.
+//
+//*****************************************************************************
+bool
+Display_Fill_Rect(int32_t i32X, int32_t i32Y, int32_t i32Width,
+                  int32_t i32Height, uint8_t ui8Color)
+{
+    tDisplayCommand sCommand;
+
+    sCommand.ui8Command = CMD_FILL_RECT;
+    sCommand.ui8Color = ui8Color;
+    sCommand.i16X = i32X;
+    sCommand.i16Y = i32Y;
+    sCommand.i16Width = i32Width;
+    sCommand.i16Height = i32Height;
+
+    return(Display_Post(&sCommand));
+}
+
+//*****************************************************************************
+//
+//! Draws a line.
+//!
+//! \return true if the command was queued.
+//
+//*****************************************************************************
+bool
+Display_Line(int32_t i32X0, int32_t i32Y0, int32_t i32X1, int32_t i32Y1,
+             uint8_t ui8Color)
+{
+    tDisplayCommand sCommand;
+
+    sCommand.ui8Command = CMD_LINE;
+    sCommand.ui8Color = ui8Color;
+    sCommand.i16X = i32X0;
+    sCommand.i16Y = i32Y0;
+    sCommand.i16Width = i32X1;
+    sCommand.i16Height = i32Y1;
+
+    return(Display_Post(&sCommand));
+}
+
+//*****************************************************************************
+//
+//! Draws a horizontal bar graph.
+//!
+//! \return true if the command was queued.
+//
+//*****************************************************************************
+bool
+Display_Bar(int32_t i32X, int32_t i32Y, int32_t i32Width, int32_t i32Height,
+            uint32_t ui32Value, uint32_t ui32Max)
+{
+    tDisplayCommand sCommand;
+
+    sCommand.ui8Command = CMD_BAR;
+    sCommand.i16X = i32X;
+    sCommand.i16Y = i32Y;
+    sCommand.i16Width = i32Width;
+    sCommand.i16Height = i32Height;
+    sCommand.ui32Value = ui32Value;
+    sCommand.ui32Max = ui32Max;
+
+    return(Display_Post(&sCommand));
+}
+
+//*****************************************************************************
+//
+//! Draws an image.
+//!
+//! The image is not copied and must stay unchanged until it is drawn, which
+//! suits the constant images in images/.
+//!
+//! \return true if the command was queued.
+//
+//*****************************************************************************
+bool
+Display_Blit(int32_t i32X, int32_t i32Y, const uint8_t *pui8Image,
+             int32_t i32Width, int32_t i32Height)
+{
+    tDisplayCommand sCommand;
+
+    sCommand.ui8Command = CMD_BLIT;
+    sCommand.i16X = i32X;
+    sCommand.i16Y = i32Y;
+    sCommand.i16Width = i32Width;
+    sCommand.i16Height = i32Height;
+    sCommand.pui8Image = pui8Image;
+
+    return(Display_Post(&sCommand));
+}
+
+//*****************************************************************************
+//
+//! Animates a progress bar filling up.
+//!
+//! \param i32X is the left column of the bar.
+//! \param i32Y is the top row of the bar.
+//! \param i32Width is the width of the bar, including its outline.
+//! \param i32Height is the height of the bar, including its outline.
+//! \param ui32Ms is the time the bar takes to fill, in milliseconds.
+//!
+//! The display task draws the bar as in OLED_FB_Bar() every
+//! DISPLAY_FRAME_MS until it is full, and draws the commands queued after
+//! this one once it is.  Nobody else waits for it, so this can stand in for a
+//! delay at boot that would otherwise hold up everything after it.
+//!
+//! \return true if the command was queued.
+//
+//*****************************************************************************
+bool
+Display_Progress(int32_t i32X, int32_t i32Y, int32_t i32Width,
+                 int32_t i32Height, uint32_t ui32Ms)
+{
+    tDisplayCommand sCommand;
+
+    sCommand.ui8Command = CMD_PROGRESS;
+    sCommand.i16X = i32X;
+    sCommand.i16Y = i32Y;
+    sCommand.i16Width = i32Width;
+    sCommand.i16Height = i32Height;
+    sCommand.ui32Max = ui32Ms / portTICK_PERIOD_MS;
+
+    return(Display_Post(&sCommand));
+}
+
+//*****************************************************************************
+//
+//! Starts the display scrolling on its own.
+//!
+//! \param ui8Direction is SSD1306_LEFT_HORIZONTAL_SCROLL,
+//! SSD1306_RIGHT_HORIZONTAL_SCROLL or one of the diagonal scrolls of
+//! ssd1306.h.
+//! \param ui32First is the first page that scrolls.
+//! \param ui32Last is the last page that scrolls.
+//! \param ui32Interval is the time between steps, one of the
+//! SSD1306_SCROLL_* frame counts.
+//! \param ui32Vertical is the number of rows the diagonal scrolls move the
+//! display up by at each step, and 0 for the horizontal ones.
+//!
+//! The display moves the pages itself, so the animation costs a single
+//! command transaction however long it runs.  Anything drawn in the pages
+//! while they scroll only shows once the scroll is stopped, when they are
+//! sent again whole.  Starting a scroll stops the previous one.
+//!
+//! \return true if the command was queued.
+//
+//*****************************************************************************
+bool
+Display_Scroll(uint8_t ui8Direction, uint32_t ui32First, uint32_t ui32Last,
+               uint32_t ui32Interval, uint32_t ui32Vertical)
+{
+    tDisplayCommand sCommand;
+
+    sCommand.ui8Command = CMD_SCROLL;
+    sCommand.ui8Color = ui8Direction;
+    sCommand.i16Y = ui32First;
+    sCommand.i16Height = ui32Last;
+    sCommand.ui32Value = ui32Interval;
+    sCommand.ui32Max = ui32Vertical;
+
+    return(Display_Post(&sCommand));
+}
+
+//*****************************************************************************
+//
+//! Stops the display scrolling and restores the pages that scrolled.
+//!
+//! \return true if the command was queued.
+//
+//*****************************************************************************
+bool
+Display_Scroll_Stop(void)
+{
+    tDisplayCommand sCommand;
+
+    sCommand.ui8Command = CMD_SCROLL_STOP;
+
+    return(Display_Post(&sCommand));
+}
+
+//*****************************************************************************
+//
+//! Draws the queued commands and sends the result to the display.
+//!
+//! \param xWait is the number of ticks to wait for a first command.
+//!
+//! This is the body of the display task.  It draws every command queued, then
+//! flushes the framebuffer once and publishes it to the display mirror.
+//!
+//! \return true if anything was drawn.
+//
+//*****************************************************************************
+bool
+Display_Process(TickType_t xWait)
+{
+    tDisplayCommand sCommand;
+
+    if(xQueueReceive(g_xQueue, &sCommand, xWait) != pdPASS)
+    {
+        return(false);
+    }
+
+    do
+    {
+        Display_Execute(&sCommand);
+    }
+    while(xQueueReceive(g_xQueue, &sCommand, 0) == pdPASS);
+
+    Display_Flush();
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Reads the counters of the display service.
+//!
+//! \param psStats receives the counters.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Display_Get_Stats(tDisplayStats *psStats)
+{
+    taskENTER_CRITICAL();
+    *psStats = g_sStats;
+    taskEXIT_CRITICAL();
+}
@@ -0,0 +1,101 @@
+//*****************************************************************************
+//
+// display.h - Prototypes for the queued OLED display service.
+//
+//*****************************************************************************
+
+#ifndef __DISPLAY_H__
+#define __DISPLAY_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The number of drawing commands that can wait for the display task, and the
+// number of text commands among them.
+//
+//*****************************************************************************
+#define DISPLAY_QUEUE_LEN       16
+#define DISPLAY_TEXT_SLOTS      8
+
+//*****************************************************************************
+//
+// The time between the frames of an animation.
+//
+//*****************************************************************************
+#define DISPLAY_FRAME_MS        50
+#define DISPLAY_FRAME_TICKS     (DISPLAY_FRAME_MS / portTICK_PERIOD_MS)
+
+//*****************************************************************************
+//
+// The longest string a text command holds: a line of font_default.
+//
+//*****************************************************************************
+#define DISPLAY_TEXT_LEN        (OLED_FB_WIDTH / OLED_FB_CHAR_WIDTH)
+
+//*****************************************************************************
+//
+// The counters of the display service.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // Commands queued, and commands refused because the queue was full.
+    //
+    uint32_t ui32Queued;
+    uint32_t ui32Dropped;
+
+    //
+    // Text commands that replaced a queued one at the same position.
+    //
+    uint32_t ui32Coalesced;
+
+    //
+    // Flushes of the framebuffer, and the bytes they sent.
+    //
+    uint32_t ui32Flushes;
+    uint32_t ui32Bytes;
+}
+tDisplayStats;
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.  The drawing functions
+// take the arguments of their OLED_FB_ counterparts, never block, and return
+// false if the command could not be queued.  They may be called from any
+// task, and before the scheduler starts.
+//
+//*****************************************************************************
+extern void Display_Init(void);
+extern bool Display_Text(int32_t i32X, int32_t i32Y, const char *pcString);
+extern bool Display_Text_Font(int32_t i32X, int32_t i32Y, int32_t i32Width,
+                              const tFont *psFont, uint32_t ui32Scale,
+                              const char *pcString);
+extern bool Display_Clear(void);
+extern bool Display_Fill_Rect(int32_t i32X, int32_t i32Y, int32_t i32Width,
+                              int32_t i32Height, uint8_t ui8Color);
+extern bool Display_Line(int32_t i32X0, int32_t i32Y0, int32_t i32X1,
+                         int32_t i32Y1, uint8_t ui8Color);
+extern bool Display_Bar(int32_t i32X, int32_t i32Y, int32_t i32Width,
+                        int32_t i32Height, uint32_t ui32Value,
+                        uint32_t ui32Max);
+extern bool Display_Blit(int32_t i32X, int32_t i32Y, const uint8_t *pui8Image,
+                         int32_t i32Width, int32_t i32Height);
+extern bool Display_Progress(int32_t i32X, int32_t i32Y, int32_t i32Width,
+                             int32_t i32Height, uint32_t ui32Ms);
+extern bool Display_Scroll(uint8_t ui8Direction, uint32_t ui32First,
+                           uint32_t ui32Last, uint32_t ui32Interval,
+                           uint32_t ui32Vertical);
+extern bool Display_Scroll_Stop(void);
+extern bool Display_Process(TickType_t xWait);
+extern void Display_Get_Stats(tDisplayStats *psStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DISPLAY_H__
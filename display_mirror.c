@@ -0,0 +1,225 @@
+//*****************************************************************************
+//
+// display_mirror.c - A copy of the OLED contents kept for remote monitoring.
+//
+// The display task records every line of text it draws and publishes the
+// framebuffer after every flush, so the web server can show what the display
+// shows without reading it back over I2C, or on a unit without a display.
+//
+// The display task is the only writer and never waits for the readers.  The
+// lines are kept in a ring, each slot tagged with the number of its line plus
+// one.  The writer changes the tag before it rewrites the slot, so a reader
+// that copies a line and finds the same tag before and after knows the copy
+// is whole.  The frames are kept in two buffers, frame n in buffer n & 1, so
+// the frame being written only overwrites the one before the latest.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include "ssd1306.h"
+#include "oled_font.h"
+#include "oled_image.h"
+#include "oled_fb.h"
+#include "display_mirror.h"
+
+//*****************************************************************************
+//
+// A slot of the line ring.  The tag is the number of the line it holds, or is
+// being written into it, plus one.
+//
+//*****************************************************************************
+typedef struct
+{
+    volatile uint32_t ui32Tag;
+    volatile tDisplayMirrorLine sLine;
+}
+tMirrorSlot;
+
+//*****************************************************************************
+//
+// The line ring and the number of lines written to it.
+//
+//*****************************************************************************
+static tMirrorSlot g_psSlots[DISPLAY_MIRROR_LINES];
+static volatile uint32_t g_ui32Lines;
+
+//*****************************************************************************
+//
+// The two frame buffers, the number of frames published and the number of
+// the frame being written, which is the number published while no frame is
+// being written.
+//
+//*****************************************************************************
+static volatile uint8_t g_ppui8Frames[2][OLED_FB_PAGES * OLED_FB_WIDTH];
+static volatile uint32_t g_ui32Frames;
+static volatile uint32_t g_ui32FrameWriting;
+
+//*****************************************************************************
+//
+//! Records a line of text drawn on the display.
+//!
+//! \param i32X is the left column of the text.
+//! \param i32Y is the top row of the text.
+//! \param pcText is the text, of which the first DISPLAY_MIRROR_TEXT_LEN
+//! characters are kept.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Display_Mirror_Line(int32_t i32X, int32_t i32Y, const char *pcText)
+{
+    tMirrorSlot *psSlot;
+    uint32_t ui32Line, ui32Idx;
+
+    ui32Line = g_ui32Lines;
+    psSlot = &g_psSlots[ui32Line & (DISPLAY_MIRROR_LINES - 1)];
+
+    psSlot->ui32Tag = ui32Line + 1;
+
+    psSlot->sLine.ui8X = (uint8_t)i32X;
+    psSlot->sLine.ui8Y = (uint8_t)i32Y;
+    for(ui32Idx = 0; (ui32Idx < DISPLAY_MIRROR_TEXT_LEN) && pcText[ui32Idx];
+        ui32Idx++)
+    {
+        psSlot->sLine.pcText[ui32Idx] = pcText[ui32Idx];
+    }
+    psSlot->sLine.pcText[ui32Idx] = '\0';
+
+    g_ui32Lines = ui32Line + 1;
+}
+
+//*****************************************************************************
+//
+//! Returns the number of lines recorded so far.
+//!
+//! The lines are numbered from 0 in the order they were drawn; only the last
+//! DISPLAY_MIRROR_LINES of them can still be read.
+//!
+//! \return The number of lines recorded.
+//
+//*****************************************************************************
+uint32_t
+Display_Mirror_Line_Count(void)
+{
+    return(g_ui32Lines);
+}
+
+//*****************************************************************************
+//
+//! Reads a line of text.
+//!
+//! \param ui32Line is the number of the line.
+//! \param psLine receives the line.
+//!
+//! \return true if the line was read, or false if it has not been drawn yet
+//! or has already been overwritten.
+//
+//*****************************************************************************
+bool
+Display_Mirror_Read_Line(uint32_t ui32Line, tDisplayMirrorLine *psLine)
+{
+    tMirrorSlot *psSlot;
+    uint32_t ui32Idx, ui32Distance;
+
+    //
+    // The distance wraps around with the line numbers.
+    //
+    ui32Distance = g_ui32Lines - ui32Line;
+    if((ui32Distance == 0) || (ui32Distance > DISPLAY_MIRROR_LINES))
+    {
+        return(false);
+    }
+
+    psSlot = &g_psSlots[ui32Line & (DISPLAY_MIRROR_LINES - 1)];
+    if(psSlot->ui32Tag != (ui32Line + 1))
+    {
+        return(false);
+    }
+
+    psLine->ui8X = psSlot->sLine.ui8X;
+    psLine->ui8Y = psSlot->sLine.ui8Y;
+    for(ui32Idx = 0; ui32Idx <= DISPLAY_MIRROR_TEXT_LEN; ui32Idx++)
+    {
+        psLine->pcText[ui32Idx] = psSlot->sLine.pcText[ui32Idx];
+    }
+    psLine->pcText[DISPLAY_MIRROR_TEXT_LEN] = '\0';
+
+    return(psSlot->ui32Tag == (ui32Line + 1));
+}
+
+//*****************************************************************************
+//
+//! Publishes the contents of the display.
+//!
+//! \param pui8Frame is the framebuffer, as returned by OLED_FB_Buffer().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Display_Mirror_Frame(const uint8_t *pui8Frame)
+{
+    volatile uint8_t *pui8Copy;
+    uint32_t ui32Frame, ui32Idx;
+
+    ui32Frame = g_ui32Frames + 1;
+    pui8Copy = g_ppui8Frames[ui32Frame & 1];
+
+    g_ui32FrameWriting = ui32Frame;
+    for(ui32Idx = 0; ui32Idx < (OLED_FB_PAGES * OLED_FB_WIDTH); ui32Idx++)
+    {
+        pui8Copy[ui32Idx] = pui8Frame[ui32Idx];
+    }
+    g_ui32Frames = ui32Frame;
+}
+
+//*****************************************************************************
+//
+//! Returns the number of the latest frame published.
+//!
+//! Frame 0 is the blank display before the first frame is published.
+//!
+//! \return The number of frames published.
+//
+//*****************************************************************************
+uint32_t
+Display_Mirror_Frame_Count(void)
+{
+    return(g_ui32Frames);
+}
+
+//*****************************************************************************
+//
+//! Reads a byte of a frame.
+//!
+//! \param ui32Frame is the number of the frame.
+//! \param ui32Offset is the offset of the byte in the framebuffer layout.
+//!
+//! The frame may be overwritten while it is read; call
+//! Display_Mirror_Frame_Valid() after reading to find out.
+//!
+//! \return The byte.
+//
+//*****************************************************************************
+uint8_t
+Display_Mirror_Frame_Byte(uint32_t ui32Frame, uint32_t ui32Offset)
+{
+    return(g_ppui8Frames[ui32Frame & 1][ui32Offset]);
+}
+
+//*****************************************************************************
+//
+//! Tells whether a frame has been published and not overwritten since.
+//!
+//! \param ui32Frame is the number of the frame.
+//!
+//! \return true if the bytes read from the frame so far belong to it.
+//
+//*****************************************************************************
+bool
+Display_Mirror_Frame_Valid(uint32_t ui32Frame)
+{
+    return((ui32Frame <= g_ui32Frames) &&
+           (g_ui32FrameWriting < (ui32Frame + 2)));
+}
@@ -0,0 +1,66 @@
+//*****************************************************************************
+//
+// display_mirror.h - Prototypes for the copy of the OLED contents kept for
+//                    remote monitoring.
+//
+//*****************************************************************************
+
+#ifndef __DISPLAY_MIRROR_H__
+#define __DISPLAY_MIRROR_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The number of lines of text the mirror remembers.  This must be a power of
+// two.
+//
+//*****************************************************************************
+#define DISPLAY_MIRROR_LINES    16
+
+//*****************************************************************************
+//
+// The longest line kept, which is a line of font_default across the display.
+//
+//*****************************************************************************
+#define DISPLAY_MIRROR_TEXT_LEN (OLED_FB_WIDTH / OLED_FB_CHAR_WIDTH)
+
+//*****************************************************************************
+//
+// A line of text drawn on the display, with the position it was drawn at.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint8_t ui8X;
+    uint8_t ui8Y;
+    char pcText[DISPLAY_MIRROR_TEXT_LEN + 1];
+}
+tDisplayMirrorLine;
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.  Display_Mirror_Line() and
+// Display_Mirror_Frame() must only be called by the display task; the other
+// functions may be called from any task at the same time.
+//
+//*****************************************************************************
+extern void Display_Mirror_Line(int32_t i32X, int32_t i32Y,
+                                const char *pcText);
+extern uint32_t Display_Mirror_Line_Count(void);
+extern bool Display_Mirror_Read_Line(uint32_t ui32Line,
+                                     tDisplayMirrorLine *psLine);
+extern void Display_Mirror_Frame(const uint8_t *pui8Frame);
+extern uint32_t Display_Mirror_Frame_Count(void);
+extern uint8_t Display_Mirror_Frame_Byte(uint32_t ui32Frame,
+                                         uint32_t ui32Offset);
+extern bool Display_Mirror_Frame_Valid(uint32_t ui32Frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DISPLAY_MIRROR_H__
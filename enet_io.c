@@ -15,7 +15,6 @@
 #include "driverlib/sysctl.h"
 #include "driverlib/systick.h"
 #include "driverlib/timer.h"
-#include "driverlib/adc.h"
 #include "driverlib/pwm.h"
 #include "driverlib/gpio.h"
 #include "driverlib/rom_map.h"
@@ -26,7 +25,16 @@
 #include "httpserver_raw/httpd.h"
 #include "drivers/pinout.h"
 #include "io.h"
+#include "io_fs.h"
+#include "telemetry.h"
+#include "timing.h"
+#include "boot.h"
+#include "utimer.h"
+#include "capture.h"
+#include "filter.h"
+#include "pid.h"
 #include "./i2c.h"
+#include "oled_fb.h"
 #include "utils.h"
 
 // FreeRTOS includes
@@ -34,8 +42,12 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "queue.h"
+#include "display.h"
+#include "analog.h"
 
+#if NO_SYS
 void ethernetTask(void *pvParameters);
+#endif
 void testTask(void *pvParameters);
 void demoSerialTask(void *pvParameters);
 void adcTask(void *pvParameters);
@@ -47,19 +59,69 @@ bool systemOnline = false;
 bool automaticMode = true;
 uint32_t automaticModeSpeed = 0;
 uint32_t manualModeSpeed = 0;
-uint32_t timerValue = 0;
-uint32_t interruptValue = 0;
 uint32_t timerEntries = 0;
-bool firstPulse = true;
-uint32_t firstTime = 0;
-uint32_t secondTime = 0;
 int32_t measuredFrequency = 0;
-
-#define PERIOD_SAMPLES 10
-uint32_t periodAverage[PERIOD_SAMPLES] = {0};
-uint32_t periodIndex = 0;
-
-//! tools/bin/makefsfile -i fs -o io_fsdata.h -r -h -q
+uint32_t pwmPulseWidth = 0;
+
+// Time spent in the Ethernet interrupt, reported every second by
+// demoSerialTask.
+tTimingStats ethernetIntStats;
+
+// Time spent in the lwIP host timer handler, which posts the network status
+// to the display.
+tTimingStats hostTimerStats;
+
+// The timing of the control loop in pwmTask: how far each pass starts from a
+// period after the one before, and how long it takes.  The statistics are
+// reported every second by demoSerialTask and the histograms, kept since
+// boot, by /loop.json and every LOOP_HISTOGRAM_S seconds over the UART.
+#define LOOP_HISTOGRAM_S 10
+tTimingStats loopJitterStats;
+tTimingStats loopExecStats;
+tTimingHistogram loopJitter;
+tTimingHistogram loopExec;
+
+// The flow sensor frequency is measured over at least FLOW_GATE_CYCLES
+// (about 17 ms) and filtered, in millihertz.  With no measurement for
+// FLOW_TIMEOUT_MS the input is taken for lost and the flow for zero; slower
+// inputs read as no signal.
+#define FLOW_GATE_CYCLES 2000000
+#define FLOW_FILTER FILTER_AVERAGE
+#define FLOW_FILTER_LENGTH 10
+#define FLOW_TIMEOUT_MS 1000
+tFilter flowFilter;
+bool flowSignal = false;
+uint32_t flowMilliHz = 0;
+uint32_t flowGateMilliHz = 0;
+uint32_t flowLastMs = 0;
+
+// The flow is held at the setpoint by a PID controller run by pwmTask every
+// CONTROL_PERIOD_MS.  A speed of 100% is a flow of FLOW_FULL_SCALE_MHZ, and
+// the feed-forward takes the duty cycle to be in proportion to the flow.
+// The controller works on the latest measurement rather than the filtered
+// one, whose delay at low flows would cost it more than the noise does.
+// The flow is measured once a period at low flows, which leaves too little
+// for a derivative term to work on.  The tuning is worked out, and the
+// response measured, by tools/pid_sim.c.
+#define FLOW_FULL_SCALE_MHZ 50000
+#define CONTROL_KP 0.006
+#define CONTROL_TI_MS 250
+#define CONTROL_TD_MS 0
+#define CONTROL_RATE 8
+const tPIDConfig flowControlConfig =
+{
+  PID_GAIN(CONTROL_KP),
+  PID_GAIN(CONTROL_KP * CONTROL_PERIOD_MS / CONTROL_TI_MS),
+  PID_GAIN(CONTROL_KP * CONTROL_TD_MS / CONTROL_PERIOD_MS),
+  PID_GAIN((double)PWM_PERIOD / FLOW_FULL_SCALE_MHZ),
+  1,
+  PWM_PERIOD - 1,
+  CONTROL_RATE
+};
+tPID flowControl;
+uint32_t flowSetpoint = 0;
+
+//! python3 tools/makefsdata.py -i fs -o io_fsdata.h
 
 #define MAX_FLOW 40
 // Defines for setting up the system clock.
@@ -70,6 +132,32 @@ uint32_t periodIndex = 0;
 // significant with lower values indicating higher priority interrupts.
 #define SYSTICK_INT_PRIORITY 0x80
 #define ETHERNET_INT_PRIORITY 0xC0
+#define I2C_INT_PRIORITY 0xE0
+#define UTIMER_INT_PRIORITY 0xE0
+#define CAPTURE_INT_PRIORITY 0xE0
+#define ANALOG_INT_PRIORITY 0xE0
+
+// Task priorities.  The PWM control loop runs above the lwIP threads
+// (TCPIP_THREAD_PRIO in lwipopts.h) so that network load cannot delay it;
+// the display and diagnostics run below them.
+#define PWM_TASK_PRIORITY 3
+#define SERIAL_TASK_PRIORITY 1
+#define OLED_TASK_PRIORITY 1
+#define ADC_TASK_PRIORITY 1
+#define ETHERNET_TASK_PRIORITY 1
+
+// Task stack sizes, in words.  Each leaves headroom over the deepest calls
+// the task makes; /status.json reports the least free stack of each task
+// since it started, to check them against.  The serial task formats the
+// readouts and timing reports with UARTprintf() and usprintf(); the OLED
+// task renders text in the proportional fonts into the frame buffer; the PWM
+// task runs the filter and the PID controller and adds to the timing
+// histograms; the ADC task averages the blocks of samples.
+#define ETHERNET_TASK_STACK_SIZE 512
+#define SERIAL_TASK_STACK_SIZE 512
+#define PWM_TASK_STACK_SIZE 384
+#define OLED_TASK_STACK_SIZE 512
+#define ADC_TASK_STACK_SIZE 256
 
 #define FLAG_TICK 0
 static volatile unsigned long g_ulFlags;
@@ -113,6 +201,21 @@ void __error__(char *pcFilename, uint32_t ui32Line)
 }
 #endif
 
+#if configCHECK_FOR_STACK_OVERFLOW
+// Called by the kernel when it finds that a task has overflowed its stack.
+// Whatever the task wrote past it has corrupted memory that belongs to
+// something else, so stop here, with the pump stopped, rather than run on.
+// pcTaskName is the name of the task, for the debugger.
+void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName)
+{
+  IntMasterDisable();
+  PWMOutputState(PWM0_BASE, PWM_OUT_4_BIT, false);
+  while (1)
+  {
+  }
+}
+#endif
+
 //*****************************************************************************
 //
 // Display an lwIP type IP Address.
@@ -132,8 +235,8 @@ void DisplayIPAddress(uint32_t ui32Addr)
   // Display the string.
   //
   UARTprintf(pcBuf);
-  I2C_OLED_Move_Cursor(1, 0);
-  I2C_OLED_Print(pcBuf);
+  Display_Fill_Rect(0, 8, OLED_FB_WIDTH, OLED_FB_CHAR_HEIGHT, BLACK);
+  Display_Text(0, 8, pcBuf);
 }
 
 //*****************************************************************************
@@ -143,7 +246,9 @@ void DisplayIPAddress(uint32_t ui32Addr)
 //*****************************************************************************
 void lwIPHostTimerHandler(void)
 {
-  uint32_t ui32NewIPAddress;
+  uint32_t ui32NewIPAddress, start;
+
+  start = TimingNow();
 
   //
   // Get the current IP address.
@@ -164,8 +269,9 @@ void lwIPHostTimerHandler(void)
       // Indicate that there is no link.
       //
       UARTprintf("Aguardando por conexo.\n");
-      I2C_OLED_Move_Cursor(0, 0);
-      I2C_OLED_Print("Aguard. Conexao ");
+      Display_Text(0, 0, "Aguard. Conexao ");
+      Display_Scroll(SSD1306_LEFT_HORIZONTAL_SCROLL, 0, 0,
+                     SSD1306_SCROLL_25_FRAMES, 0);
     }
     else if (ui32NewIPAddress == 0)
     {
@@ -174,16 +280,17 @@ void lwIPHostTimerHandler(void)
       // running.
       //
       UARTprintf("Aguardando por endereo IP.\n");
-      I2C_OLED_Move_Cursor(0, 0);
-      I2C_OLED_Print("Aguard. IP      ");
+      Display_Text(0, 0, "Aguard. IP      ");
+      Display_Scroll(SSD1306_LEFT_HORIZONTAL_SCROLL, 0, 0,
+                     SSD1306_SCROLL_25_FRAMES, 0);
     }
     else
     {
       //
-      // Display the new IP address.
+      // Display the new IP address, on a still status line.
       //
-      I2C_OLED_Move_Cursor(0, 0);
-      I2C_OLED_Print("Endereco IP:    ");
+      Display_Scroll_Stop();
+      Display_Text(0, 0, "Endereco IP:    ");
       UARTprintf("Endereo IP: ");
       DisplayIPAddress(ui32NewIPAddress);
       UARTprintf("\n");
@@ -205,18 +312,40 @@ void lwIPHostTimerHandler(void)
     // Do nothing and keep waiting.
     //
   }
+
+  //
+  // Time the link and the address for the boot trace.
+  //
+  if (ui32NewIPAddress != 0xffffffff)
+  {
+    Boot_Mark(BOOT_STAGE_LINK);
+    if (ui32NewIPAddress != 0)
+    {
+      Boot_Mark(BOOT_STAGE_IP);
+    }
+  }
+
+  //
+  // Push the speed and LED state to the /events and WebSocket clients if it
+  // has changed.
+  //
+  io_fs_events_poll();
+
+  //
+  // Send the recorded telemetry samples to the subscriber.
+  //
+  TelemetryTimer();
+
+  TimingStatsAdd(&hostTimerStats, TimingNow() - start);
 }
 
 void configureEthernet()
 {
   uint32_t ui32User0, ui32User1;
   uint8_t pui8MACArray[8];
-  // Configure debug port for internal use.
-  UARTStdioConfig(0, 115200, g_ui32SysClock);
 
   // Clear the terminal and print a banner.
-  I2C_OLED_Move_Cursor(0, 0);
-  I2C_OLED_Print("Inic. Ethernet  ");
+  Display_Text(0, 0, "Inic. Ethernet  ");
   UARTprintf("Initializando Ethernet\n");
 
   // Configure SysTick for a periodic interrupt.
@@ -253,26 +382,40 @@ void configureEthernet()
   // Initialze the lwIP library, using DHCP.
   lwIPInit(g_ui32SysClock, pui8MACArray, 0, 0, 0, IPADDR_USE_DHCP);
 
+  // The PHY now negotiates the link on its own, and lwIP starts DHCP from
+  // its thread once the link is up.
+  Boot_Mark(BOOT_STAGE_ETHERNET);
+
   // Setup the device locator service.
   LocatorInit();
   LocatorMACAddrSet(pui8MACArray);
   LocatorAppTitleSet("EK-TM4C1294XL Projeto SO-C2");
 
+  // Setup the telemetry streaming service.
+  TelemetryInit();
+
   //
-  // Initialize a sample httpd server.
+  // Register the dynamic files and initialize a sample httpd server.
   //
+  if (!io_fs_init())
+  {
+    UARTprintf("Could not register the dynamic files!\n");
+  }
   httpd_init();
 
   // Set the interrupt priorities.  We set the SysTick interrupt to a higher
   // priority than the Ethernet interrupt to ensure that the file system
   // tick is processed if SysTick occurs while the Ethernet handler is being
-  // processed.  This is very likely since all the TCP/IP and HTTP work is
-  // done in the context of the Ethernet interrupt.
+  // processed.  Without NO_SYS the Ethernet interrupt only wakes the lwIP
+  // interrupt task, so its priority must allow FreeRTOS calls (at or below
+  // configMAX_SYSCALL_INTERRUPT_PRIORITY).
   MAP_IntPrioritySet(INT_EMAC0, ETHERNET_INT_PRIORITY);
   MAP_IntPrioritySet(FAULT_SYSTICK, SYSTICK_INT_PRIORITY);
 }
 
-void configureGPIOInterrupt(void)
+// The flow sensor on PA2 drives the Timer 1A capture input, T1CCP0, which
+// times its falling edges in hardware.
+void configureCapture(void)
 {
   SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOA);
 
@@ -280,72 +423,28 @@ void configureGPIOInterrupt(void)
   {
   }
 
-  IntEnable(INT_GPIOA);
-  GPIOPinTypeGPIOInput(GPIO_PORTA_AHB_BASE, GPIO_PIN_2);
-  GPIOIntTypeSet(GPIO_PORTA_AHB_BASE, GPIO_PIN_2, GPIO_FALLING_EDGE);
-  GPIOIntEnable(GPIO_PORTA_AHB_BASE, GPIO_PIN_2);
-}
-
-void PortAIntHandler(void)
-{
-  GPIOIntClear(GPIO_PORTA_AHB_BASE, GPIO_PIN_2);
-
-  if (firstPulse)
-  {
-    firstTime = TimerValueGet64(TIMER0_BASE);
-    firstPulse = false;
-  }
-  else
-  {
-    secondTime = firstTime - TimerValueGet64(TIMER0_BASE);
-
-    if (secondTime >= 2000000)
-    {
-      periodAverage[periodIndex] = firstTime - TimerValueGet64(TIMER0_BASE);
-      if (++periodIndex >= PERIOD_SAMPLES)
-        periodIndex = 0;
-      TimerLoadSet64(TIMER0_BASE, g_ui32SysClock);
-      firstPulse = true;
-    }
-  }
-}
-
-void configureTimer(void)
-{
-  // Enable the Timer0 peripheral
-  SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER0);
+  GPIOPinConfigure(GPIO_PA2_T1CCP0);
+  GPIOPinTypeTimer(GPIO_PORTA_AHB_BASE, GPIO_PIN_2);
 
-  // Wait for the Timer0 module to beg ready.
-  while (!SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER0))
-  {
-  }
-
-  IntMasterEnable();
-
-  ROM_TimerConfigure(TIMER0_BASE, TIMER_CFG_PERIODIC);
-  ROM_TimerLoadSet(TIMER0_BASE, TIMER_A, g_ui32SysClock);
-
-  IntEnable(INT_TIMER0A);
-  TimerIntEnable(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
-
-  TimerEnable(TIMER0_BASE, TIMER_A);
+  Capture_Init();
+  IntPrioritySet(INT_TIMER1A, CAPTURE_INT_PRIORITY);
+  IntEnable(INT_TIMER1A);
 }
 
-Timer0BIntHandler(void)
+//*****************************************************************************
+//
+// The Ethernet interrupt handler.  It measures the time spent in the lwIP
+// handler, which is all TCP/IP and HTTP processing with NO_SYS and only the
+// hand-off to the lwIP interrupt task without it.
+//
+//*****************************************************************************
+void EthernetIntHandler(void)
 {
-  TimerIntClear(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
-
-  int i = 0;
-  for (i = 0; i < PERIOD_SAMPLES; i++)
-  {
-    periodAverage[i] = 0;
-  }
-
-  TimerLoadSet64(TIMER0_BASE, g_ui32SysClock);
+  uint32_t start = TimingNow();
 
-  timerValue = interruptValue;
+  lwIPEthernetIntHandler();
 
-  interruptValue = 0;
+  TimingStatsAdd(&ethernetIntStats, TimingNow() - start);
 }
 
 void configureController(void)
@@ -384,22 +483,47 @@ int main(void)
 
   configureController();
 
-  configureOLED();
+  TimingInit();
+  Boot_Mark(BOOT_STAGE_CLOCK);
+
+  // Start the microsecond timer service.  Its interrupt only counts the
+  // wraps of the timer, every 33 s.
+  UTimer_Init();
+  MAP_IntPrioritySet(INT_TIMER5A, UTIMER_INT_PRIORITY);
+  IntEnable(INT_TIMER5A);
 
+  // Configure debug port for internal use.
+  UARTStdioConfig(0, 115200, g_ui32SysClock);
+
+  // The display is brought up by oledTask, at the same time as the network,
+  // and draws what the other tasks post from then on.  Until then the posts
+  // wait in its queue, starting with the boot screen: a progress bar filling
+  // the bottom page of the splash screen for two seconds, then a blank
+  // display.
+  Display_Init();
+  Display_Progress(0, OLED_FB_HEIGHT - 8, OLED_FB_WIDTH, 8, 2000);
+  Display_Clear();
+
+  // Set up the Ethernet MAC and PHY before anything else that takes time,
+  // since the link takes the longest to come up: the PHY negotiates it
+  // while the tasks start.
   configureEthernet();
 
-  xTaskCreate(ethernetTask, (const portCHAR *)"Ethernet Task", configMINIMAL_STACK_SIZE, NULL, 1, NULL);
+#if NO_SYS
+  xTaskCreate(ethernetTask, (const portCHAR *)"Ethernet Task", ETHERNET_TASK_STACK_SIZE, NULL, ETHERNET_TASK_PRIORITY, NULL);
+#endif
 
-  xTaskCreate(demoSerialTask, (const portCHAR *)"Serial Task", configMINIMAL_STACK_SIZE, NULL, 1, NULL);
+  xTaskCreate(demoSerialTask, (const portCHAR *)"Serial Task", SERIAL_TASK_STACK_SIZE, NULL, SERIAL_TASK_PRIORITY, NULL);
 
-  xTaskCreate(pwmTask, (const portCHAR *)"PWM Task", configMINIMAL_STACK_SIZE, NULL, 1, NULL);
+  xTaskCreate(pwmTask, (const portCHAR *)"PWM Task", PWM_TASK_STACK_SIZE, NULL, PWM_TASK_PRIORITY, NULL);
 
-  xTaskCreate(oledTask, (const portCHAR *)"OLED Task", configMINIMAL_STACK_SIZE, NULL, 1, NULL);
+  xTaskCreate(oledTask, (const portCHAR *)"OLED Task", OLED_TASK_STACK_SIZE, NULL, OLED_TASK_PRIORITY, NULL);
 
-  configureTimer();
+  xTaskCreate(adcTask, (const portCHAR *)"ADC Task", ADC_TASK_STACK_SIZE, NULL, ADC_TASK_PRIORITY, NULL);
 
-  configureGPIOInterrupt();
+  configureCapture();
 
+  Boot_Mark(BOOT_STAGE_SCHEDULER);
   vTaskStartScheduler();
   while (1)
   {
@@ -427,6 +551,9 @@ int main(void)
   }
 }
 
+#if NO_SYS
+// Without an RTOS port lwIP runs in the Ethernet interrupt, which this task
+// triggers periodically to service the lwIP timers.
 void ethernetTask(void *pvParameters)
 {
   UARTprintf("First time ethernet task!!\n");
@@ -439,27 +566,150 @@ void ethernetTask(void *pvParameters)
     vTaskDelay(10 / portTICK_PERIOD_MS);
   }
 }
+#endif
+
+// Print the bins of a histogram that have counts in them, as the lower
+// bound of the bin in microseconds and the count.
+void printHistogram(const char *name, tTimingHistogram *histogram)
+{
+  tTimingHistogram copy;
+  uint32_t bin;
+
+  TimingHistogramGet(histogram, &copy);
+
+  UARTprintf("%s us:", name);
+  for (bin = 0; bin < TIMING_HISTOGRAM_BINS; bin++)
+  {
+    if (copy.pui32Bins[bin])
+    {
+      UARTprintf(" %u+:%u", TimingHistogramBinUs(bin), copy.pui32Bins[bin]);
+    }
+  }
+  UARTprintf(", max %u\n", copy.ui32MaxUs);
+}
+
+// Print the time spent in the Ethernet interrupt, the timing of the control
+// loop and the last flow sensor measurement.
+void printTiming(void)
+{
+  static uint32_t seconds = 0;
+  tTimingStats isr, host, jitter, exec;
+  tUTimerStats waits;
+  tAnalogStats analog;
+
+  TimingStatsTake(&ethernetIntStats, &isr);
+  TimingStatsTake(&hostTimerStats, &host);
+  TimingStatsTake(&loopJitterStats, &jitter);
+  TimingStatsTake(&loopExecStats, &exec);
+  UTimer_Take_Stats(&waits);
+
+  if (jitter.ui32Count && exec.ui32Count)
+  {
+    UARTprintf("control loop: %u passes, jitter max %u us, "
+               "exec avg %u us, max %u us\n",
+               exec.ui32Count, TimingCyclesToUs(jitter.ui32Max),
+               TimingCyclesToUs((uint32_t)(exec.ui64Total / exec.ui32Count)),
+               TimingCyclesToUs(exec.ui32Max));
+  }
+
+  if (++seconds >= LOOP_HISTOGRAM_S)
+  {
+    seconds = 0;
+    printHistogram("loop jitter", &loopJitter);
+    printHistogram("loop exec", &loopExec);
+
+    Analog_Get_Stats(&analog);
+    UARTprintf("adc: %u blocks, %u missed, %u overflows\n",
+               analog.ui32Blocks, analog.ui32Missed, analog.ui32Overflows);
+  }
+
+  if (isr.ui32Count)
+  {
+    // The share of the CPU, in tenths of a percent, over about a second.
+    UARTprintf("eth isr: %u calls, avg %u us, max %u us, cpu %u.%u%%\n",
+               isr.ui32Count,
+               TimingCyclesToUs((uint32_t)(isr.ui64Total / isr.ui32Count)),
+               TimingCyclesToUs(isr.ui32Max),
+               (uint32_t)(isr.ui64Total * 1000 / g_ui32SysClock) / 10,
+               (uint32_t)(isr.ui64Total * 1000 / g_ui32SysClock) % 10);
+  }
+
+  if (flowSignal)
+  {
+    UARTprintf("flow input: %u.%03u Hz, %u edges lost\n",
+               flowMilliHz / 1000, flowMilliHz % 1000,
+               Capture_Get_Overruns());
+  }
+
+  if (flowSetpoint)
+  {
+    UARTprintf("flow control: setpoint %u.%03u Hz, duty %u/%u, integral %d\n",
+               flowSetpoint / 1000, flowSetpoint % 1000, pwmPulseWidth,
+               PWM_PERIOD, PID_Get_Integral(&flowControl));
+  }
+
+  if (host.ui32Count)
+  {
+    UARTprintf("lwip host timer: %u calls, max %u us\n", host.ui32Count,
+               TimingCyclesToUs(host.ui32Max));
+  }
+
+  if (waits.ui32Delays || waits.ui32Sleeps)
+  {
+    // The time slept is CPU time a busy-wait would have taken.
+    UARTprintf("waits: %u spun %u us, %u slept %u us (cpu reclaimed)\n",
+               waits.ui32Delays, waits.ui32SpunUs, waits.ui32Sleeps,
+               waits.ui32SleptUs);
+  }
+}
+
+// Print the stages of the boot reached since the last call.
+void printBoot(void)
+{
+  static uint32_t printed = 0;
+  tBootTrace trace;
+  uint32_t stage;
+
+  Boot_Get_Trace(&trace);
+
+  for (stage = 0; stage < BOOT_NUM_STAGES; stage++)
+  {
+    if ((trace.ui32Reached & ~printed) & (1 << stage))
+    {
+      UARTprintf("boot: %s at %u.%03u ms\n", Boot_Stage_Name(stage),
+                 trace.pui32Us[stage] / 1000, trace.pui32Us[stage] % 1000);
+    }
+  }
+
+  printed = trace.ui32Reached;
+}
 
 // Write text over the Stellaris debug interface UART port
 void demoSerialTask(void *pvParameters)
 {
+  char pcFlow[DISPLAY_TEXT_LEN + 1];
+
   // Set up the UART which is connected to the virtual COM port
   UARTprintf("\r\nTask Serial Inicializada!");
-  I2C_OLED_Move_Cursor(4, 0);
-  //I2C_OLED_Print("Vazao: ");
   for (;;)
   {
-    UARTprintf("getspeed() * 2: %i\n", (measuredFrequency * 2));
+    UARTprintf("flow: %i Hz, setpoint: %u Hz\n", measuredFrequency,
+               (flowSetpoint + 500) / 1000);
+
+    // Show the flow in the double size proportional font, centered on the
+    // bottom half of the display.  Its digits are all the same width, so
+    // the readout does not move as the value changes.
+    usprintf(pcFlow, "%d Hz", measuredFrequency);
+    Display_Text_Font(0, 40, OLED_FB_WIDTH, &FONT_PROP, 2, pcFlow);
+
+    // Refresh the task statistics reported by /status.json.
+    io_update_task_stats();
+
+    printTiming();
+
+    printBoot();
+
     vTaskDelay(1000 / portTICK_PERIOD_MS);
-    // I2C_OLED_Move_Cursor(4, 56);
-    // char asciiFlow[4];
-    // asciiFlow[0] = (measuredFrequency / 200 + 48);
-    // asciiFlow[1] = (measuredFrequency / 20) + 48;
-    // asciiFlow[2] = ((measuredFrequency * 2) % 10) + 48;
-    // asciiFlow[3] = '\0';
-    // I2C_OLED_Print(asciiFlow);
-    // I2C_OLED_Move_Cursor(4, 80);
-    // I2C_OLED_Print("ml/s");
   }
 }
 
@@ -517,10 +767,9 @@ void configureOLED(void)
   {
   }
 
-  GPIOPinTypeGPIOOutput(GPIO_PORTA_AHB_BASE, GPIO_PIN_2);
-  GPIOPinTypeGPIOOutputOD(GPIO_PORTA_AHB_BASE, GPIO_PIN_3);
-  GPIOPinTypeI2CSCL(GPIO_PORTA_AHB_BASE, GPIO_PIN_2);
-  GPIOPinTypeI2C(GPIO_PORTA_AHB_BASE, GPIO_PIN_3);
+  // I2C0 is on PB2 (SCL) and PB3 (SDA).  PA2 is the flow sensor input, the
+  // Timer 1A capture pin set up by configureCapture(), which main() calls
+  // before the scheduler starts this task.
 
   // 3. Limpar o AMSEL para desabilitar a analógica
   GPIO_PORTB_AHB_AMSEL_R = 0x00;
@@ -537,8 +786,43 @@ void configureOLED(void)
   // 4. Limpar PCTL para selecionar o GPIO
   GPIO_PORTB_AHB_PCTL_R = 0x2200;
   I2C_Init();
+
+  // The I2C engine sends the display data from the I2C0 interrupt, which
+  // wakes the waiting task through FreeRTOS.
+  MAP_IntPrioritySet(INT_I2C0, I2C_INT_PRIORITY);
+  IntEnable(INT_I2C0);
+
   I2C_OLED_Init();
-  I2C_OLED_Sequence_Init();
+
+  // Show the splash screen.
+  OLED_FB_Init();
+  OLED_FB_Image(0, 0, &IMG_UTFPR);
+  OLED_FB_Flush();
+  Boot_Mark(BOOT_STAGE_DISPLAY);
+}
+
+// Filter the flow sensor measurements, and tell when they stop.
+void updateFlow(uint32_t now)
+{
+  tCapturePeriod period;
+
+  if (Capture_Measure(FLOW_GATE_CYCLES, &period))
+  {
+    flowMilliHz = Filter_Add(&flowFilter, period.ui32MilliHz);
+    flowGateMilliHz = period.ui32MilliHz;
+    flowLastMs = now;
+    flowSignal = true;
+  }
+  else if (flowSignal && ((now - flowLastMs) >= FLOW_TIMEOUT_MS))
+  {
+    // The flow has stopped or the sensor is not there.
+    flowSignal = false;
+    flowMilliHz = 0;
+    flowGateMilliHz = 0;
+    Filter_Reset(&flowFilter);
+  }
+
+  measuredFrequency = (int32_t)((flowMilliHz + 500) / 1000);
 }
 
 void pwmTask(void *pvParameters)
@@ -563,7 +847,7 @@ void pwmTask(void *pvParameters)
   // Set the period. For a 50 KHz frequency, the period = 1/50,000, or 20
   // microseconds. For a 20 MHz clock, this translates to 400 clock ticks.
   // Use this value to set the period.
-  PWMGenPeriodSet(PWM0_BASE, PWM_GEN_2, 400);
+  PWMGenPeriodSet(PWM0_BASE, PWM_GEN_2, PWM_PERIOD);
 
   // Start the timers in generator 0.
   PWMGenEnable(PWM0_BASE, PWM_GEN_2);
@@ -571,75 +855,115 @@ void pwmTask(void *pvParameters)
   // Enable the outputs.
   PWMOutputState(PWM0_BASE, (PWM_OUT_4_BIT), true);
 
+  Filter_Init(&flowFilter, FLOW_FILTER, FLOW_FILTER_LENGTH);
+  PID_Init(&flowControl, &flowControlConfig);
+
+  // Run the control loop at a fixed period, whatever the time each pass
+  // takes.
+  TickType_t lastWake = xTaskGetTickCount();
+  uint32_t periodCycles = (g_ui32SysClock / 1000) * CONTROL_PERIOD_MS;
+  uint32_t lastStart = 0;
+  bool started = false;
+
   while (1)
   {
-    int i = 0;
-    uint64_t sum = 0;
-    for (i = 0; i < PERIOD_SAMPLES; i++)
+    uint32_t start = TimingNow();
+    uint32_t now = lastWake * portTICK_PERIOD_MS;
+    uint32_t pwmValue;
+
+    if (started)
+    {
+      uint32_t interval = start - lastStart;
+      uint32_t jitter = (interval > periodCycles) ? (interval - periodCycles)
+                                                  : (periodCycles - interval);
+      TimingStatsAdd(&loopJitterStats, jitter);
+      TimingHistogramAdd(&loopJitter, jitter);
+    }
+    lastStart = start;
+    started = true;
+
+    updateFlow(now);
+
+    flowSetpoint = systemOnline ? (getSpeed() * (FLOW_FULL_SCALE_MHZ / 100)) : 0;
+
+    if (!flowSetpoint)
+    {
+      // Stop at once.
+      PID_Reset(&flowControl);
+      pwmValue = flowControl.i32Out;
+    }
+    else if (!flowSignal)
     {
-      sum += periodAverage[i];
+      // Nothing to close the loop on, while the pump starts or if the
+      // sensor is lost: run on the feed-forward alone rather than let the
+      // integral wind the pump up to full speed.
+      pwmValue = PID_Feed_Forward(&flowControl, flowSetpoint);
+    }
+    else
+    {
+      pwmValue = PID_Update(&flowControl, flowSetpoint, flowGateMilliHz);
     }
-    sum = sum / PERIOD_SAMPLES;
 
-    measuredFrequency = ((int)(g_ui32SysClock / sum));
+    PWMPulseWidthSet(PWM0_BASE, PWM_OUT_4, pwmValue);
+    pwmPulseWidth = pwmValue;
 
-    if (measuredFrequency < 0)
-      measuredFrequency = 0;
+    // Record a telemetry sample if one is due.
+    TelemetrySample(now, pwmValue);
 
-    uint32_t pwmValue = systemOnline ? (getSpeed() * 4) : 1;
-    if (pwmValue >= 400)
-      pwmValue = 399;
-    else if (pwmValue <= 0)
-      pwmValue = 1;
-    PWMPulseWidthSet(PWM0_BASE, PWM_OUT_4, (int)pwmValue);
+    uint32_t exec = TimingNow() - start;
+    TimingStatsAdd(&loopExecStats, exec);
+    TimingHistogramAdd(&loopExec, exec);
 
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    vTaskDelayUntil(&lastWake, CONTROL_PERIOD_MS / portTICK_PERIOD_MS);
   }
 }
 
+// Sample the speed potentiometer.  Timer 0 triggers the ADC and its
+// interrupt collects the samples, so this only wakes for each block of them.
 void adcTask(void *pvParameters)
 {
-  // Enable the ADC0 module.
-  SysCtlPeripheralEnable(SYSCTL_PERIPH_ADC0);
+  // Channel 0 is on PE3, whose port PinoutSet() has enabled.
+  GPIOPinTypeADC(GPIO_PORTE_BASE, GPIO_PIN_3);
 
-  // Wait for the ADC0 module to be ready.
-  while (!SysCtlPeripheralReady(SYSCTL_PERIPH_ADC0))
-  {
-  };
-
-  // Enable the first sample sequencer to capture the value of channel 0 when
-  // the processor trigger occurs.
-  ADCSequenceConfigure(ADC0_BASE, 0, ADC_TRIGGER_PROCESSOR, 0);
-  ADCSequenceStepConfigure(ADC0_BASE, 0, 0,
-                           ADC_CTL_IE | ADC_CTL_END | ADC_CTL_CH0);
-  ADCSequenceEnable(ADC0_BASE, 0);
+  Analog_Init(xTaskGetCurrentTaskHandle());
+  IntPrioritySet(INT_ADC0SS0, ANALOG_INT_PRIORITY);
+  IntEnable(INT_ADC0SS0);
 
   while (1)
   {
-    // Trigger the sample sequence.
-    ADCProcessorTrigger(ADC0_BASE, 0);
+    // Wait for a block, or a while longer if the interrupt has stopped.
+    ulTaskNotifyTake(pdTRUE, (4 * ANALOG_BLOCK_TRIGGERS * 1000 /
+                              ANALOG_TRIGGER_HZ) / portTICK_PERIOD_MS);
 
-    // Wait until the sample sequence has completed.
-    while (!ADCIntStatus(ADC0_BASE, 0, false))
+    if (Analog_Process())
     {
-    };
-
-    // Read the value from the ADC.
-    ADCSequenceDataGet(ADC0_BASE, 0, &automaticModeSpeed);
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+      automaticModeSpeed = (Analog_Get_Value() +
+                            (1 << (ANALOG_FRAC_BITS - 1))) >>
+                           ANALOG_FRAC_BITS;
+    }
   }
 }
 
+// Bring the display up, then draw what the other tasks post to the display
+// service.
 void oledTask(void *pvParameters)
 {
+  configureOLED();
 
   while (1)
   {
-    vTaskDelay(1000 / portTICK_PERIOD_MS);
+    Display_Process(portMAX_DELAY);
   }
 }
 
+// The speed setpoint in percent: from the ADC in automatic mode, or as set
+// from the web pages.
 uint32_t getSpeed()
 {
-  return automaticMode ? measuredFrequency * 2 : (manualModeSpeed);
+  if (automaticMode)
+  {
+    return Analog_Get_Percent();
+  }
+
+  return manualModeSpeed;
 }
@@ -0,0 +1,249 @@
+//*****************************************************************************
+//
+// filter.c - Moving average, median and exponential moving average filters
+// of unsigned samples.
+//
+// The moving average keeps the running sum of its window, so adding a
+// sample takes the same time whatever the length.  The median keeps the
+// window sorted and moves one sample in and one out of it.  The filters do
+// not allocate and are not shared; each belongs to one task.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include "filter.h"
+
+//*****************************************************************************
+//
+//! Sets up a filter.
+//!
+//! \param psFilter is the filter.
+//! \param ui32Mode is the kind of filter, one of \b FILTER_AVERAGE,
+//! \b FILTER_MEDIAN or \b FILTER_EMA.
+//! \param ui32Length is the number of samples averaged or taken the median
+//! of, from 1 to \b FILTER_MAX_LENGTH, or the shift of the weight of the
+//! exponential moving average, from 0 to 16.
+//!
+//! Lengths out of range are clamped.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Filter_Init(tFilter *psFilter, uint32_t ui32Mode, uint32_t ui32Length)
+{
+    if(ui32Mode == FILTER_EMA)
+    {
+        if(ui32Length > 16)
+        {
+            ui32Length = 16;
+        }
+    }
+    else if(ui32Length > FILTER_MAX_LENGTH)
+    {
+        ui32Length = FILTER_MAX_LENGTH;
+    }
+    else if(ui32Length == 0)
+    {
+        ui32Length = 1;
+    }
+
+    psFilter->ui32Mode = ui32Mode;
+    psFilter->ui32Length = ui32Length;
+    Filter_Reset(psFilter);
+}
+
+//*****************************************************************************
+//
+//! Forgets the samples a filter has been given.
+//!
+//! \param psFilter is the filter.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Filter_Reset(tFilter *psFilter)
+{
+    psFilter->ui32Count = 0;
+    psFilter->ui32Index = 0;
+    psFilter->ui64Sum = 0;
+}
+
+//*****************************************************************************
+//
+// Move a sample into the sorted window of the median, in place of the
+// oldest one if the window is full.
+//
+//*****************************************************************************
+static void
+Filter_Sort(tFilter *psFilter, uint32_t ui32Out, uint32_t ui32In)
+{
+    uint32_t *pui32Sorted;
+    uint32_t ui32Idx;
+
+    pui32Sorted = psFilter->pui32Sorted;
+
+    if(psFilter->ui32Count < psFilter->ui32Length)
+    {
+        ui32Idx = psFilter->ui32Count;
+    }
+    else
+    {
+        //
+        // Take the oldest sample out, closing the hole over it.
+        //
+        for(ui32Idx = 0; pui32Sorted[ui32Idx] != ui32Out; ui32Idx++)
+        {
+        }
+        for(; (ui32Idx + 1) < psFilter->ui32Length; ui32Idx++)
+        {
+            pui32Sorted[ui32Idx] = pui32Sorted[ui32Idx + 1];
+        }
+    }
+
+    //
+    // Insert the new one, moving the larger ones up.
+    //
+    for(; (ui32Idx > 0) && (pui32Sorted[ui32Idx - 1] > ui32In); ui32Idx--)
+    {
+        pui32Sorted[ui32Idx] = pui32Sorted[ui32Idx - 1];
+    }
+    pui32Sorted[ui32Idx] = ui32In;
+}
+
+//*****************************************************************************
+//
+//! Gives a filter a sample.
+//!
+//! \param psFilter is the filter.
+//! \param ui32Sample is the sample.
+//!
+//! \return The output of the filter with the sample.
+//
+//*****************************************************************************
+uint32_t
+Filter_Add(tFilter *psFilter, uint32_t ui32Sample)
+{
+    uint32_t ui32Out;
+
+    if(psFilter->ui32Mode == FILTER_EMA)
+    {
+        //
+        // The first sample starts the average rather than pulling it up
+        // from zero.
+        //
+        if(!psFilter->ui32Count)
+        {
+            psFilter->ui64Sum = (uint64_t)ui32Sample << FILTER_EMA_FRAC_BITS;
+            psFilter->ui32Count = 1;
+        }
+        else
+        {
+            psFilter->ui64Sum -= psFilter->ui64Sum >> psFilter->ui32Length;
+            psFilter->ui64Sum +=
+                (((uint64_t)ui32Sample << FILTER_EMA_FRAC_BITS) >>
+                 psFilter->ui32Length);
+        }
+
+        return(Filter_Get(psFilter));
+    }
+
+    //
+    // The window is a ring; once it is full the oldest sample is replaced.
+    //
+    ui32Out = psFilter->pui32Window[psFilter->ui32Index];
+
+    if(psFilter->ui32Mode == FILTER_MEDIAN)
+    {
+        Filter_Sort(psFilter, ui32Out, ui32Sample);
+    }
+
+    if(psFilter->ui32Count < psFilter->ui32Length)
+    {
+        psFilter->ui32Count++;
+    }
+    else
+    {
+        psFilter->ui64Sum -= ui32Out;
+    }
+    psFilter->ui64Sum += ui32Sample;
+
+    psFilter->pui32Window[psFilter->ui32Index] = ui32Sample;
+    if(++psFilter->ui32Index >= psFilter->ui32Length)
+    {
+        psFilter->ui32Index = 0;
+    }
+
+    return(Filter_Get(psFilter));
+}
+
+//*****************************************************************************
+//
+//! Returns the output of a filter.
+//!
+//! \param psFilter is the filter.
+//!
+//! The average and the exponential moving average are rounded to the
+//! nearest integer; the median of an even number of samples is the rounded
+//! average of the two middle ones.
+//!
+//! \return The output, or 0 if the filter has no samples.
+//
+//*****************************************************************************
+uint32_t
+Filter_Get(tFilter *psFilter)
+{
+    uint32_t ui32Count, *pui32Middle;
+
+    ui32Count = psFilter->ui32Count;
+
+    if(!ui32Count)
+    {
+        return(0);
+    }
+
+    switch(psFilter->ui32Mode)
+    {
+        case FILTER_EMA:
+        {
+            return((uint32_t)((psFilter->ui64Sum +
+                               (1 << (FILTER_EMA_FRAC_BITS - 1))) >>
+                              FILTER_EMA_FRAC_BITS));
+        }
+
+        case FILTER_MEDIAN:
+        {
+            pui32Middle = &psFilter->pui32Sorted[ui32Count / 2];
+            if(ui32Count & 1)
+            {
+                return(pui32Middle[0]);
+            }
+
+            return((uint32_t)(((uint64_t)pui32Middle[-1] + pui32Middle[0] +
+                               1) / 2));
+        }
+
+        default:
+        {
+            return((uint32_t)((psFilter->ui64Sum + (ui32Count / 2)) /
+                              ui32Count));
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Tells whether a filter has no samples.
+//!
+//! \param psFilter is the filter.
+//!
+//! \return \b true if the filter has had no sample since it was set up or
+//! reset.
+//
+//*****************************************************************************
+bool
+Filter_Is_Empty(tFilter *psFilter)
+{
+    return(psFilter->ui32Count == 0);
+}
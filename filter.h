@@ -0,0 +1,71 @@
+//*****************************************************************************
+//
+// filter.h - Prototypes for the sample filters.
+//
+//*****************************************************************************
+
+#ifndef __FILTER_H__
+#define __FILTER_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The filters.  The length of a moving average or a median is the number of
+// samples it covers, up to FILTER_MAX_LENGTH; the length of an exponential
+// moving average is the shift of its weight, which is 1/2^length.
+//
+//*****************************************************************************
+#define FILTER_AVERAGE          0   // The average of the last samples
+#define FILTER_MEDIAN           1   // The median of the last samples
+#define FILTER_EMA              2   // The exponential moving average
+
+#define FILTER_MAX_LENGTH       16
+
+//*****************************************************************************
+//
+// The fractional bits the exponential moving average is kept with.
+//
+//*****************************************************************************
+#define FILTER_EMA_FRAC_BITS    16
+
+//*****************************************************************************
+//
+// The state of a filter.  The last samples are kept in pui32Window, the
+// oldest at ui32Index once the window is full, and in pui32Sorted in order
+// for the median.  ui64Sum is the running sum of the window for the average
+// and the fixed-point output of the exponential moving average.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Mode;
+    uint32_t ui32Length;
+    uint32_t ui32Count;
+    uint32_t ui32Index;
+    uint64_t ui64Sum;
+    uint32_t pui32Window[FILTER_MAX_LENGTH];
+    uint32_t pui32Sorted[FILTER_MAX_LENGTH];
+}
+tFilter;
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.
+//
+//*****************************************************************************
+extern void Filter_Init(tFilter *psFilter, uint32_t ui32Mode,
+                        uint32_t ui32Length);
+extern void Filter_Reset(tFilter *psFilter);
+extern uint32_t Filter_Add(tFilter *psFilter, uint32_t ui32Sample);
+extern uint32_t Filter_Get(tFilter *psFilter);
+extern bool Filter_Is_Empty(tFilter *psFilter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __FILTER_H__
@@ -1,4 +1,5 @@
 #include <stdint.h>
+#include "fonts.h"
 
 const unsigned char font_A[] = {0x00, 0x7C, 0x7E, 0x0B, 0x0B, 0x7E, 0x7C, 0x00};
 
@@ -134,3 +135,8 @@ const uint8_t font_default[] =
 	0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00,	// Char 126 (~)
 	0x0F, 0x0F, 0x0F, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0
 };
+
+const tFont FONT_FIXED =
+{
+	8, 8, 0, 0, 127, 0, 0, font_default
+};
@@ -0,0 +1,137 @@
+//*****************************************************************************
+//
+// font_prop.c - A proportional font made from font_default.
+//
+// This file is generated by tools/font_prop.py:
+//
+//     python3 tools/font_prop.py -o fonts/font_prop.c fonts/font_default.c
+//
+//*****************************************************************************
+#include <stdint.h>
+#include "fonts.h"
+
+static const uint8_t g_pui8Widths[] =
+{
+    3, 2, 6, 8, 6, 6, 7, 4, 4, 4, 8, 6, 3, 6, 2, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 2, 3, 6, 6, 6, 6,
+    8, 6, 6, 6, 6, 6, 6, 6, 6, 4, 6, 6, 6, 7, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 7, 6, 6, 6, 8, 4, 2, 2, 2,
+    8, 6, 6, 5, 6, 6, 5, 6, 6, 4, 5, 6, 4, 7, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 7, 6, 6, 6, 4, 4, 5, 4,
+};
+
+static const uint16_t g_pui16Offsets[] =
+{
+    0, 3, 5, 11, 19, 25, 31, 38, 42, 46, 50, 58,
+    64, 67, 73, 75, 82, 89, 96, 103, 110, 117, 124, 131,
+    138, 145, 152, 154, 157, 163, 169, 175, 181, 189, 195, 201,
+    207, 213, 219, 225, 231, 237, 241, 247, 253, 259, 266, 272,
+    278, 284, 290, 296, 302, 308, 314, 320, 327, 333, 339, 345,
+    353, 357, 359, 361, 363, 371, 377, 383, 388, 394, 400, 405,
+    411, 417, 421, 426, 432, 436, 443, 449, 455, 461, 467, 473,
+    479, 485, 491, 497, 504, 510, 516, 522, 526, 530, 535,
+};
+
+static const uint8_t g_pui8Data[] =
+{
+    0x00, 0x00, 0x00,                                // space
+    0x4f, 0x4f,                                      // !
+    0x07, 0x07, 0x00, 0x00, 0x07, 0x07,              // "
+    0x14, 0x7f, 0x7f, 0x14, 0x14, 0x7f, 0x7f, 0x14,  // #
+    0x24, 0x2e, 0x6b, 0x6b, 0x3a, 0x12,              // $
+    0x63, 0x33, 0x18, 0x0c, 0x66, 0x63,              // %
+    0x32, 0x7f, 0x4d, 0x4d, 0x77, 0x72, 0x50,        // &
+    0x04, 0x06, 0x03, 0x01,                          // '
+    0x1c, 0x3e, 0x63, 0x41,                          // (
+    0x41, 0x63, 0x3e, 0x1c,                          // )
+    0x08, 0x2a, 0x3e, 0x1c, 0x1c, 0x3e, 0x2a, 0x08,  // *
+    0x08, 0x08, 0x3e, 0x3e, 0x08, 0x08,              // +
+    0x80, 0xe0, 0x60,                                // ,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08,              // -
+    0x60, 0x60,                                      // .
+    0x40, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x02,        // /
+    0x3e, 0x7f, 0x49, 0x45, 0x7f, 0x3e, 0x00,        // 0
+    0x40, 0x44, 0x7f, 0x7f, 0x40, 0x40, 0x00,        // 1
+    0x62, 0x73, 0x51, 0x49, 0x4f, 0x46, 0x00,        // 2
+    0x22, 0x63, 0x49, 0x49, 0x7f, 0x36, 0x00,        // 3
+    0x18, 0x18, 0x14, 0x16, 0x7f, 0x7f, 0x10,        // 4
+    0x27, 0x67, 0x45, 0x45, 0x7d, 0x39, 0x00,        // 5
+    0x3e, 0x7f, 0x49, 0x49, 0x7b, 0x32, 0x00,        // 6
+    0x03, 0x03, 0x79, 0x7d, 0x07, 0x03, 0x00,        // 7
+    0x36, 0x7f, 0x49, 0x49, 0x7f, 0x36, 0x00,        // 8
+    0x26, 0x6f, 0x49, 0x49, 0x7f, 0x3e, 0x00,        // 9
+    0x24, 0x24,                                      // :
+    0x80, 0xe4, 0x64,                                // ;
+    0x08, 0x1c, 0x36, 0x63, 0x41, 0x41,              // <
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14,              // =
+    0x41, 0x41, 0x63, 0x36, 0x1c, 0x08,              // >
+    0x02, 0x03, 0x51, 0x59, 0x0f, 0x06,              // ?
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,  // @
+    0x7c, 0x7e, 0x0b, 0x0b, 0x7e, 0x7c,              // A
+    0x7f, 0x7f, 0x49, 0x49, 0x7f, 0x36,              // B
+    0x3e, 0x7f, 0x41, 0x41, 0x63, 0x22,              // C
+    0x7f, 0x7f, 0x41, 0x63, 0x3e, 0x1c,              // D
+    0x7f, 0x7f, 0x49, 0x49, 0x41, 0x41,              // E
+    0x7f, 0x7f, 0x09, 0x09, 0x01, 0x01,              // F
+    0x3e, 0x7f, 0x41, 0x49, 0x7b, 0x3a,              // G
+    0x7f, 0x7f, 0x08, 0x08, 0x7f, 0x7f,              // H
+    0x41, 0x7f, 0x7f, 0x41,                          // I
+    0x20, 0x60, 0x41, 0x7f, 0x3f, 0x01,              // J
+    0x7f, 0x7f, 0x1c, 0x36, 0x63, 0x41,              // K
+    0x7f, 0x7f, 0x40, 0x40, 0x40, 0x40,              // L
+    0x7f, 0x7f, 0x06, 0x0c, 0x06, 0x7f, 0x7f,        // M
+    0x7f, 0x7f, 0x0e, 0x1c, 0x7f, 0x7f,              // N
+    0x3e, 0x7f, 0x41, 0x41, 0x7f, 0x3e,              // O
+    0x7f, 0x7f, 0x09, 0x09, 0x0f, 0x06,              // P
+    0x1e, 0x3f, 0x21, 0x61, 0x7f, 0x5e,              // Q
+    0x7f, 0x7f, 0x19, 0x39, 0x6f, 0x46,              // R
+    0x26, 0x6f, 0x49, 0x49, 0x7b, 0x32,              // S
+    0x01, 0x01, 0x7f, 0x7f, 0x01, 0x01,              // T
+    0x3f, 0x7f, 0x40, 0x40, 0x7f, 0x3f,              // U
+    0x1f, 0x3f, 0x60, 0x60, 0x3f, 0x1f,              // V
+    0x7f, 0x7f, 0x30, 0x18, 0x30, 0x7f, 0x7f,        // W
+    0x63, 0x77, 0x1c, 0x1c, 0x77, 0x63,              // X
+    0x07, 0x0f, 0x78, 0x78, 0x0f, 0x07,              // Y
+    0x61, 0x71, 0x59, 0x4d, 0x47, 0x43,              // Z
+    0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18,  // [
+    0x33, 0x33, 0xcc, 0xcc,                          // backslash
+    0xff, 0xff,                                      // ]
+    0x0f, 0x0f,                                      // ^
+    0xf0, 0xf0,                                      // _
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // `
+    0x20, 0x74, 0x54, 0x54, 0x7c, 0x78,              // a
+    0x7e, 0x7e, 0x48, 0x48, 0x78, 0x30,              // b
+    0x38, 0x7c, 0x44, 0x44, 0x44,                    // c
+    0x30, 0x78, 0x48, 0x48, 0x7e, 0x7e,              // d
+    0x38, 0x7c, 0x54, 0x54, 0x5c, 0x18,              // e
+    0x08, 0x7c, 0x7e, 0x0a, 0x0a,                    // f
+    0x98, 0xbc, 0xa4, 0xa4, 0xfc, 0x7c,              // g
+    0x7e, 0x7e, 0x08, 0x08, 0x78, 0x70,              // h
+    0x48, 0x7a, 0x7a, 0x40,                          // i
+    0x80, 0x80, 0x80, 0xfa, 0x7a,                    // j
+    0x7e, 0x7e, 0x10, 0x38, 0x68, 0x40,              // k
+    0x42, 0x7e, 0x7e, 0x40,                          // l
+    0x7c, 0x7c, 0x18, 0x38, 0x1c, 0x7c, 0x78,        // m
+    0x7c, 0x7c, 0x04, 0x04, 0x7c, 0x78,              // n
+    0x38, 0x7c, 0x44, 0x44, 0x7c, 0x38,              // o
+    0xfc, 0xfc, 0x24, 0x24, 0x3c, 0x18,              // p
+    0x18, 0x3c, 0x24, 0x24, 0xfc, 0xfc,              // q
+    0x7c, 0x7c, 0x04, 0x04, 0x0c, 0x08,              // r
+    0x48, 0x5c, 0x54, 0x54, 0x74, 0x24,              // s
+    0x04, 0x04, 0x3e, 0x7e, 0x44, 0x44,              // t
+    0x3c, 0x7c, 0x40, 0x40, 0x7c, 0x7c,              // u
+    0x1c, 0x3c, 0x60, 0x60, 0x3c, 0x1c,              // v
+    0x1c, 0x7c, 0x70, 0x38, 0x70, 0x7c, 0x1c,        // w
+    0x44, 0x6c, 0x38, 0x38, 0x6c, 0x44,              // x
+    0x9c, 0xbc, 0xa0, 0xe0, 0x7c, 0x3c,              // y
+    0x44, 0x64, 0x74, 0x5c, 0x4c, 0x44,              // z
+    0xf0, 0xf0, 0xf0, 0xf0,                          // {
+    0x0f, 0x0f, 0x0f, 0x0f,                          // |
+    0x18, 0x18, 0x18, 0x1f, 0x1f,                    // }
+    0x0f, 0x0f, 0x0f, 0x0f,                          // ~
+};
+
+const tFont FONT_PROP =
+{
+    8, 0, 1, 0x20, 0x7e, g_pui8Widths, g_pui16Offsets, g_pui8Data
+};
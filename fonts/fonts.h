@@ -2,7 +2,13 @@
 #define __FONTS_H__
 
 #include <stdint.h>
+#include "../oled_font.h"
 
 extern const uint8_t font_default[];
 
+// font_default as a fixed 8x8 font, and a proportional font made from it by
+// tools/font_prop.py.
+extern const tFont FONT_FIXED;
+extern const tFont FONT_PROP;
+
 #endif
@@ -1,4 +1,7 @@
 var interval;
+var events;
+var ws;
+var ioStatus;
 window.onload = function ()
 {
   document.getElementById('about').onclick = loadAbout;
@@ -29,7 +32,8 @@ function loadBlock()
 function loadIOHttp()
 {
   loadPage("io_http.htm");
-  ledstateGet();
+  if (!eventsStart())
+    statusGet();
   return false;
 }
 
@@ -43,6 +47,9 @@ function toggle_led()
 {
   var req = false;
 
+  if (wsSend([WS_CMD_TOGGLE_LED]))
+    return;
+
   function ToggleComplete()
   {
     if (req.readyState == 4) {
@@ -68,9 +75,99 @@ function toggle_led()
 
 function speedGetInterval()
 {
+  if (eventsStart()) {
+    // Switch to automatic mode; the speed is then pushed by the server.
+    if (!wsSend([WS_CMD_AUTOMATIC]))
+      speedGet();
+    return;
+  }
   if (interval)
     return;
-  interval = setInterval(speedGet, 500)
+  // /get_speed selects automatic mode; then poll the whole state.
+  speedGet();
+  interval = setInterval(statusGet, 500)
+}
+
+// Subscribe to the state pushed by the server, over a WebSocket if the
+// browser supports it and the server accepts the connection, otherwise over
+// /events.  Returns false if neither is available, in which case the page
+// falls back to polling.
+function eventsStart()
+{
+  return wsStart() || sseStart();
+}
+
+// Commands and messages of the binary WebSocket protocol (see io_ws.h).
+var WS_CMD_SET_SPEED = 0x01;
+var WS_CMD_TOGGLE_LED = 0x02;
+var WS_CMD_AUTOMATIC = 0x03;
+var WS_MSG_STATUS = 0x81;
+
+function wsStart()
+{
+  if (!window.WebSocket || !window.DataView || (ws === false))
+    return false;
+  if (!ws) {
+    ws = new WebSocket("ws://" + location.host + "/ws");
+    ws.binaryType = "arraybuffer";
+    ws.onmessage = function (e)
+    {
+      var v = new DataView(e.data);
+      if ((v.byteLength >= 7) && (v.getUint8(0) == WS_MSG_STATUS)) {
+        ioStatus = {
+          speed: v.getUint8(1),
+          auto: v.getUint8(2) & 1,
+          led: (v.getUint8(2) >> 1) & 1,
+          freq: v.getInt32(3, true)
+        };
+        statusShow();
+      }
+    }
+    ws.onclose = function ()
+    {
+      // Refused or lost: carry on with /events.
+      ws = false;
+      sseStart();
+    }
+  }
+  return true;
+}
+
+// Send a command over the WebSocket.  Returns false if it is not open.
+function wsSend(bytes)
+{
+  if (!ws || (ws.readyState != 1))
+    return false;
+  ws.send(new Uint8Array(bytes).buffer);
+  return true;
+}
+
+function sseStart()
+{
+  if (!window.EventSource)
+    return false;
+  if (!events) {
+    events = new EventSource("/events");
+    events.onmessage = function (e)
+    {
+      ioStatus = JSON.parse(e.data);
+      statusShow();
+    }
+  }
+  return true;
+}
+
+function statusShow()
+{
+  var speed = document.getElementById("current_speed");
+  var led = document.getElementById("ledstate");
+
+  if (!ioStatus)
+    return;
+  if (speed)
+    speed.innerHTML = "<div>" + ioStatus.speed + "%</div>";
+  if (led)
+    led.innerHTML = "<div>" + (ioStatus.led ? "ON" : "OFF") + "</div>";
 }
 function speedSet()
 {
@@ -81,6 +178,9 @@ function speedSet()
 
   var req = false;
   var speed_txt = document.getElementById("speed_percent");
+
+  if (wsSend([WS_CMD_SET_SPEED, speed_txt.value & 0xff]))
+    return;
   function speedComplete()
   {
     if (req.readyState == 4) {
@@ -104,29 +204,30 @@ function speedSet()
   }
 }
 
-function ledstateGet()
+// Fetch the whole state of the board in one request.
+function statusGet()
 {
-  var led = false;
-  function ledComplete()
+  var req = false;
+  function statusComplete()
   {
-    if (led.readyState == 4) {
-      if (led.status == 200) {
-        document.getElementById("ledstate").innerHTML = "<div>" +
-          led.responseText + "</div>";
+    if (req.readyState == 4) {
+      if (req.status == 200) {
+        ioStatus = JSON.parse(req.responseText);
+        statusShow();
       }
     }
   }
 
   if (window.XMLHttpRequest) {
-    led = new XMLHttpRequest();
+    req = new XMLHttpRequest();
   }
   else if (window.ActiveXObject) {
-    led = new ActiveXObject("Microsoft.XMLHTTP");
+    req = new ActiveXObject("Microsoft.XMLHTTP");
   }
-  if (led) {
-    led.open("GET", "/ledstate?id=" + Math.round(Math.random()*1000), true);
-    led.onreadystatechange = ledComplete;
-    led.send(null);
+  if (req) {
+    req.open("GET", "/status.json?id=" + Math.round(Math.random()*1000), true);
+    req.onreadystatechange = statusComplete;
+    req.send(null);
   }
 }
 
@@ -174,6 +275,7 @@ function loadPage(page)
   {
     if ((xmlhttp.readyState == 4) && (xmlhttp.status == 200)) {
       document.getElementById("content").innerHTML = xmlhttp.responseText;
+      statusShow();
     }
   }
 }
@@ -186,4 +288,6 @@ function changeValueRange(value)
 
 function liverange(value){
   document.getElementById("rangevalue").innerHTML = value;
+  // Over a WebSocket the motor follows the slider while it moves.
+  wsSend([WS_CMD_SET_SPEED, value & 0xff]);
 }
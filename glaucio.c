@@ -1,11 +1,18 @@
 #include "utils.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "utimer.h"
+
+// These used to spin in SysCtlDelay() for a number of loops that only held at
+// 120 MHz.  They now wait on the microsecond timer service, and waits of a
+// tick or more let the other tasks run.
 void SysTick_Wait1us(int time_in_us)
 {
-  SysCtlDelay(time_in_us * 40);
+  UTimer_Delay_Us(time_in_us);
 }
 void SysTick_Wait1ms(int time_in_ms)
 {
-  SysCtlDelay(time_in_ms * 40000);
+  UTimer_Sleep_Us(time_in_ms * 1000);
 }
 
 /* reverse:  reverse string s in place */
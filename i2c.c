@@ -1,15 +1,13 @@
 #include "./i2c.h"
-
-#define LCD_OFFLINE
-
-#ifdef LCD_OFFLINE
-    char offline_strings[50][16];
-    uint8_t offline_iterator = 0;
-#endif
-
+#include "oled_fb.h"
+#include "utils.h"
+#include "FreeRTOS.h"
+#include "task.h"
 
 uint32_t error = 0;
-uint32_t busy = 0;
+
+// The SSD1306 ignores the contents of a blank frame, so it can live in flash.
+static const uint8_t blank_frame[SSD1306_BUFFER_SIZE] = {0};
 
 extern uint8_t update_digit;
 
@@ -29,120 +27,166 @@ void I2C_Init(void)
     //2*(TPR+1)*10*12,5ns = 2,5us -> TPR = 9 (400kbps)
     //I2C0_MTPR_R &= ~I2C_MTPR_TPR_M;
     I2C0_MTPR_R = 9;
+
+    I2C_Xfer_Init();
 }
 
-void I2C_Check_Transmission(void)
+// Called by the I2C engine when an OLED transfer has finished: wakes up the
+// task waiting for it, if any.
+static void I2C_OLED_Done(tI2CTransfer *transfer)
 {
-    //Checks Master Control/Status register BUSY and ERROR bits
-    while (I2C0_MCS_R & I2C_MCS_BUSY)
-    {
-    }
+    BaseType_t woken = pdFALSE;
 
-    if (I2C0_MCS_R & I2C_MCS_ERROR)
+    if (transfer->pvCallbackData)
     {
-        if (!I2C0_MCS_R & I2C_MCS_ARBLST)
-        {
-            I2C0_MCS_R = (I2C_MCS_STOP);
-        }
-        error++;
+        vTaskNotifyGiveFromISR((TaskHandle_t)transfer->pvCallbackData, &woken);
+        portYIELD_FROM_ISR(woken);
     }
 }
 
-void I2C_OLED_Send(uint8_t type, uint8_t command_byte)
+// Sends a list of transfers to the display, filling in their address, and
+// waits until they are all out.  The engine sends them back to back while the
+// calling task sleeps until the last one wakes it up; before the scheduler
+// runs, when interrupts are masked, the engine is polled instead.
+void I2C_OLED_Transfer_List(tI2CTransfer *transfers, uint32_t count)
 {
+    tI2CTransfer *last;
+    bool running;
+    uint32_t i;
 
-    //--------Transmission of CONTROL byte--------
-    //Puts address and transmit bit on the Master Slave Address Register
-    I2C0_MSA_R = (SSD1306_I2C_ADDRESS << 1) | 0x00;
+    if (count == 0)
+    {
+        return;
+    }
 
-    //Writes control byte
-    I2C0_MDR_R = type;
+    running = (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING);
+    last = &transfers[count - 1];
 
-    while (I2C0_MCS_R & I2C_MCS_BUSBSY)
-        busy++;
+    for (i = 0; i < count; i++)
+    {
+        transfers[i].ui8Address = SSD1306_I2C_ADDRESS;
+        transfers[i].pfnCallback = NULL;
+    }
+    last->pfnCallback = I2C_OLED_Done;
+    last->pvCallbackData = running ? xTaskGetCurrentTaskHandle() : NULL;
 
-    //Writes ---01011 to Master Control/Status register
-    I2C0_MCS_R = (I2C_MCS_ACK | I2C_MCS_START | I2C_MCS_RUN);
+    for (i = 0; i < count; i++)
+    {
+        I2C_Xfer_Submit(&transfers[i]);
+    }
 
-    I2C_Check_Transmission();
+    while (last->ui32Status == I2C_XFER_PENDING)
+    {
+        if (running)
+        {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
+        else
+        {
+            I2C_Xfer_Poll();
+        }
+    }
 
-    SysTick_Wait1us(SSD1306_COMMAND_DELAY);
+    for (i = 0; i < count; i++)
+    {
+        if (transfers[i].ui32Status == I2C_XFER_ERROR)
+        {
+            error++;
+        }
+    }
+}
 
-    //--------Transmission of COMMAND byte--------
+// Sends a control byte followed by size bytes to the display.
+static void I2C_OLED_Transfer(uint8_t type, const uint8_t *data, uint32_t size)
+{
+    tI2CTransfer transfer;
 
-    //Writes command byte
-    I2C0_MDR_R = command_byte;
+    transfer.pui8Header = &type;
+    transfer.ui32HeaderSize = 1;
+    transfer.pui8Data = data;
+    transfer.ui32Size = size;
 
-    //Writes  ---01101 to Master Control/Status register
-    I2C0_MCS_R = (I2C_MCS_ACK | I2C_MCS_STOP | I2C_MCS_RUN);
+    I2C_OLED_Transfer_List(&transfer, 1);
+}
 
-    I2C_Check_Transmission();
+void I2C_OLED_Send(uint8_t type, uint8_t command_byte)
+{
+    I2C_OLED_Transfer(type, &command_byte, 1);
+}
 
-    SysTick_Wait1us(SSD1306_COMMAND_DELAY);
+// Sends a list of commands, with their arguments, in a single transaction:
+// after a control byte with the continuation bit clear the display takes every
+// following byte as a command, so the list needs one START, address and
+// control byte in all.
+void I2C_OLED_Send_Commands(const uint8_t *commands, uint32_t count)
+{
+    I2C_OLED_Transfer(SSD1306_COMMAND, commands, count);
 }
 
-void I2C_OLED_Init(void)
+// The power up sequence of the display.
+static const uint8_t init_commands[] =
 {
-    I2C_OLED_Send(SSD1306_COMMAND, 0xAE); // Set display OFF
+    0xAE,       // Set display OFF
+
+    0xD5,       // Set Display Clock Divide Ratio / OSC Frequency
+    0x80,       // Display Clock Divide Ratio / OSC Frequency
 
-    I2C_OLED_Send(SSD1306_COMMAND, 0xD5); // Set Display Clock Divide Ratio / OSC Frequency
-    I2C_OLED_Send(SSD1306_COMMAND, 0x80); // Display Clock Divide Ratio / OSC Frequency
+    0xA8,       // Set Multiplex Ratio
+    0x3F,       // Multiplex Ratio for 128x64 (64-1)
 
-    I2C_OLED_Send(SSD1306_COMMAND, 0xA8); // Set Multiplex Ratio
-    I2C_OLED_Send(SSD1306_COMMAND, 0x3F); // Multiplex Ratio for 128x64 (64-1)
+    0xD3,       // Set Display Offset
+    0x00,       // Display Offset
 
-    I2C_OLED_Send(SSD1306_COMMAND, 0xD3); // Set Display Offset
-    I2C_OLED_Send(SSD1306_COMMAND, 0x00); // Display Offset
+    0x40,       // Set Display Start Line
 
-    I2C_OLED_Send(SSD1306_COMMAND, 0x40); // Set Display Start Line
+    0x8D,       // Set Charge Pump
+    0x14,       // Charge Pump (0x10 External, 0x14 Internal DC/DC)
 
-    I2C_OLED_Send(SSD1306_COMMAND, 0x8D); // Set Charge Pump
-    I2C_OLED_Send(SSD1306_COMMAND, 0x14); // Charge Pump (0x10 External, 0x14 Internal DC/DC)
+    SSD1306_MEMORYMODE, // 0x20
+    0x00,
 
-    I2C_OLED_Send(SSD1306_COMMAND, SSD1306_MEMORYMODE); // 0x20
-    I2C_OLED_Send(SSD1306_COMMAND, 0x00);
+    0xA1,       // Set Segment Re-Map
+    0xC8,       // Set Com Output Scan Direction
 
-    I2C_OLED_Send(SSD1306_COMMAND, 0xA1); // Set Segment Re-Map
-    I2C_OLED_Send(SSD1306_COMMAND, 0xC8); // Set Com Output Scan Direction
+    0xDA,       // Set COM Hardware Configuration
+    0x12,       // COM Hardware Configuration
 
-    I2C_OLED_Send(SSD1306_COMMAND, 0xDA); // Set COM Hardware Configuration
-    I2C_OLED_Send(SSD1306_COMMAND, 0x12); // COM Hardware Configuration
+    0x81,       // Set Contrast
+    0xCF,       // Contrast
 
-    I2C_OLED_Send(SSD1306_COMMAND, 0x81); // Set Contrast
-    I2C_OLED_Send(SSD1306_COMMAND, 0xCF); // Contrast
+    0xD9,       // Set Pre-Charge Period
+    0xF1,       // Set Pre-Charge Period (0x22 External, 0xF1 Internal)
 
-    I2C_OLED_Send(SSD1306_COMMAND, 0xD9); // Set Pre-Charge Period
-    I2C_OLED_Send(SSD1306_COMMAND, 0xF1); // Set Pre-Charge Period (0x22 External, 0xF1 Internal)
+    0xDB,       // Set VCOMH Deselect Level
+    0x40,       // VCOMH Deselect Level
 
-    I2C_OLED_Send(SSD1306_COMMAND, 0xDB); // Set VCOMH Deselect Level
-    I2C_OLED_Send(SSD1306_COMMAND, 0x40); // VCOMH Deselect Level
+    0xA4,       // Set display fetch from RAM
+    0xA6,       // Set display not inverted
+    0xAF,       // Set display On
+};
 
-    I2C_OLED_Send(SSD1306_COMMAND, 0xA4); // Set display fetch from RAM
-    I2C_OLED_Send(SSD1306_COMMAND, 0xA6); // Set display not inverted
-    I2C_OLED_Send(SSD1306_COMMAND, 0xAF); // Set display On
+void I2C_OLED_Init(void)
+{
+    I2C_OLED_Send_Commands(init_commands, sizeof(init_commands));
 }
 
 void I2C_OLED_Move_Cursor(uint8_t row, uint8_t column)
 {
-    I2C_OLED_Send(SSD1306_COMMAND, SSD1306_PAGEADDR);
-    I2C_OLED_Send(SSD1306_COMMAND, row);
-    I2C_OLED_Send(SSD1306_COMMAND, 7);
+    uint8_t commands[6];
+
+    commands[0] = SSD1306_PAGEADDR;
+    commands[1] = row;
+    commands[2] = 7;
 
-    I2C_OLED_Send(SSD1306_COMMAND, SSD1306_COLUMNADDR);
-    I2C_OLED_Send(SSD1306_COMMAND, column);
-    I2C_OLED_Send(SSD1306_COMMAND, SSD1306_LCDWIDTH - 1);
+    commands[3] = SSD1306_COLUMNADDR;
+    commands[4] = column;
+    commands[5] = SSD1306_LCDWIDTH - 1;
+
+    I2C_OLED_Send_Commands(commands, sizeof(commands));
 }
 
 void I2C_OLED_Print(char* string)
 {
-
-    #ifdef LCD_OFFLINE
-        strcpy(offline_strings[offline_iterator], string);
-        strcpy(offline_strings[offline_iterator+1], " ");
-        if(++offline_iterator >= 50) offline_iterator = 0;
-    #endif
-
-
     while (*string != '\0')
     {
         I2C_OLED_Draw(font_default+(*string*8),8);
@@ -152,88 +196,89 @@ void I2C_OLED_Print(char* string)
 
 void I2C_OLED_Draw(const uint8_t *data_pointer, uint32_t data_size)
 {
-    I2C0_MSA_R = (SSD1306_I2C_ADDRESS << 1) | 0x00;
+    I2C_OLED_Transfer(SSD1306_DATA, data_pointer, data_size);
+}
 
-    I2C0_MDR_R = SSD1306_DATA;
+void I2C_OLED_Set_Contrast(uint8_t contrast_level)
+{
+    uint8_t commands[2];
 
-    while (I2C0_MCS_R & I2C_MCS_BUSBSY)
-        busy++;
+    commands[0] = SSD1306_SETCONTRAST;
+    commands[1] = contrast_level;
 
-    I2C0_MCS_R = (I2C_MCS_ACK | I2C_MCS_START | I2C_MCS_RUN);
+    I2C_OLED_Send_Commands(commands, sizeof(commands));
+}
 
-    I2C_Check_Transmission();
+// Start the scroll engine of the display over pages first_page to last_page,
+// moving them by a column every interval (one of the SSD1306_SCROLL_*
+// frame counts).  direction is one of the scroll commands of ssd1306.h; the
+// diagonal ones also move the whole display up by vertical_offset rows per
+// step.  The display scrolls on its own from then on, at no cost on the bus.
+void I2C_OLED_Scroll(uint8_t direction, uint8_t first_page, uint8_t last_page,
+                     uint8_t interval, uint8_t vertical_offset)
+{
+    uint8_t commands[12];
+    uint32_t count;
 
-    SysTick_Wait1us(SSD1306_COMMAND_DELAY);
+    count = 0;
+    commands[count++] = SSD1306_DEACTIVATE_SCROLL;
 
-    int i = 0;
-    for (i = 0; i < data_size - 1; i++)
+    if ((direction == SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL) ||
+        (direction == SSD1306_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL))
     {
-        I2C0_MDR_R = data_pointer[i];
-
-        I2C0_MCS_R = (I2C_MCS_ACK | I2C_MCS_RUN);
-
-        SysTick_Wait1us(SSD1306_DATA_DELAY);
-        I2C_Check_Transmission();
+        commands[count++] = SSD1306_SET_VERTICAL_SCROLL_AREA;
+        commands[count++] = 0;
+        commands[count++] = SSD1306_LCDHEIGHT;
+        commands[count++] = direction;
+        commands[count++] = 0x00;
+        commands[count++] = first_page;
+        commands[count++] = interval;
+        commands[count++] = last_page;
+        commands[count++] = vertical_offset;
+    }
+    else
+    {
+        commands[count++] = direction;
+        commands[count++] = 0x00;
+        commands[count++] = first_page;
+        commands[count++] = interval;
+        commands[count++] = last_page;
+        commands[count++] = 0x00;
+        commands[count++] = 0xFF;
     }
 
-    I2C0_MDR_R = data_pointer[data_size - 1];
-
-    I2C0_MCS_R = (I2C_MCS_ACK | I2C_MCS_STOP | I2C_MCS_RUN);
+    commands[count++] = SSD1306_ACTIVATE_SCROLL;
 
-    I2C_Check_Transmission();
+    I2C_OLED_Send_Commands(commands, count);
 }
 
-void I2C_OLED_Set_Contrast(uint8_t contrast_level)
+// Stop the scroll engine.  What the display memory holds afterwards is
+// undefined for the pages that scrolled, so they must be written again.
+void I2C_OLED_Stop_Scroll(void)
 {
-    I2C_OLED_Send(SSD1306_COMMAND, SSD1306_SETCONTRAST);
-    I2C_OLED_Send(SSD1306_COMMAND, contrast_level);
+    uint8_t command = SSD1306_DEACTIVATE_SCROLL;
+
+    I2C_OLED_Send_Commands(&command, 1);
 }
 
 void I2C_OLED_Clear()
 {
     I2C_OLED_Move_Cursor(0,0);
-
-    I2C0_MSA_R = (SSD1306_I2C_ADDRESS << 1) | 0x00;
-
-    I2C0_MDR_R = SSD1306_DATA;
-
-    while (I2C0_MCS_R & I2C_MCS_BUSBSY)
-        busy++;
-
-    I2C0_MCS_R = (I2C_MCS_ACK | I2C_MCS_START | I2C_MCS_RUN);
-
-    I2C_Check_Transmission();
-
-    SysTick_Wait1us(SSD1306_COMMAND_DELAY);
-    int i = 0;
-    for (i = 0; i < 1023; i++)
-    {
-        I2C0_MDR_R = 0x00;
-
-        I2C0_MCS_R = (I2C_MCS_ACK | I2C_MCS_RUN);
-
-        SysTick_Wait1us(SSD1306_DATA_DELAY);
-
-        I2C_Check_Transmission();
-    }
-
-    I2C0_MDR_R = 0x00;
-
-    I2C0_MCS_R = (I2C_MCS_ACK | I2C_MCS_STOP | I2C_MCS_RUN);
-
-    I2C_Check_Transmission();
+    I2C_OLED_Draw(blank_frame, SSD1306_BUFFER_SIZE);
 }
 
+// Show the splash screen.  It stays up until something else is drawn, so
+// the caller need not wait for it (configureOLED() has the display task
+// animate a progress bar under it, then clear it).
 void I2C_OLED_Sequence_Init(void)
 {
-    I2C_OLED_Move_Cursor(0,0);
-    I2C_OLED_Draw(((uint8_t *)BMP_UTFPR), 1024);
-   SysTick_Wait1ms(2000);
-   I2C_OLED_Clear();
+    OLED_FB_Init();
+    OLED_FB_Image(0, 0, &IMG_UTFPR);
+    OLED_FB_Flush();
 }
 
 uint8_t center_string_position(char* string)
 {
-    //WIDTH - 8 * (length / 2)
-    return 64 - strlen(string) * 4;
+    return (SSD1306_LCDWIDTH -
+            OLED_Font_String_Width(&FONT_FIXED, 1, string)) / 2;
 }
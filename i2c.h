@@ -1,23 +1,29 @@
 #if !defined(__I2C_H__)
 #define __I2C_H__
-#include "utils.h"
 #include "./images/images.h"
 #include "./fonts/fonts.h"
+#include <stdbool.h>
 #include <stdint.h>
 #include "tm4c1294ncpdt.h"
 #include "./ssd1306.h"
+#include "./i2c_xfer.h"
 
 #include <string.h>
 
 
 void I2C_Init(void);
+void I2C_OLED_Transfer_List(tI2CTransfer *transfers, uint32_t count);
 void I2C_OLED_Send(uint8_t type, uint8_t command);
+void I2C_OLED_Send_Commands(const uint8_t *commands, uint32_t count);
 void I2C_OLED_Init(void);
 void I2C_OLED_Draw(const uint8_t*, uint32_t);
 void I2C_OLED_Print(char *string);
 void I2C_OLED_Move_Cursor(uint8_t row, uint8_t column);
 void I2C_OLED_Set_Contrast(uint8_t contrast_level);
 void I2C_OLED_Clear(void);
+void I2C_OLED_Scroll(uint8_t direction, uint8_t first_page, uint8_t last_page,
+                     uint8_t interval, uint8_t vertical_offset);
+void I2C_OLED_Stop_Scroll(void);
 void I2C_OLED_Sequence_Init(void);
 void IC_Tester_Select(void);
 uint8_t center_string_position(char* string);
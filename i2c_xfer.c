@@ -0,0 +1,319 @@
+//*****************************************************************************
+//
+// i2c_xfer.c - Interrupt-driven transfer engine for the I2C0 master.
+//
+// Transfers are described by tI2CTransfer descriptors and queued with
+// I2C_Xfer_Submit(), which returns at once.  The I2C0 master interrupt then
+// sends the bytes one at a time, finishes each transfer with its callback and
+// starts the next one, so the CPU only spends the few cycles of each
+// interrupt on a transfer instead of spinning until the bus is free.
+//
+// The engine only touches the I2C0 master registers: the I2C module and its
+// pins are set up by I2C_Init() and the interrupt is enabled in the NVIC by
+// the application.  This also lets tools/i2c_sim.c run it against a model of
+// the registers on the host.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include "tm4c1294ncpdt.h"
+#include "i2c_xfer.h"
+
+//*****************************************************************************
+//
+// The states of the engine.
+//
+//*****************************************************************************
+#define STATE_IDLE              0       // Nothing on the bus
+#define STATE_SENDING           1       // A byte of the head transfer is out
+#define STATE_STOPPING          2       // A STOP after an error is out
+
+//*****************************************************************************
+//
+// The queue of transfers.  The head is the one on the bus.
+//
+//*****************************************************************************
+static tI2CTransfer *g_psHead;
+static tI2CTransfer *g_psTail;
+
+//*****************************************************************************
+//
+// The state of the engine, the number of bytes of the head transfer handed to
+// the controller and whether the last command included the STOP.
+//
+//*****************************************************************************
+static uint32_t g_ui32State;
+static uint32_t g_ui32Index;
+static bool g_bStopSent;
+
+//*****************************************************************************
+//
+// Return the byte of a transfer at the given position.
+//
+//*****************************************************************************
+static uint8_t
+I2C_Xfer_Byte(const tI2CTransfer *psTransfer, uint32_t ui32Index)
+{
+    if(ui32Index < psTransfer->ui32HeaderSize)
+    {
+        return(psTransfer->pui8Header[ui32Index]);
+    }
+
+    return(psTransfer->pui8Data[ui32Index - psTransfer->ui32HeaderSize]);
+}
+
+//*****************************************************************************
+//
+// Start the transfer at the head of the queue: address the slave and send
+// its first byte, with the STOP if it is also the last.
+//
+//*****************************************************************************
+static void
+I2C_Xfer_Start(void)
+{
+    tI2CTransfer *psTransfer;
+
+    psTransfer = g_psHead;
+
+    I2C0_MSA_R = psTransfer->ui8Address << 1;
+    I2C0_MDR_R = I2C_Xfer_Byte(psTransfer, 0);
+
+    g_ui32Index = 1;
+    g_bStopSent = ((psTransfer->ui32HeaderSize + psTransfer->ui32Size) == 1);
+    g_ui32State = STATE_SENDING;
+
+    I2C0_MCS_R = (I2C_MCS_START | I2C_MCS_RUN |
+                  (g_bStopSent ? I2C_MCS_STOP : 0));
+}
+
+//*****************************************************************************
+//
+// Take the head transfer off the queue, start the next one and report the
+// outcome of the finished one.
+//
+//*****************************************************************************
+static void
+I2C_Xfer_Finish(uint32_t ui32Status)
+{
+    tI2CTransfer *psTransfer;
+
+    psTransfer = g_psHead;
+    g_psHead = psTransfer->psNext;
+    if(!g_psHead)
+    {
+        g_psTail = 0;
+    }
+
+    g_ui32State = STATE_IDLE;
+    if(g_psHead)
+    {
+        I2C_Xfer_Start();
+    }
+
+    psTransfer->ui32Status = ui32Status;
+    if(psTransfer->pfnCallback)
+    {
+        psTransfer->pfnCallback(psTransfer);
+    }
+}
+
+//*****************************************************************************
+//
+// Handle the completion of the command last written to the controller.
+//
+//*****************************************************************************
+static void
+I2C_Xfer_Step(void)
+{
+    tI2CTransfer *psTransfer;
+    uint32_t ui32MCS, ui32Size;
+
+    I2C0_MICR_R = I2C_MICR_IC;
+    ui32MCS = I2C0_MCS_R;
+
+    if(g_ui32State == STATE_STOPPING)
+    {
+        I2C_Xfer_Finish(I2C_XFER_ERROR);
+        return;
+    }
+
+    if(g_ui32State != STATE_SENDING)
+    {
+        return;
+    }
+
+    //
+    // If the slave did not acknowledge, release the bus with a STOP unless
+    // it went out with the failed byte.  After a lost arbitration the bus
+    // belongs to another master, which ends the transaction.
+    //
+    if(ui32MCS & I2C_MCS_ERROR)
+    {
+        if(!(ui32MCS & I2C_MCS_ARBLST) && !g_bStopSent)
+        {
+            g_ui32State = STATE_STOPPING;
+            I2C0_MCS_R = I2C_MCS_STOP;
+        }
+        else
+        {
+            I2C_Xfer_Finish(I2C_XFER_ERROR);
+        }
+        return;
+    }
+
+    psTransfer = g_psHead;
+    ui32Size = psTransfer->ui32HeaderSize + psTransfer->ui32Size;
+
+    if(g_ui32Index < ui32Size)
+    {
+        I2C0_MDR_R = I2C_Xfer_Byte(psTransfer, g_ui32Index);
+        g_ui32Index++;
+        g_bStopSent = (g_ui32Index == ui32Size);
+        I2C0_MCS_R = I2C_MCS_RUN | (g_bStopSent ? I2C_MCS_STOP : 0);
+    }
+    else
+    {
+        I2C_Xfer_Finish(I2C_XFER_DONE);
+    }
+}
+
+//*****************************************************************************
+//
+//! Initializes the transfer engine.
+//!
+//! The I2C0 master must already be enabled.  This empties the queue and
+//! unmasks the master interrupt in the I2C module.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+I2C_Xfer_Init(void)
+{
+    I2C0_MIMR_R = 0;
+    I2C0_MICR_R = I2C_MICR_IC;
+
+    g_psHead = 0;
+    g_psTail = 0;
+    g_ui32State = STATE_IDLE;
+
+    I2C0_MIMR_R = I2C_MIMR_IM;
+}
+
+//*****************************************************************************
+//
+//! Queues a transfer.
+//!
+//! \param psTransfer is the transfer, with all the fields but ui32Status and
+//! psNext filled in.
+//!
+//! The transfer starts at once if the bus is free, or when the ones queued
+//! before it have finished.  This may be called from a task, an interrupt
+//! handler or a transfer callback.  A transfer with no bytes finishes in this
+//! call.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+I2C_Xfer_Submit(tI2CTransfer *psTransfer)
+{
+    uint32_t ui32Mask;
+
+    psTransfer->psNext = 0;
+    psTransfer->ui32Status = I2C_XFER_PENDING;
+
+    if((psTransfer->ui32HeaderSize + psTransfer->ui32Size) == 0)
+    {
+        psTransfer->ui32Status = I2C_XFER_DONE;
+        if(psTransfer->pfnCallback)
+        {
+            psTransfer->pfnCallback(psTransfer);
+        }
+        return;
+    }
+
+    //
+    // Keep the interrupt handler away from the queue while it is changed.
+    //
+    ui32Mask = I2C0_MIMR_R;
+    I2C0_MIMR_R = 0;
+
+    if(g_psTail)
+    {
+        g_psTail->psNext = psTransfer;
+    }
+    else
+    {
+        g_psHead = psTransfer;
+    }
+    g_psTail = psTransfer;
+
+    if(g_ui32State == STATE_IDLE)
+    {
+        I2C_Xfer_Start();
+    }
+
+    I2C0_MIMR_R = ui32Mask;
+}
+
+//*****************************************************************************
+//
+//! Tells whether transfers are queued or in progress.
+//!
+//! \return true if the engine has work left.
+//
+//*****************************************************************************
+bool
+I2C_Xfer_Busy(void)
+{
+    return(g_psHead != 0);
+}
+
+//*****************************************************************************
+//
+//! Advances the transfers without the interrupt.
+//!
+//! This is for when the I2C0 interrupt cannot be taken, such as before the
+//! scheduler has started, when FreeRTOS keeps interrupts masked: calling it
+//! in a loop until a transfer has finished does the work of the interrupt
+//! handler.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+I2C_Xfer_Poll(void)
+{
+    uint32_t ui32Mask;
+
+    ui32Mask = I2C0_MIMR_R;
+    I2C0_MIMR_R = 0;
+
+    if(I2C0_MRIS_R & I2C_MRIS_RIS)
+    {
+        I2C_Xfer_Step();
+    }
+
+    I2C0_MIMR_R = ui32Mask;
+}
+
+//*****************************************************************************
+//
+//! The I2C0 interrupt handler.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+I2C_Xfer_IntHandler(void)
+{
+    //
+    // The interrupt may have been left pending by I2C_Xfer_Poll() or
+    // I2C_Xfer_Submit() masking it after it was raised.
+    //
+    if(I2C0_MMIS_R & I2C_MMIS_MIS)
+    {
+        I2C_Xfer_Step();
+    }
+}
@@ -0,0 +1,92 @@
+//*****************************************************************************
+//
+// i2c_xfer.h - Prototypes for the interrupt-driven I2C0 transfer engine.
+//
+//*****************************************************************************
+
+#ifndef __I2C_XFER_H__
+#define __I2C_XFER_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The status of a transfer.
+//
+//*****************************************************************************
+#define I2C_XFER_PENDING        0       // Queued or on the bus
+#define I2C_XFER_DONE           1       // Sent and acknowledged
+#define I2C_XFER_ERROR          2       // Not acknowledged or bus lost
+
+typedef struct sI2CTransfer tI2CTransfer;
+
+//*****************************************************************************
+//
+// The function called when a transfer has finished, successfully or not.  It
+// is called from the I2C0 interrupt handler (or from I2C_Xfer_Poll()), may
+// submit new transfers, and must not block.
+//
+//*****************************************************************************
+typedef void (*tI2CCallback)(tI2CTransfer *psTransfer);
+
+//*****************************************************************************
+//
+// A write transfer to an I2C slave.  The bytes sent are the ui32HeaderSize
+// bytes of pui8Header followed by the ui32Size bytes of pui8Data, in a
+// single START ... STOP transaction, so that a control byte can precede a
+// buffer (such as a frame) without copying it.  Either part may be empty,
+// but not both.
+//
+// The descriptor and the bytes belong to the engine from I2C_Xfer_Submit()
+// until ui32Status leaves I2C_XFER_PENDING, and must not be touched meanwhile.
+//
+//*****************************************************************************
+struct sI2CTransfer
+{
+    //
+    // The 7-bit address of the slave.
+    //
+    uint8_t ui8Address;
+
+    const uint8_t *pui8Header;
+    uint32_t ui32HeaderSize;
+    const uint8_t *pui8Data;
+    uint32_t ui32Size;
+
+    //
+    // Called when the transfer has finished, if not NULL, with
+    // pvCallbackData left for it to use.
+    //
+    tI2CCallback pfnCallback;
+    void *pvCallbackData;
+
+    //
+    // One of I2C_XFER_PENDING, I2C_XFER_DONE or I2C_XFER_ERROR.
+    //
+    volatile uint32_t ui32Status;
+
+    //
+    // The next transfer in the queue, private to the engine.
+    //
+    tI2CTransfer *psNext;
+};
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.
+//
+//*****************************************************************************
+extern void I2C_Xfer_Init(void);
+extern void I2C_Xfer_Submit(tI2CTransfer *psTransfer);
+extern bool I2C_Xfer_Busy(void);
+extern void I2C_Xfer_Poll(void);
+extern void I2C_Xfer_IntHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __I2C_XFER_H__
@@ -12,5 +12,18 @@ extern const unsigned char BMP_UTFPR[];
 extern const unsigned char BMP_LOADING_EMPTY[];
 extern const unsigned char BMP_LOADING_FULL[];
 
+// The same images, run-length compressed by tools/rle_image.py into
+// images_rle.c.  The arrays above are only the input of the converter and are
+// not built into the firmware.
+#include <stdint.h>
+#include "../oled_image.h"
+
+extern const tOLEDImage IMG_74LS00;
+extern const tOLEDImage IMG_74LS08;
+extern const tOLEDImage IMG_74LS32;
+extern const tOLEDImage IMG_74LSXX;
+extern const tOLEDImage IMG_LOADING_EMPTY;
+extern const tOLEDImage IMG_UTFPR;
+
 
 #endif // __IMAGES_H__
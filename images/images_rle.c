@@ -0,0 +1,168 @@
+//*****************************************************************************
+//
+// images_rle.c - Run-length compressed images.
+//
+// This file is generated by tools/rle_image.py from the LCD Assistant images
+// in this directory:
+//
+//     python3 tools/rle_image.py -o images/images_rle.c images/*.c
+//
+//*****************************************************************************
+#include <stdint.h>
+#include "../oled_image.h"
+
+//
+// BMP_74LS00 from 74LS00.c: 768 bytes, 315 compressed.
+//
+static const uint8_t g_pui8Image74LS00[] =
+{
+    0x90, 0xc5, 0x80, 0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff, 0xc4, 0x81,
+    0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff,
+    0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80,
+    0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe,
+    0xc5, 0x80, 0xa3, 0x00, 0xff, 0x93, 0x00, 0xff, 0x83, 0x00, 0xf0, 0xc4, 0x10, 0x01, 0x90, 0x9f,
+    0xc3, 0x80, 0x86, 0x00, 0xff, 0x8b, 0x00, 0xff, 0x83, 0x00, 0xf0, 0xc4, 0x10, 0x01, 0x90, 0x9f,
+    0xc3, 0x80, 0x86, 0x00, 0xff, 0x87, 0x00, 0xff, 0xa3, 0x03, 0x3f, 0x20, 0x60, 0xc0, 0x90, 0x00,
+    0x3f, 0xc3, 0x20, 0xc5, 0x21, 0x01, 0x7f, 0x7f, 0xc2, 0x61, 0x08, 0x73, 0x3f, 0x1e, 0x0c, 0x12,
+    0x12, 0x0c, 0x08, 0x07, 0x8b, 0x00, 0x3f, 0xc3, 0x20, 0xc5, 0x21, 0x01, 0x7f, 0x7f, 0xc2, 0x61,
+    0x08, 0x73, 0x3f, 0x1e, 0x0c, 0x12, 0x12, 0x0c, 0x08, 0x07, 0x87, 0x00, 0xff, 0xa3, 0x03, 0xfc,
+    0x04, 0x06, 0x03, 0x84, 0x00, 0xfc, 0xc3, 0x04, 0xc5, 0x84, 0x01, 0xfe, 0xfe, 0xc2, 0x86, 0x08,
+    0xce, 0xfc, 0x78, 0x30, 0x48, 0x48, 0x30, 0x10, 0xe0, 0x8a, 0x00, 0xfc, 0xc3, 0x04, 0xc5, 0x84,
+    0x01, 0xfe, 0xfe, 0xc2, 0x86, 0x08, 0xce, 0xfc, 0x78, 0x18, 0x24, 0x24, 0x18, 0x10, 0xe0, 0x94,
+    0x00, 0xff, 0xa3, 0x00, 0xff, 0x87, 0x00, 0xff, 0x83, 0x00, 0x0f, 0xc4, 0x08, 0x01, 0x09, 0xf9,
+    0xc3, 0x01, 0x86, 0x00, 0xff, 0x8a, 0x00, 0xff, 0x83, 0x00, 0x0f, 0xc4, 0x08, 0x01, 0x09, 0xf9,
+    0xc3, 0x01, 0x86, 0x00, 0xff, 0x94, 0x00, 0xff, 0xa3, 0xc4, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81,
+    0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f, 0xc1,
+    0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01, 0x01,
+    0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3,
+    0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc6, 0x01, 0x92,
+};
+
+const tOLEDImage IMG_74LS00 =
+{
+    128, 48, g_pui8Image74LS00, sizeof(g_pui8Image74LS00)
+};
+
+//
+// BMP_74LS08 from 74LS08.c: 768 bytes, 307 compressed.
+//
+static const uint8_t g_pui8Image74LS08[] =
+{
+    0x90, 0xc5, 0x80, 0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff, 0xc4, 0x81,
+    0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff,
+    0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80,
+    0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe,
+    0xc5, 0x80, 0xa3, 0x00, 0xff, 0x93, 0x00, 0xff, 0x83, 0x00, 0xf0, 0xc4, 0x10, 0x01, 0x90, 0x9f,
+    0xc3, 0x80, 0x86, 0x00, 0xff, 0x8b, 0x00, 0xff, 0x83, 0x00, 0xf0, 0xc4, 0x10, 0x01, 0x90, 0x9f,
+    0xc3, 0x80, 0x86, 0x00, 0xff, 0x87, 0x00, 0xff, 0xa3, 0x03, 0x3f, 0x20, 0x60, 0xc0, 0x90, 0x00,
+    0x3f, 0xc3, 0x20, 0xc5, 0x21, 0x01, 0x7f, 0x7f, 0xc2, 0x61, 0x02, 0x73, 0x3f, 0x1e, 0xc4, 0x08,
+    0x00, 0x07, 0x8b, 0x00, 0x3f, 0xc3, 0x20, 0xc5, 0x21, 0x01, 0x7f, 0x7f, 0xc2, 0x61, 0x02, 0x73,
+    0x3f, 0x1e, 0xc4, 0x08, 0x00, 0x07, 0x87, 0x00, 0xff, 0xa3, 0x03, 0xfc, 0x04, 0x06, 0x03, 0x84,
+    0x00, 0xfc, 0xc3, 0x04, 0xc5, 0x84, 0x01, 0xfe, 0xfe, 0xc2, 0x86, 0x02, 0xce, 0xfc, 0x78, 0xc4,
+    0x10, 0x00, 0xe0, 0x8a, 0x00, 0xfc, 0xc3, 0x04, 0xc5, 0x84, 0x01, 0xfe, 0xfe, 0xc2, 0x86, 0x02,
+    0xce, 0xfc, 0x78, 0xc4, 0x10, 0x00, 0xe0, 0x94, 0x00, 0xff, 0xa3, 0x00, 0xff, 0x87, 0x00, 0xff,
+    0x83, 0x00, 0x0f, 0xc4, 0x08, 0x01, 0x09, 0xf9, 0xc3, 0x01, 0x86, 0x00, 0xff, 0x8a, 0x00, 0xff,
+    0x83, 0x00, 0x0f, 0xc4, 0x08, 0x01, 0x09, 0xf9, 0xc3, 0x01, 0x86, 0x00, 0xff, 0x94, 0x00, 0xff,
+    0xa3, 0xc4, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f, 0xc1, 0xc4,
+    0x81, 0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f,
+    0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01,
+    0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff,
+    0xc6, 0x01, 0x92,
+};
+
+const tOLEDImage IMG_74LS08 =
+{
+    128, 48, g_pui8Image74LS08, sizeof(g_pui8Image74LS08)
+};
+
+//
+// BMP_74LS32 from 74LS32.c: 768 bytes, 307 compressed.
+//
+static const uint8_t g_pui8Image74LS32[] =
+{
+    0x90, 0xc5, 0x80, 0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff, 0xc4, 0x81,
+    0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff,
+    0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80,
+    0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe,
+    0xc5, 0x80, 0xa3, 0x00, 0xff, 0x93, 0x00, 0xff, 0x83, 0x00, 0xf0, 0xc4, 0x10, 0x01, 0x90, 0x9f,
+    0xc3, 0x80, 0x86, 0x00, 0xff, 0x8b, 0x00, 0xff, 0x83, 0x00, 0xf0, 0xc4, 0x10, 0x01, 0x90, 0x9f,
+    0xc3, 0x80, 0x86, 0x00, 0xff, 0x87, 0x00, 0xff, 0xa3, 0x03, 0x3f, 0x20, 0x60, 0xc0, 0x90, 0x00,
+    0x3f, 0xc3, 0x20, 0xc5, 0x21, 0x07, 0x61, 0x73, 0x7f, 0x6d, 0x61, 0x73, 0x3f, 0x1e, 0xc4, 0x08,
+    0x00, 0x07, 0x8b, 0x00, 0x3f, 0xc3, 0x20, 0xc5, 0x21, 0x07, 0x61, 0x73, 0x7f, 0x6d, 0x61, 0x73,
+    0x3f, 0x1e, 0xc4, 0x08, 0x00, 0x07, 0x87, 0x00, 0xff, 0xa3, 0x03, 0xfc, 0x04, 0x06, 0x03, 0x84,
+    0x00, 0xfc, 0xc3, 0x04, 0xc5, 0x84, 0x07, 0x86, 0xce, 0xfe, 0xb6, 0x86, 0xce, 0xfc, 0x78, 0xc4,
+    0x10, 0x00, 0xe0, 0x8a, 0x00, 0xfc, 0xc3, 0x04, 0xc5, 0x84, 0x07, 0x86, 0xce, 0xfe, 0xb6, 0x86,
+    0xce, 0xfc, 0x78, 0xc4, 0x10, 0x00, 0xe0, 0x94, 0x00, 0xff, 0xa3, 0x00, 0xff, 0x87, 0x00, 0xff,
+    0x83, 0x00, 0x0f, 0xc4, 0x08, 0x01, 0x09, 0xf9, 0xc3, 0x01, 0x86, 0x00, 0xff, 0x8a, 0x00, 0xff,
+    0x83, 0x00, 0x0f, 0xc4, 0x08, 0x01, 0x09, 0xf9, 0xc3, 0x01, 0x86, 0x00, 0xff, 0x94, 0x00, 0xff,
+    0xa3, 0xc4, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f, 0xc1, 0xc4,
+    0x81, 0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f,
+    0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01,
+    0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff,
+    0xc6, 0x01, 0x92,
+};
+
+const tOLEDImage IMG_74LS32 =
+{
+    128, 48, g_pui8Image74LS32, sizeof(g_pui8Image74LS32)
+};
+
+//
+// BMP_74LSXX from 74LSXX.c: 768 bytes, 167 compressed.
+//
+static const uint8_t g_pui8Image74LSXX[] =
+{
+    0x90, 0xc5, 0x80, 0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff, 0xc4, 0x81,
+    0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff,
+    0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80,
+    0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe, 0xc3, 0x80, 0x00, 0xff, 0xc4, 0x81, 0x01, 0x83, 0xfe,
+    0xc5, 0x80, 0xa3, 0x00, 0xff, 0xbf, 0x99, 0x00, 0xff, 0xa3, 0x03, 0x3f, 0x20, 0x60, 0xc0, 0xbf,
+    0x96, 0x00, 0xff, 0xa3, 0x03, 0xfc, 0x04, 0x06, 0x03, 0xbf, 0x96, 0x00, 0xff, 0xa3, 0x00, 0xff,
+    0xbf, 0x99, 0x00, 0xff, 0xa3, 0xc4, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01,
+    0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff,
+    0xc3, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81,
+    0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f, 0xc1, 0xc4, 0x81, 0x00, 0xff, 0xc3, 0x01, 0x01, 0x7f, 0xc1,
+    0xc4, 0x81, 0x00, 0xff, 0xc6, 0x01, 0x92,
+};
+
+const tOLEDImage IMG_74LSXX =
+{
+    128, 48, g_pui8Image74LSXX, sizeof(g_pui8Image74LSXX)
+};
+
+//
+// BMP_LOADING_EMPTY from loading_empty.c: 128 bytes, 8 compressed.
+//
+static const uint8_t g_pui8ImageLOADING_EMPTY[] =
+{
+    0x00, 0xff, 0xff, 0x81, 0xfd, 0x81, 0x00, 0xff,
+};
+
+const tOLEDImage IMG_LOADING_EMPTY =
+{
+    128, 8, g_pui8ImageLOADING_EMPTY, sizeof(g_pui8ImageLOADING_EMPTY)
+};
+
+//
+// BMP_UTFPR from utfpr_bar.c: 1024 bytes, 184 compressed.
+//
+static const uint8_t g_pui8ImageUTFPR[] =
+{
+    0xbf, 0xbf, 0x00, 0xfc, 0xc7, 0xfe, 0x8f, 0xf9, 0xfe, 0xac, 0xc8, 0xff, 0x8f, 0xc7, 0xff, 0x88,
+    0xc8, 0xff, 0xbf, 0x8c, 0xc8, 0xff, 0x8f, 0xc7, 0xff, 0x88, 0xc8, 0xff, 0x8a, 0xd4, 0xfe, 0x82,
+    0xc4, 0xfe, 0xc7, 0x3e, 0x05, 0xfe, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0x80, 0xc4, 0xfe, 0xc8, 0x3e,
+    0x05, 0x7e, 0xfe, 0xfc, 0xfc, 0xf8, 0xe0, 0x81, 0xc8, 0xff, 0x01, 0xf8, 0x80, 0x8b, 0x01, 0x80,
+    0xf8, 0xc7, 0xff, 0x88, 0xc8, 0xff, 0x8a, 0xc7, 0xff, 0x8f, 0xc4, 0xff, 0x00, 0xf8, 0xc5, 0xf0,
+    0x06, 0xf8, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x80, 0xc4, 0xff, 0xc2, 0x78, 0xc4, 0xf8, 0x06,
+    0xfc, 0xfe, 0x3f, 0x3f, 0x1f, 0x0f, 0x07, 0x82, 0x04, 0x07, 0x0f, 0x3f, 0x7f, 0x7f, 0xc4, 0xff,
+    0x02, 0xfe, 0xfc, 0xfc, 0xc5, 0xf8, 0x02, 0xfc, 0xfc, 0xfe, 0xc3, 0xff, 0x05, 0x7f, 0x7f, 0x3f,
+    0x1f, 0x07, 0x01, 0x88, 0xc8, 0xff, 0x8a, 0xc7, 0xff, 0x8f, 0xc4, 0xff, 0x00, 0x01, 0x8d, 0xc4,
+    0xff, 0x83, 0x0b, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xfe, 0xfc, 0xf8, 0xe0, 0xc0, 0x88,
+    0xc2, 0x01, 0xcb, 0x03, 0xc2, 0x01, 0x8f, 0xc8, 0x01, 0x8a, 0xc7, 0x01, 0x8f, 0xc4, 0x01, 0x8e,
+    0xc4, 0x01, 0x8a, 0xc4, 0x01, 0xbf, 0xbf, 0x80,
+};
+
+const tOLEDImage IMG_UTFPR =
+{
+    128, 64, g_pui8ImageUTFPR, sizeof(g_pui8ImageUTFPR)
+};
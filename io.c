@@ -23,6 +23,7 @@
 //*****************************************************************************
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 #include "inc/hw_ints.h"
 #include "inc/hw_memmap.h"
 #include "inc/hw_pwm.h"
@@ -34,11 +35,16 @@
 #include "driverlib/interrupt.h"
 #include "driverlib/rom.h"
 #include "utils/ustdlib.h"
+#include "FreeRTOS.h"
+#include "task.h"
 #include "io.h"
 extern bool systemOnline;
 extern bool automaticMode;
 extern uint32_t automaticModeSpeed;
 extern uint32_t manualModeSpeed;
+extern int32_t measuredFrequency;
+extern uint32_t pwmPulseWidth;
+extern uint32_t g_ui32IPAddress;
 extern uint32_t getSpeed();
 
 //*****************************************************************************
@@ -71,6 +77,17 @@ extern uint32_t g_ui32SysClock;
 //*****************************************************************************
 volatile unsigned long g_ulAnimSpeed = 10;
 
+//*****************************************************************************
+//
+// The task statistics gathered by the last call to io_update_task_stats(),
+// and the buffer the kernel fills in while gathering them.
+//
+//*****************************************************************************
+static tIOTaskStats g_psTaskStats[IO_MAX_TASKS];
+static uint32_t g_ui32NumTaskStats;
+static uint32_t g_ui32TotalTasks;
+static TaskStatus_t g_psTaskStatus[IO_MAX_TASKS];
+
 
 //*****************************************************************************
 //
@@ -110,6 +127,19 @@ io_get_ledstate(char * pcBuf, int iBufLen)
 
 }
 
+//*****************************************************************************
+//
+// Toggle the system on or off, along with the status LED.
+//
+//*****************************************************************************
+void
+io_toggle_led(void)
+{
+    systemOnline = !systemOnline;
+
+    io_set_led(!io_is_led_on());
+}
+
 //*****************************************************************************
 //
 // Return LED state as an integer, 1 on, 0 off.
@@ -177,6 +207,7 @@ io_set_animation_speed(unsigned long ulSpeed)
     if(ulSpeed <= 100)
     {
         g_ulAnimSpeed = ulSpeed;
+        manualModeSpeed = ulSpeed;
     }
 }
 
@@ -201,3 +232,84 @@ io_get_animation_speed(void)
 {
     return(g_ulAnimSpeed);
 }
+
+//*****************************************************************************
+//
+// Take a snapshot of the state shown on the web pages.
+//
+//*****************************************************************************
+void
+io_get_status(tIOStatus *psStatus)
+{
+    psStatus->ui32Speed = getSpeed();
+    psStatus->i32Frequency = measuredFrequency;
+    psStatus->bAutomatic = automaticMode;
+    psStatus->bLEDOn = io_is_led_on() ? true : false;
+}
+
+//*****************************************************************************
+//
+// Gather the statistics of the tasks.  Walking the task lists suspends the
+// scheduler for a while, so rather than on every web request this is called
+// periodically from a low priority task.
+//
+//*****************************************************************************
+void
+io_update_task_stats(void)
+{
+    UBaseType_t uxNumTasks, uxTotalTasks, uxIdx;
+
+    //
+    // This fails, returning 0, if there are more than IO_MAX_TASKS tasks.
+    // The number there are is then reported, so that the failure shows.
+    //
+    uxNumTasks = uxTaskGetSystemState(g_psTaskStatus, IO_MAX_TASKS, NULL);
+    uxTotalTasks = uxNumTasks ? uxNumTasks : uxTaskGetNumberOfTasks();
+
+    //
+    // Publish the new statistics with interrupts masked, so that a reader
+    // never sees them half updated.
+    //
+    taskENTER_CRITICAL();
+    for(uxIdx = 0; uxIdx < uxNumTasks; uxIdx++)
+    {
+        strncpy(g_psTaskStats[uxIdx].pcName,
+                g_psTaskStatus[uxIdx].pcTaskName, IO_TASK_NAME_LEN - 1);
+        g_psTaskStats[uxIdx].pcName[IO_TASK_NAME_LEN - 1] = '\0';
+        g_psTaskStats[uxIdx].ui16StackFree =
+            g_psTaskStatus[uxIdx].usStackHighWaterMark;
+        g_psTaskStats[uxIdx].ui8Priority =
+            g_psTaskStatus[uxIdx].uxCurrentPriority;
+        g_psTaskStats[uxIdx].ui8State = g_psTaskStatus[uxIdx].eCurrentState;
+    }
+    g_ui32NumTaskStats = uxNumTasks;
+    g_ui32TotalTasks = uxTotalTasks;
+    taskEXIT_CRITICAL();
+}
+
+//*****************************************************************************
+//
+// Take a snapshot of the state of the whole system.  This may be called from
+// a task or an interrupt handler.
+//
+//*****************************************************************************
+void
+io_get_system_status(tIOSystemStatus *psStatus)
+{
+    UBaseType_t uxSavedMask;
+
+    io_get_status(&psStatus->sStatus);
+    psStatus->ui32PulseWidth = pwmPulseWidth;
+    psStatus->ui32ADC = automaticModeSpeed;
+    psStatus->ui32IPAddress = (g_ui32IPAddress == 0xffffffff) ? 0 :
+                              g_ui32IPAddress;
+    psStatus->ui32Uptime = xTaskGetTickCountFromISR() * portTICK_PERIOD_MS;
+    psStatus->ui32FreeHeap = xPortGetFreeHeapSize();
+
+    uxSavedMask = taskENTER_CRITICAL_FROM_ISR();
+    psStatus->ui32NumTasks = g_ui32NumTaskStats;
+    psStatus->ui32TotalTasks = g_ui32TotalTasks;
+    memcpy(psStatus->psTasks, g_psTaskStats,
+           g_ui32NumTaskStats * sizeof(tIOTaskStats));
+    taskEXIT_CRITICAL_FROM_ISR(uxSavedMask);
+}
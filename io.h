@@ -37,13 +37,145 @@ extern "C"
 //*****************************************************************************
 extern volatile unsigned long g_ulAnimSpeed;
 
+//*****************************************************************************
+//
+// The state shown on the web pages, as returned by io_get_status().
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The current speed, in percent.
+    //
+    uint32_t ui32Speed;
+
+    //
+    // The last flow sensor frequency measured by the PWM task, in Hz.
+    //
+    int32_t i32Frequency;
+
+    //
+    // True if the speed setpoint follows the potentiometer (the ADC) rather
+    // than the value set from the web pages.
+    //
+    bool bAutomatic;
+
+    //
+    // True if the user LED is on.
+    //
+    bool bLEDOn;
+}
+tIOStatus;
+
+//*****************************************************************************
+//
+// The largest number of tasks reported by io_get_system_status().  There are
+// eight: the four started by enet_io.c, the lwIP TCP/IP and Ethernet
+// interrupt tasks and the FreeRTOS idle and timer tasks.  The rest is room
+// for more, since the kernel reports none at all if there are more tasks
+// than this.
+//
+//*****************************************************************************
+#define IO_MAX_TASKS            12
+
+//*****************************************************************************
+//
+// The space kept for the name of a task, including the terminating NULL.
+// Longer names are cut short.
+//
+//*****************************************************************************
+#define IO_TASK_NAME_LEN        10
+
+//*****************************************************************************
+//
+// The statistics of a task, as gathered by io_update_task_stats().
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The name of the task.
+    //
+    char pcName[IO_TASK_NAME_LEN];
+
+    //
+    // The smallest amount of stack, in words, that has been left unused.
+    //
+    uint16_t ui16StackFree;
+
+    //
+    // The priority of the task.
+    //
+    uint8_t ui8Priority;
+
+    //
+    // The state of the task, one of the eTaskState values.
+    //
+    uint8_t ui8State;
+}
+tIOTaskStats;
+
+//*****************************************************************************
+//
+// The state of the whole system, as returned by io_get_system_status().
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The state shown on the web pages.
+    //
+    tIOStatus sStatus;
+
+    //
+    // The pulse width of the PWM output, in PWM clock ticks out of
+    // PWM_PERIOD.
+    //
+    uint32_t ui32PulseWidth;
+
+    //
+    // The speed potentiometer, as filtered by the analog module
+    // (Analog_Get_Value()) and rounded to whole ADC counts, from 0 to 4095.
+    //
+    uint32_t ui32ADC;
+
+    //
+    // The IP address, in network byte order, or 0 if there is none.
+    //
+    uint32_t ui32IPAddress;
+
+    //
+    // The time since the scheduler started, in milliseconds.
+    //
+    uint32_t ui32Uptime;
+
+    //
+    // The free space in the FreeRTOS heap, in bytes.
+    //
+    uint32_t ui32FreeHeap;
+
+    //
+    // The statistics of the first ui32NumTasks tasks, as of the last call to
+    // io_update_task_stats(), and the number of tasks there were then.  If
+    // there were more than IO_MAX_TASKS, ui32NumTasks is 0.
+    //
+    uint32_t ui32NumTasks;
+    uint32_t ui32TotalTasks;
+    tIOTaskStats psTasks[IO_MAX_TASKS];
+}
+tIOSystemStatus;
+
 void io_set_led(bool bOn);
+void io_toggle_led(void);
 void io_get_ledstate(char *pcBuf, int iBufLen);
 void io_set_animation_speed_string(char *pcBuf);
 void io_get_animation_speed_string(char *pcBuf, int iBufLen);
 void io_set_animation_speed(unsigned long ulSpeedPercent);
 unsigned long io_get_animation_speed(void);
 int io_is_led_on(void);
+void io_get_status(tIOStatus *psStatus);
+void io_update_task_stats(void);
+void io_get_system_status(tIOSystemStatus *psStatus);
 
 #ifdef __cplusplus
 }
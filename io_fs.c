@@ -34,207 +34,1136 @@
 #include "httpserver_raw/fs.h"
 #include "httpserver_raw/fsdata.h"
 #include "io.h"
+#include "io_fs.h"
+#include "io_ws.h"
+#include "json.h"
+#include "main.h"
+#include "ssd1306.h"
+#include "oled_font.h"
+#include "oled_image.h"
+#include "oled_fb.h"
+#include "display_mirror.h"
+#include "boot.h"
+#include "timing.h"
 
 extern bool systemOnline;
 extern bool automaticMode;
 extern uint32_t automaticModeSpeed;
 extern uint32_t manualModeSpeed;
 extern uint32_t getSpeed();
+extern tTimingHistogram loopJitter;
+extern tTimingHistogram loopExec;
+extern void httpd_sse_broadcast(const char *pcData, u16_t ui16Len);
 
 
 //*****************************************************************************
 //
 // Include the web file system data for this application.  This file is
-// generated by the makefsfile utility, using the following command:
+// generated by the makefsdata.py utility, using the following command:
 //
-//     ../../../../tools/bin/makefsfile -i fs -o io_fsdata.h -r -h -q
+//     python3 tools/makefsdata.py -i fs -o io_fsdata.h
 //
 // If any changes are made to the static content of the web pages served by the
 // application, this script must be used to regenerate io_fsdata.h in order
-// for those changes to be picked up by the web server.
+// for those changes to be picked up by the web server.  The script also
+// stores a gzip-compressed variant (name + ".gz") of each HTML, JavaScript
+// and CSS file, which the web server sends to clients that accept it.
 //
 //*****************************************************************************
 #include "io_fsdata.h"
 
 //*****************************************************************************
 //
-// Open a file and return a handle to the file, if found.  Otherwise,
-// return NULL.  This function also looks for special file names used to
-// provide specific status information or to control various subsystems.
-// These file names are used by the JavaScript on the "IO Control Demo 1"
-// example web page.
+// The number of slots in the file name hash index.  This must be a power of
+// two and should be at least twice the number of names stored in the index so
+// that the probe sequences stay short (usually a single compare).
 //
 //*****************************************************************************
-struct fs_file *
-fs_open(const char *pcName)
+#define FS_INDEX_SIZE           64
+
+//*****************************************************************************
+//
+// A name that does not fit in the index could never be opened, so check at
+// build time that the files in the image, as counted by makefsdata.py, and
+// the largest number of dynamic files fill no more than half of the index.
+//
+//*****************************************************************************
+#ifndef FS_NUMFILES
+#error "io_fsdata.h has no FS_NUMFILES; regenerate it with tools/makefsdata.py"
+#endif
+
+#if (FS_INDEX_SIZE & (FS_INDEX_SIZE - 1)) != 0
+#error "FS_INDEX_SIZE must be a power of two"
+#endif
+
+#if ((FS_NUMFILES + IO_FS_MAX_HANDLERS) * 2) > FS_INDEX_SIZE
+#error "FS_INDEX_SIZE is too small for the files in io_fsdata.h"
+#endif
+
+//*****************************************************************************
+//
+// The parameter prefix expected by the set_speed request.
+//
+//*****************************************************************************
+#define SET_SPEED_PARAM         "percent="
+
+//*****************************************************************************
+//
+// The size of the buffer an event for the /events stream is formatted in.
+//
+//*****************************************************************************
+#define EVENT_SIZE              80
+
+//*****************************************************************************
+//
+// The minimum number of calls to io_fs_events_poll() between two events that
+// only report a new speed or frequency.  Both follow the measured input and
+// may change on every call, while LED and mode changes are sent right away.
+//
+//*****************************************************************************
+#define EVENT_HOLDOFF           5
+
+//*****************************************************************************
+//
+// The header of /display.pbm, a binary PBM image of the display.
+//
+//*****************************************************************************
+#define DISPLAY_PBM_HEADER      "P4\n128 64\n"
+
+//*****************************************************************************
+//
+// The snapshot /display.json is generated from: the number of the latest
+// frame, the number of lines drawn and the latest of them, as many as fit.
+//
+//*****************************************************************************
+#define DISPLAY_JSON_LINES      ((IO_FS_STATE_SIZE - (3 * sizeof(uint32_t))) / \
+                                 sizeof(tDisplayMirrorLine))
+
+typedef struct
+{
+    uint32_t ui32Frame;
+    uint32_t ui32Lines;
+    uint32_t ui32NumLines;
+    tDisplayMirrorLine psLines[DISPLAY_JSON_LINES];
+}
+tDisplaySnapshot;
+
+//*****************************************************************************
+//
+// A single slot of the file name hash index.  Static files point at their
+// node in the file system image, while dynamic files carry the number of
+// their entry in the dynamic file table plus one (zero marks a static file).
+//
+//*****************************************************************************
+typedef struct
+{
+    const char *pcName;
+    uint32_t ui32Hash;
+    const struct fsdata_file *psFile;
+    uint32_t ui32Handler;
+}
+tFSIndexEntry;
+
+//*****************************************************************************
+//
+// A registered dynamic file.  A file generated into a response buffer has a
+// handler; a streamed file has a snapshot and a writer function instead.
+//
+//*****************************************************************************
+typedef struct
+{
+    tIOFSHandler pfnHandler;
+    tIOFSSnapshot pfnSnapshot;
+    tIOFSWriter pfnWriter;
+}
+tFSDynamicFile;
+
+//*****************************************************************************
+//
+// An open file handle.  The fs_file structure must be the first member so
+// that the handle can be recovered from the pointer returned by fs_open().
+// Each handle owns its own response buffer, so dynamic files being generated
+// for different connections never share storage.  A streamed file keeps its
+// snapshot there instead, and psStream points at its entry in the dynamic
+// file table.
+//
+//*****************************************************************************
+typedef struct tFSHandle
+{
+    struct fs_file sFile;
+    struct tFSHandle *psNext;
+    const tFSDynamicFile *psStream;
+    union
+    {
+        char pcBuf[IO_FS_RESPONSE_SIZE];
+        uint32_t pui32State[(IO_FS_STATE_SIZE + 3) / 4];
+    }
+    uData;
+}
+tFSHandle;
+
+//*****************************************************************************
+//
+// The file name hash index, built from the file system image by io_fs_init()
+// before any dynamic file is registered or any file is opened.
+//
+//*****************************************************************************
+static tFSIndexEntry g_psFSIndex[FS_INDEX_SIZE];
+
+//*****************************************************************************
+//
+// The registered dynamic files.
+//
+//*****************************************************************************
+static tFSDynamicFile g_psDynamicFiles[IO_FS_MAX_HANDLERS];
+static uint32_t g_ui32NumHandlers = 0;
+
+//*****************************************************************************
+//
+// The names of the task states reported by /status.json, in the order of the
+// eTaskState values.
+//
+//*****************************************************************************
+static const char * const g_ppcTaskStates[] =
+{
+    "running", "ready", "blocked", "suspended", "deleted"
+};
+
+//*****************************************************************************
+//
+// The pool of file handles and the list of the handles that are free.
+//
+//*****************************************************************************
+static tFSHandle g_psHandles[IO_FS_MAX_OPEN_FILES];
+static tFSHandle *g_psFreeHandles = NULL;
+static bool g_bHandlesInit = false;
+
+//*****************************************************************************
+//
+// Compute the 32-bit FNV-1a hash of a file name.  The name ends at either a
+// NULL or the '?' that starts the request parameters.  The length of the
+// name is returned through pui32Len.
+//
+//*****************************************************************************
+static uint32_t
+FSNameHash(const char *pcName, uint32_t *pui32Len)
+{
+    uint32_t ui32Hash, ui32Len;
+
+    ui32Hash = 2166136261u;
+    for(ui32Len = 0; pcName[ui32Len] && (pcName[ui32Len] != '?'); ui32Len++)
+    {
+        ui32Hash ^= (uint8_t)pcName[ui32Len];
+        ui32Hash *= 16777619u;
+    }
+
+    *pui32Len = ui32Len;
+    return(ui32Hash);
+}
+
+//*****************************************************************************
+//
+// Add a name to the hash index using linear probing.  Returns false if the
+// index is full.
+//
+//*****************************************************************************
+static bool
+FSIndexAdd(const char *pcName, const struct fsdata_file *psFile,
+           uint32_t ui32Handler)
+{
+    uint32_t ui32Hash, ui32Len, ui32Idx, ui32Probe;
+
+    ui32Hash = FSNameHash(pcName, &ui32Len);
+    ui32Idx = ui32Hash & (FS_INDEX_SIZE - 1);
+
+    for(ui32Probe = 0; ui32Probe < FS_INDEX_SIZE; ui32Probe++)
+    {
+        if(g_psFSIndex[ui32Idx].pcName == NULL)
+        {
+            g_psFSIndex[ui32Idx].pcName = pcName;
+            g_psFSIndex[ui32Idx].ui32Hash = ui32Hash;
+            g_psFSIndex[ui32Idx].psFile = psFile;
+            g_psFSIndex[ui32Idx].ui32Handler = ui32Handler;
+            return(true);
+        }
+
+        ui32Idx = (ui32Idx + 1) & (FS_INDEX_SIZE - 1);
+    }
+
+    return(false);
+}
+
+//*****************************************************************************
+//
+// Build the hash index over all the files in the file system image.  The
+// image is constant, so this is only done once, by io_fs_init().
+//
+//*****************************************************************************
+static void
+FSIndexBuild(void)
 {
     const struct fsdata_file *psTree;
-    struct fs_file *psFile = NULL;
 
-    //
-    // Allocate memory for the file system structure.
-    //
-    psFile = mem_malloc(sizeof(struct fs_file));
-    if(psFile == NULL)
+    for(psTree = FS_ROOT; psTree != NULL; psTree = psTree->next)
     {
-        return(NULL);
+        if(!FSIndexAdd((const char *)psTree->name, psTree, 0))
+        {
+            //
+            // The index is full.  This cannot happen as long as FS_NUMFILES
+            // counts the files in the image, which is checked at build time.
+            //
+            LWIP_ASSERT("FS_INDEX_SIZE too small", 0);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Find a file name in the hash index.  The name may be followed by request
+// parameters, which are ignored.  Returns NULL if the name is unknown.
+//
+//*****************************************************************************
+static const tFSIndexEntry *
+FSIndexLookup(const char *pcName)
+{
+    uint32_t ui32Hash, ui32Len, ui32Idx, ui32Probe;
+    const char *pcEntry;
+
+    ui32Hash = FSNameHash(pcName, &ui32Len);
+    ui32Idx = ui32Hash & (FS_INDEX_SIZE - 1);
+
+    for(ui32Probe = 0; ui32Probe < FS_INDEX_SIZE; ui32Probe++)
+    {
+        pcEntry = g_psFSIndex[ui32Idx].pcName;
+        if(pcEntry == NULL)
+        {
+            break;
+        }
+
+        if((g_psFSIndex[ui32Idx].ui32Hash == ui32Hash) &&
+           (ustrncmp(pcName, pcEntry, ui32Len) == 0) &&
+           (pcEntry[ui32Len] == '\0'))
+        {
+            return(&g_psFSIndex[ui32Idx]);
+        }
+
+        ui32Idx = (ui32Idx + 1) & (FS_INDEX_SIZE - 1);
+    }
+
+    return(NULL);
+}
+
+//*****************************************************************************
+//
+// Take a handle from the pool.  Returns NULL if all handles are in use.
+//
+//*****************************************************************************
+static tFSHandle *
+FSHandleAlloc(void)
+{
+    tFSHandle *psHandle;
+    uint32_t ui32Idx;
+    SYS_ARCH_DECL_PROTECT(lev);
+
+    SYS_ARCH_PROTECT(lev);
+
+    if(!g_bHandlesInit)
+    {
+        for(ui32Idx = 0; ui32Idx < IO_FS_MAX_OPEN_FILES; ui32Idx++)
+        {
+            g_psHandles[ui32Idx].psNext = g_psFreeHandles;
+            g_psFreeHandles = &g_psHandles[ui32Idx];
+        }
+        g_bHandlesInit = true;
+    }
+
+    psHandle = g_psFreeHandles;
+    if(psHandle != NULL)
+    {
+        g_psFreeHandles = psHandle->psNext;
     }
 
+    SYS_ARCH_UNPROTECT(lev);
+
+    return(psHandle);
+}
+
+//*****************************************************************************
+//
+// Return a handle to the pool.
+//
+//*****************************************************************************
+static void
+FSHandleFree(tFSHandle *psHandle)
+{
+    SYS_ARCH_DECL_PROTECT(lev);
+
+    SYS_ARCH_PROTECT(lev);
+    psHandle->psNext = g_psFreeHandles;
+    g_psFreeHandles = psHandle;
+    SYS_ARCH_UNPROTECT(lev);
+}
+
+//*****************************************************************************
+//
+// Process request to toggle STATUS LED.
+//
+//*****************************************************************************
+static int
+ToggleLEDHandler(const char *pcParams, char *pcBuf, int iBufLen)
+{
     //
-    // Process request to toggle STATUS LED
+    // Toggle the system and the STATUS LED
     //
-    if(ustrncmp(pcName, "/cgi-bin/toggle_led", 19) == 0)
-    {
-        static char pcBuf[4];
+    io_toggle_led();
 
-        systemOnline = !systemOnline;
-        //
-        // Toggle the STATUS LED
-        //
-        io_set_led(!io_is_led_on());
+    //
+    // Get the new state of the LED
+    //
+    io_get_ledstate(pcBuf, iBufLen);
 
-        //
-        // Get the new state of the LED
-        //
-        io_get_ledstate(pcBuf, 4);
+    return(ustrlen(pcBuf));
+}
 
-        psFile->data = pcBuf;
-        psFile->len = strlen(pcBuf);
-        psFile->index = psFile->len;
-        psFile->pextension = NULL;
+//*****************************************************************************
+//
+// Request for the animation speed.
+//
+//*****************************************************************************
+static int
+GetSpeedHandler(const char *pcParams, char *pcBuf, int iBufLen)
+{
+    automaticMode = true;
 
+    //
+    // Get the current animation speed as a string.
+    //
+    io_get_animation_speed_string(pcBuf, iBufLen);
+
+    return(ustrlen(pcBuf));
+}
+
+//*****************************************************************************
+//
+// Set the animation speed.
+//
+//*****************************************************************************
+static int
+SetSpeedHandler(const char *pcParams, char *pcBuf, int iBufLen)
+{
+    automaticMode = false;
+
+    if(ustrncmp(pcParams, SET_SPEED_PARAM, sizeof(SET_SPEED_PARAM) - 1) == 0)
+    {
         //
-        // Return the psFile system pointer.
+        // Extract the parameter and set the actual speed requested.
         //
-        return(psFile);
+        io_set_animation_speed_string((char *)pcParams +
+                                      sizeof(SET_SPEED_PARAM) - 1);
     }
 
     //
-    // Request for LED State?
+    // Get the current speed setting as a string to send back.
     //
-    else if(ustrncmp(pcName, "/ledstate", 9) == 0)
-    {
-        static char pcBuf[4];
+    io_get_animation_speed_string(pcBuf, iBufLen);
 
-        //
-        // Get the state of the LED
-        //
-        io_get_ledstate(pcBuf, 4);
+    return(ustrlen(pcBuf));
+}
+
+//*****************************************************************************
+//
+// Take the snapshot of the system that /status.json is generated from.
+//
+//*****************************************************************************
+static void
+StatusSnapshot(void *pvState)
+{
+    io_get_system_status((tIOSystemStatus *)pvState);
+}
+
+//*****************************************************************************
+//
+// Generate /status.json from a snapshot of the system.
+//
+//*****************************************************************************
+static uint32_t
+StatusWrite(const void *pvState, char *pcBuf, uint32_t ui32Skip,
+            uint32_t ui32Size)
+{
+    const tIOSystemStatus *psStatus;
+    const tIOTaskStats *psTask;
+    tJSONWriter sWriter;
+    char pcIP[16];
+    uint32_t ui32Idx;
+
+    psStatus = (const tIOSystemStatus *)pvState;
+
+    usnprintf(pcIP, sizeof(pcIP), "%d.%d.%d.%d",
+              psStatus->ui32IPAddress & 0xff,
+              (psStatus->ui32IPAddress >> 8) & 0xff,
+              (psStatus->ui32IPAddress >> 16) & 0xff,
+              (psStatus->ui32IPAddress >> 24) & 0xff);
+
+    JSONInit(&sWriter, pcBuf, ui32Skip, ui32Size);
+    JSONObjectStart(&sWriter, NULL);
 
-        psFile->data = pcBuf;
-        psFile->len = strlen(pcBuf);
-        psFile->index = psFile->len;
-        psFile->pextension = NULL;
-        return(psFile);
-    }
     //
-    // Request for the animation speed?
+    // The members shared with the /events stream come first, under the same
+    // names.
     //
-    else if(ustrncmp(pcName, "/get_speed", 10) == 0)
-    {
-        automaticMode = true;
+    JSONUInt(&sWriter, "speed", psStatus->sStatus.ui32Speed);
+    JSONInt(&sWriter, "freq", psStatus->sStatus.i32Frequency);
+    JSONBool(&sWriter, "auto", psStatus->sStatus.bAutomatic);
+    JSONBool(&sWriter, "led", psStatus->sStatus.bLEDOn);
 
-        static char pcBuf[6];
+    JSONObjectStart(&sWriter, "pwm");
+    JSONUInt(&sWriter, "pulse", psStatus->ui32PulseWidth);
+    JSONUInt(&sWriter, "period", PWM_PERIOD);
+    JSONObjectEnd(&sWriter);
 
-        //
-        // Get the current animation speed as a string.
-        //
-        io_get_animation_speed_string(pcBuf, 6);
+    JSONUInt(&sWriter, "adc", psStatus->ui32ADC);
+    JSONString(&sWriter, "ip", pcIP);
+    JSONUInt(&sWriter, "uptime", psStatus->ui32Uptime);
+    JSONUInt(&sWriter, "heap", psStatus->ui32FreeHeap);
 
-        psFile->data = pcBuf;
-        psFile->len = strlen(pcBuf);
-        psFile->index = psFile->len;
-        psFile->pextension = NULL;
-        return(psFile);
+    JSONArrayStart(&sWriter, "tasks");
+    for(ui32Idx = 0; ui32Idx < psStatus->ui32NumTasks; ui32Idx++)
+    {
+        psTask = &psStatus->psTasks[ui32Idx];
+
+        JSONObjectStart(&sWriter, NULL);
+        JSONString(&sWriter, "name", psTask->pcName);
+        JSONString(&sWriter, "state",
+                   (psTask->ui8State < (sizeof(g_ppcTaskStates) /
+                                        sizeof(g_ppcTaskStates[0]))) ?
+                   g_ppcTaskStates[psTask->ui8State] : NULL);
+        JSONUInt(&sWriter, "priority", psTask->ui8Priority);
+        JSONUInt(&sWriter, "stack", psTask->ui16StackFree);
+        JSONObjectEnd(&sWriter);
     }
+    JSONArrayEnd(&sWriter);
+
     //
-    // Set the animation speed?
+    // The list is empty rather than cut short if there are more tasks than
+    // it has room for: say so, with the number there are.
     //
-    else if(ustrncmp(pcName, "/cgi-bin/set_speed?percent=", 12) == 0)
+    JSONUInt(&sWriter, "task_count", psStatus->ui32TotalTasks);
+    JSONBool(&sWriter, "tasks_truncated",
+             psStatus->ui32NumTasks < psStatus->ui32TotalTasks);
+
+    JSONObjectEnd(&sWriter);
+
+    return(JSONLength(&sWriter));
+}
+
+//*****************************************************************************
+//
+// Take the snapshot of the display that /display.pbm is generated from: the
+// number of the latest frame in the display mirror.
+//
+//*****************************************************************************
+static void
+DisplayPBMSnapshot(void *pvState)
+{
+    *(uint32_t *)pvState = Display_Mirror_Frame_Count();
+}
+
+//*****************************************************************************
+//
+// Generate /display.pbm from a frame of the display mirror.  The image has a
+// row of pixels per 16 bytes, the leftmost pixel in the most significant bit,
+// and a set bit is black, so lit pixels are cleared.  If the display task
+// publishes two more frames while the image is sent, the image may mix them.
+//
+//*****************************************************************************
+static uint32_t
+DisplayPBMWrite(const void *pvState, char *pcBuf, uint32_t ui32Skip,
+                uint32_t ui32Size)
+{
+    uint32_t ui32Frame, ui32Pos, ui32End, ui32Row, ui32Col, ui32Bit;
+    uint8_t ui8Byte, ui8Column;
+
+    ui32Frame = *(const uint32_t *)pvState;
+    ui32End = ui32Skip + ui32Size;
+
+    for(ui32Pos = ui32Skip; ui32Pos < ui32End; ui32Pos++)
     {
-        automaticMode = false;
-        static char pcBuf[6];
+        if(ui32Pos < (sizeof(DISPLAY_PBM_HEADER) - 1))
+        {
+            *pcBuf++ = DISPLAY_PBM_HEADER[ui32Pos];
+            continue;
+        }
 
-        //
-        // Extract the parameter and set the actual speed requested.
-        //
-        io_set_animation_speed_string((char*)pcName + 27);
+        ui32Row = (ui32Pos - (sizeof(DISPLAY_PBM_HEADER) - 1)) /
+                  (OLED_FB_WIDTH / 8);
+        ui32Col = ((ui32Pos - (sizeof(DISPLAY_PBM_HEADER) - 1)) %
+                   (OLED_FB_WIDTH / 8)) * 8;
+        if(ui32Row >= OLED_FB_HEIGHT)
+        {
+            break;
+        }
+
+        ui8Byte = 0;
+        for(ui32Bit = 0; ui32Bit < 8; ui32Bit++)
+        {
+            ui8Column = Display_Mirror_Frame_Byte(ui32Frame,
+                                                  ((ui32Row / 8) *
+                                                   OLED_FB_WIDTH) +
+                                                  ui32Col + ui32Bit);
+            if(!(ui8Column & (1 << (ui32Row % 8))))
+            {
+                ui8Byte |= 0x80 >> ui32Bit;
+            }
+        }
+        *pcBuf++ = ui8Byte;
+    }
+
+    return((sizeof(DISPLAY_PBM_HEADER) - 1) +
+           ((OLED_FB_WIDTH / 8) * OLED_FB_HEIGHT));
+}
+
+//*****************************************************************************
+//
+// Take the snapshot of the display that /display.json is generated from.
+// The lines are copied, since the display task may overwrite them in the
+// mirror at any time; a line that is overwritten while it is copied is left
+// out along with the lines before it.
+//
+//*****************************************************************************
+static void
+DisplayJSONSnapshot(void *pvState)
+{
+    tDisplaySnapshot *psSnapshot;
+    uint32_t ui32Line;
+
+    psSnapshot = (tDisplaySnapshot *)pvState;
+    psSnapshot->ui32Frame = Display_Mirror_Frame_Count();
+    psSnapshot->ui32Lines = Display_Mirror_Line_Count();
+    psSnapshot->ui32NumLines = 0;
+
+    ui32Line = 0;
+    if(psSnapshot->ui32Lines > DISPLAY_JSON_LINES)
+    {
+        ui32Line = psSnapshot->ui32Lines - DISPLAY_JSON_LINES;
+    }
+
+    for(; ui32Line < psSnapshot->ui32Lines; ui32Line++)
+    {
+        if(!Display_Mirror_Read_Line(ui32Line,
+                                     &psSnapshot->psLines[psSnapshot->
+                                                          ui32NumLines]))
+        {
+            psSnapshot->ui32NumLines = 0;
+            continue;
+        }
+        psSnapshot->ui32NumLines++;
+    }
+}
+
+//*****************************************************************************
+//
+// Generate /display.json from a snapshot of the display.
+//
+//*****************************************************************************
+static uint32_t
+DisplayJSONWrite(const void *pvState, char *pcBuf, uint32_t ui32Skip,
+                 uint32_t ui32Size)
+{
+    const tDisplaySnapshot *psSnapshot;
+    const tDisplayMirrorLine *psLine;
+    tJSONWriter sWriter;
+    uint32_t ui32Idx;
+
+    psSnapshot = (const tDisplaySnapshot *)pvState;
+
+    JSONInit(&sWriter, pcBuf, ui32Skip, ui32Size);
+    JSONObjectStart(&sWriter, NULL);
+
+    JSONUInt(&sWriter, "frame", psSnapshot->ui32Frame);
+    JSONUInt(&sWriter, "count", psSnapshot->ui32Lines);
+
+    JSONArrayStart(&sWriter, "lines");
+    for(ui32Idx = 0; ui32Idx < psSnapshot->ui32NumLines; ui32Idx++)
+    {
+        psLine = &psSnapshot->psLines[ui32Idx];
+
+        JSONObjectStart(&sWriter, NULL);
+        JSONUInt(&sWriter, "n", psSnapshot->ui32Lines -
+                 psSnapshot->ui32NumLines + ui32Idx);
+        JSONUInt(&sWriter, "x", psLine->ui8X);
+        JSONUInt(&sWriter, "y", psLine->ui8Y);
+        JSONString(&sWriter, "text", psLine->pcText);
+        JSONObjectEnd(&sWriter);
+    }
+    JSONArrayEnd(&sWriter);
+
+    JSONObjectEnd(&sWriter);
+
+    return(JSONLength(&sWriter));
+}
+
+//*****************************************************************************
+//
+// The histograms of the control loop timing that /loop.json is generated
+// from.
+//
+//*****************************************************************************
+typedef struct
+{
+    tTimingHistogram sJitter;
+    tTimingHistogram sExec;
+}
+tLoopSnapshot;
+
+//*****************************************************************************
+//
+// Take the snapshot of the control loop timing that /loop.json is generated
+// from.
+//
+//*****************************************************************************
+static void
+LoopSnapshot(void *pvState)
+{
+    tLoopSnapshot *psLoop;
+
+    psLoop = (tLoopSnapshot *)pvState;
+
+    TimingHistogramGet(&loopJitter, &psLoop->sJitter);
+    TimingHistogramGet(&loopExec, &psLoop->sExec);
+}
+
+//*****************************************************************************
+//
+// Write one histogram of /loop.json: the number of passes, their average and
+// longest time and the count in each bin.
+//
+//*****************************************************************************
+static void
+LoopWriteHistogram(tJSONWriter *psWriter, const char *pcKey,
+                   const tTimingHistogram *psHistogram)
+{
+    uint32_t ui32Bin, ui32Count;
 
+    ui32Count = 0;
+    for(ui32Bin = 0; ui32Bin < TIMING_HISTOGRAM_BINS; ui32Bin++)
+    {
+        ui32Count += psHistogram->pui32Bins[ui32Bin];
+    }
+
+    JSONObjectStart(psWriter, pcKey);
+    JSONUInt(psWriter, "count", ui32Count);
+    JSONUInt(psWriter, "avg_us",
+             ui32Count ? (uint32_t)(psHistogram->ui64TotalUs / ui32Count) : 0);
+    JSONUInt(psWriter, "max_us", psHistogram->ui32MaxUs);
+    JSONArrayStart(psWriter, "counts");
+    for(ui32Bin = 0; ui32Bin < TIMING_HISTOGRAM_BINS; ui32Bin++)
+    {
+        JSONUInt(psWriter, NULL, psHistogram->pui32Bins[ui32Bin]);
+    }
+    JSONArrayEnd(psWriter);
+    JSONObjectEnd(psWriter);
+}
+
+//*****************************************************************************
+//
+// Generate /loop.json from the control loop timing since boot: how far each
+// pass of the loop started from a period after the one before, and how long
+// each took.  "bin_us" holds the lower bound of each bin in microseconds, and
+// the counts of each histogram follow in the same order.
+//
+//*****************************************************************************
+static uint32_t
+LoopWrite(const void *pvState, char *pcBuf, uint32_t ui32Skip,
+          uint32_t ui32Size)
+{
+    const tLoopSnapshot *psLoop;
+    tJSONWriter sWriter;
+    uint32_t ui32Bin;
+
+    psLoop = (const tLoopSnapshot *)pvState;
+
+    JSONInit(&sWriter, pcBuf, ui32Skip, ui32Size);
+    JSONObjectStart(&sWriter, NULL);
+
+    JSONUInt(&sWriter, "period_us", CONTROL_PERIOD_MS * 1000);
+    JSONArrayStart(&sWriter, "bin_us");
+    for(ui32Bin = 0; ui32Bin < TIMING_HISTOGRAM_BINS; ui32Bin++)
+    {
+        JSONUInt(&sWriter, NULL, TimingHistogramBinUs(ui32Bin));
+    }
+    JSONArrayEnd(&sWriter);
+
+    LoopWriteHistogram(&sWriter, "jitter", &psLoop->sJitter);
+    LoopWriteHistogram(&sWriter, "exec", &psLoop->sExec);
+
+    JSONObjectEnd(&sWriter);
+
+    return(JSONLength(&sWriter));
+}
+
+//*****************************************************************************
+//
+// Take the snapshot of the boot trace that /boot.json is generated from.
+//
+//*****************************************************************************
+static void
+BootSnapshot(void *pvState)
+{
+    Boot_Get_Trace((tBootTrace *)pvState);
+}
+
+//*****************************************************************************
+//
+// Generate /boot.json from the boot trace: the stages reached so far, in
+// order, with the time they were reached at in microseconds since the system
+// clock was set up.
+//
+//*****************************************************************************
+static uint32_t
+BootWrite(const void *pvState, char *pcBuf, uint32_t ui32Skip,
+          uint32_t ui32Size)
+{
+    const tBootTrace *psTrace;
+    tJSONWriter sWriter;
+    uint32_t ui32Stage;
+
+    psTrace = (const tBootTrace *)pvState;
+
+    JSONInit(&sWriter, pcBuf, ui32Skip, ui32Size);
+    JSONObjectStart(&sWriter, NULL);
+
+    JSONArrayStart(&sWriter, "stages");
+    for(ui32Stage = 0; ui32Stage < BOOT_NUM_STAGES; ui32Stage++)
+    {
+        if(!(psTrace->ui32Reached & (1 << ui32Stage)))
+        {
+            continue;
+        }
+
+        JSONObjectStart(&sWriter, NULL);
+        JSONString(&sWriter, "name", Boot_Stage_Name(ui32Stage));
+        JSONUInt(&sWriter, "us", psTrace->pui32Us[ui32Stage]);
+        JSONObjectEnd(&sWriter);
+    }
+    JSONArrayEnd(&sWriter);
+
+    JSONObjectEnd(&sWriter);
+
+    return(JSONLength(&sWriter));
+}
+
+//*****************************************************************************
+//
+// The state sent with the last event and the number of calls to
+// io_fs_events_poll() since it was sent.
+//
+//*****************************************************************************
+static tIOStatus g_sEventStatus;
+static bool g_bEventSent = false;
+static uint32_t g_ui32EventAge;
+
+//*****************************************************************************
+//
+// Format the state as an event for the /events stream.  Returns the length of
+// the event, or 0 if it does not fit in the buffer.
+//
+//*****************************************************************************
+static u16_t
+EventFormat(const tIOStatus *psStatus, char *pcBuf, u16_t ui16Len)
+{
+    int iLen;
+
+    iLen = usnprintf(pcBuf, ui16Len,
+                     "data: {\"speed\":%u,\"freq\":%d,\"auto\":%d,"
+                     "\"led\":%d}\n\n", psStatus->ui32Speed,
+                     psStatus->i32Frequency, psStatus->bAutomatic ? 1 : 0,
+                     psStatus->bLEDOn ? 1 : 0);
+
+    return(((iLen > 0) && (iLen < ui16Len)) ? (u16_t)iLen : 0);
+}
+
+//*****************************************************************************
+//
+// Called by the web server at the end of every response.  The first one
+// ends the boot trace.
+//
+//*****************************************************************************
+void
+httpd_response_sent(void)
+{
+    Boot_Mark(BOOT_STAGE_HTTP);
+}
+
+//*****************************************************************************
+//
+// Called by the web server for a client that has just connected to the
+// /events stream, or one that could not take the last event: format the
+// current state into pcBuf.
+//
+//*****************************************************************************
+u16_t
+httpd_sse_snapshot(char *pcBuf, u16_t ui16Len)
+{
+    tIOStatus sStatus;
+
+    io_get_status(&sStatus);
+
+    return(EventFormat(&sStatus, pcBuf, ui16Len));
+}
+
+//*****************************************************************************
+//
+// Send the state to the /events and WebSocket clients if it has changed.
+// This must be called periodically from the lwIP context.
+//
+//*****************************************************************************
+void
+io_fs_events_poll(void)
+{
+    tIOStatus sStatus;
+    char pcBuf[EVENT_SIZE];
+    u16_t ui16Len;
+
+    io_get_status(&sStatus);
+    g_ui32EventAge++;
+
+    if(g_bEventSent && (sStatus.bLEDOn == g_sEventStatus.bLEDOn) &&
+       (sStatus.bAutomatic == g_sEventStatus.bAutomatic))
+    {
         //
-        // Get the current speed setting as a string to send back.
+        // Only the speed and frequency may have changed.  Hold them back
+        // until enough time has passed since the last event.
         //
-        io_get_animation_speed_string(pcBuf, 6);
+        if(((sStatus.ui32Speed == g_sEventStatus.ui32Speed) &&
+            (sStatus.i32Frequency == g_sEventStatus.i32Frequency)) ||
+           (g_ui32EventAge < EVENT_HOLDOFF))
+        {
+            return;
+        }
+    }
 
-        psFile->data = pcBuf;
-        psFile->len = strlen(pcBuf);
-        psFile->index = psFile->len;
-        psFile->pextension = NULL;
-        return(psFile);
+    g_sEventStatus = sStatus;
+    g_bEventSent = true;
+    g_ui32EventAge = 0;
+
+    ui16Len = EventFormat(&sStatus, pcBuf, sizeof(pcBuf));
+    if(ui16Len)
+    {
+        httpd_sse_broadcast(pcBuf, ui16Len);
+    }
+
+    io_ws_send_status();
+}
+
+//*****************************************************************************
+//
+// Add a dynamic file to the index and the dynamic file table.  Returns false
+// if the name is already in use or there is no room left for another file.
+//
+//*****************************************************************************
+static bool
+FSRegister(const char *pcName, tIOFSHandler pfnHandler,
+           tIOFSSnapshot pfnSnapshot, tIOFSWriter pfnWriter)
+{
+    tFSDynamicFile *psDynamic;
+
+    if((g_ui32NumHandlers == IO_FS_MAX_HANDLERS) ||
+       (FSIndexLookup(pcName) != NULL))
+    {
+        return(false);
+    }
+
+    if(!FSIndexAdd(pcName, NULL, g_ui32NumHandlers + 1))
+    {
+        return(false);
+    }
+
+    psDynamic = &g_psDynamicFiles[g_ui32NumHandlers++];
+    psDynamic->pfnHandler = pfnHandler;
+    psDynamic->pfnSnapshot = pfnSnapshot;
+    psDynamic->pfnWriter = pfnWriter;
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Register a dynamic file.  Requests for pcName are answered by calling
+// pfnHandler, which generates the response into a buffer owned by the
+// request.  This must be called after io_fs_init().  The name string must
+// remain valid for as long as the file system is in use.  Returns false if
+// the name is already in use or there is no room left for another handler.
+//
+//*****************************************************************************
+bool
+io_fs_register(const char *pcName, tIOFSHandler pfnHandler)
+{
+    return(FSRegister(pcName, pfnHandler, NULL, NULL));
+}
+
+//*****************************************************************************
+//
+// Register a streamed file.  When pcName is opened, pfnSnapshot stores the
+// state the file shows (ui32StateSize bytes) in the open file, and pfnWriter
+// then generates the file from it a block at a time, straight into the send
+// buffer of the web server, so the file is not limited to the size of a
+// response buffer.  This must be called after io_fs_init().  Returns false if
+// the name is already in use, there is no room left for another handler or
+// the state does not fit in an open file.
+//
+//*****************************************************************************
+bool
+io_fs_register_stream(const char *pcName, uint32_t ui32StateSize,
+                      tIOFSSnapshot pfnSnapshot, tIOFSWriter pfnWriter)
+{
+    if(ui32StateSize > IO_FS_STATE_SIZE)
+    {
+        return(false);
     }
+
+    return(FSRegister(pcName, NULL, pfnSnapshot, pfnWriter));
+}
+
+//*****************************************************************************
+//
+// Build the file name index over the file system image and register the
+// dynamic files used by the JavaScript on the "IO Control Demo 1" example web
+// page.  This must be called once, before the web server is started.
+// Returns false if any of the files could not be registered, in which case
+// requests for it get a 404 response.
+//
+//*****************************************************************************
+bool
+io_fs_init(void)
+{
+    bool bOK;
+
+    FSIndexBuild();
+
+    bOK = io_fs_register("/cgi-bin/toggle_led", ToggleLEDHandler);
+    bOK &= io_fs_register("/get_speed", GetSpeedHandler);
+    bOK &= io_fs_register("/cgi-bin/set_speed", SetSpeedHandler);
+    bOK &= io_fs_register_stream("/status.json", sizeof(tIOSystemStatus),
+                                 StatusSnapshot, StatusWrite);
+    bOK &= io_fs_register_stream("/display.pbm", sizeof(uint32_t),
+                                 DisplayPBMSnapshot, DisplayPBMWrite);
+    bOK &= io_fs_register_stream("/display.json", sizeof(tDisplaySnapshot),
+                                 DisplayJSONSnapshot, DisplayJSONWrite);
+    bOK &= io_fs_register_stream("/boot.json", sizeof(tBootTrace),
+                                 BootSnapshot, BootWrite);
+    bOK &= io_fs_register_stream("/loop.json", sizeof(tLoopSnapshot),
+                                 LoopSnapshot, LoopWrite);
+
+    LWIP_ASSERT("io_fs_init: a dynamic file could not be registered", bOK);
+
+    return(bOK);
+}
+
+//*****************************************************************************
+//
+// Open a file and return a handle to the file, if found.  Otherwise,
+// return NULL.  Names registered with io_fs_register() are generated on the
+// fly by their handler, which receives any parameters that follow a '?' in
+// the name.
+//
+// The name is resolved through a hash index, so a lookup costs one hash and
+// normally a single string compare regardless of the number of files.
+//
+//*****************************************************************************
+struct fs_file *
+fs_open(const char *pcName)
+{
+    const tFSIndexEntry *psEntry;
+    const tFSDynamicFile *psDynamic;
+    tFSHandle *psHandle;
+    struct fs_file *psFile;
+    const char *pcParams;
+    int iLen;
+
     //
-    // If I can't find it there, look in the rest of the main psFile system
+    // Look the name up before allocating anything, so that misses (which
+    // the web server generates while probing for default and error pages)
+    // are cheap.
     //
-    else
+    psEntry = FSIndexLookup(pcName);
+    if(psEntry == NULL)
     {
-        //
-        // Initialize the psFile system tree pointer to the root of the linked
-        // list.
-        //
-        psTree = FS_ROOT;
+        return(NULL);
+    }
+
+    //
+    // Take a handle for the file from the pool.
+    //
+    psHandle = FSHandleAlloc();
+    if(psHandle == NULL)
+    {
+        return(NULL);
+    }
+    psFile = &psHandle->sFile;
 
+    //
+    // We are not using any file system extensions in this application, so
+    // set the pointer to NULL.
+    //
+    psFile->pextension = NULL;
+    psHandle->psStream = NULL;
+
+    if(psEntry->ui32Handler == 0)
+    {
         //
-        // Begin processing the linked list, looking for the requested file name.
+        // Fill in the data pointer and length values from the linked list
+        // node.
         //
-        while(NULL != psTree)
+        psFile->data = (char *)psEntry->psFile->data;
+        psFile->len = psEntry->psFile->len;
+    }
+    else
+    {
+        psDynamic = &g_psDynamicFiles[psEntry->ui32Handler - 1];
+
+        if(psDynamic->pfnWriter)
         {
             //
-            // Compare the requested file "pcName" to the file name in the
-            // current node.
+            // Take the snapshot the file is generated from and find the
+            // length of the file, which goes into the Content-Length header.
+            // There is no data in memory, so the web server reads the file
+            // with fs_read(), which generates it.
             //
-            if(ustrncmp(pcName, (char *)psTree->name, psTree->len) == 0)
-            {
-                //
-                // Fill in the data pointer and length values from the
-                // linked list node.
-                //
-                psFile->data = (char *)psTree->data;
-                psFile->len = psTree->len;
-
-                //
-                // For now, we setup the read index to the end of the file,
-                // indicating that all data has been read.
-                //
-                psFile->index = psTree->len;
-
-                //
-                // We are not using any file system extensions in this
-                // application, so set the pointer to NULL.
-                //
-                psFile->pextension = NULL;
-
-                //
-                // Exit the loop and return the file system pointer.
-                //
-                break;
-            }
+            psDynamic->pfnSnapshot(psHandle->uData.pui32State);
 
-            //
-            // If we get here, we did not find the file at this node of the
-            // linked list.  Get the next element in the list.
-            //
-            psTree = psTree->next;
+            psHandle->psStream = psDynamic;
+            psFile->data = NULL;
+            psFile->len = psDynamic->pfnWriter(psHandle->uData.pui32State,
+                                               NULL, 0, 0);
+            psFile->index = 0;
+
+            return(psFile);
+        }
+
+        //
+        // Find the parameters, if any, and let the handler generate the
+        // response into the buffer owned by this handle.
+        //
+        pcParams = ustrstr(pcName, "?");
+        pcParams = pcParams ? (pcParams + 1) : "";
+
+        psHandle->uData.pcBuf[0] = '\0';
+        iLen = psDynamic->pfnHandler(pcParams, psHandle->uData.pcBuf,
+                                     IO_FS_RESPONSE_SIZE);
+        if((iLen < 0) || (iLen > IO_FS_RESPONSE_SIZE))
+        {
+            iLen = 0;
         }
+
+        psFile->data = psHandle->uData.pcBuf;
+        psFile->len = iLen;
     }
 
     //
-    // If we didn't find the file, ptTee will be NULL.  Make sure we
-    // return a NULL pointer if this happens.
+    // For now, we setup the read index to the end of the file, indicating
+    // that all data has been read.
     //
-    if(NULL == psTree)
-    {
-        mem_free(psFile);
-        psFile = NULL;
-    }
+    psFile->index = psFile->len;
 
     //
     // Return the file system pointer.
@@ -251,9 +1180,9 @@ void
 fs_close(struct fs_file *psFile)
 {
     //
-    // Free the main psFile system object.
+    // Return the handle to the pool.
     //
-    mem_free(psFile);
+    FSHandleFree((tFSHandle *)psFile);
 }
 
 //*****************************************************************************
@@ -266,6 +1195,7 @@ fs_close(struct fs_file *psFile)
 int
 fs_read(struct fs_file *psFile, char *pcBuffer, int iCount)
 {
+    tFSHandle *psHandle;
     int iAvailable;
 
     //
@@ -302,9 +1232,18 @@ fs_read(struct fs_file *psFile, char *pcBuffer, int iCount)
     }
 
     //
-    // Copy the data.
+    // Generate the data of a streamed file, or copy the data of any other.
     //
-    memcpy(pcBuffer, psFile->data + iAvailable, iAvailable);
+    psHandle = (tFSHandle *)psFile;
+    if(psHandle->psStream)
+    {
+        psHandle->psStream->pfnWriter(psHandle->uData.pui32State, pcBuffer,
+                                      psFile->index, iAvailable);
+    }
+    else
+    {
+        memcpy(pcBuffer, psFile->data + psFile->index, iAvailable);
+    }
     psFile->index += iAvailable;
 
     //
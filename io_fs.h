@@ -0,0 +1,95 @@
+//*****************************************************************************
+//
+// io_fs.h - Prototypes for the dynamic file registration of the enet_io
+//           file system.
+//
+//*****************************************************************************
+
+#ifndef __IO_FS_H__
+#define __IO_FS_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The size of the response buffer handed to a dynamic file handler.  Every
+// open file owns one of these, so concurrent requests never share a buffer.
+//
+//*****************************************************************************
+#define IO_FS_RESPONSE_SIZE     64
+
+//*****************************************************************************
+//
+// The size of the snapshot a streamed file is generated from.  It shares its
+// storage with the response buffer of the open file.  The largest is that of
+// /status.json, a tIOSystemStatus with room for IO_MAX_TASKS tasks.
+//
+//*****************************************************************************
+#define IO_FS_STATE_SIZE        208
+
+//*****************************************************************************
+//
+// The number of files that can be open at the same time.  The web server
+// holds at most one file per connection.
+//
+//*****************************************************************************
+#define IO_FS_MAX_OPEN_FILES    MEMP_NUM_TCP_PCB
+
+//*****************************************************************************
+//
+// The maximum number of dynamic files that can be registered.  io_fs_init()
+// registers eight; the rest is room for new ones.
+//
+//*****************************************************************************
+#define IO_FS_MAX_HANDLERS      12
+
+//*****************************************************************************
+//
+// Prototype of a dynamic file handler.  pcParams points to the parameter
+// string that followed the '?' in the request URI (an empty string if there
+// were none).  The handler writes the response into pcBuf, which holds up to
+// iBufLen bytes, and returns the number of bytes written.
+//
+//*****************************************************************************
+typedef int (*tIOFSHandler)(const char *pcParams, char *pcBuf, int iBufLen);
+
+//*****************************************************************************
+//
+// Prototypes of the functions behind a streamed file, which is generated
+// straight into the send buffer of the web server instead of a response
+// buffer, so it may be of any length.
+//
+// The snapshot function is called when the file is opened and stores the
+// state that the file shows in pvState, which is word aligned and holds up to
+// IO_FS_STATE_SIZE bytes.  The writer function generates the file from that
+// state: it stores the ui32Size bytes of the file that follow the first
+// ui32Skip bytes into pcBuf, and returns the length of the whole file.  It is
+// called with ui32Size 0 to find the length of the file, then once for every
+// block that is sent, so it must generate the same file from the same state
+// every time.
+//
+//*****************************************************************************
+typedef void (*tIOFSSnapshot)(void *pvState);
+typedef uint32_t (*tIOFSWriter)(const void *pvState, char *pcBuf,
+                                uint32_t ui32Skip, uint32_t ui32Size);
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.
+//
+//*****************************************************************************
+extern bool io_fs_init(void);
+extern bool io_fs_register(const char *pcName, tIOFSHandler pfnHandler);
+extern bool io_fs_register_stream(const char *pcName, uint32_t ui32StateSize,
+                                  tIOFSSnapshot pfnSnapshot,
+                                  tIOFSWriter pfnWriter);
+extern void io_fs_events_poll(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __IO_FS_H__
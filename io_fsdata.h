@@ -2,7 +2,7 @@
 //
 // File System Image.
 //
-// This file was automatically generated using the makefsfile utility.
+// This file was automatically generated using the makefsdata.py utility.
 //
 //***************************************************************************
 
@@ -124,6 +124,59 @@ static const uint8_t data_about_htm[] =
     0x0d, 0x0a,
 };
 
+static const uint8_t data_about_htm_gz[] =
+{
+    /* /about.htm.gz */
+    0x2f, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x2e, 0x68,
+    0x74, 0x6d, 0x2e, 0x67, 0x7a, 0x00,
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x03, 0x5d, 0x51, 0xcd, 0x4e, 0xc3, 0x30,
+    0x0c, 0xbe, 0x23, 0xf1, 0x0e, 0x5e, 0x4e, 0x70,
+    0xc8, 0xca, 0x06, 0x12, 0x20, 0xda, 0x49, 0xd3,
+    0x18, 0x02, 0x6d, 0x13, 0x48, 0x14, 0x09, 0x4e,
+    0x28, 0x6b, 0xdd, 0x35, 0x90, 0x35, 0x5d, 0xe2,
+    0x56, 0x2d, 0x6f, 0xc3, 0xb3, 0xf0, 0x62, 0x24,
+    0xeb, 0xca, 0x81, 0x8b, 0x1d, 0xff, 0x7c, 0x9f,
+    0xbf, 0xd8, 0xe1, 0xe0, 0xf6, 0x71, 0x16, 0xbf,
+    0x3d, 0xcd, 0xe1, 0x3e, 0x5e, 0x2d, 0x27, 0xc7,
+    0x47, 0xe1, 0x80, 0x73, 0x98, 0xe9, 0xb2, 0x35,
+    0x72, 0x93, 0x13, 0x9c, 0x24, 0xa7, 0x30, 0x3e,
+    0x1b, 0x9d, 0x73, 0x67, 0x2e, 0x21, 0xc6, 0x46,
+    0x58, 0x78, 0x28, 0x2c, 0x99, 0x6a, 0x8b, 0x05,
+    0xf9, 0x77, 0xa2, 0x4d, 0xa9, 0x8d, 0x20, 0x4c,
+    0x87, 0x00, 0x53, 0xa5, 0x60, 0x0f, 0xb4, 0x60,
+    0xd0, 0xa2, 0xa9, 0x7d, 0x96, 0x73, 0xcf, 0x9b,
+    0xd3, 0x56, 0xed, 0x3d, 0x8a, 0xd4, 0x7b, 0x92,
+    0xa4, 0x70, 0x32, 0x5f, 0xf0, 0x78, 0x75, 0x31,
+    0x1b, 0x8d, 0xaf, 0x2f, 0x5e, 0x97, 0x30, 0xaf,
+    0x85, 0xaa, 0x04, 0x49, 0x5d, 0xc0, 0x42, 0x52,
+    0x18, 0x74, 0x3d, 0xae, 0x79, 0x8b, 0x24, 0x20,
+    0x27, 0x2a, 0x39, 0xee, 0x2a, 0x59, 0x47, 0x6c,
+    0xa6, 0x0b, 0x72, 0x02, 0x38, 0xb5, 0x25, 0x32,
+    0x48, 0xba, 0x28, 0x62, 0x84, 0x0d, 0x05, 0x7e,
+    0xd2, 0x4d, 0x92, 0x0b, 0x63, 0x91, 0xa2, 0x97,
+    0xf8, 0x8e, 0x5f, 0x31, 0xcf, 0xa1, 0x64, 0xf1,
+    0xe9, 0x54, 0xa9, 0x88, 0x59, 0x6a, 0x15, 0xda,
+    0x1c, 0x91, 0x18, 0x78, 0x82, 0x03, 0x2e, 0xb1,
+    0x96, 0x41, 0x6e, 0x30, 0xeb, 0x3b, 0x86, 0x3e,
+    0x13, 0xfc, 0xc3, 0xe6, 0xda, 0x50, 0x52, 0x11,
+    0x48, 0x37, 0xb4, 0x87, 0xcb, 0xad, 0xd8, 0x60,
+    0xd0, 0xf0, 0x2e, 0xd7, 0x51, 0x64, 0xa2, 0xf6,
+    0xe1, 0xd0, 0x99, 0x8e, 0x23, 0xe8, 0x7f, 0xbe,
+    0xd6, 0x69, 0xeb, 0x7d, 0x09, 0x32, 0x8d, 0xd8,
+    0x41, 0xfb, 0xbb, 0xaf, 0xca, 0x62, 0xc3, 0x26,
+    0xcf, 0x7a, 0x6d, 0x10, 0x34, 0x94, 0x46, 0x7f,
+    0x20, 0xe9, 0x30, 0x28, 0xf7, 0x6b, 0x33, 0x7b,
+    0xa8, 0xb7, 0x53, 0xb7, 0x02, 0x40, 0x4b, 0xc2,
+    0xfc, 0x7c, 0xbb, 0x3e, 0xb1, 0x76, 0xe7, 0x10,
+    0xa4, 0x21, 0xfd, 0xc3, 0x40, 0x26, 0x0b, 0xa1,
+    0x00, 0x9b, 0x52, 0xc9, 0x44, 0x14, 0xae, 0xa0,
+    0x61, 0x57, 0x21, 0xa0, 0x42, 0xc8, 0xc4, 0xd7,
+    0xd0, 0xab, 0xe9, 0x55, 0x04, 0x87, 0xc3, 0xfc,
+    0x02, 0x2a, 0xc4, 0x10, 0xd7, 0x0a, 0x02, 0x00,
+    0x00,
+};
+
 static const uint8_t data_favicon_ico[] =
 {
     /* /favicon.ico */
@@ -647,6 +700,88 @@ static const uint8_t data_index_htm[] =
     0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e,
 };
 
+static const uint8_t data_index_htm_gz[] =
+{
+    /* /index.htm.gz */
+    0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x68,
+    0x74, 0x6d, 0x2e, 0x67, 0x7a, 0x00,
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x03, 0x85, 0x54, 0x4d, 0x8f, 0xd3, 0x30,
+    0x10, 0xbd, 0x23, 0xf1, 0x1f, 0x66, 0x2d, 0x21,
+    0xc1, 0x21, 0x49, 0x5b, 0x84, 0x58, 0x89, 0x24,
+    0x12, 0x74, 0x59, 0x01, 0x62, 0xd5, 0x8a, 0x96,
+    0x03, 0xa7, 0xca, 0x49, 0xdc, 0xc4, 0xc5, 0x89,
+    0x83, 0x3d, 0x29, 0xed, 0xbf, 0x67, 0x9c, 0xa4,
+    0x5f, 0x69, 0x81, 0x4b, 0x32, 0xe3, 0xf1, 0xbc,
+    0x79, 0xf3, 0x3c, 0x76, 0x78, 0xf7, 0x30, 0x9b,
+    0x2e, 0x7f, 0xcc, 0x3f, 0xc2, 0xa7, 0xe5, 0xd3,
+    0xd7, 0xf8, 0xf9, 0xb3, 0xf0, 0xce, 0xf3, 0x60,
+    0xaa, 0xeb, 0xbd, 0x91, 0x79, 0x81, 0xf0, 0x32,
+    0x7d, 0x05, 0x93, 0xd1, 0xf8, 0xb5, 0x47, 0x9f,
+    0xb7, 0xb0, 0x14, 0x3b, 0x6e, 0xe1, 0x73, 0x65,
+    0xd1, 0x34, 0xa5, 0xa8, 0xd0, 0xd9, 0xa9, 0x36,
+    0xb5, 0x36, 0x1c, 0x45, 0xe6, 0x03, 0xbc, 0x57,
+    0x0a, 0xda, 0x44, 0x0b, 0x46, 0x58, 0x61, 0xb6,
+    0x6e, 0xd5, 0xf3, 0x1c, 0x6e, 0x81, 0xa5, 0xa2,
+    0xbf, 0xb3, 0x04, 0xcf, 0xc8, 0x02, 0x08, 0x4b,
+    0x81, 0x1c, 0x0a, 0xc4, 0xda, 0x13, 0xbf, 0x1a,
+    0xb9, 0x8d, 0xd8, 0x54, 0x57, 0x48, 0xb8, 0x1e,
+    0xee, 0x6b, 0xc1, 0x20, 0xed, 0xbc, 0x88, 0xa1,
+    0xd8, 0x61, 0xe0, 0x00, 0xde, 0xa5, 0x05, 0x37,
+    0x56, 0x60, 0xf4, 0x7d, 0xf9, 0xe8, 0xdd, 0xb3,
+    0x0e, 0x05, 0x25, 0x2a, 0x11, 0xcf, 0x8d, 0xde,
+    0x08, 0xd4, 0xf0, 0x28, 0x2b, 0xae, 0xc0, 0x83,
+    0xc5, 0x0c, 0x04, 0x38, 0x3c, 0xa3, 0x95, 0x80,
+    0x49, 0x18, 0x74, 0xdb, 0xda, 0x0c, 0x25, 0xab,
+    0x9f, 0x44, 0x50, 0x45, 0xcc, 0xe2, 0x5e, 0x09,
+    0x5b, 0x08, 0x81, 0x0c, 0x5c, 0xd1, 0xbe, 0x56,
+    0x6a, 0x2d, 0x83, 0xc2, 0x88, 0xf5, 0x61, 0x87,
+    0xdf, 0xae, 0x04, 0x57, 0xe9, 0x85, 0x36, 0x98,
+    0x36, 0x08, 0x92, 0xb8, 0x1e, 0x10, 0x64, 0xc9,
+    0x73, 0x11, 0xec, 0xbc, 0x6e, 0xad, 0x43, 0x59,
+    0xf3, 0xad, 0x73, 0x7d, 0xfa, 0x1c, 0x61, 0x6c,
+    0x6a, 0x64, 0x8d, 0x60, 0x4d, 0x1a, 0xb1, 0x0d,
+    0xdf, 0xf2, 0xce, 0xf7, 0x37, 0x54, 0x48, 0xf1,
+    0x2a, 0x6f, 0x08, 0x25, 0x62, 0x5f, 0x28, 0xb0,
+    0x68, 0x03, 0x63, 0x7f, 0x42, 0x92, 0xf4, 0xfd,
+    0xb3, 0x06, 0xd7, 0x4e, 0x80, 0x30, 0xe8, 0xb2,
+    0x9c, 0xc2, 0x41, 0x2f, 0x2c, 0x99, 0x89, 0xce,
+    0xf6, 0x5d, 0x91, 0x4c, 0x6e, 0x41, 0x66, 0x11,
+    0x73, 0x31, 0x59, 0xe5, 0x9d, 0x64, 0x4e, 0x34,
+    0x9e, 0x90, 0x2c, 0xbf, 0x65, 0x86, 0x45, 0xc4,
+    0xc6, 0xa3, 0xd1, 0x8b, 0x43, 0xc4, 0xc5, 0xcc,
+    0xd1, 0x76, 0x5e, 0x76, 0xe6, 0x91, 0xcf, 0xcf,
+    0xf1, 0x56, 0x28, 0xa9, 0x6d, 0x6e, 0x72, 0xc7,
+    0x69, 0x75, 0xe8, 0x36, 0x60, 0x17, 0x29, 0x94,
+    0x24, 0xcb, 0xbc, 0x6b, 0x94, 0x78, 0xd7, 0xc6,
+    0xaf, 0x89, 0x49, 0x5f, 0x7c, 0xf2, 0x66, 0x04,
+    0x5c, 0x51, 0xf6, 0xd5, 0x70, 0x5d, 0x82, 0x84,
+    0x01, 0x3f, 0x67, 0x15, 0x5c, 0xd0, 0x22, 0x92,
+    0xb7, 0x7b, 0x69, 0x83, 0x03, 0x0d, 0x56, 0xc5,
+    0x78, 0xc8, 0x6f, 0x69, 0x78, 0xc2, 0x55, 0xd1,
+    0x4f, 0x4f, 0x98, 0x98, 0x78, 0x21, 0x2d, 0x8a,
+    0x92, 0x08, 0xcd, 0x6a, 0x61, 0x78, 0x2a, 0x75,
+    0xc5, 0xa5, 0xbd, 0x98, 0xa8, 0x4b, 0x72, 0x54,
+    0xe3, 0x3f, 0x45, 0x27, 0xc3, 0xa2, 0x4f, 0xdc,
+    0xa4, 0x42, 0x69, 0x02, 0x7d, 0x90, 0x3a, 0xd7,
+    0xff, 0xc2, 0x1b, 0xb6, 0x7b, 0xa6, 0x05, 0x85,
+    0x0e, 0xc7, 0x45, 0xa6, 0x3b, 0xd5, 0x83, 0x57,
+    0x98, 0x81, 0x75, 0x42, 0x3d, 0xb2, 0x23, 0xa1,
+    0x9b, 0xe3, 0x4c, 0x34, 0xea, 0x84, 0xaa, 0x64,
+    0x4c, 0x27, 0xdd, 0x1d, 0x27, 0x4f, 0x74, 0x83,
+    0x3e, 0xdd, 0x3f, 0xd6, 0xe6, 0xb4, 0x2e, 0x8b,
+    0x17, 0x3a, 0x31, 0xc2, 0x31, 0x09, 0x03, 0xda,
+    0x7c, 0x33, 0x51, 0xea, 0x95, 0xbb, 0xdd, 0xa7,
+    0xd4, 0x7e, 0x81, 0xc5, 0x47, 0x19, 0x33, 0x0e,
+    0x1f, 0x74, 0x99, 0xf0, 0x01, 0x50, 0x18, 0xf4,
+    0x64, 0x6e, 0x70, 0xee, 0x9f, 0x05, 0xf6, 0xb7,
+    0xf8, 0x5a, 0x6b, 0x3c, 0x1f, 0xf5, 0x2b, 0x1d,
+    0x00, 0xe8, 0xf9, 0x98, 0x7f, 0x73, 0x0f, 0xdb,
+    0xfd, 0x39, 0x46, 0x18, 0xf4, 0xf7, 0xa6, 0xbd,
+    0x4c, 0xee, 0xbd, 0xfa, 0x03, 0xae, 0x34, 0x6e,
+    0xbd, 0x1f, 0x05, 0x00, 0x00,
+};
+
 static const uint8_t data_io_cgi_ssi[] =
 {
     /* /io_cgi.ssi */
@@ -1625,271 +1760,268 @@ static const uint8_t data_io_http_htm[] =
     0x2e, 0x68, 0x74, 0x6d, 0x00,
     0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50,
     0x45, 0x20, 0x48, 0x54, 0x4d, 0x4c, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x6f,
-    0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20,
-    0x28, 0x63, 0x29, 0x20, 0x32, 0x30, 0x31, 0x33,
-    0x20, 0x54, 0x65, 0x78, 0x61, 0x73, 0x20, 0x49,
-    0x6e, 0x73, 0x74, 0x72, 0x75, 0x6d, 0x65, 0x6e,
-    0x74, 0x73, 0x20, 0x49, 0x6e, 0x63, 0x6f, 0x72,
-    0x70, 0x6f, 0x72, 0x61, 0x74, 0x65, 0x64, 0x2e,
-    0x20, 0x41, 0x6c, 0x6c, 0x20, 0x72, 0x69, 0x67,
-    0x68, 0x74, 0x73, 0x20, 0x72, 0x65, 0x73, 0x65,
-    0x72, 0x76, 0x65, 0x64, 0x2e, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x3c, 0x68, 0x74, 0x6d, 0x6c,
-    0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0d,
+    0x0a, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0d,
+    0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x68, 0x65, 0x61, 0x64, 0x3e, 0x0d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x6d, 0x65, 0x74, 0x61, 0x20, 0x68, 0x74, 0x74,
+    0x70, 0x2d, 0x65, 0x71, 0x75, 0x69, 0x76, 0x3d,
+    0x22, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
+    0x2d, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x63,
+    0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22,
+    0x74, 0x65, 0x78, 0x74, 0x2f, 0x68, 0x74, 0x6d,
+    0x6c, 0x3b, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65,
+    0x74, 0x3d, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+    0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x74, 0x69, 0x74, 0x6c,
+    0x65, 0x3e, 0x49, 0x2f, 0x4f, 0x20, 0x43, 0x6f,
+    0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x44, 0x65,
+    0x6d, 0x6f, 0x20, 0x31, 0x3c, 0x2f, 0x74, 0x69,
+    0x74, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c,
+    0x69, 0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d,
+    0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68,
+    0x65, 0x65, 0x74, 0x22, 0x20, 0x74, 0x79, 0x70,
+    0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f,
+    0x63, 0x73, 0x73, 0x22, 0x20, 0x68, 0x72, 0x65,
+    0x66, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65,
+    0x73, 0x2e, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2f,
+    0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x6c, 0x69, 0x6e, 0x6b,
+    0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 0x73, 0x68,
+    0x6f, 0x72, 0x74, 0x63, 0x75, 0x74, 0x20, 0x69,
+    0x63, 0x6f, 0x6e, 0x22, 0x20, 0x74, 0x79, 0x70,
+    0x65, 0x3d, 0x22, 0x69, 0x6d, 0x61, 0x67, 0x65,
+    0x2f, 0x78, 0x2d, 0x69, 0x63, 0x6f, 0x6e, 0x22,
+    0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x66,
+    0x61, 0x76, 0x69, 0x63, 0x6f, 0x6e, 0x2e, 0x69,
+    0x63, 0x6f, 0x22, 0x20, 0x2f, 0x3e, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x68, 0x65,
+    0x61, 0x64, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x62, 0x6f, 0x64, 0x79,
+    0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x74, 0x61, 0x62, 0x6c,
+    0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d,
+    0x22, 0x31, 0x30, 0x30, 0x25, 0x22, 0x3e, 0x0d,
     0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x68,
-    0x74, 0x74, 0x70, 0x2d, 0x65, 0x71, 0x75, 0x69,
-    0x76, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x65,
-    0x6e, 0x74, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x22,
-    0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-    0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x68,
-    0x74, 0x6d, 0x6c, 0x3b, 0x63, 0x68, 0x61, 0x72,
-    0x73, 0x65, 0x74, 0x3d, 0x55, 0x54, 0x46, 0x2d,
-    0x38, 0x22, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x69,
-    0x74, 0x6c, 0x65, 0x3e, 0x49, 0x2f, 0x4f, 0x20,
-    0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20,
-    0x44, 0x65, 0x6d, 0x6f, 0x20, 0x31, 0x3c, 0x2f,
-    0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x62,
+    0x6f, 0x64, 0x79, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3c, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x72, 0x65,
-    0x6c, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65,
-    0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x20, 0x74,
-    0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78,
-    0x74, 0x2f, 0x63, 0x73, 0x73, 0x22, 0x20, 0x68,
-    0x72, 0x65, 0x66, 0x3d, 0x22, 0x73, 0x74, 0x79,
-    0x6c, 0x65, 0x73, 0x2e, 0x63, 0x73, 0x73, 0x22,
-    0x20, 0x2f, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x69,
-    0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22,
-    0x73, 0x68, 0x6f, 0x72, 0x74, 0x63, 0x75, 0x74,
-    0x20, 0x69, 0x63, 0x6f, 0x6e, 0x22, 0x20, 0x74,
-    0x79, 0x70, 0x65, 0x3d, 0x22, 0x69, 0x6d, 0x61,
-    0x67, 0x65, 0x2f, 0x78, 0x2d, 0x69, 0x63, 0x6f,
-    0x6e, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d,
-    0x22, 0x66, 0x61, 0x76, 0x69, 0x63, 0x6f, 0x6e,
-    0x2e, 0x69, 0x63, 0x6f, 0x22, 0x20, 0x2f, 0x3e,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
-    0x68, 0x65, 0x61, 0x64, 0x3e, 0x0d, 0x0a, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x6f,
-    0x64, 0x79, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x61,
-    0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74,
-    0x68, 0x3d, 0x22, 0x31, 0x30, 0x30, 0x25, 0x22,
-    0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
-    0x74, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74,
+    0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3c, 0x74, 0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
+    0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c, 0x69, 0x67,
+    0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 0x74, 0x22,
+    0x20, 0x76, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d,
+    0x22, 0x74, 0x6f, 0x70, 0x22, 0x20, 0x77, 0x69,
+    0x64, 0x74, 0x68, 0x3d, 0x22, 0x37, 0x35, 0x25,
+    0x22, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3c, 0x74, 0x64, 0x20, 0x61, 0x6c,
-    0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66,
-    0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x67,
-    0x6e, 0x3d, 0x22, 0x74, 0x6f, 0x70, 0x22, 0x20,
-    0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x37,
-    0x35, 0x25, 0x22, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x65, 0x6e,
+    0x74, 0x65, 0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63,
-    0x65, 0x6e, 0x74, 0x65, 0x72, 0x3e, 0x0d, 0x0a,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0x68, 0x32, 0x20, 0x61, 0x6c,
+    0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e,
+    0x74, 0x65, 0x72, 0x22, 0x3e, 0x43, 0x6f, 0x6e,
+    0x74, 0x72, 0x6f, 0x6c, 0x65, 0x20, 0x64, 0x61,
+    0x20, 0x42, 0x6f, 0x6d, 0x62, 0x61, 0x3c, 0x2f,
+    0x68, 0x32, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x32, 0x20,
-    0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63,
-    0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x3e, 0x43,
-    0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x65, 0x20,
-    0x64, 0x61, 0x20, 0x42, 0x6f, 0x6d, 0x62, 0x61,
-    0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63,
+    0x65, 0x6e, 0x74, 0x65, 0x72, 0x3e, 0x0d, 0x0a,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
-    0x2f, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3e,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3c, 0x68, 0x72, 0x20, 0x73, 0x69,
-    0x7a, 0x65, 0x3d, 0x22, 0x32, 0x22, 0x20, 0x77,
-    0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x30,
-    0x30, 0x25, 0x22, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
+    0x3c, 0x68, 0x72, 0x20, 0x73, 0x69, 0x7a, 0x65,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x77, 0x69, 0x64,
+    0x74, 0x68, 0x3d, 0x22, 0x31, 0x30, 0x30, 0x25,
+    0x22, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
-    0x3e, 0x45, 0x73, 0x74, 0x61, 0x20, 0x70, 0xc3,
-    0xa1, 0x67, 0x69, 0x6e, 0x61, 0x20, 0x63, 0x6f,
-    0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x61, 0x20, 0x6f,
-    0x20, 0x6c, 0x69, 0x67, 0x61, 0x6d, 0x65, 0x6e,
-    0x74, 0x6f, 0x2d, 0x64, 0x65, 0x73, 0x6c, 0x69,
-    0x67, 0x61, 0x6d, 0x65, 0x6e, 0x74, 0x6f, 0x20,
-    0x64, 0x61, 0x20, 0x62, 0x6f, 0x6d, 0x62, 0x61,
-    0x20, 0x65, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66,
-    0x69, 0x63, 0x61, 0x20, 0x73, 0x65, 0x75, 0x20,
-    0x66, 0x75, 0x6e, 0x63, 0x69, 0x6f, 0x6e, 0x61,
-    0x6d, 0x65, 0x6e, 0x74, 0x6f, 0x20, 0x65, 0x6e,
-    0x74, 0x72, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74,
-    0x72, 0x6f, 0x6c, 0x65, 0x20, 0x6d, 0x61, 0x6e,
-    0x75, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x61, 0x75,
-    0x74, 0x6f, 0x6d, 0xc3, 0xa1, 0x74, 0x69, 0x63,
-    0x6f, 0x2e, 0x3c, 0x2f, 0x70, 0x3e, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3c, 0x70, 0x3e, 0x3c, 0x62, 0x3e, 0x4c, 0x69,
-    0x67, 0x61, 0x72, 0x2f, 0x44, 0x65, 0x73, 0x6c,
-    0x69, 0x67, 0x61, 0x72, 0x20, 0x53, 0x69, 0x73,
-    0x74, 0x65, 0x6d, 0x61, 0x20, 0x64, 0x65, 0x20,
-    0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x65,
-    0x20, 0x64, 0x61, 0x20, 0x42, 0x6f, 0x6d, 0x62,
-    0x61, 0x3c, 0x2f, 0x62, 0x3e, 0x3c, 0x2f, 0x70,
-    0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x3e, 0x45,
+    0x73, 0x74, 0x61, 0x20, 0x70, 0xc3, 0xa1, 0x67,
+    0x69, 0x6e, 0x61, 0x20, 0x63, 0x6f, 0x6e, 0x74,
+    0x72, 0x6f, 0x6c, 0x61, 0x20, 0x6f, 0x20, 0x6c,
+    0x69, 0x67, 0x61, 0x6d, 0x65, 0x6e, 0x74, 0x6f,
+    0x2d, 0x64, 0x65, 0x73, 0x6c, 0x69, 0x67, 0x61,
+    0x6d, 0x65, 0x6e, 0x74, 0x6f, 0x20, 0x64, 0x61,
+    0x20, 0x62, 0x6f, 0x6d, 0x62, 0x61, 0x20, 0x65,
+    0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x63,
+    0x61, 0x20, 0x73, 0x65, 0x75, 0x20, 0x66, 0x75,
+    0x6e, 0x63, 0x69, 0x6f, 0x6e, 0x61, 0x6d, 0x65,
+    0x6e, 0x74, 0x6f, 0x20, 0x65, 0x6e, 0x74, 0x72,
+    0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f,
+    0x6c, 0x65, 0x20, 0x6d, 0x61, 0x6e, 0x75, 0x61,
+    0x6c, 0x20, 0x65, 0x20, 0x61, 0x75, 0x74, 0x6f,
+    0x6d, 0xc3, 0xa1, 0x74, 0x69, 0x63, 0x6f, 0x2e,
+    0x3c, 0x2f, 0x70, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3c, 0x74, 0x61, 0x62, 0x6c,
-    0x65, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+    0x3e, 0x3c, 0x62, 0x3e, 0x4c, 0x69, 0x67, 0x61,
+    0x72, 0x2f, 0x44, 0x65, 0x73, 0x6c, 0x69, 0x67,
+    0x61, 0x72, 0x20, 0x53, 0x69, 0x73, 0x74, 0x65,
+    0x6d, 0x61, 0x20, 0x64, 0x65, 0x20, 0x43, 0x6f,
+    0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x65, 0x20, 0x64,
+    0x61, 0x20, 0x42, 0x6f, 0x6d, 0x62, 0x61, 0x3c,
+    0x2f, 0x62, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0x0d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e,
+    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3c, 0x74, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74,
+    0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0d, 0x0a, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3c, 0x74, 0x72, 0x3e, 0x0d, 0x0a, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x74, 0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3c, 0x74, 0x64, 0x3e, 0x0d, 0x0a, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20,
-    0x69, 0x64, 0x3d, 0x22, 0x74, 0x6f, 0x67, 0x67,
-    0x6c, 0x65, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75,
-    0x65, 0x3d, 0x22, 0x41, 0x6c, 0x74, 0x65, 0x72,
-    0x6e, 0x61, 0x72, 0x20, 0x42, 0x6f, 0x6d, 0x62,
-    0x61, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69,
-    0x63, 0x6b, 0x3d, 0x22, 0x74, 0x6f, 0x67, 0x67,
-    0x6c, 0x65, 0x5f, 0x6c, 0x65, 0x64, 0x28, 0x29,
-    0x3b, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d,
-    0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22,
-    0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64,
+    0x3d, 0x22, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65,
+    0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d,
+    0x22, 0x41, 0x6c, 0x74, 0x65, 0x72, 0x6e, 0x61,
+    0x72, 0x20, 0x42, 0x6f, 0x6d, 0x62, 0x61, 0x22,
+    0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b,
+    0x3d, 0x22, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65,
+    0x5f, 0x6c, 0x65, 0x64, 0x28, 0x29, 0x3b, 0x22,
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x62,
+    0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x3e, 0x0d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
-    0x2f, 0x74, 0x64, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74,
+    0x64, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x0d, 0x0a,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x74, 0x64, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d,
-    0x22, 0x6c, 0x65, 0x64, 0x73, 0x74, 0x61, 0x74,
-    0x65, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e,
-    0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72,
-    0x22, 0x3e, 0x4f, 0x46, 0x46, 0x3c, 0x2f, 0x64,
-    0x69, 0x76, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64,
+    0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6c,
+    0x65, 0x64, 0x73, 0x74, 0x61, 0x74, 0x65, 0x22,
+    0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22,
+    0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x3e,
+    0x4f, 0x46, 0x46, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+    0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x2f, 0x74, 0x64, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0d, 0x0a,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+    0x74, 0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x0d, 0x0a, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3c, 0x2f, 0x74, 0x62, 0x6f, 0x64, 0x79,
+    0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x62, 0x6f,
-    0x64, 0x79, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x61, 0x62,
+    0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74,
-    0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x3e,
+    0x3c, 0x2f, 0x70, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
-    0x70, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62,
+    0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x3e, 0x3c,
+    0x62, 0x3e, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x69,
+    0x6f, 0x6e, 0x61, 0x72, 0x20, 0x4d, 0x6f, 0x64,
+    0x6f, 0x20, 0x4d, 0x61, 0x6e, 0x75, 0x61, 0x6c,
+    0x2f, 0x41, 0x75, 0x74, 0x6f, 0x6d, 0xc3, 0xa1,
+    0x74, 0x69, 0x63, 0x6f, 0x3c, 0x2f, 0x62, 0x3e,
+    0x3c, 0x2f, 0x70, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3c, 0x62, 0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74,
+    0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
-    0x3e, 0x3c, 0x62, 0x3e, 0x53, 0x65, 0x6c, 0x65,
-    0x63, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x20, 0x4d,
-    0x6f, 0x64, 0x6f, 0x20, 0x4d, 0x61, 0x6e, 0x75,
-    0x61, 0x6c, 0x2f, 0x41, 0x75, 0x74, 0x6f, 0x6d,
-    0xc3, 0xa1, 0x74, 0x69, 0x63, 0x6f, 0x3c, 0x2f,
-    0x62, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0x0d, 0x0a,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x74, 0x62, 0x6f, 0x64,
+    0x79, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x62,
-    0x6f, 0x64, 0x79, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e,
+    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74,
-    0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x64, 0x3e, 0x56, 0x65, 0x6c, 0x6f, 0x63, 0x69,
+    0x64, 0x61, 0x64, 0x65, 0x20, 0x41, 0x74, 0x75,
+    0x61, 0x6c, 0x3a, 0x3c, 0x2f, 0x74, 0x64, 0x3e,
+    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3c, 0x74, 0x64, 0x3e, 0x56, 0x65, 0x6c, 0x6f,
-    0x63, 0x69, 0x64, 0x61, 0x64, 0x65, 0x20, 0x41,
-    0x74, 0x75, 0x61, 0x6c, 0x3a, 0x3c, 0x2f, 0x74,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74,
     0x64, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3c, 0x74, 0x64, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76,
+    0x20, 0x69, 0x64, 0x3d, 0x22, 0x63, 0x75, 0x72,
+    0x72, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x70, 0x65,
+    0x65, 0x64, 0x22, 0x20, 0x61, 0x6c, 0x69, 0x67,
+    0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 0x65,
+    0x72, 0x22, 0x3e, 0x2d, 0x3c, 0x2f, 0x64, 0x69,
+    0x76, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64,
-    0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x63,
-    0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x73,
-    0x70, 0x65, 0x65, 0x64, 0x22, 0x20, 0x61, 0x6c,
-    0x69, 0x67, 0x6e, 0x3d, 0x22, 0x63, 0x65, 0x6e,
-    0x74, 0x65, 0x72, 0x22, 0x3e, 0x2d, 0x3c, 0x2f,
-    0x64, 0x69, 0x76, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0d, 0x0a, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x2f, 0x74, 0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74,
+    0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3c, 0x74, 0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
+    0x3c, 0x74, 0x64, 0x3e, 0x4d, 0x6f, 0x64, 0x6f,
+    0x20, 0x4d, 0x61, 0x6e, 0x75, 0x61, 0x6c, 0x3c,
+    0x2f, 0x74, 0x64, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
@@ -1900,127 +2032,237 @@ static const uint8_t data_io_http_htm[] =
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x69,
-    0x64, 0x3d, 0x22, 0x73, 0x70, 0x65, 0x65, 0x64,
-    0x5f, 0x73, 0x65, 0x74, 0x22, 0x20, 0x76, 0x61,
-    0x6c, 0x75, 0x65, 0x3d, 0x22, 0x4d, 0x6f, 0x64,
-    0x6f, 0x20, 0x4d, 0x61, 0x6e, 0x75, 0x61, 0x6c,
-    0x22, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63,
-    0x6b, 0x3d, 0x22, 0x73, 0x70, 0x65, 0x65, 0x64,
-    0x53, 0x65, 0x74, 0x28, 0x29, 0x22, 0x20, 0x74,
-    0x79, 0x70, 0x65, 0x3d, 0x22, 0x62, 0x75, 0x74,
-    0x74, 0x6f, 0x6e, 0x22, 0x3e, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74,
+    0x79, 0x70, 0x65, 0x3d, 0x22, 0x72, 0x61, 0x6e,
+    0x67, 0x65, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x68,
+    0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x63, 0x68,
+    0x61, 0x6e, 0x67, 0x65, 0x56, 0x61, 0x6c, 0x75,
+    0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x28, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x76, 0x61, 0x6c, 0x75,
+    0x65, 0x29, 0x22, 0x20, 0x6f, 0x6e, 0x69, 0x6e,
+    0x70, 0x75, 0x74, 0x3d, 0x22, 0x6c, 0x69, 0x76,
+    0x65, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x28, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x76, 0x61, 0x6c, 0x75,
+    0x65, 0x29, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+    0x3d, 0x22, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73,
+    0x22, 0x20, 0x6d, 0x69, 0x6e, 0x3d, 0x22, 0x30,
+    0x22, 0x20, 0x6d, 0x61, 0x78, 0x3d, 0x22, 0x31,
+    0x30, 0x30, 0x22, 0x3e, 0x20, 0x3c, 0x73, 0x70,
+    0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72,
+    0x61, 0x6e, 0x67, 0x65, 0x76, 0x61, 0x6c, 0x75,
+    0x65, 0x22, 0x3e, 0x30, 0x3c, 0x2f, 0x73, 0x70,
+    0x61, 0x6e, 0x3e, 0x25, 0x0d, 0x0a, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74,
-    0x64, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x0d, 0x0a,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70,
-    0x75, 0x74, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65,
-    0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x33, 0x22,
-    0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x34,
-    0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x70,
-    0x65, 0x65, 0x64, 0x5f, 0x70, 0x65, 0x72, 0x63,
-    0x65, 0x6e, 0x74, 0x22, 0x20, 0x74, 0x79, 0x70,
-    0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22,
-    0x3e, 0x25, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6d,
+    0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
+    0x3d, 0x22, 0x33, 0x22, 0x20, 0x68, 0x69, 0x64,
+    0x64, 0x65, 0x6e, 0x20, 0x73, 0x69, 0x7a, 0x65,
+    0x3d, 0x22, 0x34, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x73, 0x70, 0x65, 0x65, 0x64, 0x5f, 0x70,
+    0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x22, 0x20,
+    0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65,
+    0x78, 0x74, 0x22, 0x3e, 0x3c, 0x2f, 0x74, 0x64,
+    0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x0d, 0x0a,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x2f, 0x74, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x62,
-    0x6f, 0x64, 0x79, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
+    0x20, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65,
+    0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
-    0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x3c, 0x74, 0x61, 0x62, 0x6c,
+    0x65, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d,
+    0x3c, 0x74, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0d,
     0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x62,
-    0x6f, 0x64, 0x79, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3c, 0x74, 0x72, 0x3e, 0x0d, 0x0a, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74,
-    0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x0d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3c, 0x74, 0x64, 0x3e, 0x0d, 0x0a, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20,
+    0x69, 0x64, 0x3d, 0x22, 0x73, 0x70, 0x65, 0x65,
+    0x64, 0x5f, 0x73, 0x65, 0x74, 0x22, 0x20, 0x76,
+    0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x4d, 0x6f,
+    0x64, 0x6f, 0x20, 0x41, 0x75, 0x74, 0x6f, 0x6d,
+    0xc3, 0xa1, 0x74, 0x69, 0x63, 0x6f, 0x22, 0x20,
+    0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x3d,
+    0x22, 0x73, 0x70, 0x65, 0x65, 0x64, 0x47, 0x65,
+    0x74, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61,
+    0x6c, 0x28, 0x29, 0x22, 0x20, 0x74, 0x79, 0x70,
+    0x65, 0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f,
+    0x6e, 0x22, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69,
-    0x6e, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64, 0x3d,
-    0x22, 0x73, 0x70, 0x65, 0x65, 0x64, 0x5f, 0x73,
-    0x65, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75,
-    0x65, 0x3d, 0x22, 0x4d, 0x6f, 0x64, 0x6f, 0x20,
-    0x41, 0x75, 0x74, 0x6f, 0x6d, 0xc3, 0xa1, 0x74,
-    0x69, 0x63, 0x6f, 0x22, 0x20, 0x6f, 0x6e, 0x63,
-    0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 0x73, 0x70,
-    0x65, 0x65, 0x64, 0x47, 0x65, 0x74, 0x49, 0x6e,
-    0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x28, 0x29,
-    0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22,
-    0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x3e,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
-    0x74, 0x64, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0d, 0x0a,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74,
-    0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x0d, 0x0a, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3c, 0x2f, 0x74, 0x62, 0x6f, 0x64, 0x79, 0x3e,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x62, 0x6f,
+    0x64, 0x79, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c,
-    0x65, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74,
+    0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x3e, 0x3c,
-    0x2f, 0x70, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x70, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0x0d, 0x0a,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0d, 0x0a,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x64,
+    0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x0d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e,
+    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+    0x74, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0d, 0x0a,
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x62, 0x6f,
-    0x64, 0x79, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74,
-    0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x3c, 0x2f, 0x62, 0x6f, 0x64,
-    0x79, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x2f,
-    0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0d, 0x0a,
+    0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e,
+    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+    0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0d, 0x0a, 0x0d,
+    0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e,
+    0x0d, 0x0a,
+};
+
+static const uint8_t data_io_http_htm_gz[] =
+{
+    /* /io_http.htm.gz */
+    0x2f, 0x69, 0x6f, 0x5f, 0x68, 0x74, 0x74, 0x70,
+    0x2e, 0x68, 0x74, 0x6d, 0x2e, 0x67, 0x7a, 0x00,
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x03, 0xd5, 0x57, 0xdd, 0x4e, 0xdb, 0x30,
+    0x14, 0xbe, 0x9f, 0xc4, 0x3b, 0x78, 0x96, 0x90,
+    0xe0, 0xa2, 0x75, 0x61, 0x9b, 0x36, 0x8d, 0x34,
+    0x12, 0xe3, 0x67, 0x43, 0x02, 0x31, 0x0d, 0x86,
+    0xb4, 0x2b, 0xe4, 0xc4, 0xa7, 0x8d, 0x85, 0x63,
+    0x67, 0x8e, 0xd3, 0xc1, 0xde, 0x86, 0x67, 0xe1,
+    0xc5, 0x76, 0xec, 0xa4, 0xd0, 0xd2, 0xd2, 0x14,
+    0x09, 0x04, 0xeb, 0x45, 0x13, 0xc7, 0x9f, 0xcf,
+    0xf9, 0x7c, 0xce, 0x77, 0x7c, 0x92, 0xe8, 0xed,
+    0xee, 0xf1, 0xce, 0xe9, 0xaf, 0xef, 0x7b, 0xe4,
+    0xdb, 0xe9, 0xd1, 0x61, 0xbc, 0xf2, 0x26, 0xca,
+    0x5c, 0xae, 0xf0, 0xba, 0xf2, 0x86, 0xe0, 0x2f,
+    0xca, 0x80, 0x8b, 0xb8, 0xbe, 0x0f, 0xe3, 0x1c,
+    0x1c, 0x27, 0x99, 0x73, 0x45, 0x07, 0x7e, 0x57,
+    0x72, 0xd4, 0xa7, 0x3b, 0x46, 0x3b, 0xd0, 0xae,
+    0xe3, 0xae, 0x0a, 0xa0, 0x24, 0xad, 0x47, 0x7d,
+    0xea, 0xe0, 0xd2, 0x31, 0x6f, 0x6a, 0x2b, 0xcd,
+    0xb8, 0x2d, 0xc1, 0xf5, 0x7f, 0x9e, 0xee, 0x77,
+    0x3e, 0xd1, 0x49, 0x5b, 0x4e, 0x3a, 0x05, 0xf1,
+    0x01, 0x3b, 0x26, 0xde, 0x88, 0x35, 0x8a, 0xec,
+    0x42, 0x6e, 0xc8, 0x46, 0xc4, 0xea, 0x99, 0x09,
+    0xa8, 0x92, 0xfa, 0x82, 0x58, 0x50, 0x7d, 0x5a,
+    0xba, 0x2b, 0x05, 0x65, 0x06, 0xe0, 0x28, 0xf1,
+    0x3e, 0x1b, 0x57, 0x69, 0x59, 0x52, 0x92, 0x59,
+    0x18, 0x8c, 0x11, 0xdd, 0xf0, 0x84, 0x3d, 0x60,
+    0x24, 0x33, 0xd6, 0xa5, 0x95, 0x23, 0x12, 0x09,
+    0x8f, 0xed, 0xc8, 0x9c, 0x0f, 0x81, 0x5d, 0x76,
+    0xea, 0x67, 0xb5, 0xad, 0x01, 0x1f, 0xf9, 0x61,
+    0x17, 0xff, 0xee, 0x8c, 0x45, 0xac, 0x89, 0x4a,
+    0x33, 0x4c, 0x8c, 0xb8, 0x9a, 0xda, 0x17, 0x4f,
+    0x14, 0x90, 0x3f, 0x52, 0xb8, 0xac, 0x4f, 0x37,
+    0x7a, 0xbd, 0xd5, 0xc9, 0x5d, 0xd7, 0x88, 0x7b,
+    0x4b, 0xee, 0x26, 0xec, 0x9c, 0xa7, 0xf5, 0x8c,
+    0x20, 0x5c, 0xc9, 0xa1, 0xee, 0x53, 0x05, 0x03,
+    0xdc, 0xfb, 0xa8, 0x19, 0x39, 0x53, 0xd0, 0xb1,
+    0xaf, 0x8f, 0x1f, 0x66, 0x5c, 0x4d, 0xd9, 0x48,
+    0x31, 0x35, 0x60, 0x17, 0x20, 0xea, 0x94, 0x6f,
+    0x8e, 0x3d, 0xd5, 0x78, 0x1a, 0x37, 0xe9, 0x01,
+    0x22, 0x38, 0xf9, 0x62, 0xf2, 0x84, 0x63, 0x04,
+    0x36, 0x17, 0x39, 0x62, 0xad, 0x9e, 0xa2, 0xcc,
+    0x92, 0x52, 0xfe, 0xc5, 0xb0, 0x6f, 0xd2, 0x45,
+    0xa1, 0x9a, 0x5a, 0x53, 0xc4, 0x7b, 0x25, 0xca,
+    0xaf, 0xb8, 0xb9, 0x1e, 0x4a, 0xcd, 0x83, 0xd8,
+    0x90, 0x16, 0x27, 0x86, 0x20, 0x5f, 0x9e, 0xa3,
+    0x4f, 0xd3, 0x11, 0x50, 0xde, 0x0e, 0x3c, 0xdf,
+    0xc4, 0xf3, 0x25, 0x40, 0x72, 0x23, 0xe4, 0x40,
+    0xa6, 0x9c, 0x94, 0x50, 0x91, 0x41, 0xa5, 0x53,
+    0x69, 0x74, 0x83, 0xc2, 0x3f, 0x0b, 0x63, 0x6b,
+    0x88, 0xe4, 0xba, 0xe2, 0x0a, 0x97, 0xf0, 0xca,
+    0x99, 0xfc, 0xe6, 0xda, 0x61, 0xf2, 0xbb, 0x11,
+    0x2b, 0x16, 0x33, 0x8b, 0x92, 0xf8, 0x10, 0xfd,
+    0x5a, 0xb6, 0x5b, 0x13, 0xb0, 0xe4, 0x44, 0x96,
+    0x0e, 0x72, 0x4e, 0x04, 0x90, 0x39, 0x01, 0x4c,
+    0xe2, 0x16, 0x93, 0x41, 0x45, 0x6d, 0xb9, 0x7a,
+    0x48, 0x48, 0xcb, 0x0b, 0x6b, 0x8e, 0xd0, 0x96,
+    0x44, 0x06, 0xb4, 0xd4, 0x85, 0x2f, 0x23, 0xe1,
+    0x85, 0x38, 0x1c, 0x2a, 0x08, 0xc2, 0xac, 0x30,
+    0xad, 0xdb, 0x0a, 0x05, 0xa0, 0x31, 0x0c, 0x61,
+    0xbf, 0x94, 0x18, 0x9d, 0x2a, 0x99, 0x5e, 0x8c,
+    0x71, 0xe7, 0x0a, 0xc4, 0xda, 0xfa, 0xd6, 0xb8,
+    0xf6, 0x92, 0xca, 0x39, 0xac, 0xba, 0x65, 0x39,
+    0xb2, 0xa5, 0x49, 0x3e, 0x72, 0x3b, 0x42, 0x8e,
+    0xc2, 0x66, 0x90, 0x1d, 0x2a, 0xcd, 0xe1, 0x76,
+    0xee, 0x95, 0xc2, 0xf1, 0xfe, 0x7e, 0xc4, 0x10,
+    0xf5, 0xb4, 0x4c, 0x11, 0xd6, 0x5a, 0x96, 0xac,
+    0x2d, 0xd7, 0x88, 0x68, 0x91, 0x8c, 0x97, 0xe9,
+    0x62, 0xd1, 0x25, 0xb6, 0x55, 0xe5, 0x27, 0xa0,
+    0x20, 0x14, 0x8f, 0x25, 0x47, 0x46, 0x18, 0x72,
+    0x14, 0xca, 0x85, 0x6d, 0xdf, 0x15, 0xcb, 0xeb,
+    0x16, 0xf7, 0x19, 0x28, 0x93, 0x4a, 0xc1, 0xb1,
+    0x2c, 0xb7, 0x1d, 0x32, 0xff, 0xfc, 0xfc, 0x6a,
+    0x4a, 0x2b, 0x6b, 0x51, 0x3f, 0xe7, 0x65, 0x01,
+    0x20, 0x66, 0x24, 0xd5, 0x79, 0x19, 0x41, 0x3d,
+    0x3e, 0x72, 0x13, 0xe9, 0x7e, 0xbe, 0x98, 0xd5,
+    0x07, 0x4a, 0x7d, 0x2a, 0x58, 0xae, 0x87, 0x10,
+    0x8e, 0x8e, 0xcc, 0xdf, 0x61, 0xc8, 0xc2, 0xf5,
+    0xcc, 0x9f, 0x30, 0x3f, 0xfc, 0xdd, 0x9a, 0xcb,
+    0x64, 0xd9, 0x0d, 0x27, 0xce, 0xba, 0xc7, 0x85,
+    0xc5, 0x58, 0xbd, 0x72, 0x04, 0x76, 0x76, 0xde,
+    0x9f, 0xf7, 0x7d, 0x5a, 0x18, 0xa9, 0x1d, 0xbe,
+    0x1a, 0xe4, 0x12, 0x73, 0xd0, 0xc3, 0x2b, 0xbf,
+    0x0c, 0xad, 0x87, 0xc6, 0x24, 0x2a, 0x0b, 0xae,
+    0x43, 0xc6, 0xc2, 0xea, 0xb0, 0x8e, 0xc6, 0xbd,
+    0x88, 0xf9, 0xe7, 0xf1, 0xea, 0x8b, 0x64, 0xa8,
+    0x8e, 0x07, 0x92, 0x54, 0xa0, 0x87, 0xbe, 0x4b,
+    0xbe, 0xc3, 0x77, 0x13, 0x29, 0x04, 0xe8, 0xa6,
+    0x7f, 0xbe, 0xa7, 0x81, 0x71, 0xd0, 0xd6, 0x79,
+    0x01, 0xd6, 0xcb, 0x6a, 0xf2, 0xd5, 0x88, 0xc6,
+    0x4b, 0x30, 0x7a, 0x92, 0xd3, 0xe5, 0x7f, 0xeb,
+    0x58, 0x75, 0xc8, 0x4a, 0x70, 0xb7, 0x4d, 0x2b,
+    0x28, 0x7c, 0xe2, 0x24, 0x9b, 0x68, 0x5b, 0x01,
+    0xfc, 0x15, 0xdc, 0x81, 0x2f, 0x5a, 0x84, 0xaf,
+    0xad, 0x3f, 0x6b, 0xef, 0x7a, 0x0d, 0x1d, 0xe1,
+    0x01, 0xaa, 0x73, 0xa8, 0xcd, 0x52, 0x99, 0x76,
+    0x8d, 0x1d, 0xa1, 0x9e, 0xc6, 0xef, 0x0b, 0xd6,
+    0x7c, 0x60, 0xfc, 0x03, 0x02, 0xba, 0x74, 0x4b,
+    0x7a, 0x0c, 0x00, 0x00,
 };
 
 static const uint8_t data_javascript_js[] =
@@ -2029,93 +2271,514 @@ static const uint8_t data_javascript_js[] =
     0x2f, 0x6a, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72,
     0x69, 0x70, 0x74, 0x2e, 0x6a, 0x73, 0x00,
     0x76, 0x61, 0x72, 0x20, 0x69, 0x6e, 0x74, 0x65,
-    0x72, 0x76, 0x61, 0x6c, 0x3b, 0x0d, 0x0a, 0x77,
-    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x6f, 0x6e,
-    0x6c, 0x6f, 0x61, 0x64, 0x20, 0x3d, 0x20, 0x66,
+    0x72, 0x76, 0x61, 0x6c, 0x3b, 0x0d, 0x0a, 0x76,
+    0x61, 0x72, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74,
+    0x73, 0x3b, 0x0d, 0x0a, 0x76, 0x61, 0x72, 0x20,
+    0x77, 0x73, 0x3b, 0x0d, 0x0a, 0x76, 0x61, 0x72,
+    0x20, 0x69, 0x6f, 0x53, 0x74, 0x61, 0x74, 0x75,
+    0x73, 0x3b, 0x0d, 0x0a, 0x77, 0x69, 0x6e, 0x64,
+    0x6f, 0x77, 0x2e, 0x6f, 0x6e, 0x6c, 0x6f, 0x61,
+    0x64, 0x20, 0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63,
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x0d,
+    0x0a, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x64, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67,
+    0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+    0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x61,
+    0x62, 0x6f, 0x75, 0x74, 0x27, 0x29, 0x2e, 0x6f,
+    0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x20, 0x3d,
+    0x20, 0x6c, 0x6f, 0x61, 0x64, 0x41, 0x62, 0x6f,
+    0x75, 0x74, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x64,
+    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
+    0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+    0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
+    0x69, 0x6f, 0x5f, 0x68, 0x74, 0x74, 0x70, 0x27,
+    0x29, 0x2e, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63,
+    0x6b, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x61, 0x64,
+    0x49, 0x4f, 0x48, 0x74, 0x74, 0x70, 0x3b, 0x0d,
+    0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x61,
+    0x64, 0x41, 0x62, 0x6f, 0x75, 0x74, 0x28, 0x29,
+    0x3b, 0x0d, 0x0a, 0x0d, 0x0a, 0x7d, 0x0d, 0x0a,
+    0x0d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x41,
+    0x62, 0x6f, 0x75, 0x74, 0x28, 0x29, 0x0d, 0x0a,
+    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x61,
+    0x64, 0x50, 0x61, 0x67, 0x65, 0x28, 0x22, 0x61,
+    0x62, 0x6f, 0x75, 0x74, 0x2e, 0x68, 0x74, 0x6d,
+    0x22, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61,
+    0x6c, 0x73, 0x65, 0x3b, 0x0d, 0x0a, 0x7d, 0x0d,
+    0x0a, 0x0d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x61, 0x64,
+    0x4f, 0x76, 0x65, 0x72, 0x76, 0x69, 0x65, 0x77,
+    0x28, 0x29, 0x0d, 0x0a, 0x7b, 0x0d, 0x0a, 0x20,
+    0x20, 0x6c, 0x6f, 0x61, 0x64, 0x50, 0x61, 0x67,
+    0x65, 0x28, 0x22, 0x6f, 0x76, 0x65, 0x72, 0x76,
+    0x69, 0x65, 0x77, 0x2e, 0x68, 0x74, 0x6d, 0x22,
+    0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c,
+    0x73, 0x65, 0x3b, 0x0d, 0x0a, 0x7d, 0x0d, 0x0a,
+    0x0d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x42,
+    0x6c, 0x6f, 0x63, 0x6b, 0x28, 0x29, 0x0d, 0x0a,
+    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x61,
+    0x64, 0x50, 0x61, 0x67, 0x65, 0x28, 0x22, 0x62,
+    0x6c, 0x6f, 0x63, 0x6b, 0x2e, 0x68, 0x74, 0x6d,
+    0x22, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61,
+    0x6c, 0x73, 0x65, 0x3b, 0x0d, 0x0a, 0x7d, 0x0d,
+    0x0a, 0x0d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x61, 0x64,
+    0x49, 0x4f, 0x48, 0x74, 0x74, 0x70, 0x28, 0x29,
+    0x0d, 0x0a, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x6c,
+    0x6f, 0x61, 0x64, 0x50, 0x61, 0x67, 0x65, 0x28,
+    0x22, 0x69, 0x6f, 0x5f, 0x68, 0x74, 0x74, 0x70,
+    0x2e, 0x68, 0x74, 0x6d, 0x22, 0x29, 0x3b, 0x0d,
+    0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21,
+    0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x53, 0x74,
+    0x61, 0x72, 0x74, 0x28, 0x29, 0x29, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74,
+    0x75, 0x73, 0x47, 0x65, 0x74, 0x28, 0x29, 0x3b,
+    0x0d, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65,
+    0x3b, 0x0d, 0x0a, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x20, 0x53, 0x65, 0x74, 0x46, 0x6f, 0x72, 0x6d,
+    0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73,
+    0x28, 0x29, 0x0d, 0x0a, 0x7b, 0x0d, 0x0a, 0x20,
+    0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+    0x74, 0x2e, 0x69, 0x6f, 0x63, 0x6f, 0x6e, 0x74,
+    0x72, 0x6f, 0x6c, 0x2e, 0x4c, 0x45, 0x44, 0x4f,
+    0x6e, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65,
+    0x64, 0x20, 0x3d, 0x20, 0x6c, 0x73, 0x3b, 0x0d,
+    0x0a, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+    0x65, 0x6e, 0x74, 0x2e, 0x69, 0x6f, 0x63, 0x6f,
+    0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x2e, 0x73, 0x70,
+    0x65, 0x65, 0x64, 0x5f, 0x70, 0x65, 0x72, 0x63,
+    0x65, 0x6e, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75,
+    0x65, 0x20, 0x3d, 0x20, 0x73, 0x70, 0x3b, 0x0d,
+    0x0a, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x66, 0x75,
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74,
+    0x6f, 0x67, 0x67, 0x6c, 0x65, 0x5f, 0x6c, 0x65,
+    0x64, 0x28, 0x29, 0x0d, 0x0a, 0x7b, 0x0d, 0x0a,
+    0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x72, 0x65,
+    0x71, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73,
+    0x65, 0x3b, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20,
+    0x69, 0x66, 0x20, 0x28, 0x77, 0x73, 0x53, 0x65,
+    0x6e, 0x64, 0x28, 0x5b, 0x57, 0x53, 0x5f, 0x43,
+    0x4d, 0x44, 0x5f, 0x54, 0x4f, 0x47, 0x47, 0x4c,
+    0x45, 0x5f, 0x4c, 0x45, 0x44, 0x5d, 0x29, 0x29,
+    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0d, 0x0a, 0x0d,
+    0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x20, 0x54, 0x6f, 0x67, 0x67,
+    0x6c, 0x65, 0x43, 0x6f, 0x6d, 0x70, 0x6c, 0x65,
+    0x74, 0x65, 0x28, 0x29, 0x0d, 0x0a, 0x20, 0x20,
+    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+    0x66, 0x20, 0x28, 0x72, 0x65, 0x71, 0x2e, 0x72,
+    0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74,
+    0x65, 0x20, 0x3d, 0x3d, 0x20, 0x34, 0x29, 0x20,
+    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x69, 0x66, 0x20, 0x28, 0x72, 0x65, 0x71,
+    0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20,
+    0x3d, 0x3d, 0x20, 0x32, 0x30, 0x30, 0x29, 0x20,
+    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+    0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45,
+    0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79,
+    0x49, 0x64, 0x28, 0x22, 0x6c, 0x65, 0x64, 0x73,
+    0x74, 0x61, 0x74, 0x65, 0x22, 0x29, 0x2e, 0x69,
+    0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c,
+    0x20, 0x3d, 0x20, 0x22, 0x3c, 0x64, 0x69, 0x76,
+    0x3e, 0x22, 0x20, 0x2b, 0x0d, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x72, 0x65, 0x71, 0x2e, 0x72, 0x65, 0x73, 0x70,
+    0x6f, 0x6e, 0x73, 0x65, 0x54, 0x65, 0x78, 0x74,
+    0x20, 0x2b, 0x20, 0x22, 0x3c, 0x2f, 0x64, 0x69,
+    0x76, 0x3e, 0x22, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20,
+    0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x69,
+    0x66, 0x20, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f,
+    0x77, 0x2e, 0x58, 0x4d, 0x4c, 0x48, 0x74, 0x74,
+    0x70, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
+    0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x72, 0x65, 0x71, 0x20, 0x3d, 0x20, 0x6e,
+    0x65, 0x77, 0x20, 0x58, 0x4d, 0x4c, 0x48, 0x74,
+    0x74, 0x70, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73,
+    0x74, 0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
+    0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x65, 0x6c, 0x73,
+    0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x77, 0x69,
+    0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x41, 0x63, 0x74,
+    0x69, 0x76, 0x65, 0x58, 0x4f, 0x62, 0x6a, 0x65,
+    0x63, 0x74, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x20, 0x3d,
+    0x20, 0x6e, 0x65, 0x77, 0x20, 0x41, 0x63, 0x74,
+    0x69, 0x76, 0x65, 0x58, 0x4f, 0x62, 0x6a, 0x65,
+    0x63, 0x74, 0x28, 0x22, 0x4d, 0x69, 0x63, 0x72,
+    0x6f, 0x73, 0x6f, 0x66, 0x74, 0x2e, 0x58, 0x4d,
+    0x4c, 0x48, 0x54, 0x54, 0x50, 0x22, 0x29, 0x3b,
+    0x0d, 0x0a, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20,
+    0x20, 0x69, 0x66, 0x20, 0x28, 0x72, 0x65, 0x71,
+    0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x72, 0x65, 0x71, 0x2e, 0x6f, 0x70, 0x65,
+    0x6e, 0x28, 0x22, 0x47, 0x45, 0x54, 0x22, 0x2c,
+    0x20, 0x22, 0x2f, 0x63, 0x67, 0x69, 0x2d, 0x62,
+    0x69, 0x6e, 0x2f, 0x74, 0x6f, 0x67, 0x67, 0x6c,
+    0x65, 0x5f, 0x6c, 0x65, 0x64, 0x3f, 0x69, 0x64,
+    0x22, 0x20, 0x2b, 0x20, 0x4d, 0x61, 0x74, 0x68,
+    0x2e, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x28, 0x4d,
+    0x61, 0x74, 0x68, 0x2e, 0x72, 0x61, 0x6e, 0x64,
+    0x6f, 0x6d, 0x28, 0x29, 0x2a, 0x31, 0x30, 0x30,
+    0x30, 0x29, 0x2c, 0x20, 0x74, 0x72, 0x75, 0x65,
+    0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x72, 0x65, 0x71, 0x2e, 0x6f, 0x6e, 0x72, 0x65,
+    0x61, 0x64, 0x79, 0x73, 0x74, 0x61, 0x74, 0x65,
+    0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x3d,
+    0x20, 0x54, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x43,
+    0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x3b,
+    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+    0x71, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x6e,
+    0x75, 0x6c, 0x6c, 0x29, 0x3b, 0x0d, 0x0a, 0x20,
+    0x20, 0x7d, 0x0d, 0x0a, 0x7d, 0x0d, 0x0a, 0x0d,
+    0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x47,
+    0x65, 0x74, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x76,
+    0x61, 0x6c, 0x28, 0x29, 0x0d, 0x0a, 0x7b, 0x0d,
+    0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65,
+    0x76, 0x65, 0x6e, 0x74, 0x73, 0x53, 0x74, 0x61,
+    0x72, 0x74, 0x28, 0x29, 0x29, 0x20, 0x7b, 0x0d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+    0x53, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x74,
+    0x6f, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x6d, 0x61,
+    0x74, 0x69, 0x63, 0x20, 0x6d, 0x6f, 0x64, 0x65,
+    0x3b, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70,
+    0x65, 0x65, 0x64, 0x20, 0x69, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x6e, 0x20, 0x70, 0x75, 0x73, 0x68,
+    0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
+    0x2e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+    0x66, 0x20, 0x28, 0x21, 0x77, 0x73, 0x53, 0x65,
+    0x6e, 0x64, 0x28, 0x5b, 0x57, 0x53, 0x5f, 0x43,
+    0x4d, 0x44, 0x5f, 0x41, 0x55, 0x54, 0x4f, 0x4d,
+    0x41, 0x54, 0x49, 0x43, 0x5d, 0x29, 0x29, 0x0d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
+    0x70, 0x65, 0x65, 0x64, 0x47, 0x65, 0x74, 0x28,
+    0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0d,
+    0x0a, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20,
+    0x69, 0x66, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x65,
+    0x72, 0x76, 0x61, 0x6c, 0x29, 0x0d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6e, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x2f, 0x2f,
+    0x20, 0x2f, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x70,
+    0x65, 0x65, 0x64, 0x20, 0x73, 0x65, 0x6c, 0x65,
+    0x63, 0x74, 0x73, 0x20, 0x61, 0x75, 0x74, 0x6f,
+    0x6d, 0x61, 0x74, 0x69, 0x63, 0x20, 0x6d, 0x6f,
+    0x64, 0x65, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e,
+    0x20, 0x70, 0x6f, 0x6c, 0x6c, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x20,
+    0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x0d, 0x0a,
+    0x20, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x47,
+    0x65, 0x74, 0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x20,
+    0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61,
+    0x6c, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x49,
+    0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x28,
+    0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x47, 0x65,
+    0x74, 0x2c, 0x20, 0x35, 0x30, 0x30, 0x29, 0x0d,
+    0x0a, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x2f, 0x2f,
+    0x20, 0x53, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69,
+    0x62, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20,
+    0x70, 0x75, 0x73, 0x68, 0x65, 0x64, 0x20, 0x62,
+    0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65,
+    0x72, 0x76, 0x65, 0x72, 0x2c, 0x20, 0x6f, 0x76,
+    0x65, 0x72, 0x20, 0x61, 0x20, 0x57, 0x65, 0x62,
+    0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x69,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x0d, 0x0a, 0x2f,
+    0x2f, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x73, 0x65,
+    0x72, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72,
+    0x74, 0x73, 0x20, 0x69, 0x74, 0x20, 0x61, 0x6e,
+    0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65,
+    0x72, 0x76, 0x65, 0x72, 0x20, 0x61, 0x63, 0x63,
+    0x65, 0x70, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x6f, 0x74, 0x68,
+    0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x6f,
+    0x76, 0x65, 0x72, 0x0d, 0x0a, 0x2f, 0x2f, 0x20,
+    0x2f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e,
+    0x20, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e,
+    0x73, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x20,
+    0x69, 0x66, 0x20, 0x6e, 0x65, 0x69, 0x74, 0x68,
+    0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x61, 0x76,
+    0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x2c,
+    0x20, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x69, 0x63,
+    0x68, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x70, 0x61, 0x67, 0x65, 0x0d,
+    0x0a, 0x2f, 0x2f, 0x20, 0x66, 0x61, 0x6c, 0x6c,
+    0x73, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x74,
+    0x6f, 0x20, 0x70, 0x6f, 0x6c, 0x6c, 0x69, 0x6e,
+    0x67, 0x2e, 0x0d, 0x0a, 0x66, 0x75, 0x6e, 0x63,
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x65, 0x76, 0x65,
+    0x6e, 0x74, 0x73, 0x53, 0x74, 0x61, 0x72, 0x74,
+    0x28, 0x29, 0x0d, 0x0a, 0x7b, 0x0d, 0x0a, 0x20,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+    0x77, 0x73, 0x53, 0x74, 0x61, 0x72, 0x74, 0x28,
+    0x29, 0x20, 0x7c, 0x7c, 0x20, 0x73, 0x73, 0x65,
+    0x53, 0x74, 0x61, 0x72, 0x74, 0x28, 0x29, 0x3b,
+    0x0d, 0x0a, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x2f,
+    0x2f, 0x20, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e,
+    0x64, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6d,
+    0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x73, 0x20,
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+    0x69, 0x6e, 0x61, 0x72, 0x79, 0x20, 0x57, 0x65,
+    0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20,
+    0x70, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c,
+    0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x69, 0x6f,
+    0x5f, 0x77, 0x73, 0x2e, 0x68, 0x29, 0x2e, 0x0d,
+    0x0a, 0x76, 0x61, 0x72, 0x20, 0x57, 0x53, 0x5f,
+    0x43, 0x4d, 0x44, 0x5f, 0x53, 0x45, 0x54, 0x5f,
+    0x53, 0x50, 0x45, 0x45, 0x44, 0x20, 0x3d, 0x20,
+    0x30, 0x78, 0x30, 0x31, 0x3b, 0x0d, 0x0a, 0x76,
+    0x61, 0x72, 0x20, 0x57, 0x53, 0x5f, 0x43, 0x4d,
+    0x44, 0x5f, 0x54, 0x4f, 0x47, 0x47, 0x4c, 0x45,
+    0x5f, 0x4c, 0x45, 0x44, 0x20, 0x3d, 0x20, 0x30,
+    0x78, 0x30, 0x32, 0x3b, 0x0d, 0x0a, 0x76, 0x61,
+    0x72, 0x20, 0x57, 0x53, 0x5f, 0x43, 0x4d, 0x44,
+    0x5f, 0x41, 0x55, 0x54, 0x4f, 0x4d, 0x41, 0x54,
+    0x49, 0x43, 0x20, 0x3d, 0x20, 0x30, 0x78, 0x30,
+    0x33, 0x3b, 0x0d, 0x0a, 0x76, 0x61, 0x72, 0x20,
+    0x57, 0x53, 0x5f, 0x4d, 0x53, 0x47, 0x5f, 0x53,
+    0x54, 0x41, 0x54, 0x55, 0x53, 0x20, 0x3d, 0x20,
+    0x30, 0x78, 0x38, 0x31, 0x3b, 0x0d, 0x0a, 0x0d,
+    0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x20, 0x77, 0x73, 0x53, 0x74, 0x61, 0x72,
+    0x74, 0x28, 0x29, 0x0d, 0x0a, 0x7b, 0x0d, 0x0a,
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x77,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x57, 0x65,
+    0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20,
+    0x7c, 0x7c, 0x20, 0x21, 0x77, 0x69, 0x6e, 0x64,
+    0x6f, 0x77, 0x2e, 0x44, 0x61, 0x74, 0x61, 0x56,
+    0x69, 0x65, 0x77, 0x20, 0x7c, 0x7c, 0x20, 0x28,
+    0x77, 0x73, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x66,
+    0x61, 0x6c, 0x73, 0x65, 0x29, 0x29, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65,
+    0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
+    0x28, 0x21, 0x77, 0x73, 0x29, 0x20, 0x7b, 0x0d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x73, 0x20,
+    0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x57, 0x65,
+    0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x28,
+    0x22, 0x77, 0x73, 0x3a, 0x2f, 0x2f, 0x22, 0x20,
+    0x2b, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69,
+    0x6f, 0x6e, 0x2e, 0x68, 0x6f, 0x73, 0x74, 0x20,
+    0x2b, 0x20, 0x22, 0x2f, 0x77, 0x73, 0x22, 0x29,
+    0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77,
+    0x73, 0x2e, 0x62, 0x69, 0x6e, 0x61, 0x72, 0x79,
+    0x54, 0x79, 0x70, 0x65, 0x20, 0x3d, 0x20, 0x22,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x22, 0x3b, 0x0d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x77, 0x73, 0x2e, 0x6f, 0x6e,
+    0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20,
+    0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x20, 0x28, 0x65, 0x29, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x7b, 0x0d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72,
+    0x20, 0x76, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77,
+    0x20, 0x44, 0x61, 0x74, 0x61, 0x56, 0x69, 0x65,
+    0x77, 0x28, 0x65, 0x2e, 0x64, 0x61, 0x74, 0x61,
+    0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x76,
+    0x2e, 0x62, 0x79, 0x74, 0x65, 0x4c, 0x65, 0x6e,
+    0x67, 0x74, 0x68, 0x20, 0x3e, 0x3d, 0x20, 0x37,
+    0x29, 0x20, 0x26, 0x26, 0x20, 0x28, 0x76, 0x2e,
+    0x67, 0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x38,
+    0x28, 0x30, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x57,
+    0x53, 0x5f, 0x4d, 0x53, 0x47, 0x5f, 0x53, 0x54,
+    0x41, 0x54, 0x55, 0x53, 0x29, 0x29, 0x20, 0x7b,
+    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x69, 0x6f, 0x53, 0x74, 0x61, 0x74,
+    0x75, 0x73, 0x20, 0x3d, 0x20, 0x7b, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x3a,
+    0x20, 0x76, 0x2e, 0x67, 0x65, 0x74, 0x55, 0x69,
+    0x6e, 0x74, 0x38, 0x28, 0x31, 0x29, 0x2c, 0x0d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3a,
+    0x20, 0x76, 0x2e, 0x67, 0x65, 0x74, 0x55, 0x69,
+    0x6e, 0x74, 0x38, 0x28, 0x32, 0x29, 0x20, 0x26,
+    0x20, 0x31, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
+    0x65, 0x64, 0x3a, 0x20, 0x28, 0x76, 0x2e, 0x67,
+    0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x28,
+    0x32, 0x29, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29,
+    0x20, 0x26, 0x20, 0x31, 0x2c, 0x0d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x66, 0x72, 0x65, 0x71, 0x3a, 0x20, 0x76,
+    0x2e, 0x67, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x33,
+    0x32, 0x28, 0x33, 0x2c, 0x20, 0x74, 0x72, 0x75,
+    0x65, 0x29, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x7d, 0x3b, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x53, 0x68,
+    0x6f, 0x77, 0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x77, 0x73, 0x2e, 0x6f, 0x6e,
+    0x63, 0x6c, 0x6f, 0x73, 0x65, 0x20, 0x3d, 0x20,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x20, 0x28, 0x29, 0x0d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x2f, 0x2f, 0x20, 0x52, 0x65, 0x66,
+    0x75, 0x73, 0x65, 0x64, 0x20, 0x6f, 0x72, 0x20,
+    0x6c, 0x6f, 0x73, 0x74, 0x3a, 0x20, 0x63, 0x61,
+    0x72, 0x72, 0x79, 0x20, 0x6f, 0x6e, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x2f, 0x65, 0x76, 0x65,
+    0x6e, 0x74, 0x73, 0x2e, 0x0d, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x77, 0x73, 0x20, 0x3d,
+    0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
+    0x73, 0x65, 0x53, 0x74, 0x61, 0x72, 0x74, 0x28,
+    0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x7d, 0x0d, 0x0a,
+    0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+    0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x0d, 0x0a,
+    0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x2f, 0x2f, 0x20,
+    0x53, 0x65, 0x6e, 0x64, 0x20, 0x61, 0x20, 0x63,
+    0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x6f,
+    0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65,
+    0x74, 0x2e, 0x20, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6e, 0x73, 0x20, 0x66, 0x61, 0x6c, 0x73,
+    0x65, 0x20, 0x69, 0x66, 0x20, 0x69, 0x74, 0x20,
+    0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6f,
+    0x70, 0x65, 0x6e, 0x2e, 0x0d, 0x0a, 0x66, 0x75,
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77,
+    0x73, 0x53, 0x65, 0x6e, 0x64, 0x28, 0x62, 0x79,
+    0x74, 0x65, 0x73, 0x29, 0x0d, 0x0a, 0x7b, 0x0d,
+    0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21,
+    0x77, 0x73, 0x20, 0x7c, 0x7c, 0x20, 0x28, 0x77,
+    0x73, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53,
+    0x74, 0x61, 0x74, 0x65, 0x20, 0x21, 0x3d, 0x20,
+    0x31, 0x29, 0x29, 0x0d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+    0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0d, 0x0a,
+    0x20, 0x20, 0x77, 0x73, 0x2e, 0x73, 0x65, 0x6e,
+    0x64, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69,
+    0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79,
+    0x28, 0x62, 0x79, 0x74, 0x65, 0x73, 0x29, 0x2e,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x29, 0x3b,
+    0x0d, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6e, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b,
+    0x0d, 0x0a, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x66,
     0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+    0x73, 0x73, 0x65, 0x53, 0x74, 0x61, 0x72, 0x74,
     0x28, 0x29, 0x0d, 0x0a, 0x7b, 0x0d, 0x0a, 0x20,
+    0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x77, 0x69,
+    0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x45, 0x76, 0x65,
+    0x6e, 0x74, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65,
+    0x29, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61,
+    0x6c, 0x73, 0x65, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
+    0x69, 0x66, 0x20, 0x28, 0x21, 0x65, 0x76, 0x65,
+    0x6e, 0x74, 0x73, 0x29, 0x20, 0x7b, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x76, 0x65, 0x6e,
+    0x74, 0x73, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77,
+    0x20, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x53, 0x6f,
+    0x75, 0x72, 0x63, 0x65, 0x28, 0x22, 0x2f, 0x65,
+    0x76, 0x65, 0x6e, 0x74, 0x73, 0x22, 0x29, 0x3b,
+    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x76,
+    0x65, 0x6e, 0x74, 0x73, 0x2e, 0x6f, 0x6e, 0x6d,
+    0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x3d,
+    0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x20, 0x28, 0x65, 0x29, 0x0d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x6f, 0x53, 0x74,
+    0x61, 0x74, 0x75, 0x73, 0x20, 0x3d, 0x20, 0x4a,
+    0x53, 0x4f, 0x4e, 0x2e, 0x70, 0x61, 0x72, 0x73,
+    0x65, 0x28, 0x65, 0x2e, 0x64, 0x61, 0x74, 0x61,
+    0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x53, 0x68, 0x6f, 0x77, 0x28, 0x29, 0x3b, 0x0d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a,
+    0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x72,
+    0x75, 0x65, 0x3b, 0x0d, 0x0a, 0x7d, 0x0d, 0x0a,
+    0x0d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75,
+    0x73, 0x53, 0x68, 0x6f, 0x77, 0x28, 0x29, 0x0d,
+    0x0a, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x76, 0x61,
+    0x72, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20,
+    0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+    0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49,
+    0x64, 0x28, 0x22, 0x63, 0x75, 0x72, 0x72, 0x65,
+    0x6e, 0x74, 0x5f, 0x73, 0x70, 0x65, 0x65, 0x64,
+    0x22, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x76,
+    0x61, 0x72, 0x20, 0x6c, 0x65, 0x64, 0x20, 0x3d,
     0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
     0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65,
     0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64,
-    0x28, 0x27, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x27,
-    0x29, 0x2e, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63,
-    0x6b, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x61, 0x64,
-    0x41, 0x62, 0x6f, 0x75, 0x74, 0x3b, 0x0d, 0x0a,
-    0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
-    0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c,
-    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49,
-    0x64, 0x28, 0x27, 0x69, 0x6f, 0x5f, 0x68, 0x74,
-    0x74, 0x70, 0x27, 0x29, 0x2e, 0x6f, 0x6e, 0x63,
-    0x6c, 0x69, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x6c,
-    0x6f, 0x61, 0x64, 0x49, 0x4f, 0x48, 0x74, 0x74,
-    0x70, 0x3b, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20,
-    0x6c, 0x6f, 0x61, 0x64, 0x41, 0x62, 0x6f, 0x75,
-    0x74, 0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x0d, 0x0a,
-    0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x66, 0x75, 0x6e,
-    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f,
-    0x61, 0x64, 0x41, 0x62, 0x6f, 0x75, 0x74, 0x28,
-    0x29, 0x0d, 0x0a, 0x7b, 0x0d, 0x0a, 0x20, 0x20,
-    0x6c, 0x6f, 0x61, 0x64, 0x50, 0x61, 0x67, 0x65,
-    0x28, 0x22, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x2e,
-    0x68, 0x74, 0x6d, 0x22, 0x29, 0x3b, 0x0d, 0x0a,
-    0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
-    0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0d,
-    0x0a, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x66, 0x75,
-    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c,
-    0x6f, 0x61, 0x64, 0x4f, 0x76, 0x65, 0x72, 0x76,
-    0x69, 0x65, 0x77, 0x28, 0x29, 0x0d, 0x0a, 0x7b,
-    0x0d, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x61, 0x64,
-    0x50, 0x61, 0x67, 0x65, 0x28, 0x22, 0x6f, 0x76,
-    0x65, 0x72, 0x76, 0x69, 0x65, 0x77, 0x2e, 0x68,
-    0x74, 0x6d, 0x22, 0x29, 0x3b, 0x0d, 0x0a, 0x20,
-    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
-    0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0d, 0x0a,
-    0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x66, 0x75, 0x6e,
-    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f,
-    0x61, 0x64, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x28,
-    0x29, 0x0d, 0x0a, 0x7b, 0x0d, 0x0a, 0x20, 0x20,
-    0x6c, 0x6f, 0x61, 0x64, 0x50, 0x61, 0x67, 0x65,
-    0x28, 0x22, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x2e,
-    0x68, 0x74, 0x6d, 0x22, 0x29, 0x3b, 0x0d, 0x0a,
+    0x28, 0x22, 0x6c, 0x65, 0x64, 0x73, 0x74, 0x61,
+    0x74, 0x65, 0x22, 0x29, 0x3b, 0x0d, 0x0a, 0x0d,
+    0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21,
+    0x69, 0x6f, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x29, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0d, 0x0a,
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x70,
+    0x65, 0x65, 0x64, 0x29, 0x0d, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x2e,
+    0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d,
+    0x4c, 0x20, 0x3d, 0x20, 0x22, 0x3c, 0x64, 0x69,
+    0x76, 0x3e, 0x22, 0x20, 0x2b, 0x20, 0x69, 0x6f,
+    0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2e, 0x73,
+    0x70, 0x65, 0x65, 0x64, 0x20, 0x2b, 0x20, 0x22,
+    0x25, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x22,
+    0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
+    0x28, 0x6c, 0x65, 0x64, 0x29, 0x0d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x6c, 0x65, 0x64, 0x2e, 0x69,
+    0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c,
+    0x20, 0x3d, 0x20, 0x22, 0x3c, 0x64, 0x69, 0x76,
+    0x3e, 0x22, 0x20, 0x2b, 0x20, 0x28, 0x69, 0x6f,
+    0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2e, 0x6c,
+    0x65, 0x64, 0x20, 0x3f, 0x20, 0x22, 0x4f, 0x4e,
+    0x22, 0x20, 0x3a, 0x20, 0x22, 0x4f, 0x46, 0x46,
+    0x22, 0x29, 0x20, 0x2b, 0x20, 0x22, 0x3c, 0x2f,
+    0x64, 0x69, 0x76, 0x3e, 0x22, 0x3b, 0x0d, 0x0a,
+    0x7d, 0x0d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x20, 0x73, 0x70, 0x65, 0x65,
+    0x64, 0x53, 0x65, 0x74, 0x28, 0x29, 0x0d, 0x0a,
+    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
+    0x28, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61,
+    0x6c, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x49,
+    0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x28,
+    0x69, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c,
+    0x29, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+    0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x20,
+    0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x0d,
+    0x0a, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a,
+    0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x72, 0x65,
+    0x71, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73,
+    0x65, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x76, 0x61,
+    0x72, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x5f,
+    0x74, 0x78, 0x74, 0x20, 0x3d, 0x20, 0x64, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67,
+    0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+    0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x73,
+    0x70, 0x65, 0x65, 0x64, 0x5f, 0x70, 0x65, 0x72,
+    0x63, 0x65, 0x6e, 0x74, 0x22, 0x29, 0x3b, 0x0d,
+    0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
+    0x28, 0x77, 0x73, 0x53, 0x65, 0x6e, 0x64, 0x28,
+    0x5b, 0x57, 0x53, 0x5f, 0x43, 0x4d, 0x44, 0x5f,
+    0x53, 0x45, 0x54, 0x5f, 0x53, 0x50, 0x45, 0x45,
+    0x44, 0x2c, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64,
+    0x5f, 0x74, 0x78, 0x74, 0x2e, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x20, 0x26, 0x20, 0x30, 0x78, 0x66,
+    0x66, 0x5d, 0x29, 0x29, 0x0d, 0x0a, 0x20, 0x20,
     0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
-    0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0d,
-    0x0a, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x66, 0x75,
-    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c,
-    0x6f, 0x61, 0x64, 0x49, 0x4f, 0x48, 0x74, 0x74,
-    0x70, 0x28, 0x29, 0x0d, 0x0a, 0x7b, 0x0d, 0x0a,
-    0x20, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x50, 0x61,
-    0x67, 0x65, 0x28, 0x22, 0x69, 0x6f, 0x5f, 0x68,
-    0x74, 0x74, 0x70, 0x2e, 0x68, 0x74, 0x6d, 0x22,
-    0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x6c, 0x65,
-    0x64, 0x73, 0x74, 0x61, 0x74, 0x65, 0x47, 0x65,
-    0x74, 0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-    0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66,
-    0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0d, 0x0a, 0x7d,
-    0x0d, 0x0a, 0x0d, 0x0a, 0x66, 0x75, 0x6e, 0x63,
-    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x53, 0x65, 0x74,
-    0x46, 0x6f, 0x72, 0x6d, 0x44, 0x65, 0x66, 0x61,
-    0x75, 0x6c, 0x74, 0x73, 0x28, 0x29, 0x0d, 0x0a,
-    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x64, 0x6f, 0x63,
-    0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x69, 0x6f,
-    0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x2e,
-    0x4c, 0x45, 0x44, 0x4f, 0x6e, 0x2e, 0x63, 0x68,
-    0x65, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x3d, 0x20,
-    0x6c, 0x73, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x64,
-    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
-    0x69, 0x6f, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f,
-    0x6c, 0x2e, 0x73, 0x70, 0x65, 0x65, 0x64, 0x5f,
-    0x70, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x2e,
-    0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20,
-    0x73, 0x70, 0x3b, 0x0d, 0x0a, 0x7d, 0x0d, 0x0a,
-    0x0d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
-    0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x67, 0x67, 0x6c,
-    0x65, 0x5f, 0x6c, 0x65, 0x64, 0x28, 0x29, 0x0d,
-    0x0a, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x76, 0x61,
-    0x72, 0x20, 0x72, 0x65, 0x71, 0x20, 0x3d, 0x20,
-    0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0d, 0x0a,
-    0x0d, 0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63,
-    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x54, 0x6f, 0x67,
-    0x67, 0x6c, 0x65, 0x43, 0x6f, 0x6d, 0x70, 0x6c,
+    0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x70,
+    0x65, 0x65, 0x64, 0x43, 0x6f, 0x6d, 0x70, 0x6c,
     0x65, 0x74, 0x65, 0x28, 0x29, 0x0d, 0x0a, 0x20,
     0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
     0x69, 0x66, 0x20, 0x28, 0x72, 0x65, 0x71, 0x2e,
@@ -2129,126 +2792,103 @@ static const uint8_t data_javascript_js[] =
     0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75,
     0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74,
     0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42,
-    0x79, 0x49, 0x64, 0x28, 0x22, 0x6c, 0x65, 0x64,
-    0x73, 0x74, 0x61, 0x74, 0x65, 0x22, 0x29, 0x2e,
-    0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d,
-    0x4c, 0x20, 0x3d, 0x20, 0x22, 0x3c, 0x64, 0x69,
-    0x76, 0x3e, 0x22, 0x20, 0x2b, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x72, 0x65, 0x71, 0x2e, 0x72, 0x65, 0x73,
-    0x70, 0x6f, 0x6e, 0x73, 0x65, 0x54, 0x65, 0x78,
-    0x74, 0x20, 0x2b, 0x20, 0x22, 0x3c, 0x2f, 0x64,
-    0x69, 0x76, 0x3e, 0x22, 0x3b, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20,
-    0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20,
-    0x69, 0x66, 0x20, 0x28, 0x77, 0x69, 0x6e, 0x64,
-    0x6f, 0x77, 0x2e, 0x58, 0x4d, 0x4c, 0x48, 0x74,
-    0x74, 0x70, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73,
-    0x74, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x72, 0x65, 0x71, 0x20, 0x3d, 0x20,
-    0x6e, 0x65, 0x77, 0x20, 0x58, 0x4d, 0x4c, 0x48,
-    0x74, 0x74, 0x70, 0x52, 0x65, 0x71, 0x75, 0x65,
-    0x73, 0x74, 0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x20,
-    0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x65, 0x6c,
-    0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x77,
-    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x41, 0x63,
-    0x74, 0x69, 0x76, 0x65, 0x58, 0x4f, 0x62, 0x6a,
-    0x65, 0x63, 0x74, 0x29, 0x20, 0x7b, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x20,
-    0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x41, 0x63,
-    0x74, 0x69, 0x76, 0x65, 0x58, 0x4f, 0x62, 0x6a,
-    0x65, 0x63, 0x74, 0x28, 0x22, 0x4d, 0x69, 0x63,
-    0x72, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x2e, 0x58,
-    0x4d, 0x4c, 0x48, 0x54, 0x54, 0x50, 0x22, 0x29,
-    0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x7d, 0x0d, 0x0a,
-    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x72, 0x65,
-    0x71, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x72, 0x65, 0x71, 0x2e, 0x6f, 0x70,
-    0x65, 0x6e, 0x28, 0x22, 0x47, 0x45, 0x54, 0x22,
-    0x2c, 0x20, 0x22, 0x2f, 0x63, 0x67, 0x69, 0x2d,
-    0x62, 0x69, 0x6e, 0x2f, 0x74, 0x6f, 0x67, 0x67,
-    0x6c, 0x65, 0x5f, 0x6c, 0x65, 0x64, 0x3f, 0x69,
-    0x64, 0x22, 0x20, 0x2b, 0x20, 0x4d, 0x61, 0x74,
-    0x68, 0x2e, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x28,
-    0x4d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x61, 0x6e,
-    0x64, 0x6f, 0x6d, 0x28, 0x29, 0x2a, 0x31, 0x30,
-    0x30, 0x30, 0x29, 0x2c, 0x20, 0x74, 0x72, 0x75,
-    0x65, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x72, 0x65, 0x71, 0x2e, 0x6f, 0x6e, 0x72,
-    0x65, 0x61, 0x64, 0x79, 0x73, 0x74, 0x61, 0x74,
-    0x65, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20,
-    0x3d, 0x20, 0x54, 0x6f, 0x67, 0x67, 0x6c, 0x65,
+    0x79, 0x49, 0x64, 0x28, 0x22, 0x63, 0x75, 0x72,
+    0x72, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x70, 0x65,
+    0x65, 0x64, 0x22, 0x29, 0x2e, 0x69, 0x6e, 0x6e,
+    0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c, 0x20, 0x3d,
+    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x3c, 0x64, 0x69,
+    0x76, 0x3e, 0x22, 0x20, 0x2b, 0x20, 0x72, 0x65,
+    0x71, 0x2e, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e,
+    0x73, 0x65, 0x54, 0x65, 0x78, 0x74, 0x20, 0x2b,
+    0x20, 0x22, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+    0x22, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x7d, 0x0d,
+    0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x77,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x58, 0x4d,
+    0x4c, 0x48, 0x74, 0x74, 0x70, 0x52, 0x65, 0x71,
+    0x75, 0x65, 0x73, 0x74, 0x29, 0x20, 0x7b, 0x0d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71,
+    0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x58,
+    0x4d, 0x4c, 0x48, 0x74, 0x74, 0x70, 0x52, 0x65,
+    0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x29, 0x3b,
+    0x0d, 0x0a, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20,
+    0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66,
+    0x20, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77,
+    0x2e, 0x41, 0x63, 0x74, 0x69, 0x76, 0x65, 0x58,
+    0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x29, 0x20,
+    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
+    0x65, 0x71, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77,
+    0x20, 0x41, 0x63, 0x74, 0x69, 0x76, 0x65, 0x58,
+    0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x28, 0x22,
+    0x4d, 0x69, 0x63, 0x72, 0x6f, 0x73, 0x6f, 0x66,
+    0x74, 0x2e, 0x58, 0x4d, 0x4c, 0x48, 0x54, 0x54,
+    0x50, 0x22, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
+    0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
+    0x28, 0x72, 0x65, 0x71, 0x29, 0x20, 0x7b, 0x0d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71,
+    0x2e, 0x6f, 0x70, 0x65, 0x6e, 0x28, 0x22, 0x47,
+    0x45, 0x54, 0x22, 0x2c, 0x20, 0x22, 0x2f, 0x63,
+    0x67, 0x69, 0x2d, 0x62, 0x69, 0x6e, 0x2f, 0x73,
+    0x65, 0x74, 0x5f, 0x73, 0x70, 0x65, 0x65, 0x64,
+    0x3f, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74,
+    0x3d, 0x22, 0x20, 0x2b, 0x20, 0x73, 0x70, 0x65,
+    0x65, 0x64, 0x5f, 0x74, 0x78, 0x74, 0x2e, 0x76,
+    0x61, 0x6c, 0x75, 0x65, 0x20, 0x2b, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26,
+    0x69, 0x64, 0x22, 0x20, 0x2b, 0x20, 0x4d, 0x61,
+    0x74, 0x68, 0x2e, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+    0x28, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x61,
+    0x6e, 0x64, 0x6f, 0x6d, 0x28, 0x29, 0x2a, 0x31,
+    0x30, 0x30, 0x30, 0x29, 0x2c, 0x20, 0x74, 0x72,
+    0x75, 0x65, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x72, 0x65, 0x71, 0x2e, 0x6f, 0x6e,
+    0x72, 0x65, 0x61, 0x64, 0x79, 0x73, 0x74, 0x61,
+    0x74, 0x65, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+    0x20, 0x3d, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64,
     0x43, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65,
     0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
     0x65, 0x71, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28,
     0x6e, 0x75, 0x6c, 0x6c, 0x29, 0x3b, 0x0d, 0x0a,
     0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x7d, 0x0d, 0x0a,
-    0x0d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
-    0x6f, 0x6e, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64,
-    0x47, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x65, 0x72,
-    0x76, 0x61, 0x6c, 0x28, 0x29, 0x0d, 0x0a, 0x7b,
-    0x0d, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
-    0x69, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c,
-    0x29, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
-    0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0d, 0x0a,
-    0x20, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x76,
-    0x61, 0x6c, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74,
-    0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c,
-    0x28, 0x73, 0x70, 0x65, 0x65, 0x64, 0x47, 0x65,
-    0x74, 0x2c, 0x20, 0x35, 0x30, 0x30, 0x29, 0x0d,
-    0x0a, 0x7d, 0x0d, 0x0a, 0x66, 0x75, 0x6e, 0x63,
-    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x70, 0x65,
-    0x65, 0x64, 0x53, 0x65, 0x74, 0x28, 0x29, 0x0d,
-    0x0a, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x69, 0x66,
-    0x20, 0x28, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x76,
-    0x61, 0x6c, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72,
-    0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c,
-    0x28, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61,
-    0x6c, 0x29, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x69, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c,
-    0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b,
-    0x0d, 0x0a, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d,
-    0x0a, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x72,
-    0x65, 0x71, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c,
-    0x73, 0x65, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x76,
-    0x61, 0x72, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64,
-    0x5f, 0x74, 0x78, 0x74, 0x20, 0x3d, 0x20, 0x64,
-    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
-    0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
-    0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22,
-    0x73, 0x70, 0x65, 0x65, 0x64, 0x5f, 0x70, 0x65,
-    0x72, 0x63, 0x65, 0x6e, 0x74, 0x22, 0x29, 0x3b,
-    0x0d, 0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63,
-    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x70, 0x65,
-    0x65, 0x64, 0x43, 0x6f, 0x6d, 0x70, 0x6c, 0x65,
-    0x74, 0x65, 0x28, 0x29, 0x0d, 0x0a, 0x20, 0x20,
-    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
-    0x66, 0x20, 0x28, 0x72, 0x65, 0x71, 0x2e, 0x72,
-    0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74,
-    0x65, 0x20, 0x3d, 0x3d, 0x20, 0x34, 0x29, 0x20,
-    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x69, 0x66, 0x20, 0x28, 0x72, 0x65, 0x71,
-    0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20,
-    0x3d, 0x3d, 0x20, 0x32, 0x30, 0x30, 0x29, 0x20,
-    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d,
-    0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45,
-    0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79,
-    0x49, 0x64, 0x28, 0x22, 0x63, 0x75, 0x72, 0x72,
-    0x65, 0x6e, 0x74, 0x5f, 0x73, 0x70, 0x65, 0x65,
-    0x64, 0x22, 0x29, 0x2e, 0x69, 0x6e, 0x6e, 0x65,
-    0x72, 0x48, 0x54, 0x4d, 0x4c, 0x20, 0x3d, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x22, 0x3c, 0x64, 0x69, 0x76,
-    0x3e, 0x22, 0x20, 0x2b, 0x20, 0x72, 0x65, 0x71,
-    0x2e, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
-    0x65, 0x54, 0x65, 0x78, 0x74, 0x20, 0x2b, 0x20,
-    0x22, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x22,
-    0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x7d, 0x0d, 0x0a,
+    0x0d, 0x0a, 0x2f, 0x2f, 0x20, 0x46, 0x65, 0x74,
+    0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77,
+    0x68, 0x6f, 0x6c, 0x65, 0x20, 0x73, 0x74, 0x61,
+    0x74, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20,
+    0x69, 0x6e, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x72,
+    0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x2e, 0x0d,
+    0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x47, 0x65, 0x74, 0x28, 0x29, 0x0d, 0x0a, 0x7b,
+    0x0d, 0x0a, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20,
+    0x72, 0x65, 0x71, 0x20, 0x3d, 0x20, 0x66, 0x61,
+    0x6c, 0x73, 0x65, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x43,
+    0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x28,
+    0x29, 0x0d, 0x0a, 0x20, 0x20, 0x7b, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+    0x72, 0x65, 0x71, 0x2e, 0x72, 0x65, 0x61, 0x64,
+    0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x20, 0x3d,
+    0x3d, 0x20, 0x34, 0x29, 0x20, 0x7b, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+    0x20, 0x28, 0x72, 0x65, 0x71, 0x2e, 0x73, 0x74,
+    0x61, 0x74, 0x75, 0x73, 0x20, 0x3d, 0x3d, 0x20,
+    0x32, 0x30, 0x30, 0x29, 0x20, 0x7b, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x69, 0x6f, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x20, 0x3d, 0x20, 0x4a, 0x53, 0x4f, 0x4e, 0x2e,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x28, 0x72, 0x65,
+    0x71, 0x2e, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e,
+    0x73, 0x65, 0x54, 0x65, 0x78, 0x74, 0x29, 0x3b,
+    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x53, 0x68, 0x6f, 0x77, 0x28, 0x29, 0x3b, 0x0d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d,
+    0x0a, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a,
     0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x77, 0x69,
     0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x58, 0x4d, 0x4c,
     0x48, 0x74, 0x74, 0x70, 0x52, 0x65, 0x71, 0x75,
@@ -2273,57 +2913,51 @@ static const uint8_t data_javascript_js[] =
     0x72, 0x65, 0x71, 0x29, 0x20, 0x7b, 0x0d, 0x0a,
     0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x2e,
     0x6f, 0x70, 0x65, 0x6e, 0x28, 0x22, 0x47, 0x45,
-    0x54, 0x22, 0x2c, 0x20, 0x22, 0x2f, 0x63, 0x67,
-    0x69, 0x2d, 0x62, 0x69, 0x6e, 0x2f, 0x73, 0x65,
-    0x74, 0x5f, 0x73, 0x70, 0x65, 0x65, 0x64, 0x3f,
-    0x70, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x3d,
-    0x22, 0x20, 0x2b, 0x20, 0x73, 0x70, 0x65, 0x65,
-    0x64, 0x5f, 0x74, 0x78, 0x74, 0x2e, 0x76, 0x61,
-    0x6c, 0x75, 0x65, 0x20, 0x2b, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x69,
-    0x64, 0x22, 0x20, 0x2b, 0x20, 0x4d, 0x61, 0x74,
-    0x68, 0x2e, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x28,
-    0x4d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x61, 0x6e,
-    0x64, 0x6f, 0x6d, 0x28, 0x29, 0x2a, 0x31, 0x30,
-    0x30, 0x30, 0x29, 0x2c, 0x20, 0x74, 0x72, 0x75,
-    0x65, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x72, 0x65, 0x71, 0x2e, 0x6f, 0x6e, 0x72,
-    0x65, 0x61, 0x64, 0x79, 0x73, 0x74, 0x61, 0x74,
-    0x65, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20,
-    0x3d, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x43,
-    0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x3b,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
-    0x71, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x6e,
-    0x75, 0x6c, 0x6c, 0x29, 0x3b, 0x0d, 0x0a, 0x20,
-    0x20, 0x7d, 0x0d, 0x0a, 0x7d, 0x0d, 0x0a, 0x0d,
-    0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
-    0x6e, 0x20, 0x6c, 0x65, 0x64, 0x73, 0x74, 0x61,
-    0x74, 0x65, 0x47, 0x65, 0x74, 0x28, 0x29, 0x0d,
-    0x0a, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x76, 0x61,
-    0x72, 0x20, 0x6c, 0x65, 0x64, 0x20, 0x3d, 0x20,
-    0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0d, 0x0a,
-    0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
-    0x6f, 0x6e, 0x20, 0x6c, 0x65, 0x64, 0x43, 0x6f,
-    0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x28, 0x29,
-    0x0d, 0x0a, 0x20, 0x20, 0x7b, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c,
-    0x65, 0x64, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x79,
-    0x53, 0x74, 0x61, 0x74, 0x65, 0x20, 0x3d, 0x3d,
-    0x20, 0x34, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
-    0x28, 0x6c, 0x65, 0x64, 0x2e, 0x73, 0x74, 0x61,
-    0x74, 0x75, 0x73, 0x20, 0x3d, 0x3d, 0x20, 0x32,
-    0x30, 0x30, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
-    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
-    0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
-    0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22,
-    0x6c, 0x65, 0x64, 0x73, 0x74, 0x61, 0x74, 0x65,
-    0x22, 0x29, 0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72,
-    0x48, 0x54, 0x4d, 0x4c, 0x20, 0x3d, 0x20, 0x22,
-    0x3c, 0x64, 0x69, 0x76, 0x3e, 0x22, 0x20, 0x2b,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x6c, 0x65, 0x64, 0x2e,
+    0x54, 0x22, 0x2c, 0x20, 0x22, 0x2f, 0x73, 0x74,
+    0x61, 0x74, 0x75, 0x73, 0x2e, 0x6a, 0x73, 0x6f,
+    0x6e, 0x3f, 0x69, 0x64, 0x3d, 0x22, 0x20, 0x2b,
+    0x20, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x6f,
+    0x75, 0x6e, 0x64, 0x28, 0x4d, 0x61, 0x74, 0x68,
+    0x2e, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x28,
+    0x29, 0x2a, 0x31, 0x30, 0x30, 0x30, 0x29, 0x2c,
+    0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x3b, 0x0d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71,
+    0x2e, 0x6f, 0x6e, 0x72, 0x65, 0x61, 0x64, 0x79,
+    0x73, 0x74, 0x61, 0x74, 0x65, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x74,
+    0x61, 0x74, 0x75, 0x73, 0x43, 0x6f, 0x6d, 0x70,
+    0x6c, 0x65, 0x74, 0x65, 0x3b, 0x0d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x2e, 0x73,
+    0x65, 0x6e, 0x64, 0x28, 0x6e, 0x75, 0x6c, 0x6c,
+    0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x7d, 0x0d,
+    0x0a, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x66, 0x75,
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73,
+    0x70, 0x65, 0x65, 0x64, 0x47, 0x65, 0x74, 0x28,
+    0x29, 0x0d, 0x0a, 0x7b, 0x0d, 0x0a, 0x0d, 0x0a,
+    0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x72, 0x65,
+    0x71, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73,
+    0x65, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x66, 0x75,
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73,
+    0x70, 0x65, 0x65, 0x64, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6e, 0x65, 0x64, 0x28, 0x29, 0x0d, 0x0a,
+    0x20, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x69, 0x66, 0x20, 0x28, 0x72, 0x65, 0x71,
+    0x2e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74,
+    0x61, 0x74, 0x65, 0x20, 0x3d, 0x3d, 0x20, 0x34,
+    0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x72,
+    0x65, 0x71, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75,
+    0x73, 0x20, 0x3d, 0x3d, 0x20, 0x32, 0x30, 0x30,
+    0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63,
+    0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65,
+    0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+    0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x63, 0x75,
+    0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x70,
+    0x65, 0x65, 0x64, 0x22, 0x29, 0x2e, 0x69, 0x6e,
+    0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c, 0x20,
+    0x3d, 0x20, 0x22, 0x3c, 0x64, 0x69, 0x76, 0x3e,
+    0x22, 0x20, 0x2b, 0x20, 0x72, 0x65, 0x71, 0x2e,
     0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65,
     0x54, 0x65, 0x78, 0x74, 0x20, 0x2b, 0x20, 0x22,
     0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x22, 0x3b,
@@ -2334,7 +2968,7 @@ static const uint8_t data_javascript_js[] =
     0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x58, 0x4d,
     0x4c, 0x48, 0x74, 0x74, 0x70, 0x52, 0x65, 0x71,
     0x75, 0x65, 0x73, 0x74, 0x29, 0x20, 0x7b, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x65, 0x64,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71,
     0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x58,
     0x4d, 0x4c, 0x48, 0x74, 0x74, 0x70, 0x52, 0x65,
     0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x29, 0x3b,
@@ -2343,175 +2977,390 @@ static const uint8_t data_javascript_js[] =
     0x20, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77,
     0x2e, 0x41, 0x63, 0x74, 0x69, 0x76, 0x65, 0x58,
     0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x29, 0x20,
-    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c,
-    0x65, 0x64, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77,
+    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
+    0x65, 0x71, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77,
     0x20, 0x41, 0x63, 0x74, 0x69, 0x76, 0x65, 0x58,
     0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x28, 0x22,
     0x4d, 0x69, 0x63, 0x72, 0x6f, 0x73, 0x6f, 0x66,
     0x74, 0x2e, 0x58, 0x4d, 0x4c, 0x48, 0x54, 0x54,
     0x50, 0x22, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
     0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
-    0x28, 0x6c, 0x65, 0x64, 0x29, 0x20, 0x7b, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x65, 0x64,
+    0x28, 0x72, 0x65, 0x71, 0x29, 0x20, 0x7b, 0x0d,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71,
     0x2e, 0x6f, 0x70, 0x65, 0x6e, 0x28, 0x22, 0x47,
-    0x45, 0x54, 0x22, 0x2c, 0x20, 0x22, 0x2f, 0x6c,
-    0x65, 0x64, 0x73, 0x74, 0x61, 0x74, 0x65, 0x3f,
-    0x69, 0x64, 0x3d, 0x22, 0x20, 0x2b, 0x20, 0x4d,
-    0x61, 0x74, 0x68, 0x2e, 0x72, 0x6f, 0x75, 0x6e,
-    0x64, 0x28, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x72,
-    0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x28, 0x29, 0x2a,
-    0x31, 0x30, 0x30, 0x30, 0x29, 0x2c, 0x20, 0x74,
-    0x72, 0x75, 0x65, 0x29, 0x3b, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x6c, 0x65, 0x64, 0x2e, 0x6f,
-    0x6e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x73, 0x74,
-    0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6e, 0x67,
-    0x65, 0x20, 0x3d, 0x20, 0x6c, 0x65, 0x64, 0x43,
-    0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x3b,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x65,
-    0x64, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x6e,
-    0x75, 0x6c, 0x6c, 0x29, 0x3b, 0x0d, 0x0a, 0x20,
-    0x20, 0x7d, 0x0d, 0x0a, 0x7d, 0x0d, 0x0a, 0x0d,
-    0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
-    0x6e, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x47,
-    0x65, 0x74, 0x28, 0x29, 0x0d, 0x0a, 0x7b, 0x0d,
-    0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x76, 0x61, 0x72,
-    0x20, 0x72, 0x65, 0x71, 0x20, 0x3d, 0x20, 0x66,
-    0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0d, 0x0a, 0x20,
-    0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
-    0x6e, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x52,
-    0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x28,
-    0x29, 0x0d, 0x0a, 0x20, 0x20, 0x7b, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
-    0x72, 0x65, 0x71, 0x2e, 0x72, 0x65, 0x61, 0x64,
-    0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x20, 0x3d,
-    0x3d, 0x20, 0x34, 0x29, 0x20, 0x7b, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
-    0x20, 0x28, 0x72, 0x65, 0x71, 0x2e, 0x73, 0x74,
-    0x61, 0x74, 0x75, 0x73, 0x20, 0x3d, 0x3d, 0x20,
-    0x32, 0x30, 0x30, 0x29, 0x20, 0x7b, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-    0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d,
-    0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
-    0x22, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
-    0x5f, 0x73, 0x70, 0x65, 0x65, 0x64, 0x22, 0x29,
-    0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54,
-    0x4d, 0x4c, 0x20, 0x3d, 0x20, 0x22, 0x3c, 0x64,
-    0x69, 0x76, 0x3e, 0x22, 0x20, 0x2b, 0x20, 0x72,
-    0x65, 0x71, 0x2e, 0x72, 0x65, 0x73, 0x70, 0x6f,
-    0x6e, 0x73, 0x65, 0x54, 0x65, 0x78, 0x74, 0x20,
-    0x2b, 0x20, 0x22, 0x3c, 0x2f, 0x64, 0x69, 0x76,
-    0x3e, 0x22, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x7d,
-    0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x69, 0x66,
-    0x20, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77,
-    0x2e, 0x58, 0x4d, 0x4c, 0x48, 0x74, 0x74, 0x70,
-    0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x29,
-    0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x72, 0x65, 0x71, 0x20, 0x3d, 0x20, 0x6e, 0x65,
+    0x45, 0x54, 0x22, 0x2c, 0x20, 0x22, 0x2f, 0x67,
+    0x65, 0x74, 0x5f, 0x73, 0x70, 0x65, 0x65, 0x64,
+    0x3f, 0x69, 0x64, 0x3d, 0x22, 0x20, 0x2b, 0x20,
+    0x4d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x6f, 0x75,
+    0x6e, 0x64, 0x28, 0x4d, 0x61, 0x74, 0x68, 0x2e,
+    0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x28, 0x29,
+    0x2a, 0x31, 0x30, 0x30, 0x30, 0x29, 0x2c, 0x20,
+    0x74, 0x72, 0x75, 0x65, 0x29, 0x3b, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x2e,
+    0x6f, 0x6e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x73,
+    0x74, 0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6e,
+    0x67, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x70, 0x65,
+    0x65, 0x64, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e,
+    0x65, 0x64, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x72, 0x65, 0x71, 0x2e, 0x73, 0x65, 0x6e,
+    0x64, 0x28, 0x6e, 0x75, 0x6c, 0x6c, 0x29, 0x3b,
+    0x0d, 0x0a, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x7d,
+    0x0d, 0x0a, 0x0d, 0x0a, 0x66, 0x75, 0x6e, 0x63,
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x61,
+    0x64, 0x50, 0x61, 0x67, 0x65, 0x28, 0x70, 0x61,
+    0x67, 0x65, 0x29, 0x0d, 0x0a, 0x7b, 0x0d, 0x0a,
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x77, 0x69,
+    0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x58, 0x4d, 0x4c,
+    0x48, 0x74, 0x74, 0x70, 0x52, 0x65, 0x71, 0x75,
+    0x65, 0x73, 0x74, 0x29, 0x20, 0x7b, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x78, 0x6d, 0x6c, 0x68,
+    0x74, 0x74, 0x70, 0x20, 0x3d, 0x20, 0x6e, 0x65,
     0x77, 0x20, 0x58, 0x4d, 0x4c, 0x48, 0x74, 0x74,
     0x70, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
     0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x7d,
     0x0d, 0x0a, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65,
-    0x20, 0x69, 0x66, 0x20, 0x28, 0x77, 0x69, 0x6e,
-    0x64, 0x6f, 0x77, 0x2e, 0x41, 0x63, 0x74, 0x69,
-    0x76, 0x65, 0x58, 0x4f, 0x62, 0x6a, 0x65, 0x63,
-    0x74, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x72, 0x65, 0x71, 0x20, 0x3d, 0x20,
-    0x6e, 0x65, 0x77, 0x20, 0x41, 0x63, 0x74, 0x69,
-    0x76, 0x65, 0x58, 0x4f, 0x62, 0x6a, 0x65, 0x63,
-    0x74, 0x28, 0x22, 0x4d, 0x69, 0x63, 0x72, 0x6f,
-    0x73, 0x6f, 0x66, 0x74, 0x2e, 0x58, 0x4d, 0x4c,
-    0x48, 0x54, 0x54, 0x50, 0x22, 0x29, 0x3b, 0x0d,
-    0x0a, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20,
-    0x69, 0x66, 0x20, 0x28, 0x72, 0x65, 0x71, 0x29,
     0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x72, 0x65, 0x71, 0x2e, 0x6f, 0x70, 0x65, 0x6e,
+    0x78, 0x6d, 0x6c, 0x68, 0x74, 0x74, 0x70, 0x20,
+    0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x41, 0x63,
+    0x74, 0x69, 0x76, 0x65, 0x58, 0x4f, 0x62, 0x6a,
+    0x65, 0x63, 0x74, 0x28, 0x22, 0x4d, 0x69, 0x63,
+    0x72, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x2e, 0x58,
+    0x4d, 0x4c, 0x48, 0x54, 0x54, 0x50, 0x22, 0x29,
+    0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x7d, 0x0d, 0x0a,
+    0x0d, 0x0a, 0x20, 0x20, 0x78, 0x6d, 0x6c, 0x68,
+    0x74, 0x74, 0x70, 0x2e, 0x6f, 0x70, 0x65, 0x6e,
     0x28, 0x22, 0x47, 0x45, 0x54, 0x22, 0x2c, 0x20,
-    0x22, 0x2f, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x70,
-    0x65, 0x65, 0x64, 0x3f, 0x69, 0x64, 0x3d, 0x22,
-    0x20, 0x2b, 0x20, 0x4d, 0x61, 0x74, 0x68, 0x2e,
-    0x72, 0x6f, 0x75, 0x6e, 0x64, 0x28, 0x4d, 0x61,
-    0x74, 0x68, 0x2e, 0x72, 0x61, 0x6e, 0x64, 0x6f,
-    0x6d, 0x28, 0x29, 0x2a, 0x31, 0x30, 0x30, 0x30,
-    0x29, 0x2c, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29,
-    0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
-    0x65, 0x71, 0x2e, 0x6f, 0x6e, 0x72, 0x65, 0x61,
-    0x64, 0x79, 0x73, 0x74, 0x61, 0x74, 0x65, 0x63,
-    0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x3d, 0x20,
-    0x73, 0x70, 0x65, 0x65, 0x64, 0x52, 0x65, 0x74,
-    0x75, 0x72, 0x6e, 0x65, 0x64, 0x3b, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x2e,
-    0x73, 0x65, 0x6e, 0x64, 0x28, 0x6e, 0x75, 0x6c,
-    0x6c, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x7d,
-    0x0d, 0x0a, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x66,
-    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-    0x6c, 0x6f, 0x61, 0x64, 0x50, 0x61, 0x67, 0x65,
-    0x28, 0x70, 0x61, 0x67, 0x65, 0x29, 0x0d, 0x0a,
-    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
-    0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e,
-    0x58, 0x4d, 0x4c, 0x48, 0x74, 0x74, 0x70, 0x52,
-    0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x29, 0x20,
-    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x78,
-    0x6d, 0x6c, 0x68, 0x74, 0x74, 0x70, 0x20, 0x3d,
-    0x20, 0x6e, 0x65, 0x77, 0x20, 0x58, 0x4d, 0x4c,
-    0x48, 0x74, 0x74, 0x70, 0x52, 0x65, 0x71, 0x75,
-    0x65, 0x73, 0x74, 0x28, 0x29, 0x3b, 0x0d, 0x0a,
-    0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x65,
-    0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x78, 0x6d, 0x6c, 0x68, 0x74,
-    0x74, 0x70, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77,
-    0x20, 0x41, 0x63, 0x74, 0x69, 0x76, 0x65, 0x58,
-    0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x28, 0x22,
-    0x4d, 0x69, 0x63, 0x72, 0x6f, 0x73, 0x6f, 0x66,
-    0x74, 0x2e, 0x58, 0x4d, 0x4c, 0x48, 0x54, 0x54,
-    0x50, 0x22, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
-    0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x78,
-    0x6d, 0x6c, 0x68, 0x74, 0x74, 0x70, 0x2e, 0x6f,
-    0x70, 0x65, 0x6e, 0x28, 0x22, 0x47, 0x45, 0x54,
-    0x22, 0x2c, 0x20, 0x70, 0x61, 0x67, 0x65, 0x2c,
-    0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x3b, 0x0d,
-    0x0a, 0x20, 0x20, 0x78, 0x6d, 0x6c, 0x68, 0x74,
-    0x74, 0x70, 0x2e, 0x73, 0x65, 0x74, 0x52, 0x65,
-    0x71, 0x75, 0x65, 0x73, 0x74, 0x48, 0x65, 0x61,
-    0x64, 0x65, 0x72, 0x28, 0x22, 0x43, 0x6f, 0x6e,
-    0x74, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x79, 0x70,
-    0x65, 0x22, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x22, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63,
-    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x78, 0x2d,
-    0x77, 0x77, 0x77, 0x2d, 0x66, 0x6f, 0x72, 0x6d,
-    0x2d, 0x75, 0x72, 0x6c, 0x65, 0x6e, 0x63, 0x6f,
-    0x64, 0x65, 0x64, 0x22, 0x29, 0x3b, 0x0d, 0x0a,
-    0x20, 0x20, 0x78, 0x6d, 0x6c, 0x68, 0x74, 0x74,
-    0x70, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x29,
-    0x3b, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x78,
-    0x6d, 0x6c, 0x68, 0x74, 0x74, 0x70, 0x2e, 0x6f,
-    0x6e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x73, 0x74,
-    0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6e, 0x67,
-    0x65, 0x20, 0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63,
-    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x0d,
-    0x0a, 0x20, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x78,
-    0x6d, 0x6c, 0x68, 0x74, 0x74, 0x70, 0x2e, 0x72,
-    0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74,
-    0x65, 0x20, 0x3d, 0x3d, 0x20, 0x34, 0x29, 0x20,
-    0x26, 0x26, 0x20, 0x28, 0x78, 0x6d, 0x6c, 0x68,
-    0x74, 0x74, 0x70, 0x2e, 0x73, 0x74, 0x61, 0x74,
-    0x75, 0x73, 0x20, 0x3d, 0x3d, 0x20, 0x32, 0x30,
-    0x30, 0x29, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63,
+    0x70, 0x61, 0x67, 0x65, 0x2c, 0x20, 0x74, 0x72,
+    0x75, 0x65, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
+    0x78, 0x6d, 0x6c, 0x68, 0x74, 0x74, 0x70, 0x2e,
+    0x73, 0x65, 0x74, 0x52, 0x65, 0x71, 0x75, 0x65,
+    0x73, 0x74, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72,
+    0x28, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
+    0x74, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x22, 0x2c,
+    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61,
+    0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69,
+    0x6f, 0x6e, 0x2f, 0x78, 0x2d, 0x77, 0x77, 0x77,
+    0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x75, 0x72,
+    0x6c, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x64,
+    0x22, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x78,
+    0x6d, 0x6c, 0x68, 0x74, 0x74, 0x70, 0x2e, 0x73,
+    0x65, 0x6e, 0x64, 0x28, 0x29, 0x3b, 0x0d, 0x0a,
+    0x0d, 0x0a, 0x20, 0x20, 0x78, 0x6d, 0x6c, 0x68,
+    0x74, 0x74, 0x70, 0x2e, 0x6f, 0x6e, 0x72, 0x65,
+    0x61, 0x64, 0x79, 0x73, 0x74, 0x61, 0x74, 0x65,
+    0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x3d,
+    0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x20, 0x28, 0x29, 0x0d, 0x0a, 0x20, 0x20,
+    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+    0x66, 0x20, 0x28, 0x28, 0x78, 0x6d, 0x6c, 0x68,
+    0x74, 0x74, 0x70, 0x2e, 0x72, 0x65, 0x61, 0x64,
+    0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x20, 0x3d,
+    0x3d, 0x20, 0x34, 0x29, 0x20, 0x26, 0x26, 0x20,
+    0x28, 0x78, 0x6d, 0x6c, 0x68, 0x74, 0x74, 0x70,
+    0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20,
+    0x3d, 0x3d, 0x20, 0x32, 0x30, 0x30, 0x29, 0x29,
+    0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+    0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49,
+    0x64, 0x28, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x65,
+    0x6e, 0x74, 0x22, 0x29, 0x2e, 0x69, 0x6e, 0x6e,
+    0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c, 0x20, 0x3d,
+    0x20, 0x78, 0x6d, 0x6c, 0x68, 0x74, 0x74, 0x70,
+    0x2e, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
+    0x65, 0x54, 0x65, 0x78, 0x74, 0x3b, 0x0d, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74,
+    0x61, 0x74, 0x75, 0x73, 0x53, 0x68, 0x6f, 0x77,
+    0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x7d, 0x0d,
+    0x0a, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x66, 0x75,
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63,
+    0x68, 0x61, 0x6e, 0x67, 0x65, 0x56, 0x61, 0x6c,
+    0x75, 0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x28,
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x0d, 0x0a,
+    0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x64, 0x6f, 0x63,
     0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65,
     0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
-    0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x63, 0x6f,
-    0x6e, 0x74, 0x65, 0x6e, 0x74, 0x22, 0x29, 0x2e,
-    0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d,
-    0x4c, 0x20, 0x3d, 0x20, 0x78, 0x6d, 0x6c, 0x68,
-    0x74, 0x74, 0x70, 0x2e, 0x72, 0x65, 0x73, 0x70,
-    0x6f, 0x6e, 0x73, 0x65, 0x54, 0x65, 0x78, 0x74,
-    0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
-    0x0d, 0x0a, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x7d,
-    0x0d, 0x0a,
+    0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x73, 0x70,
+    0x65, 0x65, 0x64, 0x5f, 0x70, 0x65, 0x72, 0x63,
+    0x65, 0x6e, 0x74, 0x22, 0x29, 0x2e, 0x76, 0x61,
+    0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x76, 0x61,
+    0x6c, 0x75, 0x65, 0x3b, 0x0d, 0x0a, 0x20, 0x20,
+    0x73, 0x70, 0x65, 0x65, 0x64, 0x53, 0x65, 0x74,
+    0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x7d, 0x0d, 0x0a,
+    0x0d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x20, 0x6c, 0x69, 0x76, 0x65, 0x72,
+    0x61, 0x6e, 0x67, 0x65, 0x28, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x29, 0x7b, 0x0d, 0x0a, 0x20, 0x20,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d,
+    0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
+    0x22, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x76, 0x61,
+    0x6c, 0x75, 0x65, 0x22, 0x29, 0x2e, 0x69, 0x6e,
+    0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c, 0x20,
+    0x3d, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b,
+    0x0d, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x4f,
+    0x76, 0x65, 0x72, 0x20, 0x61, 0x20, 0x57, 0x65,
+    0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x74, 0x6f,
+    0x72, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6c,
+    0x69, 0x64, 0x65, 0x72, 0x20, 0x77, 0x68, 0x69,
+    0x6c, 0x65, 0x20, 0x69, 0x74, 0x20, 0x6d, 0x6f,
+    0x76, 0x65, 0x73, 0x2e, 0x0d, 0x0a, 0x20, 0x20,
+    0x77, 0x73, 0x53, 0x65, 0x6e, 0x64, 0x28, 0x5b,
+    0x57, 0x53, 0x5f, 0x43, 0x4d, 0x44, 0x5f, 0x53,
+    0x45, 0x54, 0x5f, 0x53, 0x50, 0x45, 0x45, 0x44,
+    0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+    0x26, 0x20, 0x30, 0x78, 0x66, 0x66, 0x5d, 0x29,
+    0x3b, 0x0d, 0x0a, 0x7d, 0x0d, 0x0a,
+};
+
+static const uint8_t data_javascript_js_gz[] =
+{
+    /* /javascript.js.gz */
+    0x2f, 0x6a, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72,
+    0x69, 0x70, 0x74, 0x2e, 0x6a, 0x73, 0x2e, 0x67,
+    0x7a, 0x00,
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x03, 0xdd, 0x59, 0x6d, 0x6f, 0xdb, 0x46,
+    0x12, 0xfe, 0x1e, 0x20, 0xff, 0x61, 0x43, 0xa0,
+    0x29, 0xd9, 0xda, 0x94, 0x9d, 0xdc, 0xa1, 0x45,
+    0x54, 0x27, 0x70, 0x63, 0xc7, 0xc9, 0xc1, 0x8e,
+    0x82, 0x48, 0x69, 0x0b, 0x14, 0x07, 0x81, 0xa2,
+    0x46, 0x16, 0x9b, 0x15, 0x97, 0xdd, 0x5d, 0x8a,
+    0x31, 0x12, 0xff, 0xf7, 0x9b, 0xd9, 0x5d, 0x2e,
+    0x97, 0x92, 0xec, 0x24, 0xbd, 0x5c, 0x0f, 0xc8,
+    0x17, 0x8b, 0xdc, 0x97, 0xd9, 0xd9, 0x67, 0x9e,
+    0x79, 0xa3, 0xd7, 0x99, 0x64, 0x45, 0xa9, 0x41,
+    0xae, 0x33, 0x3e, 0xbc, 0x7b, 0x67, 0x8d, 0xaf,
+    0xb0, 0x86, 0x52, 0x2b, 0xf7, 0xd2, 0xb4, 0x0f,
+    0x85, 0x18, 0xeb, 0x4c, 0xd7, 0xf4, 0xda, 0x14,
+    0xe5, 0x5c, 0x34, 0xa9, 0x28, 0xb9, 0xc8, 0xe6,
+    0xec, 0x88, 0x2d, 0xea, 0x32, 0xd7, 0x85, 0x28,
+    0x59, 0x9c, 0xdc, 0xbd, 0xf3, 0xfe, 0xee, 0x1d,
+    0xc6, 0xe6, 0x22, 0xaf, 0x57, 0x28, 0x25, 0xbd,
+    0x04, 0x7d, 0xca, 0x81, 0x1e, 0x7f, 0xbe, 0x7a,
+    0x31, 0x8f, 0xbf, 0xcd, 0x66, 0xa2, 0xd6, 0xdf,
+    0x26, 0xb8, 0x37, 0xe7, 0x45, 0xfe, 0x16, 0x37,
+    0x93, 0x8c, 0x63, 0x1a, 0x1d, 0xde, 0xba, 0xb1,
+    0x10, 0xd3, 0xa5, 0xd6, 0xd5, 0xd6, 0xd6, 0x17,
+    0xa3, 0xe7, 0x38, 0x8c, 0x7b, 0x69, 0xb7, 0x97,
+    0x15, 0x27, 0x66, 0xe4, 0x9a, 0xfe, 0x78, 0xed,
+    0x82, 0x59, 0xa7, 0x26, 0x8d, 0xbc, 0xca, 0x2e,
+    0x21, 0x8e, 0x8c, 0x5e, 0xe9, 0x52, 0xaf, 0xa2,
+    0xc4, 0xe8, 0x21, 0x41, 0xd7, 0xb2, 0x64, 0x8b,
+    0x8c, 0x2b, 0x18, 0xee, 0x12, 0x34, 0x5a, 0x23,
+    0x64, 0x05, 0x34, 0x3b, 0x64, 0x09, 0x37, 0xf5,
+    0x39, 0xe2, 0x7e, 0xe6, 0x22, 0x7f, 0xbb, 0x43,
+    0xd6, 0x8c, 0xc6, 0x3f, 0x47, 0x90, 0xc5, 0x63,
+    0x87, 0x24, 0x07, 0x60, 0x20, 0xab, 0x58, 0xb0,
+    0xf8, 0x9e, 0x35, 0x36, 0x9a, 0x56, 0x22, 0x2c,
+    0x09, 0x0d, 0x33, 0xa6, 0x8c, 0xa1, 0xcf, 0xc0,
+    0xc2, 0xf8, 0x91, 0x43, 0xc7, 0xa0, 0x9f, 0x09,
+    0xb9, 0x3a, 0x81, 0x45, 0x56, 0x73, 0xad, 0xb6,
+    0x29, 0x50, 0x88, 0x5c, 0x94, 0x5a, 0x0a, 0x9e,
+    0x9e, 0x9f, 0x9e, 0x8c, 0xca, 0x34, 0x5f, 0x42,
+    0xfe, 0x16, 0x88, 0x37, 0x5c, 0x0d, 0x6f, 0x58,
+    0xa9, 0x2a, 0x80, 0xf9, 0xb4, 0x02, 0x99, 0xd3,
+    0x38, 0x52, 0xb3, 0x06, 0x5c, 0xaf, 0xaa, 0xad,
+    0xd3, 0xb5, 0xb8, 0xbc, 0xe4, 0x30, 0xe5, 0x30,
+    0xf7, 0x07, 0x13, 0x59, 0x25, 0xfc, 0x49, 0xbc,
+    0x74, 0x0a, 0xb7, 0x97, 0x6d, 0xd4, 0x18, 0xca,
+    0x79, 0xfc, 0xfb, 0xaf, 0xe3, 0xe9, 0xd3, 0x8b,
+    0x93, 0xe9, 0x64, 0x74, 0x76, 0x76, 0x7e, 0x3a,
+    0x45, 0xad, 0xfe, 0xdd, 0xde, 0xdc, 0xde, 0xd4,
+    0x6d, 0xf1, 0x87, 0x4c, 0xcc, 0x21, 0x4f, 0xc5,
+    0xaa, 0xe2, 0xa0, 0x21, 0x36, 0x6b, 0xdf, 0xdb,
+    0x0d, 0x24, 0x16, 0x0f, 0x4b, 0x25, 0x64, 0xf3,
+    0x2b, 0x72, 0x10, 0xd4, 0xf3, 0x88, 0xfd, 0x23,
+    0x69, 0xe7, 0xbb, 0x15, 0x16, 0x54, 0x9a, 0x7d,
+    0x70, 0x70, 0x10, 0xcc, 0xdf, 0xcc, 0xf9, 0x08,
+    0x6f, 0x45, 0xbb, 0x20, 0x4a, 0xd2, 0xa2, 0x2c,
+    0x41, 0x3e, 0x9f, 0x5c, 0x9c, 0xe3, 0xb5, 0xa2,
+    0x9f, 0xe6, 0xc5, 0xfa, 0x71, 0xc4, 0xbe, 0xef,
+    0x44, 0x90, 0xe6, 0xa4, 0x84, 0xaa, 0x44, 0xa9,
+    0x60, 0x02, 0xef, 0x34, 0xfb, 0x1e, 0xd7, 0x0d,
+    0xcc, 0xc2, 0x61, 0xbb, 0xee, 0xda, 0x3e, 0x98,
+    0x9f, 0xeb, 0x00, 0x16, 0xeb, 0xce, 0xbf, 0x5d,
+    0x9c, 0x13, 0x75, 0x5e, 0xc3, 0x9f, 0x35, 0x28,
+    0xed, 0x35, 0xb4, 0x50, 0x96, 0xd0, 0xb0, 0xfe,
+    0x02, 0xc7, 0x0d, 0x23, 0x0c, 0x10, 0xe7, 0x50,
+    0xd4, 0x31, 0xe2, 0xb6, 0x86, 0xdf, 0x46, 0xb3,
+    0x3f, 0x20, 0xdf, 0x25, 0xa9, 0x37, 0x1f, 0x47,
+    0x17, 0x45, 0x2e, 0x85, 0x12, 0x0b, 0x6d, 0x74,
+    0x98, 0x4c, 0x5e, 0x45, 0x81, 0x6c, 0x87, 0x5f,
+    0x28, 0x25, 0x15, 0x15, 0x94, 0x71, 0x74, 0x76,
+    0x3a, 0x89, 0xf6, 0x58, 0x34, 0xc8, 0x2f, 0x8b,
+    0xfd, 0x59, 0x51, 0x0e, 0x3a, 0x2e, 0x3c, 0x29,
+    0xe6, 0x08, 0x0f, 0xbb, 0xc8, 0xf4, 0x32, 0x95,
+    0xa2, 0x46, 0x9b, 0xdb, 0xc7, 0x0c, 0xb5, 0x5b,
+    0xc5, 0xc9, 0x77, 0x87, 0x07, 0x68, 0x82, 0x3d,
+    0xa6, 0x65, 0x0d, 0xc9, 0x30, 0x10, 0x5b, 0x1a,
+    0x33, 0x1a, 0xcc, 0xf3, 0x65, 0x56, 0x5e, 0x12,
+    0xe9, 0xfa, 0xc6, 0x0f, 0x56, 0x2b, 0xe2, 0x52,
+    0x59, 0x73, 0xee, 0x95, 0xed, 0x53, 0xd3, 0x70,
+    0x18, 0x9d, 0xe8, 0x85, 0x8b, 0xae, 0x9e, 0xa0,
+    0x74, 0xa3, 0xbe, 0xdb, 0xb5, 0x77, 0x1b, 0x0c,
+    0xd8, 0xb8, 0x29, 0x74, 0xbe, 0x44, 0x5e, 0xb3,
+    0xac, 0xd6, 0x62, 0x95, 0xe9, 0x22, 0x67, 0x2b,
+    0x31, 0x87, 0x21, 0xd3, 0x4b, 0xb0, 0x32, 0x59,
+    0xa1, 0xe8, 0xa5, 0x64, 0x55, 0xad, 0x96, 0xf8,
+    0x3a, 0xbb, 0xb2, 0x73, 0x78, 0x0a, 0xc8, 0xb4,
+    0xe3, 0xe5, 0xbd, 0x0d, 0xbe, 0x1f, 0xbf, 0x99,
+    0x8c, 0x2e, 0x8e, 0x27, 0x2f, 0x9e, 0x7a, 0xba,
+    0x33, 0xaf, 0x64, 0xdc, 0xe1, 0xe0, 0x3c, 0x20,
+    0x80, 0xbf, 0xcd, 0x0f, 0xc9, 0xd6, 0x12, 0x54,
+    0x78, 0x80, 0xac, 0x9d, 0x5a, 0xbd, 0x14, 0x70,
+    0xb4, 0xa7, 0xda, 0xa5, 0x39, 0x2a, 0x2b, 0x38,
+    0x37, 0x7a, 0x36, 0x4b, 0xc1, 0xc1, 0xc4, 0x18,
+    0x30, 0xca, 0x6e, 0xa8, 0xd0, 0x1e, 0x46, 0xfe,
+    0x1e, 0x80, 0xe7, 0x63, 0xd2, 0x1e, 0xfb, 0x27,
+    0x1a, 0xcf, 0x81, 0x4d, 0x80, 0xd5, 0x33, 0x95,
+    0xcb, 0x62, 0x06, 0x84, 0x99, 0xc1, 0xc1, 0x78,
+    0xe1, 0x2e, 0x6c, 0xf6, 0x18, 0x85, 0x66, 0x96,
+    0xb1, 0x5f, 0x61, 0x36, 0xc6, 0xb8, 0x0a, 0x9a,
+    0xae, 0x87, 0xf3, 0x46, 0xd0, 0x4c, 0x8a, 0x06,
+    0xd7, 0x31, 0x55, 0x57, 0x95, 0x90, 0x78, 0x8d,
+    0x42, 0x33, 0x24, 0x4c, 0xb0, 0x9f, 0x65, 0x79,
+    0x0e, 0x95, 0x36, 0xe8, 0x33, 0x0c, 0x55, 0x25,
+    0x18, 0x4b, 0xa3, 0x58, 0x1c, 0x90, 0x4d, 0x81,
+    0x4e, 0x40, 0x07, 0x18, 0x69, 0x03, 0x6b, 0xe1,
+    0x94, 0xb1, 0xd7, 0x06, 0x2e, 0x65, 0xa3, 0x11,
+    0x1d, 0x58, 0x42, 0x41, 0xeb, 0xc9, 0x8c, 0xd9,
+    0x3a, 0x2b, 0x78, 0x36, 0xe3, 0xb0, 0x87, 0xf7,
+    0x46, 0x64, 0x0a, 0x34, 0x7d, 0x9e, 0xe1, 0x32,
+    0x3a, 0xa1, 0xc2, 0xb8, 0x6d, 0x64, 0xe1, 0x4e,
+    0xae, 0xd8, 0x2c, 0xc3, 0xa4, 0x87, 0x77, 0x24,
+    0x20, 0x8b, 0xf2, 0x32, 0x0d, 0xa8, 0xd6, 0x63,
+    0x93, 0x63, 0x99, 0x0b, 0xda, 0x4d, 0x3b, 0xcc,
+    0x3e, 0x7c, 0x60, 0x4a, 0x81, 0x7b, 0x1b, 0x76,
+    0x00, 0x22, 0xb5, 0x57, 0x78, 0x4f, 0x65, 0x2e,
+    0xbb, 0x02, 0xa5, 0xf0, 0x58, 0xc5, 0x84, 0x01,
+    0x86, 0xa1, 0x5f, 0x65, 0xf2, 0x2a, 0x00, 0xac,
+    0x92, 0x42, 0x63, 0x98, 0xe6, 0x2c, 0x56, 0x80,
+    0xb7, 0x11, 0xd3, 0x46, 0xa5, 0xcb, 0x24, 0xb5,
+    0x35, 0x82, 0x23, 0xda, 0xf8, 0x74, 0x32, 0x1d,
+    0xbf, 0x3a, 0x3d, 0x3d, 0x41, 0x1b, 0x1e, 0xbc,
+    0x3b, 0x38, 0x1c, 0xf6, 0x66, 0xbb, 0xb0, 0x6b,
+    0xa7, 0x1f, 0xf4, 0xa7, 0x3d, 0x4b, 0xed, 0xec,
+    0xc3, 0x6e, 0xf6, 0x62, 0x7c, 0x36, 0x1d, 0x4f,
+    0x8e, 0x27, 0x6f, 0xc6, 0x66, 0xea, 0xc7, 0xc3,
+    0x61, 0xcf, 0xdf, 0x9a, 0x0d, 0x00, 0xac, 0x0b,
+    0xd8, 0x80, 0xd4, 0xe9, 0x8f, 0x28, 0xb4, 0x83,
+    0x27, 0x99, 0xce, 0x7e, 0xc1, 0x3c, 0x4d, 0x63,
+    0x98, 0x1b, 0x30, 0x34, 0xbb, 0x94, 0xd1, 0xcf,
+    0x06, 0x3e, 0x8d, 0x78, 0xaf, 0xf2, 0xfe, 0x4a,
+    0x9b, 0x4c, 0x40, 0xf3, 0xf2, 0xe3, 0xa8, 0x51,
+    0x8f, 0x06, 0x03, 0x8a, 0x3e, 0x98, 0xb9, 0x33,
+    0x52, 0x2c, 0x5d, 0x0a, 0x65, 0xc2, 0xf1, 0xa0,
+    0x51, 0x51, 0xeb, 0x66, 0x88, 0x9a, 0x85, 0x76,
+    0x72, 0x55, 0x51, 0x94, 0x89, 0x32, 0x29, 0xb3,
+    0xab, 0x59, 0xbd, 0x58, 0x80, 0x8c, 0xba, 0x35,
+    0xa2, 0x74, 0x06, 0xe9, 0x55, 0x59, 0xe0, 0xf4,
+    0xf3, 0x39, 0x84, 0x00, 0x5a, 0x3b, 0x55, 0xda,
+    0x5b, 0xc5, 0x90, 0xce, 0xf1, 0x31, 0x19, 0x86,
+    0x89, 0x28, 0x5e, 0xa7, 0xb3, 0x2b, 0x0d, 0xe7,
+    0x50, 0x5e, 0xea, 0x25, 0x7b, 0x7c, 0xc4, 0x7e,
+    0x48, 0xd8, 0xfd, 0xfb, 0x0c, 0x87, 0xd1, 0x8b,
+    0xdf, 0xa0, 0xeb, 0xfd, 0x18, 0x63, 0x6e, 0x42,
+    0x1c, 0x7a, 0x70, 0x27, 0xbd, 0x74, 0xd5, 0x16,
+    0x82, 0x78, 0xde, 0xfb, 0x30, 0x03, 0x19, 0x3f,
+    0x7e, 0xc4, 0x02, 0x51, 0x87, 0xc9, 0x5e, 0xb8,
+    0x80, 0xc2, 0x42, 0x6f, 0xfe, 0x01, 0x1e, 0xce,
+    0x0e, 0x7b, 0x6b, 0x38, 0x89, 0x88, 0xfb, 0x6b,
+    0x1e, 0x3f, 0x66, 0x87, 0xdb, 0x2b, 0x17, 0x18,
+    0x83, 0x9d, 0x34, 0x0c, 0x12, 0x0f, 0x1f, 0xc4,
+    0x0f, 0x5d, 0x40, 0xef, 0x16, 0x5d, 0x0f, 0xbb,
+    0x67, 0x1b, 0x3f, 0xc6, 0x4b, 0xd1, 0xc4, 0xc9,
+    0xce, 0x84, 0xe8, 0xf0, 0xce, 0xb9, 0x50, 0xb0,
+    0x59, 0xd3, 0xf6, 0xc0, 0x46, 0x97, 0x79, 0x0d,
+    0x8b, 0x5a, 0x61, 0x74, 0x11, 0x12, 0xad, 0xac,
+    0xf4, 0x23, 0xf4, 0x59, 0x89, 0x5e, 0x42, 0x24,
+    0x44, 0xd7, 0xf6, 0xbe, 0xdf, 0xee, 0x30, 0x34,
+    0xe9, 0x58, 0x64, 0xd4, 0x09, 0x3d, 0x31, 0x4c,
+    0xca, 0x9e, 0x75, 0x74, 0x97, 0xc0, 0x4b, 0x29,
+    0x92, 0x63, 0xe4, 0xca, 0xad, 0xb3, 0xda, 0x40,
+    0x46, 0x0e, 0xea, 0x99, 0xb7, 0x2b, 0xd2, 0x60,
+    0x04, 0xc3, 0x20, 0x53, 0x0a, 0xcd, 0x28, 0x63,
+    0xa6, 0x7d, 0x67, 0xa1, 0xd4, 0x40, 0x64, 0x50,
+    0x7d, 0x87, 0x51, 0xce, 0x1d, 0xc2, 0x92, 0xe6,
+    0xde, 0x11, 0x5a, 0xe0, 0x26, 0xa7, 0xc0, 0xa5,
+    0x36, 0x15, 0x22, 0xf9, 0x8c, 0xcd, 0x8e, 0x89,
+    0xca, 0x4e, 0x74, 0x6a, 0x29, 0xdd, 0xab, 0x23,
+    0xc3, 0x9b, 0x75, 0xd9, 0xd2, 0x03, 0xb2, 0xc3,
+    0x7d, 0x4f, 0x09, 0xcf, 0xb1, 0xa8, 0xb1, 0x1c,
+    0xbc, 0xd5, 0x35, 0x2d, 0xee, 0x9e, 0xad, 0xf6,
+    0xd5, 0xf9, 0x45, 0x20, 0x23, 0x8e, 0x9c, 0x85,
+    0xbc, 0x3b, 0x3a, 0x83, 0x7d, 0xa2, 0xbb, 0x05,
+    0x1e, 0xf0, 0xaf, 0xf1, 0xe8, 0x65, 0x5a, 0x65,
+    0x52, 0xc1, 0x96, 0xbf, 0xed, 0x60, 0xdc, 0xad,
+    0x46, 0xee, 0xa0, 0x08, 0x36, 0x06, 0x35, 0xad,
+    0xcd, 0xb1, 0x47, 0x37, 0x97, 0x8b, 0x79, 0x2d,
+    0x25, 0xbe, 0xd8, 0x64, 0xec, 0xae, 0x46, 0x1b,
+    0xf9, 0xed, 0xdb, 0xba, 0x2a, 0x33, 0x28, 0x95,
+    0xef, 0xb5, 0x77, 0xdc, 0xce, 0xf9, 0x34, 0x6d,
+    0x8e, 0x68, 0xbb, 0x05, 0x7a, 0xde, 0x5d, 0xa0,
+    0x7a, 0xa4, 0x6c, 0x41, 0x4f, 0x41, 0xf0, 0x9b,
+    0xb0, 0x28, 0x25, 0x51, 0xdc, 0x0b, 0xe2, 0x37,
+    0x8a, 0x89, 0xbd, 0x1c, 0xba, 0xcb, 0x13, 0x16,
+    0x8d, 0x5e, 0x46, 0xec, 0x11, 0xfe, 0x3c, 0x7b,
+    0x16, 0x25, 0xfd, 0x4a, 0xf7, 0x7a, 0xb3, 0x02,
+    0x1b, 0x43, 0x9f, 0x53, 0xbe, 0x98, 0x69, 0xed,
+    0x99, 0x73, 0xc8, 0xa4, 0xaf, 0x33, 0x36, 0x6a,
+    0x9d, 0xa0, 0x1a, 0xa1, 0x52, 0x6f, 0x18, 0x94,
+    0xce, 0xdb, 0x7d, 0x46, 0x60, 0xa7, 0xa9, 0xc6,
+    0x12, 0xfc, 0x16, 0xd0, 0x7b, 0x0d, 0x4e, 0x0f,
+    0xf9, 0x8d, 0xa2, 0xcd, 0xe7, 0xd2, 0xbd, 0x4e,
+    0xb0, 0x6b, 0x88, 0xee, 0x63, 0x12, 0x5c, 0x2c,
+    0xb6, 0x7b, 0x97, 0xa0, 0x73, 0x31, 0x5b, 0xfe,
+    0xfe, 0xc6, 0x65, 0x83, 0x89, 0xa1, 0x55, 0xc3,
+    0x10, 0xde, 0x19, 0xf8, 0x2f, 0x74, 0x2f, 0x5f,
+    0x57, 0xef, 0xa2, 0xda, 0x22, 0xfa, 0x89, 0xe3,
+    0xc4, 0x11, 0xc1, 0xb2, 0x69, 0x71, 0xdf, 0xf1,
+    0x45, 0xf7, 0xbf, 0x60, 0x87, 0xd3, 0x23, 0xc9,
+    0xc7, 0x1b, 0x1c, 0x4c, 0x46, 0xcf, 0xc0, 0xf4,
+    0x28, 0xfd, 0x62, 0xde, 0x97, 0x8c, 0x22, 0x93,
+    0x73, 0x2a, 0x67, 0x45, 0x09, 0x24, 0x87, 0x00,
+    0x4f, 0xb7, 0xc2, 0xdb, 0x59, 0xe0, 0x96, 0xbb,
+    0x3c, 0x69, 0x63, 0xf9, 0xff, 0x8c, 0xc3, 0xbb,
+    0x63, 0xf9, 0x26, 0x1f, 0x93, 0xcf, 0xa9, 0x24,
+    0xbe, 0xa2, 0xd6, 0xda, 0xde, 0x35, 0xfd, 0x43,
+    0x89, 0x12, 0x7b, 0xea, 0xa3, 0x2f, 0x47, 0xb9,
+    0x9e, 0x51, 0xff, 0x42, 0x53, 0xed, 0xb8, 0xf3,
+    0x71, 0xf6, 0xd0, 0x7a, 0x5b, 0x17, 0xd9, 0x4f,
+    0x44, 0xff, 0xf7, 0x00, 0xf8, 0xdf, 0x45, 0xbd,
+    0xaf, 0x85, 0x58, 0xfe, 0xa3, 0xc1, 0x97, 0xa5,
+    0x55, 0x68, 0xed, 0xcf, 0x60, 0x95, 0xff, 0x4a,
+    0x4a, 0x2d, 0x77, 0x58, 0x2c, 0xdc, 0x0e, 0xf3,
+    0xbb, 0x15, 0xa7, 0x4f, 0xaa, 0x9f, 0x06, 0xf5,
+    0xce, 0x3d, 0x9f, 0x0e, 0x2a, 0xfd, 0xb8, 0xbd,
+    0x3d, 0x28, 0x49, 0xe3, 0x10, 0x9d, 0x76, 0x0d,
+    0x26, 0x14, 0xa7, 0xc9, 0x73, 0xc4, 0x09, 0x64,
+    0x1c, 0x3d, 0x15, 0x58, 0xcb, 0x94, 0x7a, 0x5f,
+    0x63, 0xc7, 0x19, 0xb9, 0x56, 0x2a, 0xca, 0xaa,
+    0x8a, 0x17, 0xb6, 0x4f, 0x1d, 0xbc, 0xdb, 0x6f,
+    0x9a, 0x66, 0x7f, 0x21, 0xe4, 0x6a, 0xbf, 0x96,
+    0x1c, 0xca, 0x5c, 0xcc, 0x7d, 0x1d, 0xd9, 0x89,
+    0x45, 0x24, 0xdb, 0x72, 0xc5, 0xeb, 0xb3, 0xcb,
+    0x16, 0x1b, 0x0d, 0x54, 0xe0, 0x75, 0x71, 0xbb,
+    0x6f, 0xcb, 0xf5, 0xa8, 0x15, 0xf5, 0x27, 0xf5,
+    0xbc, 0x2e, 0x70, 0xbb, 0x9b, 0x9d, 0xce, 0x5e,
+    0x70, 0xc3, 0xdd, 0xba, 0xc3, 0x3a, 0x47, 0xfb,
+    0x94, 0x1a, 0xbd, 0xcf, 0x10, 0x7b, 0xad, 0x5f,
+    0x28, 0x0b, 0xbf, 0xa6, 0xa7, 0xd8, 0x24, 0xe4,
+    0x8f, 0xfd, 0xbb, 0x63, 0xb3, 0xcc, 0xf3, 0x5f,
+    0xb2, 0xcd, 0xef, 0xd0, 0x7f, 0xfd, 0x1a, 0x43,
+    0xf0, 0x49, 0xa6, 0x63, 0x25, 0x52, 0x43, 0x06,
+    0x87, 0xdd, 0x7e, 0x94, 0x59, 0x69, 0x16, 0x6e,
+    0x00, 0xd0, 0x9d, 0x85, 0x99, 0x7b, 0xb4, 0xf9,
+    0x01, 0x8c, 0x32, 0xf6, 0x4a, 0x68, 0xec, 0x64,
+    0x17, 0x82, 0x73, 0xd1, 0xd8, 0x8f, 0x5b, 0x8a,
+    0x17, 0xc8, 0x19, 0xfa, 0x20, 0x85, 0xd9, 0x1d,
+    0xbb, 0xc8, 0x15, 0xf6, 0x9b, 0xb6, 0x9f, 0xbd,
+    0xb9, 0x3c, 0xed, 0x17, 0xa5, 0xf6, 0x36, 0xff,
+    0x01, 0x57, 0x2c, 0xf1, 0xe6, 0x5e, 0x1a, 0x00,
+    0x00,
 };
 
 static const uint8_t data_perror_htm[] =
@@ -2882,6 +3731,132 @@ static const uint8_t data_perror_htm[] =
     0x0d, 0x0a,
 };
 
+static const uint8_t data_perror_htm_gz[] =
+{
+    /* /perror.htm.gz */
+    0x2f, 0x70, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2e,
+    0x68, 0x74, 0x6d, 0x2e, 0x67, 0x7a, 0x00,
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x03, 0xa5, 0x56, 0xeb, 0x6f, 0xe3, 0x36,
+    0x0c, 0xff, 0x3e, 0x60, 0xff, 0x03, 0x2b, 0xe0,
+    0x0e, 0x77, 0xc0, 0x6c, 0x35, 0x59, 0x87, 0xdb,
+    0x56, 0x27, 0xc0, 0x2d, 0x6d, 0x77, 0xb9, 0xc7,
+    0x1a, 0xac, 0x19, 0xb0, 0x7d, 0x2a, 0x14, 0x5b,
+    0xb1, 0xd5, 0xca, 0x96, 0x4f, 0x92, 0xf3, 0xb8,
+    0xbf, 0x7e, 0x94, 0x1f, 0x8d, 0x9d, 0x67, 0x8b,
+    0xfb, 0x10, 0x47, 0xa4, 0xc8, 0x1f, 0x29, 0x92,
+    0x22, 0x15, 0x9c, 0x5d, 0xdd, 0x8e, 0xa6, 0xff,
+    0x4d, 0xae, 0xe1, 0xc3, 0xf4, 0xcb, 0xe7, 0xe1,
+    0x8f, 0x3f, 0x04, 0x67, 0x9e, 0x07, 0x23, 0x95,
+    0xaf, 0xb5, 0x88, 0x13, 0x0b, 0x6f, 0xc2, 0xb7,
+    0xd0, 0x3f, 0xef, 0xfd, 0xec, 0xe1, 0xe7, 0x1d,
+    0x4c, 0xf9, 0x8a, 0x19, 0x18, 0x67, 0xc6, 0xea,
+    0x22, 0xe5, 0x99, 0x75, 0xeb, 0x50, 0xe9, 0x5c,
+    0x69, 0x66, 0x79, 0xe4, 0x03, 0xbc, 0x97, 0x12,
+    0x4a, 0x45, 0x03, 0x9a, 0x1b, 0xae, 0x17, 0x8e,
+    0xeb, 0x79, 0x0e, 0x37, 0xb1, 0xa9, 0xc4, 0x7f,
+    0x80, 0x20, 0xe1, 0x2c, 0x2a, 0x57, 0xb8, 0x4e,
+    0xb9, 0x65, 0x90, 0x58, 0x9b, 0x7b, 0xfc, 0x6b,
+    0x21, 0x16, 0x03, 0x32, 0x52, 0x99, 0x45, 0x64,
+    0xcf, 0xae, 0x73, 0x4e, 0x20, 0xac, 0xa8, 0x01,
+    0xb1, 0x7c, 0x65, 0xa9, 0x83, 0xb8, 0x0c, 0x13,
+    0xa6, 0x0d, 0xb7, 0x83, 0x7f, 0xa6, 0x37, 0xde,
+    0xaf, 0xa4, 0xc1, 0xb1, 0xc2, 0x4a, 0x3e, 0xbc,
+    0x51, 0x3a, 0x85, 0x09, 0xd3, 0x0c, 0x61, 0xb9,
+    0x86, 0x6b, 0xad, 0x95, 0x0e, 0x68, 0xb5, 0x57,
+    0x0b, 0x4a, 0x91, 0x3d, 0xa2, 0x6f, 0x72, 0x40,
+    0x8c, 0x5d, 0x4b, 0x6e, 0x12, 0xce, 0x2d, 0x01,
+    0x67, 0xad, 0x36, 0x12, 0x1a, 0x43, 0x20, 0xd1,
+    0x7c, 0xde, 0x48, 0xf8, 0x8e, 0x43, 0xf7, 0xe8,
+    0x27, 0x4a, 0xdb, 0xb0, 0xb0, 0x20, 0xd0, 0xcb,
+    0x06, 0x42, 0xa4, 0x2c, 0xe6, 0x74, 0xe5, 0x55,
+    0xbc, 0x0a, 0x66, 0xce, 0x16, 0x8e, 0xf4, 0xf1,
+    0xb3, 0xc1, 0x31, 0xa1, 0x16, 0xb9, 0x05, 0xa3,
+    0xc3, 0x01, 0x79, 0x60, 0x0b, 0x56, 0xd1, 0xfe,
+    0x03, 0x1a, 0x97, 0x2c, 0x8b, 0x0b, 0x84, 0x19,
+    0x90, 0x8f, 0xb8, 0x71, 0x57, 0x6e, 0xf4, 0xfc,
+    0x3e, 0x46, 0xa3, 0x3e, 0x3a, 0x29, 0xec, 0xdc,
+    0x9d, 0x3d, 0xa0, 0x95, 0x56, 0x15, 0x56, 0xfa,
+    0x14, 0xd7, 0x60, 0xa6, 0xa2, 0x75, 0x63, 0x28,
+    0x12, 0x0b, 0x10, 0xd1, 0x80, 0xb8, 0x5d, 0x91,
+    0xc5, 0x4d, 0xc4, 0x5c, 0xcc, 0xd8, 0x4c, 0x72,
+    0x58, 0x8a, 0xc8, 0x26, 0x03, 0xd2, 0x3b, 0x3f,
+    0x7f, 0xb5, 0xd9, 0x73, 0xbb, 0xba, 0x45, 0x39,
+    0x3a, 0xea, 0xd0, 0xc8, 0x61, 0x6d, 0xdc, 0x7b,
+    0x2b, 0x30, 0x06, 0x4c, 0xc7, 0xce, 0xbf, 0xfb,
+    0xe6, 0xe8, 0x2e, 0xb3, 0xbf, 0x53, 0xba, 0x5c,
+    0x2e, 0x7d, 0x2b, 0xfc, 0x50, 0xa5, 0x64, 0x0b,
+    0x04, 0x61, 0x44, 0x1a, 0x57, 0x61, 0x40, 0x89,
+    0x87, 0x3c, 0x26, 0xc0, 0x24, 0x42, 0xec, 0x94,
+    0xda, 0xb6, 0x66, 0x40, 0x59, 0xd7, 0x41, 0xba,
+    0xe5, 0x21, 0x7a, 0x7c, 0xe8, 0x70, 0xfb, 0x02,
+    0x73, 0x9f, 0xf4, 0x76, 0x9d, 0x9b, 0x7e, 0xb9,
+    0x18, 0xc1, 0x1d, 0xd7, 0x82, 0x9b, 0x72, 0xdd,
+    0xeb, 0xff, 0x76, 0xf1, 0xef, 0x67, 0xb8, 0x5e,
+    0x30, 0x59, 0x30, 0x2b, 0x54, 0x06, 0x9f, 0x84,
+    0xdd, 0xf6, 0x0b, 0x81, 0x4f, 0xda, 0xea, 0xef,
+    0xda, 0xba, 0xfe, 0xe4, 0x6d, 0x4c, 0x9c, 0xc2,
+    0xdc, 0x77, 0xda, 0x53, 0xf9, 0x59, 0xb0, 0xe7,
+    0x64, 0x88, 0xda, 0xf4, 0x22, 0x3c, 0x9a, 0x26,
+    0xdc, 0x6f, 0x27, 0x0a, 0x7d, 0x7e, 0x61, 0x6e,
+    0x90, 0xdc, 0x14, 0x17, 0x12, 0xae, 0x0e, 0x37,
+    0x74, 0xa2, 0x87, 0xee, 0x57, 0x97, 0x6f, 0xeb,
+    0xe4, 0x4f, 0x51, 0xc4, 0x7a, 0x28, 0x5a, 0x75,
+    0x5c, 0xc8, 0x36, 0xb6, 0x14, 0x43, 0x3c, 0x79,
+    0x75, 0x38, 0x36, 0x53, 0x85, 0xf5, 0xb1, 0x6d,
+    0x90, 0x52, 0xaf, 0x24, 0xc9, 0xf0, 0xbd, 0xfb,
+    0x83, 0xe9, 0xd8, 0x79, 0x19, 0x50, 0x94, 0x3f,
+    0xa0, 0xad, 0x16, 0xd8, 0xc0, 0x04, 0x5f, 0x6e,
+    0x00, 0x1a, 0x0e, 0x19, 0xb6, 0x0b, 0xe3, 0xb6,
+    0xe6, 0x9e, 0xc2, 0x9b, 0x49, 0x15, 0x3e, 0x6e,
+    0xc0, 0x4a, 0xb2, 0x42, 0x72, 0x39, 0xff, 0x6b,
+    0x34, 0xb9, 0x9a, 0xc2, 0x1f, 0x8e, 0x09, 0x57,
+    0x82, 0xc5, 0xd8, 0xc4, 0x0e, 0x03, 0x3e, 0x27,
+    0x8d, 0x4a, 0x49, 0xca, 0x1f, 0x3d, 0x97, 0x2e,
+    0x87, 0xbf, 0x92, 0x64, 0xd8, 0x29, 0x31, 0x98,
+    0x68, 0x15, 0x15, 0xa1, 0xc5, 0x86, 0x19, 0xf3,
+    0xef, 0x33, 0x55, 0x56, 0xcc, 0x9e, 0xbb, 0xb2,
+    0x82, 0x1b, 0x96, 0x0a, 0xb9, 0x7e, 0xa6, 0xa9,
+    0x0a, 0x5f, 0xa8, 0x7b, 0x67, 0x62, 0x13, 0xa8,
+    0x9a, 0x41, 0x86, 0x63, 0x7a, 0x0b, 0x6e, 0x3e,
+    0x68, 0x25, 0xe1, 0x8a, 0xa7, 0x0a, 0x7a, 0xc1,
+    0x4c, 0x0f, 0xdf, 0x7c, 0x98, 0x4e, 0x27, 0xf0,
+    0x37, 0xce, 0x0f, 0x6e, 0xac, 0x79, 0xfb, 0x0c,
+    0xf8, 0x30, 0x16, 0xbe, 0x31, 0x62, 0x0f, 0x60,
+    0xbf, 0x04, 0xbc, 0xbb, 0x1b, 0xd3, 0xd1, 0x9f,
+    0xe3, 0x5d, 0xa8, 0x80, 0xb6, 0x6a, 0x6d, 0x73,
+    0x23, 0x3a, 0x51, 0x6e, 0x5d, 0x8d, 0x4e, 0xb8,
+    0xc9, 0xb1, 0x8a, 0xae, 0xe7, 0xdc, 0xce, 0x3d,
+    0x3a, 0xda, 0xa2, 0x2b, 0x89, 0x56, 0xaf, 0xef,
+    0x6e, 0xe8, 0x3d, 0xdc, 0xa6, 0x2f, 0x32, 0x29,
+    0xe2, 0x6c, 0x40, 0x24, 0x9f, 0xe3, 0xf0, 0x5b,
+    0xd4, 0x94, 0x55, 0x39, 0x69, 0x6c, 0xbd, 0xfb,
+    0xe5, 0x15, 0x39, 0xa0, 0x5f, 0x62, 0x84, 0xe8,
+    0x2d, 0xd7, 0x47, 0x24, 0xaa, 0xab, 0xdc, 0x6f,
+    0x2c, 0x55, 0xf2, 0x64, 0xb8, 0x33, 0x9c, 0x93,
+    0xfe, 0x31, 0x33, 0xf4, 0xa4, 0x1d, 0x6c, 0x15,
+    0x60, 0xc4, 0x37, 0x1c, 0x96, 0x7d, 0x72, 0x2c,
+    0x50, 0x1d, 0x9d, 0x7c, 0xdb, 0xad, 0x80, 0xe6,
+    0x2f, 0x92, 0xbf, 0x55, 0xb9, 0x01, 0x0f, 0x54,
+    0xc6, 0x41, 0xcd, 0xc1, 0x26, 0x1c, 0xf2, 0xe6,
+    0x60, 0x06, 0x0c, 0x0a, 0x81, 0x55, 0x25, 0x7b,
+    0xa6, 0x98, 0x8e, 0x4e, 0x44, 0x09, 0x4b, 0x6e,
+    0x89, 0xb3, 0x8e, 0x0b, 0x54, 0xd0, 0x90, 0x0a,
+    0x2c, 0xcd, 0x2c, 0xfe, 0x09, 0x44, 0xe6, 0x12,
+    0x13, 0x81, 0xd2, 0xe0, 0xfa, 0x15, 0xda, 0xd1,
+    0xf8, 0x30, 0xe0, 0xfe, 0xeb, 0x6c, 0x66, 0xf2,
+    0xcb, 0x97, 0x7a, 0x3c, 0x91, 0x9c, 0x19, 0x0e,
+    0x56, 0xaf, 0x81, 0xc5, 0x4c, 0x64, 0x67, 0xa7,
+    0x9d, 0x3a, 0x96, 0x97, 0x43, 0xc6, 0x77, 0xe6,
+    0xd2, 0x9e, 0x8e, 0xff, 0xc4, 0xda, 0x2a, 0xdd,
+    0xee, 0x24, 0xd8, 0x7b, 0x4f, 0xe6, 0x4a, 0xd9,
+    0xee, 0x23, 0xa6, 0x33, 0x2d, 0xa0, 0xf5, 0x72,
+    0x7d, 0x1d, 0xe2, 0xf2, 0xf2, 0x7b, 0x1f, 0xaf,
+    0xdb, 0xbe, 0x04, 0xb4, 0x76, 0x3a, 0xa0, 0xf5,
+    0x83, 0xf6, 0x7f, 0xda, 0xf1, 0x17, 0x21, 0x42,
+    0x0b, 0x00, 0x00,
+};
+
 static const uint8_t data_styles_css[] =
 {
     /* /styles.css */
@@ -3091,7 +4066,82 @@ static const uint8_t data_styles_css[] =
     0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c,
     0x69, 0x64, 0x20, 0x23, 0x66, 0x66, 0x63, 0x63,
     0x30, 0x30, 0x3b, 0x0d, 0x0a, 0x7d, 0x0d, 0x0a,
-   
+};
+
+static const uint8_t data_styles_css_gz[] =
+{
+    /* /styles.css.gz */
+    0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x2e,
+    0x63, 0x73, 0x73, 0x2e, 0x67, 0x7a, 0x00,
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x03, 0xb5, 0x54, 0xc1, 0x8e, 0x9b, 0x30,
+    0x14, 0xbc, 0x47, 0xca, 0x3f, 0x3c, 0x69, 0x2f,
+    0x6d, 0x14, 0x12, 0x42, 0xbb, 0x5a, 0x89, 0x3d,
+    0xad, 0x7a, 0x69, 0xcf, 0xed, 0x7d, 0xe5, 0xd8,
+    0x0f, 0xb0, 0xd6, 0xd8, 0xc8, 0x76, 0x48, 0x68,
+    0xd5, 0x7f, 0xaf, 0x0d, 0x86, 0x00, 0x25, 0x51,
+    0xa5, 0xb6, 0x1c, 0x10, 0x1e, 0x9b, 0xf1, 0xbc,
+    0x79, 0x63, 0xef, 0x37, 0xf0, 0x49, 0x55, 0x8d,
+    0xe6, 0x79, 0x61, 0xe1, 0x1d, 0x7d, 0x0f, 0x49,
+    0x7c, 0xf8, 0x10, 0xb9, 0xd7, 0x13, 0x7c, 0xc3,
+    0x0b, 0x31, 0xf0, 0x45, 0x1a, 0xab, 0x4f, 0x25,
+    0x4a, 0xeb, 0xbf, 0xa9, 0xd2, 0x95, 0xd2, 0xc4,
+    0x22, 0xdb, 0x01, 0xbc, 0x08, 0x01, 0xed, 0x8f,
+    0x06, 0x34, 0x1a, 0xd4, 0xb5, 0x47, 0x37, 0xfb,
+    0xf5, 0x6a, 0xbd, 0xda, 0x6f, 0xe0, 0xab, 0x6d,
+    0x04, 0x97, 0x39, 0x64, 0x4a, 0x83, 0x2d, 0x10,
+    0x1c, 0x03, 0xd7, 0x08, 0x4c, 0xd1, 0x96, 0xad,
+    0x5b, 0x79, 0x54, 0xac, 0x59, 0xaf, 0x7e, 0xac,
+    0x57, 0xe0, 0x9e, 0x23, 0xa1, 0x6f, 0xb9, 0x56,
+    0x27, 0xc9, 0x22, 0xaa, 0x84, 0xd2, 0x29, 0x9c,
+    0x0b, 0x6e, 0xf1, 0xb9, 0x9b, 0x0d, 0xd0, 0x51,
+    0xb8, 0x55, 0x01, 0xca, 0x94, 0xb4, 0x51, 0x46,
+    0x4a, 0x2e, 0x9a, 0x14, 0x5e, 0x34, 0x47, 0xb1,
+    0xfd, 0x8c, 0xa2, 0x46, 0xcb, 0x29, 0xd9, 0x1a,
+    0x22, 0x4d, 0xe4, 0x54, 0xf1, 0xcc, 0xad, 0xfe,
+    0x79, 0x43, 0x54, 0x81, 0x84, 0xf9, 0x31, 0xe3,
+    0x75, 0x27, 0xe8, 0x21, 0x20, 0x83, 0x28, 0x2a,
+    0x90, 0xf8, 0x6d, 0x95, 0x2d, 0xc2, 0xae, 0x25,
+    0xd1, 0x39, 0x97, 0x91, 0x43, 0xac, 0x2a, 0x53,
+    0x38, 0xc4, 0xd5, 0xa5, 0xdf, 0xa1, 0xff, 0xfb,
+    0xb5, 0x38, 0x0c, 0x04, 0xad, 0x48, 0xc3, 0xbf,
+    0x63, 0x0a, 0x09, 0x96, 0x63, 0xe5, 0x67, 0xf4,
+    0xe6, 0x79, 0x6e, 0xc1, 0x02, 0x6e, 0xf1, 0x62,
+    0x23, 0x22, 0x78, 0x2e, 0x53, 0xa0, 0xce, 0x25,
+    0xd4, 0xbf, 0x53, 0x27, 0x4b, 0xd4, 0x87, 0x5d,
+    0xf2, 0xf8, 0x0f, 0xd8, 0xa1, 0xd0, 0xd7, 0x76,
+    0x28, 0xcd, 0x50, 0x5f, 0xeb, 0xac, 0x2e, 0x60,
+    0x94, 0xe0, 0x0c, 0x1e, 0xb2, 0x8c, 0xd2, 0x38,
+    0x7e, 0x9e, 0x2c, 0xb3, 0xaa, 0x5a, 0x5e, 0x33,
+    0xe5, 0x27, 0xc0, 0xcb, 0x7c, 0xb6, 0x45, 0x0a,
+    0xf1, 0x9d, 0x16, 0xb9, 0xb0, 0x9c, 0x46, 0xfd,
+    0xf1, 0xc3, 0xab, 0x01, 0x42, 0x11, 0x57, 0xa2,
+    0xc0, 0xcc, 0xde, 0x6d, 0x8e, 0x9f, 0x39, 0x73,
+    0x66, 0x0b, 0xd7, 0x83, 0xe4, 0x71, 0xd4, 0xaf,
+    0x96, 0xfc, 0x24, 0x06, 0x42, 0xc1, 0x8d, 0x73,
+    0xd4, 0x29, 0xc0, 0xc8, 0x36, 0x95, 0xf3, 0x55,
+    0x2a, 0x89, 0x13, 0xea, 0x4e, 0xac, 0x1f, 0x57,
+    0x84, 0xf9, 0x92, 0x46, 0xea, 0x3b, 0x3a, 0x92,
+    0x3a, 0xfd, 0x6f, 0x5b, 0xe8, 0x47, 0x35, 0x37,
+    0x2e, 0xc5, 0xec, 0x4e, 0xcc, 0xa7, 0x86, 0xf6,
+    0x60, 0xd2, 0x3e, 0x01, 0x64, 0xdc, 0x54, 0x82,
+    0x34, 0x3e, 0xff, 0x6a, 0x9a, 0xff, 0x85, 0x3e,
+    0xcf, 0x4c, 0x48, 0x06, 0x0f, 0xc2, 0x44, 0xdb,
+    0xab, 0x2b, 0x3a, 0x14, 0xf2, 0x71, 0x80, 0x16,
+    0x93, 0x32, 0x4c, 0x30, 0xa4, 0xfe, 0x12, 0xe0,
+    0x4a, 0x4e, 0x0c, 0xea, 0x1d, 0x8e, 0xe3, 0xb9,
+    0xc3, 0x24, 0x2d, 0x54, 0x8d, 0xfa, 0xea, 0x09,
+    0xa1, 0x96, 0xd7, 0xf8, 0x47, 0x96, 0xdc, 0xca,
+    0x05, 0x75, 0xc5, 0x3b, 0x65, 0xa3, 0x68, 0x04,
+    0x64, 0x60, 0xbd, 0x9d, 0x85, 0x30, 0xe3, 0x73,
+    0x33, 0x4f, 0x44, 0x20, 0x79, 0x9d, 0xdf, 0x03,
+    0x93, 0xb3, 0xf6, 0x37, 0x47, 0x6d, 0xa1, 0x94,
+    0x4c, 0x29, 0x3b, 0xbd, 0x85, 0x02, 0x72, 0xe7,
+    0x16, 0x1a, 0xe9, 0xd9, 0x3d, 0xcd, 0xf4, 0xb4,
+    0x01, 0x4e, 0x81, 0x5b, 0x27, 0x80, 0x2e, 0x08,
+    0x6a, 0x2f, 0xed, 0xa1, 0xe2, 0x7e, 0xf7, 0xff,
+    0x72, 0xf4, 0x7f, 0x01, 0x95, 0xb0, 0x9f, 0xf4,
+    0x60, 0x06, 0x00, 0x00,
 };
 
 static const uint8_t data_utfpr_png[] =
@@ -5258,40 +6308,80 @@ const struct fsdata_file file_utfpr_png[] =
 	}
 };
 
-const struct fsdata_file file_styles_css[] =
+const struct fsdata_file file_styles_css_gz[] =
 {
 	{
 		file_utfpr_png,
+		data_styles_css_gz,
+		data_styles_css_gz + 15,
+		sizeof(data_styles_css_gz) - 15
+	}
+};
+
+const struct fsdata_file file_styles_css[] =
+{
+	{
+		file_styles_css_gz,
 		data_styles_css,
 		data_styles_css + 12,
 		sizeof(data_styles_css) - 12
 	}
 };
 
-const struct fsdata_file file_perror_htm[] =
+const struct fsdata_file file_perror_htm_gz[] =
 {
 	{
 		file_styles_css,
+		data_perror_htm_gz,
+		data_perror_htm_gz + 15,
+		sizeof(data_perror_htm_gz) - 15
+	}
+};
+
+const struct fsdata_file file_perror_htm[] =
+{
+	{
+		file_perror_htm_gz,
 		data_perror_htm,
 		data_perror_htm + 12,
 		sizeof(data_perror_htm) - 12
 	}
 };
 
-const struct fsdata_file file_javascript_js[] =
+const struct fsdata_file file_javascript_js_gz[] =
 {
 	{
 		file_perror_htm,
+		data_javascript_js_gz,
+		data_javascript_js_gz + 18,
+		sizeof(data_javascript_js_gz) - 18
+	}
+};
+
+const struct fsdata_file file_javascript_js[] =
+{
+	{
+		file_javascript_js_gz,
 		data_javascript_js,
 		data_javascript_js + 15,
 		sizeof(data_javascript_js) - 15
 	}
 };
 
-const struct fsdata_file file_io_http_htm[] =
+const struct fsdata_file file_io_http_htm_gz[] =
 {
 	{
 		file_javascript_js,
+		data_io_http_htm_gz,
+		data_io_http_htm_gz + 16,
+		sizeof(data_io_http_htm_gz) - 16
+	}
+};
+
+const struct fsdata_file file_io_http_htm[] =
+{
+	{
+		file_io_http_htm_gz,
 		data_io_http_htm,
 		data_io_http_htm + 13,
 		sizeof(data_io_http_htm) - 13
@@ -5308,10 +6398,20 @@ const struct fsdata_file file_io_cgi_ssi[] =
 	}
 };
 
-const struct fsdata_file file_index_htm[] =
+const struct fsdata_file file_index_htm_gz[] =
 {
 	{
 		file_io_cgi_ssi,
+		data_index_htm_gz,
+		data_index_htm_gz + 14,
+		sizeof(data_index_htm_gz) - 14
+	}
+};
+
+const struct fsdata_file file_index_htm[] =
+{
+	{
+		file_index_htm_gz,
 		data_index_htm,
 		data_index_htm + 11,
 		sizeof(data_index_htm) - 11
@@ -5328,10 +6428,20 @@ const struct fsdata_file file_favicon_ico[] =
 	}
 };
 
-const struct fsdata_file file_about_htm[] =
+const struct fsdata_file file_about_htm_gz[] =
 {
 	{
 		file_favicon_ico,
+		data_about_htm_gz,
+		data_about_htm_gz + 14,
+		sizeof(data_about_htm_gz) - 14
+	}
+};
+
+const struct fsdata_file file_about_htm[] =
+{
+	{
+		file_about_htm_gz,
 		data_about_htm,
 		data_about_htm + 11,
 		sizeof(data_about_htm) - 11
@@ -5350,5 +6460,5 @@ const struct fsdata_file file_404_htm[] =
 
 #define FS_ROOT file_404_htm
 
-#define FS_NUMFILES 10
+#define FS_NUMFILES 16
 
@@ -0,0 +1,777 @@
+//*****************************************************************************
+//
+// io_ws.c - WebSocket control channel for the enet_io application.
+//
+// The web server hands over connections that request an upgrade to the
+// WebSocket protocol on /ws (see LWIP_HTTPD_WEBSOCKET in httpd.c).  From then
+// on the connection belongs to this module, which answers the handshake,
+// decodes the frames sent by the client and runs the commands they carry.
+// All of this happens in the lwIP context, just like the web server.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "utils/lwiplib.h"
+#include "utils/ustdlib.h"
+#include "io.h"
+#include "io_ws.h"
+
+extern bool automaticMode;
+
+//*****************************************************************************
+//
+// The GUID appended to the client's key to compute the handshake response.
+//
+//*****************************************************************************
+#define WS_GUID                 "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+#define WS_GUID_LEN             36
+
+//*****************************************************************************
+//
+// The longest Sec-WebSocket-Key accepted.  The key is the base64 encoding of
+// 16 random bytes, i.e. 24 characters.
+//
+//*****************************************************************************
+#define WS_MAX_KEY_LEN          32
+
+//*****************************************************************************
+//
+// The length of the Sec-WebSocket-Accept value: a base64 encoded SHA-1 hash.
+//
+//*****************************************************************************
+#define WS_ACCEPT_LEN           28
+
+//*****************************************************************************
+//
+// The frame opcodes.
+//
+//*****************************************************************************
+#define WS_OP_CONTINUATION      0x0
+#define WS_OP_TEXT              0x1
+#define WS_OP_BINARY            0x2
+#define WS_OP_CLOSE             0x8
+#define WS_OP_PING              0x9
+#define WS_OP_PONG              0xa
+
+#define WS_FIN                  0x80
+#define WS_MASK                 0x80
+
+//*****************************************************************************
+//
+// The status codes sent when the server closes the connection.
+//
+//*****************************************************************************
+#define WS_CLOSE_UNSUPPORTED    1003
+#define WS_CLOSE_TOO_BIG        1009
+
+//*****************************************************************************
+//
+// The receive buffer holds one complete frame: up to 2 bytes of header, 4
+// bytes of mask and the payload.
+//
+//*****************************************************************************
+#define WS_RX_SIZE              (2 + 4 + IO_WS_MAX_PAYLOAD)
+
+//*****************************************************************************
+//
+// The interval of the poll callback of a connection, in units of the TCP
+// coarse timer (500 ms).  An idle connection is sent a ping on every poll so
+// that a client that has gone away is noticed.
+//
+//*****************************************************************************
+#define WS_POLL_INTERVAL        4
+
+#define ROL(x, n)               (((x) << (n)) | ((x) >> (32 - (n))))
+
+//*****************************************************************************
+//
+// The state of a WebSocket connection.  The slot is free if psPCB is NULL.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The connection.
+    //
+    struct tcp_pcb *psPCB;
+
+    //
+    // True if the client has to be sent the state as it could not take the
+    // last status message.
+    //
+    bool bStatusPending;
+
+    //
+    // True if nothing has been sent since the last poll.
+    //
+    bool bIdle;
+
+    //
+    // The number of bytes in pui8Rx.
+    //
+    uint32_t ui32RxLen;
+
+    //
+    // The received bytes of the frame being reassembled.
+    //
+    uint8_t pui8Rx[WS_RX_SIZE];
+}
+tWSClient;
+
+//*****************************************************************************
+//
+// The WebSocket connections.
+//
+//*****************************************************************************
+static tWSClient g_psWSClients[IO_WS_MAX_CLIENTS];
+
+//*****************************************************************************
+//
+// Process a single 64-byte block of SHA-1 input.  The message schedule is
+// kept in a rolling 16-word window to keep the stack usage low.
+//
+//*****************************************************************************
+static void
+SHA1Block(uint32_t *pui32Hash, const uint8_t *pui8Block)
+{
+    uint32_t pui32W[16];
+    uint32_t ui32A, ui32B, ui32C, ui32D, ui32E, ui32F, ui32K, ui32T;
+    int i;
+
+    for(i = 0; i < 16; i++)
+    {
+        pui32W[i] = (((uint32_t)pui8Block[i * 4] << 24) |
+                     ((uint32_t)pui8Block[i * 4 + 1] << 16) |
+                     ((uint32_t)pui8Block[i * 4 + 2] << 8) |
+                     (uint32_t)pui8Block[i * 4 + 3]);
+    }
+
+    ui32A = pui32Hash[0];
+    ui32B = pui32Hash[1];
+    ui32C = pui32Hash[2];
+    ui32D = pui32Hash[3];
+    ui32E = pui32Hash[4];
+
+    for(i = 0; i < 80; i++)
+    {
+        if(i >= 16)
+        {
+            pui32W[i & 15] = ROL(pui32W[(i + 13) & 15] ^ pui32W[(i + 8) & 15] ^
+                                 pui32W[(i + 2) & 15] ^ pui32W[i & 15], 1);
+        }
+
+        if(i < 20)
+        {
+            ui32F = (ui32B & ui32C) | (~ui32B & ui32D);
+            ui32K = 0x5a827999;
+        }
+        else if(i < 40)
+        {
+            ui32F = ui32B ^ ui32C ^ ui32D;
+            ui32K = 0x6ed9eba1;
+        }
+        else if(i < 60)
+        {
+            ui32F = (ui32B & ui32C) | (ui32B & ui32D) | (ui32C & ui32D);
+            ui32K = 0x8f1bbcdc;
+        }
+        else
+        {
+            ui32F = ui32B ^ ui32C ^ ui32D;
+            ui32K = 0xca62c1d6;
+        }
+
+        ui32T = ROL(ui32A, 5) + ui32F + ui32E + ui32K + pui32W[i & 15];
+        ui32E = ui32D;
+        ui32D = ui32C;
+        ui32C = ROL(ui32B, 30);
+        ui32B = ui32A;
+        ui32A = ui32T;
+    }
+
+    pui32Hash[0] += ui32A;
+    pui32Hash[1] += ui32B;
+    pui32Hash[2] += ui32C;
+    pui32Hash[3] += ui32D;
+    pui32Hash[4] += ui32E;
+}
+
+//*****************************************************************************
+//
+// Compute the Sec-WebSocket-Accept value for a client key: the base64
+// encoding of the SHA-1 hash of the key followed by the GUID.  pcAccept must
+// hold WS_ACCEPT_LEN bytes; no NULL terminator is written.
+//
+//*****************************************************************************
+static void
+WSAcceptKey(const char *pcKey, uint32_t ui32KeyLen, char *pcAccept)
+{
+    static const char pcBase64[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    uint8_t pui8Msg[128];
+    uint8_t pui8Digest[20];
+    uint32_t pui32Hash[5];
+    uint32_t ui32Len, ui32Bits, ui32Idx;
+
+    //
+    // Build the padded message: key, GUID, 0x80, zeros and the length in
+    // bits, which always fits in the last 4 bytes here.
+    //
+    ui32Len = ui32KeyLen + WS_GUID_LEN;
+    memset(pui8Msg, 0, sizeof(pui8Msg));
+    memcpy(pui8Msg, pcKey, ui32KeyLen);
+    memcpy(pui8Msg + ui32KeyLen, WS_GUID, WS_GUID_LEN);
+    pui8Msg[ui32Len] = 0x80;
+    ui32Idx = (ui32Len + 9 + 63) & ~63;
+    ui32Bits = ui32Len * 8;
+    pui8Msg[ui32Idx - 4] = ui32Bits >> 24;
+    pui8Msg[ui32Idx - 3] = ui32Bits >> 16;
+    pui8Msg[ui32Idx - 2] = ui32Bits >> 8;
+    pui8Msg[ui32Idx - 1] = ui32Bits;
+
+    pui32Hash[0] = 0x67452301;
+    pui32Hash[1] = 0xefcdab89;
+    pui32Hash[2] = 0x98badcfe;
+    pui32Hash[3] = 0x10325476;
+    pui32Hash[4] = 0xc3d2e1f0;
+    SHA1Block(pui32Hash, pui8Msg);
+    if(ui32Idx > 64)
+    {
+        SHA1Block(pui32Hash, pui8Msg + 64);
+    }
+
+    for(ui32Idx = 0; ui32Idx < 20; ui32Idx++)
+    {
+        pui8Digest[ui32Idx] = pui32Hash[ui32Idx / 4] >>
+                              (24 - ((ui32Idx % 4) * 8));
+    }
+
+    //
+    // Encode the 20 bytes of the digest as 27 base64 characters and a '='.
+    //
+    for(ui32Idx = 0; ui32Idx < 20; ui32Idx += 3)
+    {
+        ui32Bits = ((pui8Digest[ui32Idx] << 16) |
+                    (pui8Digest[ui32Idx + 1] << 8) |
+                    (ui32Idx + 2 < 20 ? pui8Digest[ui32Idx + 2] : 0));
+        *pcAccept++ = pcBase64[(ui32Bits >> 18) & 0x3f];
+        *pcAccept++ = pcBase64[(ui32Bits >> 12) & 0x3f];
+        *pcAccept++ = pcBase64[(ui32Bits >> 6) & 0x3f];
+        *pcAccept++ = (ui32Idx + 2 < 20) ? pcBase64[ui32Bits & 0x3f] : '=';
+    }
+}
+
+//*****************************************************************************
+//
+// Queue a frame for sending.  Frames are only ever queued as a whole; false
+// is returned if there is no room for this one.  The caller calls
+// tcp_output() once it has queued everything it wants to send.
+//
+//*****************************************************************************
+static bool
+WSSend(tWSClient *psClient, uint8_t ui8Op, const uint8_t *pui8Data,
+       uint32_t ui32Len)
+{
+    uint8_t pui8Frame[2 + IO_WS_MAX_PAYLOAD];
+
+    if((ui32Len > IO_WS_MAX_PAYLOAD) ||
+       (tcp_sndbuf(psClient->psPCB) < (ui32Len + 2)))
+    {
+        return(false);
+    }
+
+    pui8Frame[0] = WS_FIN | ui8Op;
+    pui8Frame[1] = ui32Len;
+    if(ui32Len)
+    {
+        memcpy(pui8Frame + 2, pui8Data, ui32Len);
+    }
+
+    if(tcp_write(psClient->psPCB, pui8Frame, ui32Len + 2,
+                 TCP_WRITE_FLAG_COPY) != ERR_OK)
+    {
+        return(false);
+    }
+
+    psClient->bIdle = false;
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Queue a status message for a client.  If there is no room for it, it is
+// sent as soon as the client has acknowledged some of the data in flight.
+//
+//*****************************************************************************
+static void
+WSSendStatus(tWSClient *psClient)
+{
+    tIOStatus sStatus;
+    uint8_t pui8Msg[IO_WS_STATUS_LEN];
+
+    io_get_status(&sStatus);
+
+    pui8Msg[0] = IO_WS_MSG_STATUS;
+    pui8Msg[1] = sStatus.ui32Speed;
+    pui8Msg[2] = ((sStatus.bAutomatic ? IO_WS_FLAG_AUTOMATIC : 0) |
+                  (sStatus.bLEDOn ? IO_WS_FLAG_LED : 0));
+    pui8Msg[3] = sStatus.i32Frequency;
+    pui8Msg[4] = sStatus.i32Frequency >> 8;
+    pui8Msg[5] = sStatus.i32Frequency >> 16;
+    pui8Msg[6] = sStatus.i32Frequency >> 24;
+
+    psClient->bStatusPending = !WSSend(psClient, WS_OP_BINARY, pui8Msg,
+                                       sizeof(pui8Msg));
+}
+
+//*****************************************************************************
+//
+// Retry a close that failed for lack of memory.
+//
+//*****************************************************************************
+static err_t
+WSClosePoll(void *pvArg, struct tcp_pcb *psPCB)
+{
+    if(tcp_close(psPCB) == ERR_OK)
+    {
+        tcp_poll(psPCB, NULL, 0);
+    }
+
+    return(ERR_OK);
+}
+
+//*****************************************************************************
+//
+// Close a connection and free its slot.  If ui16Code is not zero, a close
+// frame with this status code is sent first.
+//
+//*****************************************************************************
+static void
+WSClose(tWSClient *psClient, uint16_t ui16Code)
+{
+    struct tcp_pcb *psPCB;
+    uint8_t pui8Code[2];
+
+    psPCB = psClient->psPCB;
+
+    if(ui16Code)
+    {
+        pui8Code[0] = ui16Code >> 8;
+        pui8Code[1] = ui16Code;
+        WSSend(psClient, WS_OP_CLOSE, pui8Code, sizeof(pui8Code));
+    }
+
+    psClient->psPCB = NULL;
+
+    tcp_arg(psPCB, NULL);
+    tcp_recv(psPCB, NULL);
+    tcp_sent(psPCB, NULL);
+    tcp_err(psPCB, NULL);
+    tcp_poll(psPCB, NULL, 0);
+
+    if(tcp_close(psPCB) != ERR_OK)
+    {
+        tcp_poll(psPCB, WSClosePoll, WS_POLL_INTERVAL);
+    }
+}
+
+//*****************************************************************************
+//
+// Run the commands of a binary message.  Processing stops at the first
+// unknown or truncated command.
+//
+//*****************************************************************************
+static void
+WSCommands(tWSClient *psClient, const uint8_t *pui8Data, uint32_t ui32Len)
+{
+    bool bStatus;
+
+    bStatus = false;
+
+    while(ui32Len)
+    {
+        switch(pui8Data[0])
+        {
+            case IO_WS_CMD_SET_SPEED:
+            {
+                if(ui32Len < 2)
+                {
+                    return;
+                }
+                automaticMode = false;
+                io_set_animation_speed(pui8Data[1]);
+                bStatus = true;
+                pui8Data += 2;
+                ui32Len -= 2;
+                break;
+            }
+
+            case IO_WS_CMD_TOGGLE_LED:
+            {
+                io_toggle_led();
+                bStatus = true;
+                pui8Data++;
+                ui32Len--;
+                break;
+            }
+
+            case IO_WS_CMD_AUTOMATIC:
+            {
+                automaticMode = true;
+                bStatus = true;
+                pui8Data++;
+                ui32Len--;
+                break;
+            }
+
+            case IO_WS_CMD_ECHO:
+            {
+                uint8_t pui8Msg[IO_WS_ECHO_LEN];
+
+                if(ui32Len < IO_WS_ECHO_LEN)
+                {
+                    return;
+                }
+                pui8Msg[0] = IO_WS_MSG_ECHO;
+                memcpy(pui8Msg + 1, pui8Data + 1, IO_WS_ECHO_LEN - 1);
+                WSSend(psClient, WS_OP_BINARY, pui8Msg, sizeof(pui8Msg));
+                pui8Data += IO_WS_ECHO_LEN;
+                ui32Len -= IO_WS_ECHO_LEN;
+                break;
+            }
+
+            default:
+            {
+                ui32Len = 0;
+                break;
+            }
+        }
+    }
+
+    //
+    // Confirm the change with the new state right away.  The other clients
+    // get it with the next periodic update.
+    //
+    if(bStatus)
+    {
+        WSSendStatus(psClient);
+    }
+}
+
+//*****************************************************************************
+//
+// Decode and handle the complete frames in the receive buffer.  Returns false
+// if the connection has been closed.
+//
+//*****************************************************************************
+static bool
+WSProcess(tWSClient *psClient)
+{
+    uint8_t *pui8Frame, *pui8Payload;
+    uint32_t ui32Left, ui32Len, ui32Idx;
+    uint8_t ui8Op;
+
+    pui8Frame = psClient->pui8Rx;
+    ui32Left = psClient->ui32RxLen;
+
+    while(ui32Left >= 2)
+    {
+        ui8Op = pui8Frame[0] & 0x0f;
+        ui32Len = pui8Frame[1] & 0x7f;
+
+        //
+        // Client frames are always masked.  Messages split into several
+        // frames and payloads that need an extended length are not used by
+        // the control protocol.
+        //
+        if(!(pui8Frame[1] & WS_MASK) || !(pui8Frame[0] & WS_FIN) ||
+           (ui8Op == WS_OP_CONTINUATION))
+        {
+            WSClose(psClient, WS_CLOSE_UNSUPPORTED);
+            return(false);
+        }
+        if(ui32Len > IO_WS_MAX_PAYLOAD)
+        {
+            WSClose(psClient, WS_CLOSE_TOO_BIG);
+            return(false);
+        }
+        if(ui32Left < (6 + ui32Len))
+        {
+            break;
+        }
+
+        pui8Payload = pui8Frame + 6;
+        for(ui32Idx = 0; ui32Idx < ui32Len; ui32Idx++)
+        {
+            pui8Payload[ui32Idx] ^= pui8Frame[2 + (ui32Idx & 3)];
+        }
+
+        switch(ui8Op)
+        {
+            case WS_OP_BINARY:
+            {
+                WSCommands(psClient, pui8Payload, ui32Len);
+                break;
+            }
+
+            case WS_OP_PING:
+            {
+                WSSend(psClient, WS_OP_PONG, pui8Payload, ui32Len);
+                break;
+            }
+
+            case WS_OP_CLOSE:
+            {
+                //
+                // Echo the status code and close the connection.
+                //
+                WSSend(psClient, WS_OP_CLOSE, pui8Payload,
+                       (ui32Len >= 2) ? 2 : 0);
+                WSClose(psClient, 0);
+                return(false);
+            }
+
+            default:
+            {
+                //
+                // Text messages and pongs are ignored.
+                //
+                break;
+            }
+        }
+
+        pui8Frame += 6 + ui32Len;
+        ui32Left -= 6 + ui32Len;
+    }
+
+    //
+    // Keep the start of the next frame.
+    //
+    memmove(psClient->pui8Rx, pui8Frame, ui32Left);
+    psClient->ui32RxLen = ui32Left;
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Data has been received on a WebSocket connection.
+//
+//*****************************************************************************
+static err_t
+WSRecv(void *pvArg, struct tcp_pcb *psPCB, struct pbuf *psBuf, err_t iErr)
+{
+    tWSClient *psClient;
+    uint16_t ui16Offset, ui16Len;
+
+    psClient = (tWSClient *)pvArg;
+
+    if((psBuf == NULL) || (iErr != ERR_OK))
+    {
+        if(psBuf != NULL)
+        {
+            tcp_recved(psPCB, psBuf->tot_len);
+            pbuf_free(psBuf);
+        }
+        WSClose(psClient, 0);
+        return(ERR_OK);
+    }
+
+    tcp_recved(psPCB, psBuf->tot_len);
+
+    //
+    // Frames fit in the receive buffer, so a segment carrying several of
+    // them is copied and decoded a piece at a time.
+    //
+    for(ui16Offset = 0; ui16Offset < psBuf->tot_len; ui16Offset += ui16Len)
+    {
+        ui16Len = pbuf_copy_partial(psBuf,
+                                    psClient->pui8Rx + psClient->ui32RxLen,
+                                    WS_RX_SIZE - psClient->ui32RxLen,
+                                    ui16Offset);
+        psClient->ui32RxLen += ui16Len;
+
+        if(!WSProcess(psClient))
+        {
+            break;
+        }
+    }
+
+    pbuf_free(psBuf);
+
+    if(psClient->psPCB != NULL)
+    {
+        tcp_output(psPCB);
+    }
+
+    return(ERR_OK);
+}
+
+//*****************************************************************************
+//
+// Data sent on a WebSocket connection has been acknowledged.
+//
+//*****************************************************************************
+static err_t
+WSSent(void *pvArg, struct tcp_pcb *psPCB, u16_t ui16Len)
+{
+    tWSClient *psClient;
+
+    psClient = (tWSClient *)pvArg;
+
+    if(psClient->bStatusPending)
+    {
+        WSSendStatus(psClient);
+        tcp_output(psPCB);
+    }
+
+    return(ERR_OK);
+}
+
+//*****************************************************************************
+//
+// Called periodically for every WebSocket connection.
+//
+//*****************************************************************************
+static err_t
+WSPoll(void *pvArg, struct tcp_pcb *psPCB)
+{
+    tWSClient *psClient;
+
+    psClient = (tWSClient *)pvArg;
+
+    if(psClient->bStatusPending)
+    {
+        WSSendStatus(psClient);
+    }
+    else if(psClient->bIdle)
+    {
+        WSSend(psClient, WS_OP_PING, NULL, 0);
+    }
+
+    psClient->bIdle = true;
+    tcp_output(psPCB);
+
+    return(ERR_OK);
+}
+
+//*****************************************************************************
+//
+// A WebSocket connection has been aborted; the pcb is already gone.
+//
+//*****************************************************************************
+static void
+WSError(void *pvArg, err_t iErr)
+{
+    tWSClient *psClient;
+
+    psClient = (tWSClient *)pvArg;
+
+    psClient->psPCB = NULL;
+}
+
+//*****************************************************************************
+//
+// Called by the web server for a request to upgrade a connection to the
+// WebSocket protocol.  pcKey is the value of the Sec-WebSocket-Key header
+// (not NULL terminated).  Returns ERR_OK if the connection has been taken
+// over, in which case the web server must not use it anymore.
+//
+//*****************************************************************************
+err_t
+httpd_websocket_open(struct tcp_pcb *psPCB, const char *pcKey,
+                     u16_t ui16KeyLen)
+{
+    static const char pcResponse[] =
+        "HTTP/1.1 101 Switching Protocols\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        "Sec-WebSocket-Accept: ";
+    tWSClient *psClient;
+    char pcAccept[WS_ACCEPT_LEN + 4];
+    uint32_t ui32Idx;
+
+    if((ui16KeyLen == 0) || (ui16KeyLen > WS_MAX_KEY_LEN) ||
+       (tcp_sndbuf(psPCB) < (sizeof(pcResponse) - 1 + sizeof(pcAccept))))
+    {
+        return(ERR_VAL);
+    }
+
+    //
+    // Find a free slot.
+    //
+    psClient = NULL;
+    for(ui32Idx = 0; ui32Idx < IO_WS_MAX_CLIENTS; ui32Idx++)
+    {
+        if(g_psWSClients[ui32Idx].psPCB == NULL)
+        {
+            psClient = &g_psWSClients[ui32Idx];
+            break;
+        }
+    }
+    if(psClient == NULL)
+    {
+        return(ERR_MEM);
+    }
+
+    //
+    // Send the handshake response.  The constant part is sent straight from
+    // flash.
+    //
+    WSAcceptKey(pcKey, ui16KeyLen, pcAccept);
+    memcpy(pcAccept + WS_ACCEPT_LEN, "\r\n\r\n", 4);
+    if((tcp_write(psPCB, pcResponse, sizeof(pcResponse) - 1, 0) != ERR_OK) ||
+       (tcp_write(psPCB, pcAccept, sizeof(pcAccept),
+                  TCP_WRITE_FLAG_COPY) != ERR_OK))
+    {
+        return(ERR_MEM);
+    }
+
+    //
+    // Take the connection over from the web server.
+    //
+    psClient->psPCB = psPCB;
+    psClient->bStatusPending = false;
+    psClient->bIdle = false;
+    psClient->ui32RxLen = 0;
+
+    tcp_arg(psPCB, psClient);
+    tcp_recv(psPCB, WSRecv);
+    tcp_sent(psPCB, WSSent);
+    tcp_err(psPCB, WSError);
+    tcp_poll(psPCB, WSPoll, WS_POLL_INTERVAL);
+    tcp_nagle_disable(psPCB);
+
+    //
+    // Start with the current state.
+    //
+    WSSendStatus(psClient);
+    tcp_output(psPCB);
+
+    return(ERR_OK);
+}
+
+//*****************************************************************************
+//
+// Send the current state to all WebSocket clients.  This must be called from
+// the lwIP context.
+//
+//*****************************************************************************
+void
+io_ws_send_status(void)
+{
+    uint32_t ui32Idx;
+    tWSClient *psClient;
+
+    for(ui32Idx = 0; ui32Idx < IO_WS_MAX_CLIENTS; ui32Idx++)
+    {
+        psClient = &g_psWSClients[ui32Idx];
+        if(psClient->psPCB != NULL)
+        {
+            WSSendStatus(psClient);
+            tcp_output(psClient->psPCB);
+        }
+    }
+}
@@ -0,0 +1,75 @@
+//*****************************************************************************
+//
+// io_ws.h - Prototypes for the WebSocket control channel of the enet_io
+//           application.
+//
+//*****************************************************************************
+
+#ifndef __IO_WS_H__
+#define __IO_WS_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The maximum number of WebSocket connections open at the same time.
+//
+//*****************************************************************************
+#define IO_WS_MAX_CLIENTS       2
+
+//*****************************************************************************
+//
+// The largest frame payload accepted from a client.  Commands are a few
+// bytes long; a client sending anything bigger is disconnected.
+//
+//*****************************************************************************
+#define IO_WS_MAX_PAYLOAD       125
+
+//*****************************************************************************
+//
+// Commands sent by the client in binary messages.  A message may hold any
+// number of commands back to back; each one starts with its code and is
+// followed by the listed payload.
+//
+//*****************************************************************************
+#define IO_WS_CMD_SET_SPEED     0x01    // uint8_t percent; selects manual mode
+#define IO_WS_CMD_TOGGLE_LED    0x02    // no payload
+#define IO_WS_CMD_AUTOMATIC     0x03    // no payload; selects automatic mode
+#define IO_WS_CMD_ECHO          0x04    // uint32_t tag, sent back unchanged
+
+//*****************************************************************************
+//
+// Messages sent to the client, each in a binary message of its own.
+// Multi-byte values are little endian.
+//
+//*****************************************************************************
+#define IO_WS_MSG_STATUS        0x81    // uint8_t speed, uint8_t flags,
+                                        // int32_t frequency
+#define IO_WS_MSG_ECHO          0x84    // uint32_t tag
+
+#define IO_WS_STATUS_LEN        7
+#define IO_WS_ECHO_LEN          5
+
+//*****************************************************************************
+//
+// The flags of the IO_WS_MSG_STATUS message.
+//
+//*****************************************************************************
+#define IO_WS_FLAG_AUTOMATIC    0x01
+#define IO_WS_FLAG_LED          0x02
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.
+//
+//*****************************************************************************
+extern void io_ws_send_status(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __IO_WS_H__
@@ -0,0 +1,418 @@
+//*****************************************************************************
+//
+// json.c - A streaming JSON writer that needs no memory of its own.
+//
+// The document is described by a sequence of calls, which the writer turns
+// into text.  Only the part of the text that falls into the window given to
+// JSONInit() is stored, so a document can be sent in pieces straight into a
+// transmit buffer by describing it once for each piece (see json.h).
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "json.h"
+
+//*****************************************************************************
+//
+// The hexadecimal digits used to escape control characters.
+//
+//*****************************************************************************
+static const char g_pcHex[] = "0123456789abcdef";
+
+//*****************************************************************************
+//
+// Add characters to the document, storing the ones that fall into the window.
+//
+//*****************************************************************************
+static void
+JSONWrite(tJSONWriter *psWriter, const char *pcData, uint32_t ui32Len)
+{
+    uint32_t ui32Pos, ui32Start, ui32End;
+
+    ui32Pos = psWriter->ui32Len;
+    ui32Start = ui32Pos;
+    ui32End = ui32Pos + ui32Len;
+    psWriter->ui32Len = ui32End;
+
+    //
+    // Clip the characters to the window.
+    //
+    if(ui32Start < psWriter->ui32Skip)
+    {
+        ui32Start = psWriter->ui32Skip;
+    }
+    if(ui32End > (psWriter->ui32Skip + psWriter->ui32Size))
+    {
+        ui32End = psWriter->ui32Skip + psWriter->ui32Size;
+    }
+
+    if(ui32Start < ui32End)
+    {
+        memcpy(psWriter->pcBuf + (ui32Start - psWriter->ui32Skip),
+               pcData + (ui32Start - ui32Pos),
+               ui32End - ui32Start);
+    }
+}
+
+//*****************************************************************************
+//
+// Add a string to the document as a quoted JSON string, escaping the
+// characters that cannot appear in it as they are.
+//
+//*****************************************************************************
+static void
+JSONWriteString(tJSONWriter *psWriter, const char *pcString)
+{
+    const char *pcRun;
+    char pcEscape[6];
+    uint8_t ui8Char;
+
+    JSONWrite(psWriter, "\"", 1);
+
+    for(pcRun = pcString; *pcString; pcString++)
+    {
+        ui8Char = (uint8_t)*pcString;
+        if((ui8Char >= 0x20) && (ui8Char != '"') && (ui8Char != '\\'))
+        {
+            continue;
+        }
+
+        //
+        // Write the characters before this one in one go, then the escape
+        // sequence for this one.
+        //
+        JSONWrite(psWriter, pcRun, pcString - pcRun);
+        pcRun = pcString + 1;
+
+        pcEscape[0] = '\\';
+        if((ui8Char == '"') || (ui8Char == '\\'))
+        {
+            pcEscape[1] = ui8Char;
+            JSONWrite(psWriter, pcEscape, 2);
+        }
+        else
+        {
+            pcEscape[1] = 'u';
+            pcEscape[2] = '0';
+            pcEscape[3] = '0';
+            pcEscape[4] = g_pcHex[ui8Char >> 4];
+            pcEscape[5] = g_pcHex[ui8Char & 0xf];
+            JSONWrite(psWriter, pcEscape, 6);
+        }
+    }
+
+    JSONWrite(psWriter, pcRun, pcString - pcRun);
+    JSONWrite(psWriter, "\"", 1);
+}
+
+//*****************************************************************************
+//
+// Start a value: separate it from the previous value at the same level and
+// write its key, if any.
+//
+//*****************************************************************************
+static void
+JSONValueStart(tJSONWriter *psWriter, const char *pcKey)
+{
+    uint32_t ui32Bit;
+
+    ui32Bit = (uint32_t)1 << psWriter->ui32Depth;
+    if(psWriter->ui32First & ui32Bit)
+    {
+        psWriter->ui32First &= ~ui32Bit;
+    }
+    else
+    {
+        JSONWrite(psWriter, ",", 1);
+    }
+
+    if(pcKey)
+    {
+        JSONWriteString(psWriter, pcKey);
+        JSONWrite(psWriter, ":", 1);
+    }
+}
+
+//*****************************************************************************
+//
+// Open an object or array.
+//
+//*****************************************************************************
+static void
+JSONOpen(tJSONWriter *psWriter, const char *pcKey, const char *pcBracket)
+{
+    JSONValueStart(psWriter, pcKey);
+    JSONWrite(psWriter, pcBracket, 1);
+
+    if(psWriter->ui32Depth < JSON_MAX_DEPTH)
+    {
+        psWriter->ui32Depth++;
+        psWriter->ui32First |= (uint32_t)1 << psWriter->ui32Depth;
+    }
+}
+
+//*****************************************************************************
+//
+// Close an object or array.
+//
+//*****************************************************************************
+static void
+JSONClose(tJSONWriter *psWriter, const char *pcBracket)
+{
+    JSONWrite(psWriter, pcBracket, 1);
+
+    if(psWriter->ui32Depth)
+    {
+        psWriter->ui32Depth--;
+    }
+}
+
+//*****************************************************************************
+//
+//! Starts a JSON document.
+//!
+//! \param psWriter is the writer to initialize.
+//! \param pcBuf is the buffer that receives the window of the document.
+//! \param ui32Skip is the number of characters of the document that come
+//! before the window.
+//! \param ui32Size is the size of the window, in characters.
+//!
+//! The document is not terminated by a NULL.  pcBuf may be NULL if ui32Size
+//! is 0, which is used to find the length of a document.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+JSONInit(tJSONWriter *psWriter, char *pcBuf, uint32_t ui32Skip,
+         uint32_t ui32Size)
+{
+    psWriter->pcBuf = pcBuf;
+    psWriter->ui32Skip = ui32Skip;
+    psWriter->ui32Size = ui32Size;
+    psWriter->ui32Len = 0;
+    psWriter->ui32Depth = 0;
+    psWriter->ui32First = 1;
+}
+
+//*****************************************************************************
+//
+//! Opens an object.
+//!
+//! \param psWriter is the writer.
+//! \param pcKey is the key of the object in the enclosing object, or NULL.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+JSONObjectStart(tJSONWriter *psWriter, const char *pcKey)
+{
+    JSONOpen(psWriter, pcKey, "{");
+}
+
+//*****************************************************************************
+//
+//! Closes the object opened last.
+//!
+//! \param psWriter is the writer.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+JSONObjectEnd(tJSONWriter *psWriter)
+{
+    JSONClose(psWriter, "}");
+}
+
+//*****************************************************************************
+//
+//! Opens an array.
+//!
+//! \param psWriter is the writer.
+//! \param pcKey is the key of the array in the enclosing object, or NULL.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+JSONArrayStart(tJSONWriter *psWriter, const char *pcKey)
+{
+    JSONOpen(psWriter, pcKey, "[");
+}
+
+//*****************************************************************************
+//
+//! Closes the array opened last.
+//!
+//! \param psWriter is the writer.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+JSONArrayEnd(tJSONWriter *psWriter)
+{
+    JSONClose(psWriter, "]");
+}
+
+//*****************************************************************************
+//
+//! Writes a string value.
+//!
+//! \param psWriter is the writer.
+//! \param pcKey is the key of the value, or NULL.
+//! \param pcValue is the NULL-terminated string; NULL writes null.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+JSONString(tJSONWriter *psWriter, const char *pcKey, const char *pcValue)
+{
+    JSONValueStart(psWriter, pcKey);
+
+    if(pcValue)
+    {
+        JSONWriteString(psWriter, pcValue);
+    }
+    else
+    {
+        JSONWrite(psWriter, "null", 4);
+    }
+}
+
+//*****************************************************************************
+//
+//! Writes a signed number.
+//!
+//! \param psWriter is the writer.
+//! \param pcKey is the key of the value, or NULL.
+//! \param i32Value is the number.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+JSONInt(tJSONWriter *psWriter, const char *pcKey, int32_t i32Value)
+{
+    if(i32Value < 0)
+    {
+        JSONValueStart(psWriter, pcKey);
+        JSONWrite(psWriter, "-", 1);
+
+        //
+        // Write the magnitude as a number that is not separated from the
+        // sign.
+        //
+        psWriter->ui32First |= (uint32_t)1 << psWriter->ui32Depth;
+        JSONUInt(psWriter, NULL, 0 - (uint32_t)i32Value);
+    }
+    else
+    {
+        JSONUInt(psWriter, pcKey, (uint32_t)i32Value);
+    }
+}
+
+//*****************************************************************************
+//
+//! Writes an unsigned number.
+//!
+//! \param psWriter is the writer.
+//! \param pcKey is the key of the value, or NULL.
+//! \param ui32Value is the number.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+JSONUInt(tJSONWriter *psWriter, const char *pcKey, uint32_t ui32Value)
+{
+    char pcDigits[10];
+    uint32_t ui32Idx;
+
+    JSONValueStart(psWriter, pcKey);
+
+    //
+    // Produce the digits from the last one backwards.
+    //
+    ui32Idx = sizeof(pcDigits);
+    do
+    {
+        pcDigits[--ui32Idx] = '0' + (ui32Value % 10);
+        ui32Value /= 10;
+    }
+    while(ui32Value);
+
+    JSONWrite(psWriter, pcDigits + ui32Idx, sizeof(pcDigits) - ui32Idx);
+}
+
+//*****************************************************************************
+//
+//! Writes a boolean value.
+//!
+//! \param psWriter is the writer.
+//! \param pcKey is the key of the value, or NULL.
+//! \param bValue is the value.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+JSONBool(tJSONWriter *psWriter, const char *pcKey, bool bValue)
+{
+    JSONValueStart(psWriter, pcKey);
+
+    if(bValue)
+    {
+        JSONWrite(psWriter, "true", 4);
+    }
+    else
+    {
+        JSONWrite(psWriter, "false", 5);
+    }
+}
+
+//*****************************************************************************
+//
+//! Returns the length of the document written so far.
+//!
+//! \param psWriter is the writer.
+//!
+//! \return The number of characters in the document, including the ones
+//! outside the window.
+//
+//*****************************************************************************
+uint32_t
+JSONLength(const tJSONWriter *psWriter)
+{
+    return(psWriter->ui32Len);
+}
+
+//*****************************************************************************
+//
+//! Returns the number of characters stored in the window.
+//!
+//! \param psWriter is the writer.
+//!
+//! \return The number of characters of the document written so far that fell
+//! into the window.
+//
+//*****************************************************************************
+uint32_t
+JSONWindowLength(const tJSONWriter *psWriter)
+{
+    if(psWriter->ui32Len <= psWriter->ui32Skip)
+    {
+        return(0);
+    }
+
+    if((psWriter->ui32Len - psWriter->ui32Skip) > psWriter->ui32Size)
+    {
+        return(psWriter->ui32Size);
+    }
+
+    return(psWriter->ui32Len - psWriter->ui32Skip);
+}
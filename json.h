@@ -0,0 +1,90 @@
+//*****************************************************************************
+//
+// json.h - Prototypes for the streaming JSON writer.
+//
+//*****************************************************************************
+
+#ifndef __JSON_H__
+#define __JSON_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The deepest nesting of objects and arrays the writer supports.
+//
+//*****************************************************************************
+#define JSON_MAX_DEPTH          31
+
+//*****************************************************************************
+//
+// The state of a JSON writer.
+//
+// The writer never allocates memory and never buffers the document.  It
+// produces the document a character at a time and only stores the characters
+// that fall into a window of the output: the ui32Size bytes that follow the
+// first ui32Skip bytes.  Generating the same document again with the next
+// window therefore streams a document of any length through a buffer of any
+// size, and generating it with an empty window computes its length.
+//
+// The members are private to json.c.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The buffer that receives the window of the document.
+    //
+    char *pcBuf;
+
+    //
+    // The offset of the window in the document and its size.
+    //
+    uint32_t ui32Skip;
+    uint32_t ui32Size;
+
+    //
+    // The number of characters produced so far.
+    //
+    uint32_t ui32Len;
+
+    //
+    // The current nesting depth and one bit per level that is set until the
+    // first value has been written at that level.
+    //
+    uint32_t ui32Depth;
+    uint32_t ui32First;
+}
+tJSONWriter;
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.  Within an object, every
+// value is written with its key; within an array, or for the top level value,
+// pcKey must be NULL.
+//
+//*****************************************************************************
+extern void JSONInit(tJSONWriter *psWriter, char *pcBuf, uint32_t ui32Skip,
+                     uint32_t ui32Size);
+extern void JSONObjectStart(tJSONWriter *psWriter, const char *pcKey);
+extern void JSONObjectEnd(tJSONWriter *psWriter);
+extern void JSONArrayStart(tJSONWriter *psWriter, const char *pcKey);
+extern void JSONArrayEnd(tJSONWriter *psWriter);
+extern void JSONString(tJSONWriter *psWriter, const char *pcKey,
+                       const char *pcValue);
+extern void JSONInt(tJSONWriter *psWriter, const char *pcKey,
+                    int32_t i32Value);
+extern void JSONUInt(tJSONWriter *psWriter, const char *pcKey,
+                     uint32_t ui32Value);
+extern void JSONBool(tJSONWriter *psWriter, const char *pcKey, bool bValue);
+extern uint32_t JSONLength(const tJSONWriter *psWriter);
+extern uint32_t JSONWindowLength(const tJSONWriter *psWriter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __JSON_H__
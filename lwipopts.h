@@ -43,6 +43,9 @@
 #define LWIP_HTTPD_SSI                  1
 #define LWIP_HTTPD_CGI                  1
 #define LWIP_HTTPD_DYNAMIC_HEADERS      1
+#define LWIP_HTTPD_SSE                  1
+#define LWIP_HTTPD_WEBSOCKET            1
+#define LWIP_HTTPD_RESPONSE_HOOK        1
 //#define HTTPD_DEBUG                     LWIP_DBG_ON
 #if !defined(EMAC_PHY_IS_EXT_MII) && !defined(EMAC_PHY_IS_EXT_RMII)
 #define EMAC_PHY_CONFIG (EMAC_PHY_TYPE_INTERNAL | EMAC_PHY_INT_MDIX_EN |      \
@@ -68,7 +71,16 @@
 //
 //*****************************************************************************
 #define SYS_LIGHTWEIGHT_PROT            1           // default is 0
-#define NO_SYS                          1           // default is 0
+
+//
+// lwIP runs in its own thread under FreeRTOS: the Ethernet interrupt only
+// wakes the interrupt task of lwiplib.c, which hands received frames to the
+// tcpip thread, where all TCP/IP and HTTP processing and the lwIP timers
+// (including lwIPHostTimerHandler()) run.  Setting NO_SYS to 1 instead runs
+// all of it in the Ethernet interrupt, driven by ethernetTask.
+//
+#define NO_SYS                          0           // default is 0
+#define RTOS_FREERTOS                   1
 //#define MEMCPY(dst,src,len)             memcpy(dst,src,len)
 //#define SMEMCPY(dst,src,len)            memcpy(dst,src,len)
 
@@ -99,7 +111,7 @@
 //#define MEMP_NUM_REASSDATA              5
 //#define MEMP_NUM_ARP_QUEUE              30
 //#define MEMP_NUM_IGMP_GROUP             8
-#define MEMP_NUM_SYS_TIMEOUT              8
+#define MEMP_NUM_SYS_TIMEOUT              8     // lwIP needs 5, lwiplib 2
 //#define MEMP_NUM_NETBUF                 2
 //#define MEMP_NUM_NETCONN                4
 //#define MEMP_NUM_TCPIP_MSG_API          8
@@ -281,10 +293,17 @@
 // ---------- Thread options ----------
 //
 //*****************************************************************************
-//#define TCPIP_THREAD_NAME              "tcpip_thread"
-//#define TCPIP_THREAD_STACKSIZE          0
-//#define TCPIP_THREAD_PRIO               1
-//#define TCPIP_MBOX_SIZE                 0
+//
+// The tcpip thread runs above the display and diagnostic tasks, so that
+// network traffic is served promptly, and below the PWM task, so that the
+// control loop never waits for it.  The Ethernet interrupt task feeds the
+// tcpip thread and runs at the same priority.  Stack sizes are in words.
+//
+#define TCPIP_THREAD_NAME               "tcpip"
+#define TCPIP_THREAD_STACKSIZE          1024        // default is 0
+#define TCPIP_THREAD_PRIO               2           // default is 1
+#define TCPIP_MBOX_SIZE                 16          // default is 0
+#define PRIORITY_LWIPINTTASK            TCPIP_THREAD_PRIO
 //#define SLIPIF_THREAD_NAME             "slipif_loop"
 //#define SLIPIF_THREAD_STACKSIZE         0
 //#define SLIPIF_THREAD_PRIO              1
@@ -11,5 +11,11 @@
 // System clock rate, 120 MHz
 #define SYSTEM_CLOCK    120000000U
 
+// Period of the PWM output driving the motor, in PWM clock ticks
+#define PWM_PERIOD      400
+
+// Period of the control loop run by pwmTask, in milliseconds
+#define CONTROL_PERIOD_MS 10
+
 
 #endif /* MAIN_H_ */
@@ -0,0 +1,755 @@
+//*****************************************************************************
+//
+// oled_fb.c - A RAM framebuffer for the SSD1306 OLED.
+//
+// Drawing happens in a copy of the display memory kept in RAM, which records
+// for each page the range of columns whose bytes changed.  OLED_FB_Flush()
+// then sends only those ranges, grouped into as few address windows as pays
+// off, and queues all the transfers on the I2C engine in one go.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "i2c.h"
+#include "oled_font.h"
+#include "oled_image.h"
+#include "oled_fb.h"
+
+//*****************************************************************************
+//
+// The number of bytes a window costs on the bus besides its pixels: the
+// address, control and six bytes of the column and page address commands,
+// and the address and control byte of each data transfer.
+//
+//*****************************************************************************
+#define WINDOW_COST             8
+#define DATA_COST               2
+
+//*****************************************************************************
+//
+// The framebuffer, and for each page the first and last column changed since
+// the last flush.  A page is clean when its first column is past its last.
+//
+//*****************************************************************************
+static uint8_t g_pui8Frame[OLED_FB_PAGES][OLED_FB_WIDTH];
+static uint8_t g_pui8DirtyStart[OLED_FB_PAGES];
+static uint8_t g_pui8DirtyEnd[OLED_FB_PAGES];
+
+//*****************************************************************************
+//
+// The transfers of a flush and the address commands of its windows.  At most
+// one window and one data transfer per page are needed.
+//
+//*****************************************************************************
+static const uint8_t g_ui8CommandControl = SSD1306_COMMAND;
+static const uint8_t g_ui8DataControl = SSD1306_DATA;
+static uint8_t g_pui8Commands[OLED_FB_PAGES][6];
+static tI2CTransfer g_psTransfers[2 * OLED_FB_PAGES];
+
+//*****************************************************************************
+//
+// Change the bits of a byte of the framebuffer selected by ui8Mask, and
+// record the change if there is one.
+//
+//*****************************************************************************
+static void
+OLED_FB_Write(int32_t i32Page, int32_t i32X, uint8_t ui8Mask, uint8_t ui8Color)
+{
+    uint8_t ui8Old, ui8New;
+
+    if((i32Page < 0) || (i32Page >= OLED_FB_PAGES) || (i32X < 0) ||
+       (i32X >= OLED_FB_WIDTH) || !ui8Mask)
+    {
+        return;
+    }
+
+    ui8Old = g_pui8Frame[i32Page][i32X];
+    if(ui8Color == WHITE)
+    {
+        ui8New = ui8Old | ui8Mask;
+    }
+    else if(ui8Color == INVERSE)
+    {
+        ui8New = ui8Old ^ ui8Mask;
+    }
+    else
+    {
+        ui8New = ui8Old & ~ui8Mask;
+    }
+
+    if(ui8New == ui8Old)
+    {
+        return;
+    }
+
+    g_pui8Frame[i32Page][i32X] = ui8New;
+    if(i32X < g_pui8DirtyStart[i32Page])
+    {
+        g_pui8DirtyStart[i32Page] = i32X;
+    }
+    if(i32X > g_pui8DirtyEnd[i32Page])
+    {
+        g_pui8DirtyEnd[i32Page] = i32X;
+    }
+}
+
+//*****************************************************************************
+//
+// Replace the bits of a byte of the framebuffer selected by ui8Mask with the
+// ones of ui8Bits.
+//
+//*****************************************************************************
+static void
+OLED_FB_Copy(int32_t i32Page, int32_t i32X, uint8_t ui8Mask, uint8_t ui8Bits)
+{
+    OLED_FB_Write(i32Page, i32X, ui8Mask & ui8Bits, WHITE);
+    OLED_FB_Write(i32Page, i32X, ui8Mask & ~ui8Bits, BLACK);
+}
+
+//*****************************************************************************
+//
+// Draw a byte of an image: a column of 8 rows, or of i32Rows if fewer are
+// left, with its top row at i32Top.  The column spills into the next page
+// unless it is aligned.
+//
+//*****************************************************************************
+static void
+OLED_FB_Band_Byte(int32_t i32X, int32_t i32Top, int32_t i32Rows,
+                  uint8_t ui8Byte)
+{
+    int32_t i32Page, i32Shift;
+    uint16_t ui16Mask, ui16Bits;
+
+    i32Page = (i32Top >= 0) ? (i32Top / 8) : -((7 - i32Top) / 8);
+    i32Shift = i32Top - (i32Page * 8);
+
+    ui16Mask = 0xff;
+    if(i32Rows < 8)
+    {
+        ui16Mask >>= 8 - i32Rows;
+    }
+    ui16Mask <<= i32Shift;
+    ui16Bits = ui8Byte << i32Shift;
+
+    OLED_FB_Copy(i32Page, i32X, ui16Mask, ui16Bits);
+    OLED_FB_Copy(i32Page + 1, i32X, ui16Mask >> 8, ui16Bits >> 8);
+}
+
+//*****************************************************************************
+//
+// Mark every page as clean.
+//
+//*****************************************************************************
+static void
+OLED_FB_Clean(void)
+{
+    memset(g_pui8DirtyStart, 0xff, sizeof(g_pui8DirtyStart));
+    memset(g_pui8DirtyEnd, 0, sizeof(g_pui8DirtyEnd));
+}
+
+//*****************************************************************************
+//
+// Return the bytes a window over the given pages and columns costs to send.
+// A window as wide as the display is one data transfer straight from the
+// framebuffer; a narrower one needs one per page.
+//
+//*****************************************************************************
+static uint32_t
+OLED_FB_Cost(uint32_t ui32First, uint32_t ui32Last, uint32_t ui32Start,
+             uint32_t ui32End)
+{
+    uint32_t ui32Pages, ui32Width;
+
+    ui32Pages = ui32Last - ui32First + 1;
+    ui32Width = ui32End - ui32Start + 1;
+
+    if(ui32Width == OLED_FB_WIDTH)
+    {
+        return(WINDOW_COST + DATA_COST + (ui32Pages * ui32Width));
+    }
+
+    return(WINDOW_COST + (ui32Pages * (DATA_COST + ui32Width)));
+}
+
+//*****************************************************************************
+//
+// Fill in the next transfer of a flush.
+//
+//*****************************************************************************
+static tI2CTransfer *
+OLED_FB_Transfer(tI2CTransfer *psTransfer, const uint8_t *pui8Control,
+                 const uint8_t *pui8Data, uint32_t ui32Size)
+{
+    psTransfer->pui8Header = pui8Control;
+    psTransfer->ui32HeaderSize = 1;
+    psTransfer->pui8Data = pui8Data;
+    psTransfer->ui32Size = ui32Size;
+
+    return(psTransfer + 1);
+}
+
+//*****************************************************************************
+//
+//! Initializes the framebuffer.
+//!
+//! The framebuffer is cleared and, since the contents of the display are not
+//! known, marked as changed everywhere so that the next flush writes the
+//! whole display.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+OLED_FB_Init(void)
+{
+    memset(g_pui8Frame, 0, sizeof(g_pui8Frame));
+    memset(g_pui8DirtyStart, 0, sizeof(g_pui8DirtyStart));
+    memset(g_pui8DirtyEnd, OLED_FB_WIDTH - 1, sizeof(g_pui8DirtyEnd));
+}
+
+//*****************************************************************************
+//
+//! Clears the framebuffer.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+OLED_FB_Clear(void)
+{
+    OLED_FB_Fill_Rect(0, 0, OLED_FB_WIDTH, OLED_FB_HEIGHT, BLACK);
+}
+
+//*****************************************************************************
+//
+//! Marks pages to be sent again whole.
+//!
+//! \param ui32First is the first page.
+//! \param ui32Last is the last page.
+//!
+//! This is for when the display memory no longer holds what was sent, as
+//! after its scroll engine has run over those pages.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+OLED_FB_Invalidate(uint32_t ui32First, uint32_t ui32Last)
+{
+    uint32_t ui32Page;
+
+    for(ui32Page = ui32First;
+        (ui32Page <= ui32Last) && (ui32Page < OLED_FB_PAGES); ui32Page++)
+    {
+        g_pui8DirtyStart[ui32Page] = 0;
+        g_pui8DirtyEnd[ui32Page] = OLED_FB_WIDTH - 1;
+    }
+}
+
+//*****************************************************************************
+//
+//! Draws a pixel.
+//!
+//! \param i32X is the column of the pixel.
+//! \param i32Y is the row of the pixel.
+//! \param ui8Color is the color.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+OLED_FB_Pixel(int32_t i32X, int32_t i32Y, uint8_t ui8Color)
+{
+    OLED_FB_Fill_Rect(i32X, i32Y, 1, 1, ui8Color);
+}
+
+//*****************************************************************************
+//
+//! Fills a rectangle.
+//!
+//! \param i32X is the left column of the rectangle.
+//! \param i32Y is the top row of the rectangle.
+//! \param i32Width is the width of the rectangle.
+//! \param i32Height is the height of the rectangle.
+//! \param ui8Color is the color.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+OLED_FB_Fill_Rect(int32_t i32X, int32_t i32Y, int32_t i32Width,
+                  int32_t i32Height, uint8_t ui8Color)
+{
+    int32_t i32Top, i32Bottom, i32Page, i32Col, i32End;
+    uint8_t ui8Mask;
+
+    //
+    // Clip the rectangle to the screen.
+    //
+    i32End = i32X + i32Width;
+    i32Bottom = i32Y + i32Height;
+    if(i32X < 0)
+    {
+        i32X = 0;
+    }
+    if(i32Y < 0)
+    {
+        i32Y = 0;
+    }
+    if(i32End > OLED_FB_WIDTH)
+    {
+        i32End = OLED_FB_WIDTH;
+    }
+    if(i32Bottom > OLED_FB_HEIGHT)
+    {
+        i32Bottom = OLED_FB_HEIGHT;
+    }
+
+    //
+    // Go through the pages the rectangle covers, with the mask of its rows in
+    // each.
+    //
+    for(i32Top = i32Y; i32Top < i32Bottom; i32Top = (i32Page + 1) * 8)
+    {
+        i32Page = i32Top / 8;
+        ui8Mask = 0xff << (i32Top % 8);
+        if(i32Bottom < ((i32Page + 1) * 8))
+        {
+            ui8Mask &= 0xff >> (((i32Page + 1) * 8) - i32Bottom);
+        }
+
+        for(i32Col = i32X; i32Col < i32End; i32Col++)
+        {
+            OLED_FB_Write(i32Page, i32Col, ui8Mask, ui8Color);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Draws a line.
+//!
+//! \param i32X0 is the column of the start of the line.
+//! \param i32Y0 is the row of the start of the line.
+//! \param i32X1 is the column of the end of the line.
+//! \param i32Y1 is the row of the end of the line.
+//! \param ui8Color is the color.
+//!
+//! Both ends are part of the line.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+OLED_FB_Line(int32_t i32X0, int32_t i32Y0, int32_t i32X1, int32_t i32Y1,
+             uint8_t ui8Color)
+{
+    int32_t i32DX, i32DY, i32StepX, i32StepY, i32Error, i32Error2;
+
+    //
+    // Horizontal and vertical lines are rectangles, which fill whole bytes.
+    //
+    if((i32X0 == i32X1) || (i32Y0 == i32Y1))
+    {
+        OLED_FB_Fill_Rect((i32X0 < i32X1) ? i32X0 : i32X1,
+                          (i32Y0 < i32Y1) ? i32Y0 : i32Y1,
+                          ((i32X0 < i32X1) ? (i32X1 - i32X0) :
+                           (i32X0 - i32X1)) + 1,
+                          ((i32Y0 < i32Y1) ? (i32Y1 - i32Y0) :
+                           (i32Y0 - i32Y1)) + 1, ui8Color);
+        return;
+    }
+
+    //
+    // Bresenham's algorithm, for lines of any slope.
+    //
+    i32DX = (i32X1 > i32X0) ? (i32X1 - i32X0) : (i32X0 - i32X1);
+    i32DY = (i32Y1 > i32Y0) ? (i32Y0 - i32Y1) : (i32Y1 - i32Y0);
+    i32StepX = (i32X1 > i32X0) ? 1 : -1;
+    i32StepY = (i32Y1 > i32Y0) ? 1 : -1;
+    i32Error = i32DX + i32DY;
+
+    while(1)
+    {
+        OLED_FB_Pixel(i32X0, i32Y0, ui8Color);
+        if((i32X0 == i32X1) && (i32Y0 == i32Y1))
+        {
+            break;
+        }
+
+        i32Error2 = 2 * i32Error;
+        if(i32Error2 >= i32DY)
+        {
+            i32Error += i32DY;
+            i32X0 += i32StepX;
+        }
+        if(i32Error2 <= i32DX)
+        {
+            i32Error += i32DX;
+            i32Y0 += i32StepY;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Draws a horizontal bar graph.
+//!
+//! \param i32X is the left column of the bar.
+//! \param i32Y is the top row of the bar.
+//! \param i32Width is the width of the bar, including its outline.
+//! \param i32Height is the height of the bar, including its outline.
+//! \param ui32Value is the value shown.
+//! \param ui32Max is the value of a full bar.
+//!
+//! The bar is outlined, and filled from the left in proportion to ui32Value,
+//! with a gap of one pixel inside the outline.  Every pixel is drawn once, in
+//! its final color, so redrawing the bar with a new value only changes the
+//! columns between the old and the new end of the filled part.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+OLED_FB_Bar(int32_t i32X, int32_t i32Y, int32_t i32Width, int32_t i32Height,
+            uint32_t ui32Value, uint32_t ui32Max)
+{
+    int32_t i32Inner, i32Fill;
+
+    //
+    // The outline.
+    //
+    OLED_FB_Fill_Rect(i32X, i32Y, i32Width, 1, WHITE);
+    OLED_FB_Fill_Rect(i32X, i32Y + i32Height - 1, i32Width, 1, WHITE);
+    OLED_FB_Fill_Rect(i32X, i32Y + 1, 1, i32Height - 2, WHITE);
+    OLED_FB_Fill_Rect(i32X + i32Width - 1, i32Y + 1, 1, i32Height - 2, WHITE);
+
+    //
+    // The gap and the filled part.
+    //
+    i32Inner = i32Width - 4;
+    if((i32Inner <= 0) || (i32Height <= 4))
+    {
+        return;
+    }
+
+    if(ui32Value > ui32Max)
+    {
+        ui32Value = ui32Max;
+    }
+    i32Fill = ui32Max ? (int32_t)(((uint64_t)i32Inner * ui32Value) / ui32Max) :
+              0;
+
+    OLED_FB_Fill_Rect(i32X + 1, i32Y + 1, i32Width - 2, 1, BLACK);
+    OLED_FB_Fill_Rect(i32X + 1, i32Y + i32Height - 2, i32Width - 2, 1, BLACK);
+    OLED_FB_Fill_Rect(i32X + 1, i32Y + 2, 1, i32Height - 4, BLACK);
+    OLED_FB_Fill_Rect(i32X + i32Width - 2, i32Y + 2, 1, i32Height - 4, BLACK);
+
+    OLED_FB_Fill_Rect(i32X + 2, i32Y + 2, i32Fill, i32Height - 4, WHITE);
+    OLED_FB_Fill_Rect(i32X + 2 + i32Fill, i32Y + 2, i32Inner - i32Fill,
+                      i32Height - 4, BLACK);
+}
+
+//*****************************************************************************
+//
+//! Draws an image.
+//!
+//! \param i32X is the left column of the image.
+//! \param i32Y is the top row of the image, which need not be on a page
+//! boundary.
+//! \param pui8Image is the image, in the layout of the display memory: a
+//! byte per column for each band of 8 rows, such as the ones in images/.
+//! \param i32Width is the width of the image.
+//! \param i32Height is the height of the image.
+//!
+//! The image replaces what was under it.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+OLED_FB_Blit(int32_t i32X, int32_t i32Y, const uint8_t *pui8Image,
+             int32_t i32Width, int32_t i32Height)
+{
+    int32_t i32Band, i32Col;
+
+    for(i32Band = 0; (i32Band * 8) < i32Height; i32Band++)
+    {
+        for(i32Col = 0; i32Col < i32Width; i32Col++)
+        {
+            OLED_FB_Band_Byte(i32X + i32Col, i32Y + (i32Band * 8),
+                              i32Height - (i32Band * 8),
+                              pui8Image[(i32Band * i32Width) + i32Col]);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Draws a compressed image.
+//!
+//! \param i32X is the left column of the image.
+//! \param i32Y is the top row of the image, which need not be on a page
+//! boundary.
+//! \param psImage is the image, such as the ones in images/images_rle.c.
+//!
+//! The image is decoded a run at a time straight into the framebuffer and
+//! replaces what was under it.  Only the bytes that change are marked for the
+//! next flush, so the blank parts of an image drawn on a blank area cost
+//! nothing on the bus.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+OLED_FB_Image(int32_t i32X, int32_t i32Y, const tOLEDImage *psImage)
+{
+    tOLEDImageReader sReader;
+    const uint8_t *pui8Literal;
+    int32_t i32Width, i32Height, i32Band, i32Col;
+    uint32_t ui32Len, ui32Idx;
+    uint8_t ui8Value;
+
+    i32Width = psImage->ui16Width;
+    i32Height = psImage->ui16Height;
+    i32Band = 0;
+    i32Col = 0;
+
+    OLED_Image_Open(&sReader, psImage);
+    while((i32Band * 8) < i32Height)
+    {
+        ui32Len = OLED_Image_Next(&sReader, &pui8Literal, &ui8Value);
+        if(!ui32Len)
+        {
+            break;
+        }
+
+        for(ui32Idx = 0; (ui32Idx < ui32Len) && ((i32Band * 8) < i32Height);
+            ui32Idx++)
+        {
+            OLED_FB_Band_Byte(i32X + i32Col, i32Y + (i32Band * 8),
+                              i32Height - (i32Band * 8),
+                              pui8Literal ? pui8Literal[ui32Idx] : ui8Value);
+
+            if(++i32Col == i32Width)
+            {
+                i32Col = 0;
+                i32Band++;
+            }
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Draws a string with font_default.
+//!
+//! \param i32X is the left column of the string.
+//! \param i32Y is the top row of the string.
+//! \param pcString is the NULL-terminated string.
+//!
+//! The characters are drawn on a black background.  Characters that are not
+//! in the font are drawn as question marks.
+//!
+//! \return The column after the end of the string.
+//
+//*****************************************************************************
+int32_t
+OLED_FB_Text(int32_t i32X, int32_t i32Y, const char *pcString)
+{
+    return(OLED_FB_Text_Font(i32X, i32Y, 0, &FONT_FIXED, 1, pcString));
+}
+
+//*****************************************************************************
+//
+//! Draws a string with any font, at its own size or larger.
+//!
+//! \param i32X is the left column of the string, or of its box.
+//! \param i32Y is the top row of the string.
+//! \param i32Width is the width of the box the string is centered in, or 0
+//! to draw the string from i32X.
+//! \param psFont is the font, such as FONT_FIXED or FONT_PROP.
+//! \param ui32Scale is the scale, 1 or 2.
+//! \param pcString is the NULL-terminated string.
+//!
+//! The characters are drawn on a black background, and the rest of the box,
+//! if any, is cleared, so a value can be redrawn in place however its width
+//! changes.  Characters that are not in the font are drawn as question marks.
+//!
+//! \return The column after the end of the string.
+//
+//*****************************************************************************
+int32_t
+OLED_FB_Text_Font(int32_t i32X, int32_t i32Y, int32_t i32Width,
+                  const tFont *psFont, uint32_t ui32Scale,
+                  const char *pcString)
+{
+    const uint8_t *pui8Glyph;
+    int32_t i32Height, i32Spacing, i32Text, i32Left;
+    uint32_t ui32Glyph;
+
+    if(ui32Scale > OLED_FONT_MAX_SCALE)
+    {
+        ui32Scale = OLED_FONT_MAX_SCALE;
+    }
+    else if(!ui32Scale)
+    {
+        ui32Scale = 1;
+    }
+    i32Height = psFont->ui8Height * ui32Scale;
+    i32Spacing = psFont->ui8Spacing * ui32Scale;
+
+    //
+    // Center the string in its box and clear the box on both sides of it.
+    //
+    i32Left = i32X;
+    if(i32Width > 0)
+    {
+        i32Text = OLED_Font_String_Width(psFont, ui32Scale, pcString);
+        if(i32Text < i32Width)
+        {
+            i32X += (i32Width - i32Text) / 2;
+        }
+        OLED_FB_Fill_Rect(i32Left, i32Y, i32X - i32Left, i32Height, BLACK);
+    }
+
+    for(; *pcString; pcString++)
+    {
+        pui8Glyph = OLED_Font_Glyph(psFont, *pcString, ui32Scale, &ui32Glyph);
+        OLED_FB_Blit(i32X, i32Y, pui8Glyph, ui32Glyph, i32Height);
+        i32X += ui32Glyph;
+
+        if(i32Spacing && pcString[1])
+        {
+            OLED_FB_Fill_Rect(i32X, i32Y, i32Spacing, i32Height, BLACK);
+            i32X += i32Spacing;
+        }
+    }
+
+    if(i32Width > 0)
+    {
+        OLED_FB_Fill_Rect(i32X, i32Y, i32Left + i32Width - i32X, i32Height,
+                          BLACK);
+    }
+
+    return(i32X);
+}
+
+//*****************************************************************************
+//
+//! Returns the framebuffer.
+//!
+//! \return The framebuffer, OLED_FB_PAGES pages of OLED_FB_WIDTH bytes.
+//
+//*****************************************************************************
+const uint8_t *
+OLED_FB_Buffer(void)
+{
+    return(&g_pui8Frame[0][0]);
+}
+
+//*****************************************************************************
+//
+//! Sends the changes to the display.
+//!
+//! Each page that changed is sent from its first to its last changed column.
+//! Neighbouring pages are sent through a single address window covering them
+//! when that costs fewer bytes than separate windows.  All the transfers are
+//! queued at once, and this returns when they are out.
+//!
+//! \return The number of bytes sent on the bus.
+//
+//*****************************************************************************
+uint32_t
+OLED_FB_Flush(void)
+{
+    tI2CTransfer *psTransfer;
+    uint32_t ui32Page, ui32Next, ui32First, ui32Last, ui32Start, ui32End;
+    uint32_t ui32Windows, ui32Bytes, ui32Width, ui32MergedStart, ui32MergedEnd;
+
+    psTransfer = g_psTransfers;
+    ui32Windows = 0;
+    ui32Bytes = 0;
+
+    for(ui32Page = 0; ui32Page < OLED_FB_PAGES; ui32Page = ui32Last + 1)
+    {
+        ui32Last = ui32Page;
+        if(g_pui8DirtyStart[ui32Page] > g_pui8DirtyEnd[ui32Page])
+        {
+            continue;
+        }
+
+        //
+        // Grow the window over the following changed pages while that is
+        // cheaper than giving them their own.
+        //
+        ui32First = ui32Page;
+        ui32Start = g_pui8DirtyStart[ui32Page];
+        ui32End = g_pui8DirtyEnd[ui32Page];
+        for(ui32Next = ui32Page + 1; ui32Next < OLED_FB_PAGES; ui32Next++)
+        {
+            if(g_pui8DirtyStart[ui32Next] > g_pui8DirtyEnd[ui32Next])
+            {
+                continue;
+            }
+
+            ui32MergedStart = (g_pui8DirtyStart[ui32Next] < ui32Start) ?
+                              g_pui8DirtyStart[ui32Next] : ui32Start;
+            ui32MergedEnd = (g_pui8DirtyEnd[ui32Next] > ui32End) ?
+                            g_pui8DirtyEnd[ui32Next] : ui32End;
+            if(OLED_FB_Cost(ui32First, ui32Next, ui32MergedStart,
+                            ui32MergedEnd) >
+               (OLED_FB_Cost(ui32First, ui32Last, ui32Start, ui32End) +
+                OLED_FB_Cost(ui32Next, ui32Next, g_pui8DirtyStart[ui32Next],
+                             g_pui8DirtyEnd[ui32Next])))
+            {
+                break;
+            }
+
+            ui32Last = ui32Next;
+            ui32Start = ui32MergedStart;
+            ui32End = ui32MergedEnd;
+        }
+
+        //
+        // Set the window, then send its pages, in one transfer if it is as
+        // wide as the display.
+        //
+        g_pui8Commands[ui32Windows][0] = SSD1306_COLUMNADDR;
+        g_pui8Commands[ui32Windows][1] = ui32Start;
+        g_pui8Commands[ui32Windows][2] = ui32End;
+        g_pui8Commands[ui32Windows][3] = SSD1306_PAGEADDR;
+        g_pui8Commands[ui32Windows][4] = ui32First;
+        g_pui8Commands[ui32Windows][5] = ui32Last;
+        psTransfer = OLED_FB_Transfer(psTransfer, &g_ui8CommandControl,
+                                      g_pui8Commands[ui32Windows], 6);
+        ui32Windows++;
+
+        ui32Width = ui32End - ui32Start + 1;
+        if(ui32Width == OLED_FB_WIDTH)
+        {
+            psTransfer = OLED_FB_Transfer(psTransfer, &g_ui8DataControl,
+                                          g_pui8Frame[ui32First],
+                                          (ui32Last - ui32First + 1) *
+                                          ui32Width);
+        }
+        else
+        {
+            for(ui32Next = ui32First; ui32Next <= ui32Last; ui32Next++)
+            {
+                psTransfer = OLED_FB_Transfer(psTransfer, &g_ui8DataControl,
+                                              &g_pui8Frame[ui32Next][ui32Start],
+                                              ui32Width);
+            }
+        }
+
+        ui32Bytes += OLED_FB_Cost(ui32First, ui32Last, ui32Start, ui32End);
+    }
+
+    OLED_FB_Clean();
+
+    I2C_OLED_Transfer_List(g_psTransfers, psTransfer - g_psTransfers);
+
+    return(ui32Bytes);
+}
@@ -0,0 +1,69 @@
+//*****************************************************************************
+//
+// oled_fb.h - Prototypes for the OLED framebuffer.
+//
+//*****************************************************************************
+
+#ifndef __OLED_FB_H__
+#define __OLED_FB_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The size of the framebuffer.  It is laid out like the SSD1306 memory: one
+// byte holds a column of 8 pixels of a page (8 rows), the least significant
+// bit at the top, and the pages follow each other from the top.  This is also
+// the layout of the images in images/ and of font_default.
+//
+//*****************************************************************************
+#define OLED_FB_WIDTH           SSD1306_LCDWIDTH
+#define OLED_FB_HEIGHT          SSD1306_LCDHEIGHT
+#define OLED_FB_PAGES           (SSD1306_LCDHEIGHT / 8)
+
+//*****************************************************************************
+//
+// The size of a character of font_default, in pixels.
+//
+//*****************************************************************************
+#define OLED_FB_CHAR_WIDTH      8
+#define OLED_FB_CHAR_HEIGHT     8
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.  Drawing only changes the
+// framebuffer; OLED_FB_Flush() sends what changed to the display.  Colors are
+// BLACK, WHITE and INVERSE from ssd1306.h, and anything drawn off the screen
+// is clipped.
+//
+//*****************************************************************************
+extern void OLED_FB_Init(void);
+extern void OLED_FB_Clear(void);
+extern void OLED_FB_Invalidate(uint32_t ui32First, uint32_t ui32Last);
+extern void OLED_FB_Pixel(int32_t i32X, int32_t i32Y, uint8_t ui8Color);
+extern void OLED_FB_Fill_Rect(int32_t i32X, int32_t i32Y, int32_t i32Width,
+                              int32_t i32Height, uint8_t ui8Color);
+extern void OLED_FB_Line(int32_t i32X0, int32_t i32Y0, int32_t i32X1,
+                         int32_t i32Y1, uint8_t ui8Color);
+extern void OLED_FB_Bar(int32_t i32X, int32_t i32Y, int32_t i32Width,
+                        int32_t i32Height, uint32_t ui32Value,
+                        uint32_t ui32Max);
+extern void OLED_FB_Blit(int32_t i32X, int32_t i32Y, const uint8_t *pui8Image,
+                         int32_t i32Width, int32_t i32Height);
+extern void OLED_FB_Image(int32_t i32X, int32_t i32Y,
+                          const tOLEDImage *psImage);
+extern int32_t OLED_FB_Text(int32_t i32X, int32_t i32Y, const char *pcString);
+extern int32_t OLED_FB_Text_Font(int32_t i32X, int32_t i32Y, int32_t i32Width,
+                                 const tFont *psFont, uint32_t ui32Scale,
+                                 const char *pcString);
+extern const uint8_t *OLED_FB_Buffer(void);
+extern uint32_t OLED_FB_Flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __OLED_FB_H__
@@ -0,0 +1,264 @@
+//*****************************************************************************
+//
+// oled_font.c - Glyph lookup and scaling for the OLED fonts.
+//
+// The fonts in fonts/ are drawn at their own size or at twice their size.
+// Scaling a glyph doubles every pixel, which is more work than drawing it, so
+// the scaled glyphs last used are kept in a small cache; a readout that keeps
+// redrawing the same few digits only scales each of them once.
+//
+// The cache is not protected: text is only drawn by the display task.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include "oled_font.h"
+
+//*****************************************************************************
+//
+// The size of the largest scaled glyph.
+//
+//*****************************************************************************
+#define SCALED_SIZE             ((OLED_FONT_MAX_WIDTH * OLED_FONT_MAX_SCALE) *\
+                                 (OLED_FONT_MAX_HEIGHT / 8) *                 \
+                                 OLED_FONT_MAX_SCALE)
+
+//*****************************************************************************
+//
+// A scaled glyph, and the font and character it was made from.  An entry
+// with no font is free.
+//
+//*****************************************************************************
+typedef struct
+{
+    const tFont *psFont;
+    char cChar;
+    uint8_t ui8Width;
+    uint8_t pui8Data[SCALED_SIZE];
+}
+tGlyphEntry;
+
+//*****************************************************************************
+//
+// The cache, the entry to be replaced next and the counters.
+//
+//*****************************************************************************
+static tGlyphEntry g_psCache[OLED_FONT_CACHE_SIZE];
+static uint32_t g_ui32Victim;
+static tOLEDFontStats g_sStats;
+
+//*****************************************************************************
+//
+// The bits of a nibble, each doubled.
+//
+//*****************************************************************************
+static const uint8_t g_pui8Double[16] =
+{
+    0x00, 0x03, 0x0c, 0x0f, 0x30, 0x33, 0x3c, 0x3f,
+    0xc0, 0xc3, 0xcc, 0xcf, 0xf0, 0xf3, 0xfc, 0xff,
+};
+
+//*****************************************************************************
+//
+// Find the glyph of a character at its own size.
+//
+//*****************************************************************************
+static const uint8_t *
+OLED_Font_Lookup(const tFont *psFont, char cChar, uint32_t *pui32Width)
+{
+    uint32_t ui32Index;
+
+    if(((uint8_t)cChar < psFont->ui8First) ||
+       ((uint8_t)cChar > psFont->ui8Last))
+    {
+        cChar = '?';
+    }
+    ui32Index = (uint8_t)cChar - psFont->ui8First;
+
+    if(!psFont->pui8Widths)
+    {
+        *pui32Width = psFont->ui8Width;
+        return(psFont->pui8Data +
+               (ui32Index * psFont->ui8Width * (psFont->ui8Height / 8)));
+    }
+
+    *pui32Width = psFont->pui8Widths[ui32Index];
+    return(psFont->pui8Data + psFont->pui16Offsets[ui32Index]);
+}
+
+//*****************************************************************************
+//
+// Scale a glyph to twice its size.  Whatever is beyond the largest glyph
+// that can be scaled is left out.
+//
+//*****************************************************************************
+static void
+OLED_Font_Double(const uint8_t *pui8Glyph, uint32_t ui32Width,
+                 uint32_t ui32Height, uint8_t *pui8Out)
+{
+    uint32_t ui32Stride, ui32Bands, ui32Band, ui32Col, ui32Out;
+    uint8_t ui8Byte, ui8Low, ui8High;
+
+    ui32Stride = ui32Width;
+    ui32Bands = ui32Height / 8;
+    if(ui32Bands > (OLED_FONT_MAX_HEIGHT / 8))
+    {
+        ui32Bands = OLED_FONT_MAX_HEIGHT / 8;
+    }
+    if(ui32Width > OLED_FONT_MAX_WIDTH)
+    {
+        ui32Width = OLED_FONT_MAX_WIDTH;
+    }
+
+    //
+    // Band n becomes bands 2n and 2n + 1, and column n columns 2n and
+    // 2n + 1.
+    //
+    for(ui32Band = 0; ui32Band < ui32Bands; ui32Band++)
+    {
+        for(ui32Col = 0; ui32Col < ui32Width; ui32Col++)
+        {
+            ui8Byte = pui8Glyph[(ui32Band * ui32Stride) + ui32Col];
+            ui8Low = g_pui8Double[ui8Byte & 0x0f];
+            ui8High = g_pui8Double[ui8Byte >> 4];
+
+            ui32Out = (ui32Band * 2 * 2 * ui32Width) + (ui32Col * 2);
+            pui8Out[ui32Out] = ui8Low;
+            pui8Out[ui32Out + 1] = ui8Low;
+            ui32Out += 2 * ui32Width;
+            pui8Out[ui32Out] = ui8High;
+            pui8Out[ui32Out + 1] = ui8High;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Finds the glyph of a character.
+//!
+//! \param psFont is the font.
+//! \param cChar is the character, drawn as a question mark if it is not in
+//! the font.
+//! \param ui32Scale is the scale, 1 or 2.
+//! \param pui32Width receives the width of the glyph at that scale.
+//!
+//! A glyph scaled to twice its size is taken from the cache, or scaled into
+//! it.  It stays valid until OLED_FONT_CACHE_SIZE other glyphs have been
+//! scaled.
+//!
+//! \return The glyph, laid out in ui32Scale times the font height rows of
+//! the returned width.
+//
+//*****************************************************************************
+const uint8_t *
+OLED_Font_Glyph(const tFont *psFont, char cChar, uint32_t ui32Scale,
+                uint32_t *pui32Width)
+{
+    const uint8_t *pui8Glyph;
+    tGlyphEntry *psEntry;
+    uint32_t ui32Width;
+
+    if(ui32Scale < 2)
+    {
+        return(OLED_Font_Lookup(psFont, cChar, pui32Width));
+    }
+
+    for(psEntry = g_psCache; psEntry < (g_psCache + OLED_FONT_CACHE_SIZE);
+        psEntry++)
+    {
+        if((psEntry->psFont == psFont) && (psEntry->cChar == cChar))
+        {
+            g_sStats.ui32Hits++;
+            *pui32Width = psEntry->ui8Width;
+            return(psEntry->pui8Data);
+        }
+    }
+
+    //
+    // Replace the entries in turn, which keeps the glyphs of a string that
+    // fits in the cache.
+    //
+    g_sStats.ui32Misses++;
+    psEntry = &g_psCache[g_ui32Victim];
+    g_ui32Victim = (g_ui32Victim + 1) & (OLED_FONT_CACHE_SIZE - 1);
+
+    pui8Glyph = OLED_Font_Lookup(psFont, cChar, &ui32Width);
+    OLED_Font_Double(pui8Glyph, ui32Width, psFont->ui8Height,
+                     psEntry->pui8Data);
+    if(ui32Width > OLED_FONT_MAX_WIDTH)
+    {
+        ui32Width = OLED_FONT_MAX_WIDTH;
+    }
+
+    psEntry->psFont = psFont;
+    psEntry->cChar = cChar;
+    psEntry->ui8Width = ui32Width * 2;
+
+    *pui32Width = psEntry->ui8Width;
+    return(psEntry->pui8Data);
+}
+
+//*****************************************************************************
+//
+//! Returns the width of a string.
+//!
+//! \param psFont is the font.
+//! \param ui32Scale is the scale, 1 or 2.
+//! \param pcString is the NULL-terminated string.
+//!
+//! This only adds up the widths of the glyphs and the spacing between them,
+//! so it can be used to lay out text before drawing it.
+//!
+//! \return The width of the string in columns.
+//
+//*****************************************************************************
+uint32_t
+OLED_Font_String_Width(const tFont *psFont, uint32_t ui32Scale,
+                       const char *pcString)
+{
+    uint32_t ui32Total, ui32Width;
+
+    if(ui32Scale > OLED_FONT_MAX_SCALE)
+    {
+        ui32Scale = OLED_FONT_MAX_SCALE;
+    }
+    else if(!ui32Scale)
+    {
+        ui32Scale = 1;
+    }
+
+    for(ui32Total = 0; *pcString; pcString++)
+    {
+        OLED_Font_Lookup(psFont, *pcString, &ui32Width);
+        if((ui32Scale > 1) && (ui32Width > OLED_FONT_MAX_WIDTH))
+        {
+            ui32Width = OLED_FONT_MAX_WIDTH;
+        }
+        ui32Total += (ui32Width + psFont->ui8Spacing) * ui32Scale;
+    }
+
+    //
+    // There is no spacing after the last glyph.
+    //
+    if(ui32Total)
+    {
+        ui32Total -= psFont->ui8Spacing * ui32Scale;
+    }
+
+    return(ui32Total);
+}
+
+//*****************************************************************************
+//
+//! Returns the counters of the scaled glyph cache.
+//!
+//! \param psStats receives the counters.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+OLED_Font_Get_Stats(tOLEDFontStats *psStats)
+{
+    *psStats = g_sStats;
+}
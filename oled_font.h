@@ -0,0 +1,96 @@
+//*****************************************************************************
+//
+// oled_font.h - Prototypes for the OLED fonts.
+//
+//*****************************************************************************
+
+#ifndef __OLED_FONT_H__
+#define __OLED_FONT_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The largest scale text can be drawn at, and the largest glyph that can be
+// scaled, in pixels.
+//
+//*****************************************************************************
+#define OLED_FONT_MAX_SCALE     2
+#define OLED_FONT_MAX_WIDTH     8
+#define OLED_FONT_MAX_HEIGHT    8
+
+//*****************************************************************************
+//
+// The number of scaled glyphs kept, a power of two.
+//
+//*****************************************************************************
+#define OLED_FONT_CACHE_SIZE    16
+
+//*****************************************************************************
+//
+// A font.  Each glyph is laid out like the images: bands of 8 rows, one byte
+// per column, the least significant bit at the top.  The glyphs of a fixed
+// font all have the same width and follow each other, and pui8Widths and
+// pui16Offsets are NULL; those of a proportional font have their own width
+// and start at their offset in pui8Data.  Characters outside the font are
+// drawn as question marks, which every font must have.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The height of the glyphs, a multiple of 8, and the width of the glyphs
+    // of a fixed font.
+    //
+    uint8_t ui8Height;
+    uint8_t ui8Width;
+
+    //
+    // The blank columns drawn after each glyph.
+    //
+    uint8_t ui8Spacing;
+
+    //
+    // The first and last characters in the font.
+    //
+    uint8_t ui8First;
+    uint8_t ui8Last;
+
+    const uint8_t *pui8Widths;
+    const uint16_t *pui16Offsets;
+    const uint8_t *pui8Data;
+}
+tFont;
+
+//*****************************************************************************
+//
+// The counters of the scaled glyph cache.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Hits;
+    uint32_t ui32Misses;
+}
+tOLEDFontStats;
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.
+//
+//*****************************************************************************
+extern const uint8_t *OLED_Font_Glyph(const tFont *psFont, char cChar,
+                                      uint32_t ui32Scale,
+                                      uint32_t *pui32Width);
+extern uint32_t OLED_Font_String_Width(const tFont *psFont, uint32_t ui32Scale,
+                                       const char *pcString);
+extern void OLED_Font_Get_Stats(tOLEDFontStats *psStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __OLED_FONT_H__
@@ -0,0 +1,145 @@
+//*****************************************************************************
+//
+// oled_image.c - Run-length compressed OLED images.
+//
+// Most of the images shown on the display are blank or solid, so they are
+// stored as runs (see oled_image.h) and decoded a run at a time straight
+// into their destination, usually the framebuffer, without a buffer for the
+// whole image.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "oled_image.h"
+
+//*****************************************************************************
+//
+//! Starts reading the runs of an image.
+//!
+//! \param psReader is the reader.
+//! \param psImage is the image.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+OLED_Image_Open(tOLEDImageReader *psReader, const tOLEDImage *psImage)
+{
+    psReader->pui8Next = psImage->pui8Data;
+    psReader->pui8End = psImage->pui8Data + psImage->ui32Size;
+}
+
+//*****************************************************************************
+//
+//! Reads the next run of an image.
+//!
+//! \param psReader is the reader.
+//! \param ppui8Literal receives a pointer to the bytes of a run that is
+//! copied, or NULL for a run of a single value.
+//! \param pui8Value receives the value of a run of a single value.
+//!
+//! Runs are cut short where the compressed data ends.
+//!
+//! \return The length of the run, or 0 at the end of the image.
+//
+//*****************************************************************************
+uint32_t
+OLED_Image_Next(tOLEDImageReader *psReader, const uint8_t **ppui8Literal,
+                uint8_t *pui8Value)
+{
+    uint32_t ui32Len, ui32Left;
+    uint8_t ui8Token;
+
+    if(psReader->pui8Next >= psReader->pui8End)
+    {
+        return(0);
+    }
+
+    ui8Token = *psReader->pui8Next++;
+    ui32Left = psReader->pui8End - psReader->pui8Next;
+
+    if(!(ui8Token & OLED_IMAGE_ZEROS))
+    {
+        ui32Len = (ui8Token & (OLED_IMAGE_LITERAL_MAX - 1)) + 1;
+        if(ui32Len > ui32Left)
+        {
+            ui32Len = ui32Left;
+        }
+
+        *ppui8Literal = psReader->pui8Next;
+        psReader->pui8Next += ui32Len;
+
+        return(ui32Len);
+    }
+
+    ui32Len = (ui8Token & (OLED_IMAGE_RUN_MAX - 1)) + 1;
+    *ppui8Literal = 0;
+
+    if((ui8Token & OLED_IMAGE_REPEAT) == OLED_IMAGE_ZEROS)
+    {
+        *pui8Value = 0;
+    }
+    else if(ui32Left)
+    {
+        *pui8Value = *psReader->pui8Next++;
+    }
+    else
+    {
+        return(0);
+    }
+
+    return(ui32Len);
+}
+
+//*****************************************************************************
+//
+//! Decodes an image into a buffer.
+//!
+//! \param psImage is the image.
+//! \param pui8Out is the buffer, in the layout of the display memory.
+//! \param ui32Size is the size of the buffer.
+//!
+//! \return The number of bytes decoded, which is the size of the image
+//! unless the buffer is smaller or the compressed data is damaged.
+//
+//*****************************************************************************
+uint32_t
+OLED_Image_Decode(const tOLEDImage *psImage, uint8_t *pui8Out,
+                  uint32_t ui32Size)
+{
+    tOLEDImageReader sReader;
+    const uint8_t *pui8Literal;
+    uint32_t ui32Pos, ui32Len;
+    uint8_t ui8Value;
+
+    if(ui32Size > ((uint32_t)psImage->ui16Width * (psImage->ui16Height / 8)))
+    {
+        ui32Size = (uint32_t)psImage->ui16Width * (psImage->ui16Height / 8);
+    }
+
+    OLED_Image_Open(&sReader, psImage);
+    for(ui32Pos = 0; ui32Pos < ui32Size; ui32Pos += ui32Len)
+    {
+        ui32Len = OLED_Image_Next(&sReader, &pui8Literal, &ui8Value);
+        if(!ui32Len)
+        {
+            break;
+        }
+        if(ui32Len > (ui32Size - ui32Pos))
+        {
+            ui32Len = ui32Size - ui32Pos;
+        }
+
+        if(pui8Literal)
+        {
+            memcpy(pui8Out + ui32Pos, pui8Literal, ui32Len);
+        }
+        else
+        {
+            memset(pui8Out + ui32Pos, ui8Value, ui32Len);
+        }
+    }
+
+    return(ui32Pos);
+}
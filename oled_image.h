@@ -0,0 +1,77 @@
+//*****************************************************************************
+//
+// oled_image.h - Prototypes for the run-length compressed OLED images.
+//
+//*****************************************************************************
+
+#ifndef __OLED_IMAGE_H__
+#define __OLED_IMAGE_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The tokens of the compressed data.  The bytes of the image, in the layout
+// of the display memory, are coded as a sequence of runs, each starting with
+// a token byte:
+//
+//  - 0nnnnnnn: n + 1 bytes (1 to 128) follow and are copied;
+//  - 10nnnnnn: n + 1 bytes (1 to 64) of 0x00;
+//  - 11nnnnnn: n + 1 bytes (1 to 64) of the byte that follows.
+//
+// tools/rle_image.py converts the images in images/ to this format.
+//
+//*****************************************************************************
+#define OLED_IMAGE_LITERAL      0x00
+#define OLED_IMAGE_ZEROS        0x80
+#define OLED_IMAGE_REPEAT       0xc0
+#define OLED_IMAGE_LITERAL_MAX  128
+#define OLED_IMAGE_RUN_MAX      64
+
+//*****************************************************************************
+//
+// A compressed image.  The height is a multiple of 8.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint16_t ui16Width;
+    uint16_t ui16Height;
+    const uint8_t *pui8Data;
+    uint32_t ui32Size;
+}
+tOLEDImage;
+
+//*****************************************************************************
+//
+// The position of a reader in the compressed data.
+//
+//*****************************************************************************
+typedef struct
+{
+    const uint8_t *pui8Next;
+    const uint8_t *pui8End;
+}
+tOLEDImageReader;
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.
+//
+//*****************************************************************************
+extern void OLED_Image_Open(tOLEDImageReader *psReader,
+                            const tOLEDImage *psImage);
+extern uint32_t OLED_Image_Next(tOLEDImageReader *psReader,
+                                const uint8_t **ppui8Literal,
+                                uint8_t *pui8Value);
+extern uint32_t OLED_Image_Decode(const tOLEDImage *psImage, uint8_t *pui8Out,
+                                  uint32_t ui32Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __OLED_IMAGE_H__
@@ -0,0 +1,233 @@
+//*****************************************************************************
+//
+// pid.c - Fixed-point PID controller with feed-forward.
+//
+// The output is the feed-forward term, the gain times the setpoint, with
+// the proportional, integral and derivative terms trimming it.  The terms
+// are summed in 64 bits with PID_FRAC_BITS fractional bits and the output is
+// rounded to a whole unit.
+//
+// The output is limited, both in value and in how fast it changes, and the
+// integral is kept from winding up against either limit: a step may not
+// push it further past the limits than it already was, so once the output
+// saturates the integral holds until the error turns.  A rate limit is no
+// different from an output limit here, so the integral does not build up
+// while the output ramps either.
+//
+// tools/pid_sim.c runs the controller against a model of the pump and the
+// flow sensor on the host.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include "pid.h"
+
+//*****************************************************************************
+//
+// Rounds a sum with PID_FRAC_BITS fractional bits to a whole unit.  The
+// shift of a negative number is arithmetic on the compilers used here.
+//
+//*****************************************************************************
+static int32_t
+PID_Round(int64_t i64Value)
+{
+    return((int32_t)((i64Value + (1 << (PID_FRAC_BITS - 1))) >>
+                     PID_FRAC_BITS));
+}
+
+//*****************************************************************************
+//
+// Finds the limits of the output for this step, from the limits of the
+// configuration and the rate limit around the last output.
+//
+//*****************************************************************************
+static void
+PID_Limits(tPID *psPID, int32_t *pi32Low, int32_t *pi32High)
+{
+    const tPIDConfig *psConfig;
+
+    psConfig = psPID->psConfig;
+
+    *pi32Low = psConfig->i32OutMin;
+    *pi32High = psConfig->i32OutMax;
+
+    if(psConfig->i32RateMax)
+    {
+        if((psPID->i32Out - psConfig->i32RateMax) > *pi32Low)
+        {
+            *pi32Low = psPID->i32Out - psConfig->i32RateMax;
+        }
+        if((psPID->i32Out + psConfig->i32RateMax) < *pi32High)
+        {
+            *pi32High = psPID->i32Out + psConfig->i32RateMax;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Sets up a controller.
+//!
+//! \param psPID is the controller.
+//! \param psConfig is its tuning, which must stay in place while the
+//! controller is used.
+//!
+//! The output starts at the lower limit.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PID_Init(tPID *psPID, const tPIDConfig *psConfig)
+{
+    psPID->psConfig = psConfig;
+    PID_Reset(psPID);
+}
+
+//*****************************************************************************
+//
+//! Returns a controller to its lower limit and forgets its history.
+//!
+//! \param psPID is the controller.
+//!
+//! The output goes straight to the lower limit, whatever the rate limit.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PID_Reset(tPID *psPID)
+{
+    psPID->i64Integral = 0;
+    psPID->i32LastMeasured = 0;
+    psPID->i32Out = psPID->psConfig->i32OutMin;
+    psPID->bPrimed = false;
+}
+
+//*****************************************************************************
+//
+//! Runs a controller for one step.
+//!
+//! \param psPID is the controller.
+//! \param i32Setpoint is the value the measurement should have.
+//! \param i32Measured is the measurement.
+//!
+//! This must be called at the period the integral and derivative gains were
+//! worked out for.
+//!
+//! \return The new output.
+//
+//*****************************************************************************
+int32_t
+PID_Update(tPID *psPID, int32_t i32Setpoint, int32_t i32Measured)
+{
+    const tPIDConfig *psConfig;
+    int64_t i64Sum, i64Integral, i64Low, i64High;
+    int32_t i32Error, i32Low, i32High;
+
+    psConfig = psPID->psConfig;
+    i32Error = i32Setpoint - i32Measured;
+
+    //
+    // The feed-forward, proportional and derivative terms.  There is no
+    // derivative on the first step, with nothing to take it from.
+    //
+    i64Sum = ((int64_t)psConfig->i32Kff * i32Setpoint) +
+             ((int64_t)psConfig->i32Kp * i32Error);
+    if(psPID->bPrimed)
+    {
+        i64Sum -= (int64_t)psConfig->i32Kd *
+                  (i32Measured - psPID->i32LastMeasured);
+    }
+    psPID->i32LastMeasured = i32Measured;
+    psPID->bPrimed = true;
+
+    //
+    // The integral may move back towards the limits of this step but not
+    // further past them.
+    //
+    PID_Limits(psPID, &i32Low, &i32High);
+    i64Low = ((int64_t)i32Low << PID_FRAC_BITS) - i64Sum;
+    i64High = ((int64_t)i32High << PID_FRAC_BITS) - i64Sum;
+
+    i64Integral = psPID->i64Integral + ((int64_t)psConfig->i32Ki * i32Error);
+    if((i64Integral > i64High) && (i64Integral > psPID->i64Integral))
+    {
+        i64Integral = (psPID->i64Integral > i64High) ? psPID->i64Integral :
+                                                       i64High;
+    }
+    else if((i64Integral < i64Low) && (i64Integral < psPID->i64Integral))
+    {
+        i64Integral = (psPID->i64Integral < i64Low) ? psPID->i64Integral :
+                                                      i64Low;
+    }
+    psPID->i64Integral = i64Integral;
+
+    //
+    // Round the output and hold it within the limits.
+    //
+    psPID->i32Out = PID_Round(i64Sum + i64Integral);
+    if(psPID->i32Out > i32High)
+    {
+        psPID->i32Out = i32High;
+    }
+    else if(psPID->i32Out < i32Low)
+    {
+        psPID->i32Out = i32Low;
+    }
+
+    return(psPID->i32Out);
+}
+
+//*****************************************************************************
+//
+//! Runs a controller for one step without a measurement.
+//!
+//! \param psPID is the controller.
+//! \param i32Setpoint is the value the measurement should have.
+//!
+//! The output is the feed-forward term alone, within the limits.  The
+//! integral and the derivative are started afresh on the next call to
+//! PID_Update(), so the controller picks up from the feed-forward output.
+//!
+//! \return The new output.
+//
+//*****************************************************************************
+int32_t
+PID_Feed_Forward(tPID *psPID, int32_t i32Setpoint)
+{
+    int32_t i32Low, i32High;
+
+    PID_Limits(psPID, &i32Low, &i32High);
+
+    psPID->i64Integral = 0;
+    psPID->bPrimed = false;
+
+    psPID->i32Out = PID_Round((int64_t)psPID->psConfig->i32Kff *
+                              i32Setpoint);
+    if(psPID->i32Out > i32High)
+    {
+        psPID->i32Out = i32High;
+    }
+    else if(psPID->i32Out < i32Low)
+    {
+        psPID->i32Out = i32Low;
+    }
+
+    return(psPID->i32Out);
+}
+
+//*****************************************************************************
+//
+//! Returns the integral term of a controller.
+//!
+//! \param psPID is the controller.
+//!
+//! \return The integral term, in the units of the output, rounded.
+//
+//*****************************************************************************
+int32_t
+PID_Get_Integral(tPID *psPID)
+{
+    return(PID_Round(psPID->i64Integral));
+}
@@ -0,0 +1,82 @@
+//*****************************************************************************
+//
+// pid.h - Prototypes for the fixed-point PID controller.
+//
+//*****************************************************************************
+
+#ifndef __PID_H__
+#define __PID_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The gains are fixed point with PID_FRAC_BITS fractional bits.  PID_GAIN()
+// turns a constant into a gain at compile time.
+//
+//*****************************************************************************
+#define PID_FRAC_BITS           24
+
+#define PID_GAIN(fGain)         ((int32_t)(((fGain) * (1 << PID_FRAC_BITS)) + \
+                                           0.5))
+
+//*****************************************************************************
+//
+// The tuning of a controller.  The gains are in units of the output per
+// unit of the setpoint and the measurement; the integral and derivative
+// gains are per step, so they depend on the period the controller runs at.
+// The derivative acts on the measurement rather than the error, so that a
+// change of the setpoint does not kick the output.
+//
+// The output stays between i32OutMin and i32OutMax, and changes by at most
+// i32RateMax a step, or by any amount if i32RateMax is 0.
+//
+//*****************************************************************************
+typedef struct
+{
+    int32_t i32Kp;
+    int32_t i32Ki;
+    int32_t i32Kd;
+    int32_t i32Kff;
+    int32_t i32OutMin;
+    int32_t i32OutMax;
+    int32_t i32RateMax;
+}
+tPIDConfig;
+
+//*****************************************************************************
+//
+// The state of a controller.  The integral is kept in the units of the
+// output, with PID_FRAC_BITS fractional bits.
+//
+//*****************************************************************************
+typedef struct
+{
+    const tPIDConfig *psConfig;
+    int64_t i64Integral;
+    int32_t i32LastMeasured;
+    int32_t i32Out;
+    bool bPrimed;
+}
+tPID;
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.
+//
+//*****************************************************************************
+extern void PID_Init(tPID *psPID, const tPIDConfig *psConfig);
+extern void PID_Reset(tPID *psPID);
+extern int32_t PID_Update(tPID *psPID, int32_t i32Setpoint,
+                          int32_t i32Measured);
+extern int32_t PID_Feed_Forward(tPID *psPID, int32_t i32Setpoint);
+extern int32_t PID_Get_Integral(tPID *psPID);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __PID_H__
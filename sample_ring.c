@@ -0,0 +1,160 @@
+//*****************************************************************************
+//
+// sample_ring.c - Single-writer, single-reader sample ring.
+//
+// The writer stores a sample in its slot and then advances the head; the
+// reader reads the sample and then advances the tail.  On the single core
+// the order of the volatile accesses is all that either side relies on, so
+// the writer may interrupt the reader anywhere and the other way round.
+//
+// tools/sample_ring_test.c runs the ring with the writer in a signal
+// handler interrupting the reader, and in two threads.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include "sample_ring.h"
+
+//*****************************************************************************
+//
+//! Sets up an empty ring.
+//!
+//! \param psRing is the ring.
+//! \param pui32Slots is the storage for the samples.
+//! \param ui32Size is the number of slots, a power of two.
+//!
+//! This must be done before the writer or the reader use the ring.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Sample_Ring_Init(tSampleRing *psRing, volatile uint32_t *pui32Slots,
+                 uint32_t ui32Size)
+{
+    psRing->pui32Slots = pui32Slots;
+    psRing->ui32Mask = ui32Size - 1;
+    psRing->ui32Head = 0;
+    psRing->ui32Tail = 0;
+    psRing->ui32GapAt = psRing->ui32Tail - 1;
+    psRing->ui32Dropped = 0;
+    psRing->ui32Skipped = 0;
+}
+
+//*****************************************************************************
+//
+//! Stores a sample in the ring.
+//!
+//! \param psRing is the ring.
+//! \param ui32Sample is the sample.
+//!
+//! This may only be called by the writer.
+//!
+//! \return \b true if the sample was stored, or \b false if the ring was full
+//! and the sample was dropped.
+//
+//*****************************************************************************
+bool
+Sample_Ring_Put(tSampleRing *psRing, uint32_t ui32Sample)
+{
+    uint32_t ui32Head;
+
+    ui32Head = psRing->ui32Head;
+
+    if((ui32Head - psRing->ui32Tail) > psRing->ui32Mask)
+    {
+        psRing->ui32GapAt = ui32Head;
+        psRing->ui32Dropped++;
+        return(false);
+    }
+
+    psRing->pui32Slots[ui32Head & psRing->ui32Mask] = ui32Sample;
+    psRing->ui32Head = ui32Head + 1;
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Takes the oldest sample from the ring.
+//!
+//! \param psRing is the ring.
+//! \param pui32Sample receives the sample.
+//! \param pbGap is set if samples were lost right before this one.
+//!
+//! This may only be called by the reader.  Samples stored before a gap that
+//! the reader has not taken yet are skipped.
+//!
+//! \return \b true if there was a sample, or \b false if the ring was empty.
+//
+//*****************************************************************************
+bool
+Sample_Ring_Get(tSampleRing *psRing, uint32_t *pui32Sample, bool *pbGap)
+{
+    uint32_t ui32Tail, ui32Head, ui32GapAt;
+
+    //
+    // The writer sets the gap to the head it sees, so reading the gap before
+    // the head keeps it at or before the head.
+    //
+    ui32Tail = psRing->ui32Tail;
+    ui32GapAt = psRing->ui32GapAt;
+    ui32Head = psRing->ui32Head;
+
+    //
+    // The gap comes after the next sample: skip to it.
+    //
+    if(((ui32GapAt - ui32Tail) - 1) < (ui32Head - ui32Tail))
+    {
+        psRing->ui32Skipped += ui32GapAt - ui32Tail;
+        ui32Tail = ui32GapAt;
+        psRing->ui32Tail = ui32Tail;
+    }
+
+    if(ui32Tail == ui32Head)
+    {
+        return(false);
+    }
+
+    *pui32Sample = psRing->pui32Slots[ui32Tail & psRing->ui32Mask];
+    *pbGap = (ui32Tail == ui32GapAt);
+    psRing->ui32Tail = ui32Tail + 1;
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Returns the number of samples waiting in the ring.
+//!
+//! \param psRing is the ring.
+//!
+//! \return The number of samples, some of which may be skipped by the next
+//! call to Sample_Ring_Get().
+//
+//*****************************************************************************
+uint32_t
+Sample_Ring_Count(tSampleRing *psRing)
+{
+    uint32_t ui32Tail;
+
+    ui32Tail = psRing->ui32Tail;
+
+    return(psRing->ui32Head - ui32Tail);
+}
+
+//*****************************************************************************
+//
+//! Returns the number of samples lost.
+//!
+//! \param psRing is the ring.
+//!
+//! \return The number of samples dropped because the ring was full and
+//! skipped because they came before a gap, since Sample_Ring_Init().
+//
+//*****************************************************************************
+uint32_t
+Sample_Ring_Lost(tSampleRing *psRing)
+{
+    return(psRing->ui32Dropped + psRing->ui32Skipped);
+}
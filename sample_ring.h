@@ -0,0 +1,59 @@
+//*****************************************************************************
+//
+// sample_ring.h - Prototypes for the single-writer, single-reader sample
+// ring.
+//
+//*****************************************************************************
+
+#ifndef __SAMPLE_RING_H__
+#define __SAMPLE_RING_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// A ring of samples written by one context, typically an interrupt handler,
+// and read by one other, typically a task.  The slots are given by the user;
+// their number must be a power of two.  The head is only written by the
+// writer and the tail only by the reader, and the indices run freely, so
+// neither side has to mask interrupts or take a lock.
+//
+// A sample that finds the ring full is dropped, and ui32GapAt is set to the
+// index of the next one stored.  The reader skips the samples before the
+// last gap and reports the one after it, so that it never takes two samples
+// on either side of a gap for neighbours.
+//
+//*****************************************************************************
+typedef struct
+{
+    volatile uint32_t *pui32Slots;
+    uint32_t ui32Mask;
+    volatile uint32_t ui32Head;
+    volatile uint32_t ui32Tail;
+    volatile uint32_t ui32GapAt;
+    volatile uint32_t ui32Dropped;
+    volatile uint32_t ui32Skipped;
+}
+tSampleRing;
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.
+//
+//*****************************************************************************
+extern void Sample_Ring_Init(tSampleRing *psRing, volatile uint32_t *pui32Slots,
+                             uint32_t ui32Size);
+extern bool Sample_Ring_Put(tSampleRing *psRing, uint32_t ui32Sample);
+extern bool Sample_Ring_Get(tSampleRing *psRing, uint32_t *pui32Sample,
+                            bool *pbGap);
+extern uint32_t Sample_Ring_Count(tSampleRing *psRing);
+extern uint32_t Sample_Ring_Lost(tSampleRing *psRing);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SAMPLE_RING_H__
@@ -47,10 +47,6 @@
 
 #define SSD1306_BUFFER_SIZE SSD1306_LCDWIDTH * (SSD1306_LCDHEIGHT/8)
 
-//Delay between commands in microseconds
-#define SSD1306_COMMAND_DELAY       200
-#define SSD1306_DATA_DELAY          50
-
 //Bytes to be sent before actual commands or data
 #define SSD1306_COMMAND             0x00
 #define SSD1306_DATA                0x40
@@ -100,3 +96,13 @@
 #define SSD1306_LEFT_HORIZONTAL_SCROLL                  0x27
 #define SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL    0x29
 #define SSD1306_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL     0x2A
+
+// Scroll step intervals, in frames
+#define SSD1306_SCROLL_2_FRAMES                         0x07
+#define SSD1306_SCROLL_3_FRAMES                         0x04
+#define SSD1306_SCROLL_4_FRAMES                         0x05
+#define SSD1306_SCROLL_5_FRAMES                         0x00
+#define SSD1306_SCROLL_25_FRAMES                        0x06
+#define SSD1306_SCROLL_64_FRAMES                        0x01
+#define SSD1306_SCROLL_128_FRAMES                       0x02
+#define SSD1306_SCROLL_256_FRAMES                       0x03
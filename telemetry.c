@@ -0,0 +1,302 @@
+//*****************************************************************************
+//
+// telemetry.c - Binary telemetry streaming over UDP.
+//
+// A host subscribes by sending TELEMETRY_CMD_SUBSCRIBE to TELEMETRY_PORT.
+// From then on the PWM task records a sample every subscribed period into a
+// ring buffer, and the lwIP timer drains the ring into datagrams of up to
+// TELEMETRY_BATCH samples sent to the subscriber.  The ring has a single
+// producer (the PWM task) and a single consumer (the lwIP context), so it
+// needs no locking: each side only ever writes its own index.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "utils/lwiplib.h"
+#include "telemetry.h"
+
+extern bool systemOnline;
+extern bool automaticMode;
+extern uint32_t automaticModeSpeed;
+extern int32_t measuredFrequency;
+extern uint32_t getSpeed();
+
+//*****************************************************************************
+//
+// The number of samples the ring buffer holds.  This must be a power of two.
+// Samples are sent every HOST_TMR_INTERVAL, so at the shortest sample period
+// the ring has room for several rounds that could not be sent.
+//
+//*****************************************************************************
+#define TELEMETRY_RING_SIZE     64
+
+//*****************************************************************************
+//
+// The ring buffer of samples waiting to be sent.  The head is only written by
+// TelemetrySample() and the tail only by TelemetryTimer().  The entries are
+// volatile so that a sample is completely stored before the head moves past
+// it.
+//
+//*****************************************************************************
+static volatile tTelemetrySample g_psRing[TELEMETRY_RING_SIZE];
+static volatile uint32_t g_ui32RingHead;
+static volatile uint32_t g_ui32RingTail;
+
+//*****************************************************************************
+//
+// The subscribed sample period in milliseconds, or 0 if there is no
+// subscriber.  g_bRestart tells the producer that a new subscription has
+// started, so that sampling starts right away.
+//
+//*****************************************************************************
+static volatile uint32_t g_ui32Period;
+static volatile bool g_bRestart;
+
+//*****************************************************************************
+//
+// The state of the producer: the time the next sample is due and the number
+// of the next sample.
+//
+//*****************************************************************************
+static uint32_t g_ui32NextSample;
+static uint16_t g_ui16SampleSequence;
+
+//*****************************************************************************
+//
+// The state of the consumer: the UDP PCB, the subscriber, the time left
+// before the subscription ends and the number of the next datagram.
+//
+//*****************************************************************************
+static struct udp_pcb *g_psTelemetryPCB;
+static struct ip_addr g_sSubscriberAddr;
+static u16_t g_ui16SubscriberPort;
+static uint32_t g_ui32LeaseLeft;
+static uint32_t g_ui32DatagramSequence;
+
+//*****************************************************************************
+//
+// This function is called by the lwIP TCP/IP stack when it receives a UDP
+// packet on the telemetry port.  It starts, renews or ends the subscription.
+//
+//*****************************************************************************
+static void
+TelemetryReceive(void *arg, struct udp_pcb *pcb, struct pbuf *p,
+                 struct ip_addr *addr, u16_t port)
+{
+    uint8_t *pui8Data;
+    uint32_t ui32Period;
+
+    pui8Data = p->payload;
+
+    if((p->len >= 4) && (pui8Data[0] == TELEMETRY_CMD_SUBSCRIBE))
+    {
+        ui32Period = pui8Data[2] | (pui8Data[3] << 8);
+        if(ui32Period < TELEMETRY_MIN_PERIOD)
+        {
+            ui32Period = TELEMETRY_MIN_PERIOD;
+        }
+        else if(ui32Period > TELEMETRY_MAX_PERIOD)
+        {
+            ui32Period = TELEMETRY_MAX_PERIOD;
+        }
+
+        //
+        // A new subscriber or a new period restarts the sampling; renewing
+        // the subscription as it is only extends the lease.
+        //
+        if((g_ui32Period != ui32Period) ||
+           !ip_addr_cmp(&g_sSubscriberAddr, addr) ||
+           (g_ui16SubscriberPort != port))
+        {
+            ip_addr_copy(g_sSubscriberAddr, *addr);
+            g_ui16SubscriberPort = port;
+            g_bRestart = true;
+            g_ui32Period = ui32Period;
+        }
+        g_ui32LeaseLeft = TELEMETRY_LEASE;
+    }
+    else if((p->len >= 1) && (pui8Data[0] == TELEMETRY_CMD_UNSUBSCRIBE))
+    {
+        g_ui32Period = 0;
+    }
+
+    pbuf_free(p);
+}
+
+//*****************************************************************************
+//
+//! Initializes the telemetry service.
+//!
+//! This function creates the UDP server that subscribers talk to.  It must be
+//! called after lwIP has been initialized.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TelemetryInit(void)
+{
+    g_psTelemetryPCB = udp_new();
+    udp_recv(g_psTelemetryPCB, TelemetryReceive, NULL);
+    udp_bind(g_psTelemetryPCB, IP_ADDR_ANY, TELEMETRY_PORT);
+}
+
+//*****************************************************************************
+//
+//! Records a telemetry sample if one is due.
+//!
+//! \param ui32Time is the current time in milliseconds.
+//! \param ui32PulseWidth is the PWM pulse width currently driving the motor.
+//!
+//! This function is called by the PWM task on every iteration.  It does
+//! nothing unless there is a subscriber and the subscribed period has passed
+//! since the last sample.  If the ring buffer is full the sample is dropped,
+//! which the subscriber sees as a gap in the sample numbers.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TelemetrySample(uint32_t ui32Time, uint32_t ui32PulseWidth)
+{
+    tTelemetrySample sSample;
+    uint32_t ui32Period, ui32Head, ui32Speed;
+
+    ui32Period = g_ui32Period;
+    if(ui32Period == 0)
+    {
+        return;
+    }
+
+    if(g_bRestart)
+    {
+        g_bRestart = false;
+        g_ui32NextSample = ui32Time;
+    }
+
+    if((int32_t)(ui32Time - g_ui32NextSample) < 0)
+    {
+        return;
+    }
+
+    //
+    // Keep to the period, unless the task has fallen more than a period
+    // behind, in which case there is no point in catching up.
+    //
+    if((ui32Time - g_ui32NextSample) >= ui32Period)
+    {
+        g_ui32NextSample = ui32Time + ui32Period;
+    }
+    else
+    {
+        g_ui32NextSample += ui32Period;
+    }
+
+    sSample.ui16Sequence = g_ui16SampleSequence++;
+
+    ui32Head = g_ui32RingHead;
+    if((ui32Head - g_ui32RingTail) >= TELEMETRY_RING_SIZE)
+    {
+        return;
+    }
+
+    ui32Speed = getSpeed();
+    sSample.ui32Time = ui32Time;
+    sSample.i32Frequency = measuredFrequency;
+    sSample.ui16PulseWidth = ui32PulseWidth;
+    sSample.ui16ADC = automaticModeSpeed;
+    sSample.ui8Flags = ((automaticMode ? TELEMETRY_FLAG_AUTOMATIC : 0) |
+                        (systemOnline ? TELEMETRY_FLAG_ONLINE : 0));
+    sSample.ui8Speed = (ui32Speed > 255) ? 255 : ui32Speed;
+
+    g_psRing[ui32Head & (TELEMETRY_RING_SIZE - 1)] = sSample;
+    g_ui32RingHead = ui32Head + 1;
+}
+
+//*****************************************************************************
+//
+//! Sends the recorded samples to the subscriber.
+//!
+//! This function must be called every HOST_TMR_INTERVAL milliseconds from the
+//! lwIP context.  It also ends subscriptions whose lease has run out.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TelemetryTimer(void)
+{
+    tTelemetryHeader sHeader;
+    tTelemetrySample sSample;
+    struct pbuf *p;
+    uint8_t *pui8Data;
+    uint32_t ui32Tail, ui32Count, ui32Idx;
+
+    if(g_ui32Period != 0)
+    {
+        if(g_ui32LeaseLeft > HOST_TMR_INTERVAL)
+        {
+            g_ui32LeaseLeft -= HOST_TMR_INTERVAL;
+        }
+        else
+        {
+            g_ui32Period = 0;
+        }
+    }
+
+    ui32Tail = g_ui32RingTail;
+
+    if(g_ui32Period == 0)
+    {
+        //
+        // Nobody is listening; throw away anything left over.
+        //
+        g_ui32RingTail = g_ui32RingHead;
+        return;
+    }
+
+    while((ui32Count = g_ui32RingHead - ui32Tail) != 0)
+    {
+        if(ui32Count > TELEMETRY_BATCH)
+        {
+            ui32Count = TELEMETRY_BATCH;
+        }
+
+        //
+        // If there is no memory for the datagram, try again next time.
+        //
+        p = pbuf_alloc(PBUF_TRANSPORT, sizeof(sHeader) +
+                       (ui32Count * sizeof(sSample)), PBUF_RAM);
+        if(p == NULL)
+        {
+            break;
+        }
+
+        sHeader.ui16Magic = TELEMETRY_MAGIC;
+        sHeader.ui8Version = TELEMETRY_VERSION;
+        sHeader.ui8Count = ui32Count;
+        sHeader.ui32Sequence = g_ui32DatagramSequence++;
+
+        pui8Data = p->payload;
+        memcpy(pui8Data, &sHeader, sizeof(sHeader));
+        pui8Data += sizeof(sHeader);
+
+        for(ui32Idx = 0; ui32Idx < ui32Count; ui32Idx++)
+        {
+            sSample = g_psRing[ui32Tail & (TELEMETRY_RING_SIZE - 1)];
+            memcpy(pui8Data, &sSample, sizeof(sSample));
+            pui8Data += sizeof(sSample);
+            ui32Tail++;
+        }
+
+        //
+        // The samples have been copied, so their slots can be reused.
+        //
+        g_ui32RingTail = ui32Tail;
+
+        udp_sendto(g_psTelemetryPCB, p, &g_sSubscriberAddr,
+                   g_ui16SubscriberPort);
+        pbuf_free(p);
+    }
+}
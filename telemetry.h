@@ -0,0 +1,145 @@
+//*****************************************************************************
+//
+// telemetry.h - Prototypes for the UDP telemetry streaming service.
+//
+//*****************************************************************************
+
+#ifndef __TELEMETRY_H__
+#define __TELEMETRY_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The UDP port the telemetry service listens on for subscriptions.
+//
+//*****************************************************************************
+#define TELEMETRY_PORT          5005
+
+//*****************************************************************************
+//
+// The sample periods a subscriber can ask for, in milliseconds.  Samples are
+// taken by the PWM task, which runs every 10 ms.
+//
+//*****************************************************************************
+#define TELEMETRY_MIN_PERIOD    10
+#define TELEMETRY_MAX_PERIOD    10000
+
+//*****************************************************************************
+//
+// A subscription that is not renewed within this many milliseconds ends, so a
+// logger that goes away does not leave the board streaming forever.
+//
+//*****************************************************************************
+#define TELEMETRY_LEASE         10000
+
+//*****************************************************************************
+//
+// The maximum number of samples sent in one datagram.
+//
+//*****************************************************************************
+#define TELEMETRY_BATCH         32
+
+//*****************************************************************************
+//
+// The commands accepted on TELEMETRY_PORT.  A subscribe datagram is 4 bytes:
+// the command, a reserved byte and the sample period in milliseconds (16-bit
+// little endian).  An unsubscribe datagram is the command byte alone.  There
+// is a single subscriber; a new subscription replaces the previous one.
+//
+//*****************************************************************************
+#define TELEMETRY_CMD_SUBSCRIBE     0x01
+#define TELEMETRY_CMD_UNSUBSCRIBE   0x02
+
+//*****************************************************************************
+//
+// The header of a telemetry datagram, followed by ui8Count samples.  All
+// fields are little endian.
+//
+//     Byte        Description
+//     --------    ------------------------
+//      0..1       TELEMETRY_MAGIC
+//      2          TELEMETRY_VERSION
+//      3          number of samples
+//      4..7       datagram sequence number
+//
+//*****************************************************************************
+#define TELEMETRY_MAGIC         0x4d54          // "TM"
+#define TELEMETRY_VERSION       1
+
+typedef struct
+{
+    uint16_t ui16Magic;
+    uint8_t ui8Version;
+    uint8_t ui8Count;
+    uint32_t ui32Sequence;
+}
+tTelemetryHeader;
+
+//*****************************************************************************
+//
+// A telemetry sample, sent as is (16 bytes, little endian).  ui16Sequence
+// counts every sample taken, so the receiver can tell samples lost to a full
+// buffer on the board from datagrams lost on the network.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The time the sample was taken, in milliseconds since boot.
+    //
+    uint32_t ui32Time;
+
+    //
+    // The measured frequency.
+    //
+    int32_t i32Frequency;
+
+    //
+    // The PWM pulse width driving the motor, in PWM clock ticks.
+    //
+    uint16_t ui16PulseWidth;
+
+    //
+    // The filtered speed potentiometer reading, in whole ADC counts from 0
+    // to 4095, as /status.json reports it.
+    //
+    uint16_t ui16ADC;
+
+    //
+    // TELEMETRY_FLAG_* values.
+    //
+    uint8_t ui8Flags;
+
+    //
+    // The speed, in percent.
+    //
+    uint8_t ui8Speed;
+
+    //
+    // The number of the sample, modulo 65536.
+    //
+    uint16_t ui16Sequence;
+}
+tTelemetrySample;
+
+#define TELEMETRY_FLAG_AUTOMATIC    0x01
+#define TELEMETRY_FLAG_ONLINE       0x02
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.
+//
+//*****************************************************************************
+extern void TelemetryInit(void);
+extern void TelemetrySample(uint32_t ui32Time, uint32_t ui32PulseWidth);
+extern void TelemetryTimer(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __TELEMETRY_H__
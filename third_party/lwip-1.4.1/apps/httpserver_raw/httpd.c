@@ -190,6 +190,104 @@
 #define LWIP_HTTPD_SSI_INCLUDE_TAG           1
 #endif
 
+/** Set this to 1 to support HTTP/1.1 persistent connections: a response
+ * whose length is known up front is sent with a Content-Length header and
+ * the connection is kept open for further (possibly pipelined) requests
+ * unless the client asked to close it */
+#ifndef LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+#define LWIP_HTTPD_SUPPORT_11_KEEPALIVE      1
+#endif
+
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+/** Number of polls (HTTPD_POLL_INTERVAL each) a persistent connection may
+ * stay idle between requests before it is closed */
+#ifndef HTTPD_KEEPALIVE_MAX_IDLE
+#define HTTPD_KEEPALIVE_MAX_IDLE             5
+#endif
+
+/** Number of bytes and of rx pbufs of pipelined requests that are kept while
+ * the response to an earlier request is being sent. Past either, further
+ * data is refused (left to TCP, which holds on to it and drops what follows
+ * until it is taken), so that a client cannot tie up the pbuf pool. */
+#ifndef LWIP_HTTPD_NEXT_REQ_BUFSIZE
+#define LWIP_HTTPD_NEXT_REQ_BUFSIZE          1023
+#endif
+#ifndef LWIP_HTTPD_NEXT_REQ_QUEUELEN
+#define LWIP_HTTPD_NEXT_REQ_QUEUELEN         4
+#endif
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
+/** Set this to 1 to send the pre-compressed variant of a file (the file name
+ * with ".gz" appended) with a "Content-Encoding: gzip" header if the client
+ * accepts gzip encoding and the variant exists in the file system. Responses
+ * for files that have such a variant carry "Vary: Accept-Encoding", so that
+ * caches keep the two apart. */
+#ifndef LWIP_HTTPD_SUPPORT_GZIP
+#define LWIP_HTTPD_SUPPORT_GZIP              1
+#endif
+
+#if LWIP_HTTPD_SUPPORT_GZIP
+/** Maximum length of a file name (including parameters) for which the
+ * pre-compressed variant is looked up */
+#ifndef LWIP_HTTPD_MAX_GZIP_NAME_LEN
+#define LWIP_HTTPD_MAX_GZIP_NAME_LEN         63
+#endif
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
+
+/** Set this to 1 to serve a Server-Sent Events stream at LWIP_HTTPD_SSE_URI.
+ * The connection is kept open and gets every message passed to
+ * httpd_sse_broadcast(). The application provides httpd_sse_snapshot(),
+ * which formats the current state for clients that have just connected or
+ * have missed a message. Requires LWIP_HTTPD_DYNAMIC_HEADERS. */
+#ifndef LWIP_HTTPD_SSE
+#define LWIP_HTTPD_SSE                       0
+#endif
+
+#if LWIP_HTTPD_SSE
+/** The URI of the event stream */
+#ifndef LWIP_HTTPD_SSE_URI
+#define LWIP_HTTPD_SSE_URI                   "/events"
+#endif
+
+/** Maximum number of event stream connections open at the same time.
+ * Requests beyond that get a 404 response. */
+#ifndef LWIP_HTTPD_SSE_MAX_CLIENTS
+#define LWIP_HTTPD_SSE_MAX_CLIENTS           4
+#endif
+
+/** Maximum length of the message returned by httpd_sse_snapshot() */
+#ifndef LWIP_HTTPD_SSE_MAX_MSG_LEN
+#define LWIP_HTTPD_SSE_MAX_MSG_LEN           128
+#endif
+#endif /* LWIP_HTTPD_SSE */
+
+/** Set this to 1 to hand connections requesting an upgrade to the WebSocket
+ * protocol on LWIP_HTTPD_WS_URI over to the application, which provides
+ * httpd_websocket_open(). */
+#ifndef LWIP_HTTPD_WEBSOCKET
+#define LWIP_HTTPD_WEBSOCKET                 0
+#endif
+
+#if LWIP_HTTPD_WEBSOCKET
+/** The URI of the WebSocket endpoint */
+#ifndef LWIP_HTTPD_WS_URI
+#define LWIP_HTTPD_WS_URI                    "/ws"
+#endif
+#endif /* LWIP_HTTPD_WEBSOCKET */
+
+/** Set this to 1 to call httpd_response_sent(), provided by the application,
+ * every time the last of a response has been passed to TCP. */
+#ifndef LWIP_HTTPD_RESPONSE_HOOK
+#define LWIP_HTTPD_RESPONSE_HOOK             0
+#endif
+
+/** Set this to 1 to count the bytes passed to tcp_write, split into the
+ * ones that were copied into the send buffer and the ones that were sent by
+ * reference (see httpd_bytes_copied and httpd_bytes_zero_copy) */
+#ifndef LWIP_HTTPD_COPY_STATS
+#define LWIP_HTTPD_COPY_STATS                0
+#endif
+
 /** Set this to 1 to call tcp_abort when tcp_close fails with memory error.
  * This can be used to prevent consuming all memory in situations where the
  * HTTP server has low priority compared to other communication. */
@@ -210,25 +308,29 @@
 
 #define CRLF "\r\n"
 
+/** Base address of the on-chip SRAM. Anything below it is in flash, is
+ * never modified and can be handed to tcp_write without copying. */
+#ifndef HTTPD_SRAM_BASE
+#define HTTPD_SRAM_BASE                     0x20000000
+#endif
+
 /** These defines check whether tcp_write has to copy data or not */
 
-/** This was TI's check whether to let TCP copy data or not
-#define HTTP_IS_DATA_VOLATILE(hs) ((hs->file < (char *)0x20000000) ? 0 : TCP_WRITE_FLAG_COPY)*/
+/** Don't copy file data that is sent straight from flash (this includes the
+ * static parts of SSI files). Copy everything in RAM: blocks read into
+ * hs->buf by fs_read() and files generated by the file system, whose buffer
+ * is released when the file is closed, possibly before the data has been
+ * acknowledged. */
 #ifndef HTTP_IS_DATA_VOLATILE
-#if LWIP_HTTPD_SSI
-/* Copy for SSI files, no copy for non-SSI files */
-#define HTTP_IS_DATA_VOLATILE(hs)   ((hs)->tag_check ? TCP_WRITE_FLAG_COPY : 0)
-#else /* LWIP_HTTPD_SSI */
-/** Default: don't copy if the data is sent from file-system directly */
-#define HTTP_IS_DATA_VOLATILE(hs) (((hs->file != NULL) && (hs->handle != NULL) && (hs->file == \
-                                   (char*)hs->handle->data + hs->handle->len - hs->left)) \
-                                   ? 0 : TCP_WRITE_FLAG_COPY)
-#endif /* LWIP_HTTPD_SSI */
+#define HTTP_IS_DATA_VOLATILE(hs)   (((hs)->file < (char *)HTTPD_SRAM_BASE) ? \
+                                     0 : TCP_WRITE_FLAG_COPY)
 #endif
 
-/** Default: headers are sent from ROM */
+/** Default: headers are sent from ROM, except for the ones built into
+ * struct http_state (e.g. Content-Length) which must be copied */
 #ifndef HTTP_IS_HDR_VOLATILE
-#define HTTP_IS_HDR_VOLATILE(hs, ptr) 0
+#define HTTP_IS_HDR_VOLATILE(hs, ptr) (((const char *)(ptr) < (char *)HTTPD_SRAM_BASE) ? \
+                                       0 : TCP_WRITE_FLAG_COPY)
 #endif
 
 #if LWIP_HTTPD_SSI
@@ -267,9 +369,52 @@ static char http_post_response_filename[LWIP_HTTPD_POST_MAX_RESPONSE_URI_LEN+1];
 
 #if LWIP_HTTPD_DYNAMIC_HEADERS
 /* The number of individual strings that comprise the headers sent before each
- * requested file.
+ * requested file. Unused slots are NULL.
  */
-#define NUM_FILE_HDR_STRINGS 3
+#define NUM_FILE_HDR_STRINGS 7
+#define HDR_STRINGS_IDX_HTTP_STATUS       0 /* e.g. "HTTP/1.0 200 OK\r\n" */
+#define HDR_STRINGS_IDX_SERVER_NAME       1 /* e.g. "Server: "HTTPD_SERVER_AGENT"\r\n" */
+#define HDR_STRINGS_IDX_CONTENT_ENCODING  2 /* e.g. "Content-Encoding: gzip\r\n" */
+#define HDR_STRINGS_IDX_VARY              3 /* e.g. "Vary: Accept-Encoding\r\n" */
+#define HDR_STRINGS_IDX_CONTENT_LEN       4 /* e.g. "Content-Length: 1234\r\n" */
+#define HDR_STRINGS_IDX_CONNECTION        5 /* e.g. "Connection: keep-alive\r\n" */
+#define HDR_STRINGS_IDX_CONTENT_TYPE      6 /* the content type, ending with an empty line */
+
+#define HTTP_HDR_CONTENT_LEN                "Content-Length: "
+#define HTTP_HDR_CONTENT_LEN_LEN            16
+#define HTTP_HDR_CONTENT_LEN_DIGIT_MAX_LEN  10
+/* "Content-Length: " + up to 10 digits + CRLF + NUL */
+#define LWIP_HTTPD_MAX_CONTENT_LEN_SIZE     (HTTP_HDR_CONTENT_LEN_LEN + \
+                                             HTTP_HDR_CONTENT_LEN_DIGIT_MAX_LEN + 3)
+
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+#define HTTPD_HDR_OK_11                      "HTTP/1.1 200 OK\r\n"
+#define HTTPD_HDR_CONN_KEEPALIVE             "Connection: keep-alive\r\n"
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
+#if LWIP_HTTPD_SUPPORT_GZIP
+#define HTTP_HDR_CONTENT_ENCODING_GZIP    "Content-Encoding: gzip\r\n"
+#define HTTP_HDR_VARY_ACCEPT_ENCODING     "Vary: Accept-Encoding\r\n"
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
+
+/** Content type of .json files.  The answers are generated on request and
+ * must not be cached. */
+#define HTTPD_HDR_JSON_CONTENT_TYPE       "Content-type: application/json\r\n" \
+                                          "Cache-Control: no-cache\r\n\r\n"
+
+/** Content type of .pbm files, which are generated on request too. */
+#define HTTPD_HDR_PBM_CONTENT_TYPE        "Content-type: image/x-portable-bitmap\r\n" \
+                                          "Cache-Control: no-cache\r\n\r\n"
+
+#if LWIP_HTTPD_SSE
+#define HTTPD_HDR_SSE_STATUS              "HTTP/1.1 200 OK\r\n"
+#define HTTPD_HDR_SSE_CONTENT_TYPE        "Content-Type: text/event-stream\r\n" \
+                                          "Cache-Control: no-cache\r\n\r\n"
+/** Comment line sent on idle event streams */
+#define HTTPD_SSE_HEARTBEAT               ":\n\n"
+#endif /* LWIP_HTTPD_SSE */
+#elif LWIP_HTTPD_SSE
+#error LWIP_HTTPD_SSE requires LWIP_HTTPD_DYNAMIC_HEADERS
 #endif /* LWIP_HTTPD_DYNAMIC_HEADERS */
 
 #if LWIP_HTTPD_SSI
@@ -305,6 +450,25 @@ struct http_state {
 #endif /* LWIP_HTTPD_SSI || LWIP_HTTPD_DYNAMIC_HEADERS */
   u32_t left;       /* Number of unsent bytes in buf. */
   u8_t retries;
+#if LWIP_HTTPD_SUPPORT_GZIP
+  u8_t accept_gzip; /* true if the client accepts gzip content encoding */
+  u8_t gzip;        /* true if the file being sent is gzip compressed */
+  u8_t vary;        /* true if the file has a gzip variant, so that the
+                       response depends on Accept-Encoding */
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+  u8_t keepalive;   /* true if the connection stays open after the response */
+  u16_t req_len;    /* Length of the request being processed, up to and
+                       including the empty line ending its headers */
+  struct pbuf *next_req; /* Data received after the current request */
+  u16_t next_req_unrecved; /* Bytes of next_req not yet taken from the
+                              receive window */
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+#if LWIP_HTTPD_SSE
+  u8_t sse;         /* true if this connection is an event stream */
+  u8_t sse_resync;  /* true if the client has to be sent the current state */
+  u8_t sse_idle;    /* true if nothing has been sent since the last poll */
+#endif /* LWIP_HTTPD_SSE */
 #if LWIP_HTTPD_SSI
   const char *parsed;     /* Pointer to the first unparsed byte in buf. */
 #if !LWIP_HTTPD_SSI_INCLUDE_TAG
@@ -329,6 +493,7 @@ struct http_state {
 #endif /* LWIP_HTTPD_CGI */
 #if LWIP_HTTPD_DYNAMIC_HEADERS
   const char *hdrs[NUM_FILE_HDR_STRINGS]; /* HTTP headers to be sent. */
+  char hdr_content_len[LWIP_HTTPD_MAX_CONTENT_LEN_SIZE]; /* Content-Length header */
   u16_t hdr_pos;     /* The position of the first unsent header byte in the
                         current string */
   u16_t hdr_index;   /* The index of the hdr string currently being sent. */
@@ -349,6 +514,42 @@ struct http_state {
 static err_t http_find_file(struct http_state *hs, const char *uri, int is_09);
 static err_t http_init_file(struct http_state *hs, struct fs_file *file, int is_09, const char *uri);
 static err_t http_poll(void *arg, struct tcp_pcb *pcb);
+static void http_handle_request(struct tcp_pcb *pcb, struct http_state *hs, struct pbuf *p);
+
+#if LWIP_HTTPD_SSE
+/** An open event stream */
+struct http_sse_client {
+  struct tcp_pcb *pcb;
+  struct http_state *hs;  /* NULL if the slot is free */
+};
+
+static struct http_sse_client http_sse_clients[LWIP_HTTPD_SSE_MAX_CLIENTS];
+
+/** Provided by the application: format the current state as a complete event
+ * ("data: ...\n\n") into buf (len bytes) and return its length. */
+extern u16_t httpd_sse_snapshot(char *buf, u16_t len);
+#endif /* LWIP_HTTPD_SSE */
+
+#if LWIP_HTTPD_WEBSOCKET
+/** Provided by the application: answer the upgrade request of a connection
+ * (key is the value of its Sec-WebSocket-Key header, not NULL-terminated) and
+ * take the connection over. Returns ERR_OK if it did so, in which case the
+ * httpd must not touch the pcb anymore. */
+extern err_t httpd_websocket_open(struct tcp_pcb *pcb, const char *key, u16_t key_len);
+#endif /* LWIP_HTTPD_WEBSOCKET */
+
+#if LWIP_HTTPD_RESPONSE_HOOK
+/** Provided by the application: called at the end of every response. */
+extern void httpd_response_sent(void);
+#endif /* LWIP_HTTPD_RESPONSE_HOOK */
+
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+/** The connection whose requests http_handle_request() is working through.
+ * A response that ends while it runs leaves the next request to its loop
+ * instead of starting it from http_eof(), so that pipelined requests are
+ * served one after the other rather than one level of recursion deeper each. */
+static struct http_state *http_handling;
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
 
 #if LWIP_HTTPD_SSI
 /* SSI insert handler function pointer. */
@@ -369,6 +570,12 @@ const tCGI *g_pCGIs;
 int g_iNumCGIs;
 #endif /* LWIP_HTTPD_CGI */
 
+#if LWIP_HTTPD_COPY_STATS
+/* Bytes passed to tcp_write with and without TCP_WRITE_FLAG_COPY */
+u32_t httpd_bytes_copied;
+u32_t httpd_bytes_zero_copy;
+#endif /* LWIP_HTTPD_COPY_STATS */
+
 #if LWIP_HTTPD_STRNSTR_PRIVATE
 /** Like strstr but does not need 'buffer' to be NULL-terminated */
 static char*
@@ -388,6 +595,180 @@ strnstr(const char* buffer, const char* token, size_t n)
 }
 #endif /* LWIP_HTTPD_STRNSTR_PRIVATE */
 
+#if LWIP_HTTPD_SUPPORT_GZIP || LWIP_HTTPD_SUPPORT_11_KEEPALIVE || LWIP_HTTPD_WEBSOCKET
+/** Compare n characters of a string case-insensitively to a lower case
+ * string. Returns 0 if they match. */
+static int
+http_strnicmp(const char *str, const char *lower, size_t n)
+{
+  char c;
+
+  while (n--) {
+    c = *str++;
+    if ((c >= 'A') && (c <= 'Z')) {
+      c += 'a' - 'A';
+    }
+    if (c != *lower++) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/** Check whether a header value contains a (lower case) token, ignoring
+ * case. */
+static u8_t
+http_value_has(const char *value, u16_t value_len, const char *token)
+{
+  size_t token_len = strlen(token);
+  u16_t i;
+
+  for (i = 0; i + token_len <= value_len; i++) {
+    if (!http_strnicmp(value + i, token, token_len)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/** Find a request header by name. Header names are matched
+ * case-insensitively.
+ *
+ * @param headers the first byte after the request line
+ * @param len number of header bytes available
+ * @param name lower case name of the header, including the ':'
+ * @param value_len receives the length of the value
+ * @return pointer to the value of the header, without the white space around
+ *         it, or NULL if the header is not present
+ */
+static const char *
+http_find_header(const char *headers, u16_t len, const char *name,
+                 u16_t *value_len)
+{
+  const char *end = headers + len;
+  const char *line = headers;
+  const char *eol;
+  size_t name_len = strlen(name);
+
+  while (line < end) {
+    eol = strnstr(line, CRLF, end - line);
+    if (eol == NULL) {
+      eol = end;
+    }
+    if (eol == line) {
+      /* an empty line ends the headers */
+      break;
+    }
+    if (((size_t)(eol - line) >= name_len) &&
+        !http_strnicmp(line, name, name_len)) {
+      const char *value = line + name_len;
+      /* strip the white space around the value */
+      while ((value < eol) && ((*value == ' ') || (*value == '\t'))) {
+        value++;
+      }
+      while ((eol > value) && ((eol[-1] == ' ') || (eol[-1] == '\t'))) {
+        eol--;
+      }
+      *value_len = (u16_t)(eol - value);
+      return value;
+    }
+    line = eol + 2;
+  }
+  return NULL;
+}
+#endif /* LWIP_HTTPD_SUPPORT_GZIP || LWIP_HTTPD_SUPPORT_11_KEEPALIVE || LWIP_HTTPD_WEBSOCKET */
+
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+/** Decide from the request line and the headers whether the client wants the
+ * connection to be kept open after the response: HTTP/1.1 connections are
+ * persistent unless closed explicitly, HTTP/1.0 ones only on request.
+ *
+ * @param data the start of the request
+ * @param crlf the end of the request line
+ * @param req_len length of the request up to and including the empty line
+ * @return 1 if the connection should be kept open, 0 otherwise
+ */
+static u8_t
+http_wants_keepalive(const char *data, const char *crlf, u16_t req_len)
+{
+  const char *value;
+  u16_t value_len;
+
+  value = http_find_header(crlf + 2, req_len - (u16_t)((crlf + 2) - data),
+                           "connection:", &value_len);
+  if (strnstr(data, " HTTP/1.1", crlf - data) != NULL) {
+    return (value == NULL) || !http_value_has(value, value_len, "close");
+  }
+  return (value != NULL) && http_value_has(value, value_len, "keep-alive");
+}
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
+#if !LWIP_HTTPD_SUPPORT_REQUESTLIST
+/** Drop the first len bytes of a pbuf chain.
+ *
+ * @return what is left of the chain or NULL if nothing is left
+ */
+static struct pbuf *
+http_pbuf_drop(struct pbuf *p, u16_t len)
+{
+  struct pbuf *q;
+
+  while ((p != NULL) && (len >= p->len)) {
+    len -= p->len;
+    /* pbuf_cat() does not reference the tail, so take a reference before
+       freeing the head: pbuf_free() then only drops that one. */
+    q = p->next;
+    if (q != NULL) {
+      pbuf_ref(q);
+    }
+    pbuf_free(p);
+    p = q;
+  }
+  if ((p != NULL) && (len > 0)) {
+    pbuf_header(p, -(s16_t)len);
+  }
+  return p;
+}
+
+/** Make sure the first request of a pbuf chain is in its first pbuf, since
+ * it is parsed in place. A request that spans pbufs (a request larger than a
+ * pool pbuf or pipelined requests that straddle a segment boundary) is
+ * copied into a pbuf of its own, which takes the place of the pbufs it was
+ * spread over. If there is no memory for the copy, the chain is returned as
+ * it is and only its first pbuf is parsed.
+ *
+ * @return the chain, starting with the whole first request
+ */
+static struct pbuf *
+http_pbuf_contiguous(struct pbuf *p)
+{
+  struct pbuf *q;
+  u16_t len;
+
+  if (p->next == NULL) {
+    return p;
+  }
+  /* The request ends with the empty line after its headers; if that has not
+     been received, take everything there is. */
+  len = pbuf_memfind(p, CRLF CRLF, 4, 0);
+  len = (len == 0xFFFF) ? p->tot_len : (u16_t)(len + 4);
+  if (len <= p->len) {
+    return p;
+  }
+  q = pbuf_alloc(PBUF_RAW, len, PBUF_RAM);
+  if (q == NULL) {
+    LWIP_DEBUGF(HTTPD_DEBUG, ("http_pbuf_contiguous: out of memory\n"));
+    return p;
+  }
+  pbuf_copy_partial(p, q->payload, len, 0);
+  p = http_pbuf_drop(p, len);
+  if (p != NULL) {
+    pbuf_cat(q, p);
+  }
+  return q;
+}
+#endif /* !LWIP_HTTPD_SUPPORT_REQUESTLIST */
+
 /** Allocate a struct http_state. */
 static struct http_state*
 http_state_alloc(void)
@@ -409,6 +790,167 @@ http_state_alloc(void)
   return ret;
 }
 
+/** Release the file of the response that has been sent and get the
+ * struct http_state ready for the next request.
+ */
+static void
+http_state_eof(struct http_state *hs)
+{
+  if(hs->handle) {
+#if LWIP_HTTPD_TIMING
+    u32_t ms_needed = sys_now() - hs->time_started;
+    u32_t needed = LWIP_MAX(1, (ms_needed/100));
+    LWIP_DEBUGF(HTTPD_DEBUG_TIMING, ("httpd: needed %"U32_F" ms to send file of %d bytes -> %"U32_F" bytes/sec\n",
+      ms_needed, hs->handle->len, ((((u32_t)hs->handle->len) * 10) / needed)));
+#endif /* LWIP_HTTPD_TIMING */
+    fs_close(hs->handle);
+    hs->handle = NULL;
+  }
+#if LWIP_HTTPD_SSI || LWIP_HTTPD_DYNAMIC_HEADERS
+  if (hs->buf != NULL) {
+    mem_free(hs->buf);
+    hs->buf = NULL;
+  }
+#endif /* LWIP_HTTPD_SSI || LWIP_HTTPD_DYNAMIC_HEADERS */
+  hs->file = NULL;
+  hs->left = 0;
+  hs->retries = 0;
+#if LWIP_HTTPD_DYNAMIC_HEADERS
+  hs->hdr_index = NUM_FILE_HDR_STRINGS;
+  hs->hdr_pos = 0;
+#endif /* LWIP_HTTPD_DYNAMIC_HEADERS */
+}
+
+#if LWIP_HTTPD_SSE
+/** Turn a connection that requested LWIP_HTTPD_SSE_URI into an event stream.
+ *
+ * @param pcb the tcp pcb of the connection
+ * @param hs connection state
+ * @return ERR_OK if the connection has been registered, ERR_MEM if all
+ *         LWIP_HTTPD_SSE_MAX_CLIENTS slots are taken
+ */
+static err_t
+http_sse_open(struct tcp_pcb *pcb, struct http_state *hs)
+{
+  int i;
+
+  for (i = 0; i < LWIP_HTTPD_SSE_MAX_CLIENTS; i++) {
+    if (http_sse_clients[i].hs == NULL) {
+      LWIP_DEBUGF(HTTPD_DEBUG, ("Event stream %d opened on %p\n", i, (void*)pcb));
+      http_sse_clients[i].pcb = pcb;
+      http_sse_clients[i].hs = hs;
+      hs->sse = 1;
+      hs->sse_resync = 1;
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+      hs->keepalive = 0;
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+      hs->hdrs[HDR_STRINGS_IDX_HTTP_STATUS] = HTTPD_HDR_SSE_STATUS;
+      hs->hdrs[HDR_STRINGS_IDX_SERVER_NAME] = g_psHTTPHeaderStrings[HTTP_HDR_SERVER];
+      hs->hdrs[HDR_STRINGS_IDX_CONTENT_ENCODING] = NULL;
+      hs->hdrs[HDR_STRINGS_IDX_VARY] = NULL;
+      hs->hdrs[HDR_STRINGS_IDX_CONTENT_LEN] = NULL;
+      hs->hdrs[HDR_STRINGS_IDX_CONNECTION] = NULL;
+      hs->hdrs[HDR_STRINGS_IDX_CONTENT_TYPE] = HTTPD_HDR_SSE_CONTENT_TYPE;
+      hs->hdr_pos = 0;
+      hs->hdr_index = 0;
+      /* Events are small and have to go out as soon as they are written. */
+      tcp_nagle_disable(pcb);
+      return ERR_OK;
+    }
+  }
+  LWIP_DEBUGF(HTTPD_DEBUG, ("Too many event streams\n"));
+  return ERR_MEM;
+}
+
+/** Remove a connection from the list of event streams. */
+static void
+http_sse_close(struct http_state *hs)
+{
+  int i;
+
+  for (i = 0; i < LWIP_HTTPD_SSE_MAX_CLIENTS; i++) {
+    if (http_sse_clients[i].hs == hs) {
+      http_sse_clients[i].hs = NULL;
+      http_sse_clients[i].pcb = NULL;
+    }
+  }
+}
+
+/** Send the current state to an event stream client that has not got it
+ * yet: a new client, or one that could not take a broadcast message.
+ *
+ * @param pcb the tcp pcb of the connection
+ * @param hs connection state
+ * @return 1 if data has been enqueued, 0 otherwise
+ */
+static u8_t
+http_sse_send_snapshot(struct tcp_pcb *pcb, struct http_state *hs)
+{
+  char msg[LWIP_HTTPD_SSE_MAX_MSG_LEN];
+  u16_t len;
+
+  if (!hs->sse_resync) {
+    return 0;
+  }
+  len = httpd_sse_snapshot(msg, sizeof(msg));
+  if (len == 0) {
+    hs->sse_resync = 0;
+    return 0;
+  }
+  /* A message is only ever sent as a whole; if it does not fit, try again
+     when more data has been acknowledged. */
+  if ((len > sizeof(msg)) || (tcp_sndbuf(pcb) < len) ||
+      (tcp_write(pcb, msg, len, TCP_WRITE_FLAG_COPY) != ERR_OK)) {
+    return 0;
+  }
+  hs->sse_resync = 0;
+  hs->sse_idle = 0;
+  return 1;
+}
+
+/**
+ * Send a message to all event stream clients. Must be called from the
+ * context lwIP runs in.
+ *
+ * A client that cannot take the message right away is sent the current state
+ * (see httpd_sse_snapshot()) as soon as it can instead, so clients never see
+ * partial messages and always end up with the latest state.
+ *
+ * @param data the message, formatted as a complete event ("data: ...\n\n")
+ * @param len length of the message
+ */
+void
+httpd_sse_broadcast(const char *data, u16_t len)
+{
+  int i;
+
+  for (i = 0; i < LWIP_HTTPD_SSE_MAX_CLIENTS; i++) {
+    struct http_state *hs = http_sse_clients[i].hs;
+    struct tcp_pcb *pcb = http_sse_clients[i].pcb;
+    u8_t sent;
+
+    if ((hs == NULL) || (hs->hdr_index < NUM_FILE_HDR_STRINGS)) {
+      /* Free slot, or still sending the headers (the state follows them) */
+      continue;
+    }
+    if (hs->sse_resync) {
+      sent = http_sse_send_snapshot(pcb, hs);
+    } else if ((tcp_sndbuf(pcb) >= len) &&
+               (tcp_write(pcb, data, len, TCP_WRITE_FLAG_COPY) == ERR_OK)) {
+      hs->sse_idle = 0;
+      sent = 1;
+    } else {
+      LWIP_DEBUGF(HTTPD_DEBUG, ("Event stream %d: message dropped\n", i));
+      hs->sse_resync = 1;
+      sent = 0;
+    }
+    if (sent) {
+      tcp_output(pcb);
+    }
+  }
+}
+#endif /* LWIP_HTTPD_SSE */
+
 /** Free a struct http_state.
  * Also frees the file data if dynamic.
  */
@@ -416,22 +958,22 @@ static void
 http_state_free(struct http_state *hs)
 {
   if (hs != NULL) {
-    if(hs->handle) {
-#if LWIP_HTTPD_TIMING
-      u32_t ms_needed = sys_now() - hs->time_started;
-      u32_t needed = LWIP_MAX(1, (ms_needed/100));
-      LWIP_DEBUGF(HTTPD_DEBUG_TIMING, ("httpd: needed %"U32_F" ms to send file of %d bytes -> %"U32_F" bytes/sec\n",
-        ms_needed, hs->handle->len, ((((u32_t)hs->handle->len) * 10) / needed)));
-#endif /* LWIP_HTTPD_TIMING */
-      fs_close(hs->handle);
-      hs->handle = NULL;
+    http_state_eof(hs);
+#if LWIP_HTTPD_SSE
+    if (hs->sse) {
+      http_sse_close(hs);
     }
-#if LWIP_HTTPD_SSI || LWIP_HTTPD_DYNAMIC_HEADERS
-    if (hs->buf != NULL) {
-      mem_free(hs->buf);
-      hs->buf = NULL;
+#endif /* LWIP_HTTPD_SSE */
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+    if (hs->next_req != NULL) {
+      pbuf_free(hs->next_req);
+      hs->next_req = NULL;
     }
-#endif /* LWIP_HTTPD_SSI || LWIP_HTTPD_DYNAMIC_HEADERS */
+    if (http_handling == hs) {
+      /* tell http_handle_request() that the connection is gone */
+      http_handling = NULL;
+    }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
 #if HTTPD_USE_MEM_POOL
     memp_free(MEMP_HTTPD_STATE, hs);
 #else /* HTTPD_USE_MEM_POOL */
@@ -474,6 +1016,13 @@ http_write(struct tcp_pcb *pcb, const void* ptr, u16_t *length, u8_t apiflags)
 
    if (err == ERR_OK) {
      LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("Sent %d bytes\n", len));
+#if LWIP_HTTPD_COPY_STATS
+     if (apiflags & TCP_WRITE_FLAG_COPY) {
+       httpd_bytes_copied += len;
+     } else {
+       httpd_bytes_zero_copy += len;
+     }
+#endif /* LWIP_HTTPD_COPY_STATS */
    } else {
      LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("Send failed with err %d (\"%s\")\n", err, lwip_strerr(err)));
    }
@@ -527,6 +1076,84 @@ http_close_conn(struct tcp_pcb *pcb, struct http_state *hs)
   }
   return err;
 }
+
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+/** Take the pipelined requests received while the last response was being
+ * sent, and open the receive window for the bytes that were queued.
+ *
+ * @return the requests or NULL if there are none
+ */
+static struct pbuf *
+http_take_next_req(struct tcp_pcb *pcb, struct http_state *hs)
+{
+  struct pbuf *p = hs->next_req;
+
+  hs->next_req = NULL;
+  if (hs->next_req_unrecved > 0) {
+    tcp_recved(pcb, hs->next_req_unrecved);
+    hs->next_req_unrecved = 0;
+  }
+  return p;
+}
+
+/** Queue data received while a response is being sent (pipelining) until
+ * that response is done. The bytes are only taken from the receive window
+ * when the requests are handled, so TCP flow control limits what a client
+ * can send ahead; beyond LWIP_HTTPD_NEXT_REQ_BUFSIZE bytes or
+ * LWIP_HTTPD_NEXT_REQ_QUEUELEN pbufs the data is refused.
+ *
+ * @return ERR_OK if the data was queued, ERR_MEM if it was refused
+ */
+static err_t
+http_queue_next_req(struct http_state *hs, struct pbuf *p)
+{
+  if (hs->next_req == NULL) {
+    hs->next_req = p;
+  } else {
+    if ((hs->next_req->tot_len + p->tot_len > LWIP_HTTPD_NEXT_REQ_BUFSIZE) ||
+        (pbuf_clen(hs->next_req) + pbuf_clen(p) > LWIP_HTTPD_NEXT_REQ_QUEUELEN)) {
+      LWIP_DEBUGF(HTTPD_DEBUG, ("http_recv: next request queue full\n"));
+      return ERR_MEM;
+    }
+    pbuf_cat(hs->next_req, p);
+  }
+  hs->next_req_unrecved += p->tot_len;
+  return ERR_OK;
+}
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
+/**
+ * The response has been sent completely. Close the connection or, if it is
+ * kept open, get ready for the next request and process it right away if it
+ * has already been received (pipelining). If the response ended within
+ * http_handle_request(), that picks the next request up itself.
+ *
+ * @param pcb the tcp pcb of the connection
+ * @param hs connection state
+ */
+static void
+http_eof(struct tcp_pcb *pcb, struct http_state *hs)
+{
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+  struct pbuf *p;
+
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+#if LWIP_HTTPD_RESPONSE_HOOK
+  httpd_response_sent();
+#endif /* LWIP_HTTPD_RESPONSE_HOOK */
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+  if (hs->keepalive) {
+    LWIP_DEBUGF(HTTPD_DEBUG, ("Keeping connection %p open\n", (void*)pcb));
+    http_state_eof(hs);
+    if ((hs->next_req != NULL) && (http_handling != hs)) {
+      p = http_take_next_req(pcb, hs);
+      http_handle_request(pcb, hs, p);
+    }
+    return;
+  }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+  http_close_conn(pcb, hs);
+}
 #if LWIP_HTTPD_CGI
 /**
  * Extract URI parameters from the parameter-part of an URI in the form
@@ -656,6 +1283,30 @@ get_tag_insert(struct http_state *hs)
 #endif /* LWIP_HTTPD_SSI */
 
 #if LWIP_HTTPD_DYNAMIC_HEADERS
+/**
+ * Build the Content-Length header for a response of the given length.
+ */
+static void
+get_http_content_len(struct http_state *pState, u32_t len)
+{
+  char digits[HTTP_HDR_CONTENT_LEN_DIGIT_MAX_LEN];
+  int num_digits = 0;
+  char *pszWork;
+
+  do {
+    digits[num_digits++] = (char)('0' + (len % 10));
+    len /= 10;
+  } while (len);
+
+  pszWork = pState->hdr_content_len;
+  MEMCPY(pszWork, HTTP_HDR_CONTENT_LEN, HTTP_HDR_CONTENT_LEN_LEN);
+  pszWork += HTTP_HDR_CONTENT_LEN_LEN;
+  while (num_digits) {
+    *pszWork++ = digits[--num_digits];
+  }
+  MEMCPY(pszWork, CRLF, 3);
+}
+
 /**
  * Generate the relevant HTTP headers for the given filename and write
  * them into the supplied buffer.
@@ -673,13 +1324,32 @@ get_http_headers(struct http_state *pState, char *pszURI)
 
   /* In all cases, the second header we send is the server identification
      so set it here. */
-  pState->hdrs[1] = g_psHTTPHeaderStrings[HTTP_HDR_SERVER];
+  pState->hdrs[HDR_STRINGS_IDX_SERVER_NAME] = g_psHTTPHeaderStrings[HTTP_HDR_SERVER];
+
+  /* Only pre-compressed files carry a content encoding and only files of
+     known length a content length. */
+  pState->hdrs[HDR_STRINGS_IDX_CONTENT_ENCODING] = NULL;
+  pState->hdrs[HDR_STRINGS_IDX_VARY] = NULL;
+  pState->hdrs[HDR_STRINGS_IDX_CONTENT_LEN] = NULL;
+  pState->hdrs[HDR_STRINGS_IDX_CONNECTION] = NULL;
+#if LWIP_HTTPD_SUPPORT_GZIP
+  if (pState->gzip) {
+    pState->hdrs[HDR_STRINGS_IDX_CONTENT_ENCODING] = HTTP_HDR_CONTENT_ENCODING_GZIP;
+  }
+  /* Both variants name the header that chose between them. */
+  if (pState->vary) {
+    pState->hdrs[HDR_STRINGS_IDX_VARY] = HTTP_HDR_VARY_ACCEPT_ENCODING;
+  }
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
 
   /* Is this a normal file or the special case we use to send back the
      default "404: Page not found" response? */
   if (pszURI == NULL) {
-    pState->hdrs[0] = g_psHTTPHeaderStrings[HTTP_HDR_NOT_FOUND];
-    pState->hdrs[2] = g_psHTTPHeaderStrings[DEFAULT_404_HTML];
+    pState->hdrs[HDR_STRINGS_IDX_HTTP_STATUS] = g_psHTTPHeaderStrings[HTTP_HDR_NOT_FOUND];
+    pState->hdrs[HDR_STRINGS_IDX_CONTENT_TYPE] = g_psHTTPHeaderStrings[DEFAULT_404_HTML];
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+    pState->keepalive = 0;
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
 
     /* Set up to send the first header string. */
     pState->hdr_index = 0;
@@ -691,13 +1361,13 @@ get_http_headers(struct http_state *pState, char *pszURI)
        indicative of a 404 server error whereas all other files require
        the 200 OK header. */
     if (strstr(pszURI, "404")) {
-      pState->hdrs[0] = g_psHTTPHeaderStrings[HTTP_HDR_NOT_FOUND];
+      pState->hdrs[HDR_STRINGS_IDX_HTTP_STATUS] = g_psHTTPHeaderStrings[HTTP_HDR_NOT_FOUND];
     } else if (strstr(pszURI, "400")) {
-      pState->hdrs[0] = g_psHTTPHeaderStrings[HTTP_HDR_BAD_REQUEST];
+      pState->hdrs[HDR_STRINGS_IDX_HTTP_STATUS] = g_psHTTPHeaderStrings[HTTP_HDR_BAD_REQUEST];
     } else if (strstr(pszURI, "501")) {
-      pState->hdrs[0] = g_psHTTPHeaderStrings[HTTP_HDR_NOT_IMPL];
+      pState->hdrs[HDR_STRINGS_IDX_HTTP_STATUS] = g_psHTTPHeaderStrings[HTTP_HDR_NOT_IMPL];
     } else {
-      pState->hdrs[0] = g_psHTTPHeaderStrings[HTTP_HDR_OK];
+      pState->hdrs[HDR_STRINGS_IDX_HTTP_STATUS] = g_psHTTPHeaderStrings[HTTP_HDR_OK];
     }
 
     /* Determine if the URI has any variables and, if so, temporarily remove
@@ -716,40 +1386,60 @@ get_http_headers(struct http_state *pState, char *pszURI)
       pszWork = strchr(pszExt, '.');
     }
 
-    /* Now determine the content type and add the relevant header for that. */
+    /* Now determine the content type and add the relevant header for that.
+       If there is no match, or if the URL passed has no file extension at
+       all (the special-case URLs used for control state notification), use
+       the default, plain text file type. */
+    pState->hdrs[HDR_STRINGS_IDX_CONTENT_TYPE] = g_psHTTPHeaderStrings[HTTP_HDR_DEFAULT_TYPE];
     for(iLoop = 0; (iLoop < NUM_HTTP_HEADERS) && pszExt; iLoop++) {
       /* Have we found a matching extension? */
       if(!strcmp(g_psHTTPHeaders[iLoop].extension, pszExt)) {
-        pState->hdrs[2] =
+        pState->hdrs[HDR_STRINGS_IDX_CONTENT_TYPE] =
           g_psHTTPHeaderStrings[g_psHTTPHeaders[iLoop].headerIndex];
         break;
       }
     }
 
+    /* The header table does not know JSON or PBM. */
+    if(pszExt && (iLoop == NUM_HTTP_HEADERS) && !strcmp(pszExt, "json")) {
+      pState->hdrs[HDR_STRINGS_IDX_CONTENT_TYPE] = HTTPD_HDR_JSON_CONTENT_TYPE;
+    }
+    else if(pszExt && (iLoop == NUM_HTTP_HEADERS) && !strcmp(pszExt, "pbm")) {
+      pState->hdrs[HDR_STRINGS_IDX_CONTENT_TYPE] = HTTPD_HDR_PBM_CONTENT_TYPE;
+    }
+
     /* Reinstate the parameter marker if there was one in the original URI. */
     if(pszVars) {
       *pszVars = '?';
     }
   }
 
-  /* Does the URL passed have any file extension?  If not, we assume it
-     is a special-case URL used for control state notification and we do
-     not send any HTTP headers with the response. */
-  if(!pszExt) {
-    /* Force the header index to a value indicating that all headers
-       have already been sent. */
-    pState->hdr_index = NUM_FILE_HDR_STRINGS;
-  } else {
-    /* Did we find a matching extension? */
-    if(iLoop == NUM_HTTP_HEADERS) {
-      /* No - use the default, plain text file type. */
-      pState->hdrs[2] = g_psHTTPHeaderStrings[HTTP_HDR_DEFAULT_TYPE];
+  /* The length of the response is known up front unless SSI tags are
+     replaced while it is sent. */
+  if((pState->handle != NULL)
+#if LWIP_HTTPD_SSI
+     && !pState->tag_check
+#endif /* LWIP_HTTPD_SSI */
+    ) {
+    get_http_content_len(pState, (u32_t)pState->handle->len);
+    pState->hdrs[HDR_STRINGS_IDX_CONTENT_LEN] = pState->hdr_content_len;
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+    /* Only successful responses keep the connection open. */
+    if(pState->keepalive &&
+       (pState->hdrs[HDR_STRINGS_IDX_HTTP_STATUS] == g_psHTTPHeaderStrings[HTTP_HDR_OK])) {
+      pState->hdrs[HDR_STRINGS_IDX_HTTP_STATUS] = HTTPD_HDR_OK_11;
+      pState->hdrs[HDR_STRINGS_IDX_CONNECTION] = HTTPD_HDR_CONN_KEEPALIVE;
+    } else {
+      pState->keepalive = 0;
     }
-
-    /* Set up to send the first header string. */
-    pState->hdr_index = 0;
-    pState->hdr_pos = 0;
+  } else {
+    pState->keepalive = 0;
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
   }
+
+  /* Set up to send the first header string. */
+  pState->hdr_index = 0;
+  pState->hdr_pos = 0;
 }
 #endif /* LWIP_HTTPD_DYNAMIC_HEADERS */
 
@@ -785,6 +1475,13 @@ http_send_data(struct tcp_pcb *pcb, struct http_state *hs)
     return 0;
   }
 
+#if LWIP_HTTPD_SSE
+  if (hs->sse && (hs->hdr_index == NUM_FILE_HDR_STRINGS)) {
+    /* An event stream never ends: only send the state if it is due. */
+    return http_sse_send_snapshot(pcb, hs);
+  }
+#endif /* LWIP_HTTPD_SSE */
+
   /* Assume no error until we find otherwise */
   err = ERR_OK;
 
@@ -797,6 +1494,11 @@ http_send_data(struct tcp_pcb *pcb, struct http_state *hs)
     while(len && (hs->hdr_index < NUM_FILE_HDR_STRINGS) && sendlen) {
       const void *ptr;
       u16_t old_sendlen;
+      /* Skip unused header slots. */
+      if (hs->hdrs[hs->hdr_index] == NULL) {
+        hs->hdr_index++;
+        continue;
+      }
       /* How much do we have to send from the current header? */
       hdrlen = (u16_t)strlen(hs->hdrs[hs->hdr_index]);
 
@@ -831,8 +1533,15 @@ http_send_data(struct tcp_pcb *pcb, struct http_state *hs)
     /* If we get here and there are still header bytes to send, we send
     * the header information we just wrote immediately.  If there are no
     * more headers to send, but we do have file data to send, drop through
-    * to try to send some file data too. */
-    if((hs->hdr_index < NUM_FILE_HDR_STRINGS) || !hs->file) {
+    * to try to send some file data too.  Files without data in memory are
+    * read through fs_read() below. */
+    if((hs->hdr_index < NUM_FILE_HDR_STRINGS) || (!hs->file && !hs->handle)) {
+#if LWIP_HTTPD_SSE
+      if (hs->sse && (hs->hdr_index == NUM_FILE_HDR_STRINGS)) {
+        /* Headers done: follow them with the current state. */
+        http_sse_send_snapshot(pcb, hs);
+      }
+#endif /* LWIP_HTTPD_SSE */
       LWIP_DEBUGF(HTTPD_DEBUG, ("tcp_output\n"));
       return 1;
     }
@@ -851,15 +1560,20 @@ http_send_data(struct tcp_pcb *pcb, struct http_state *hs)
 
     /* Do we have a valid file handle? */
     if (hs->handle == NULL) {
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+      if (hs->keepalive) {
+        /* No - a persistent connection waiting for the next request */
+        return 0;
+      }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
       /* No - close the connection. */
       http_close_conn(pcb, hs);
       return 0;
     }
     if (fs_bytes_left(hs->handle) <= 0) {
-      /* We reached the end of the file so this request is done.
-       * @todo: don't close here for HTTP/1.1? */
+      /* We reached the end of the file so this request is done. */
       LWIP_DEBUGF(HTTPD_DEBUG, ("End of file.\n"));
-      http_close_conn(pcb, hs);
+      http_eof(pcb, hs);
       return 0;
     }
 #if LWIP_HTTPD_SSI || LWIP_HTTPD_DYNAMIC_HEADERS
@@ -891,10 +1605,9 @@ http_send_data(struct tcp_pcb *pcb, struct http_state *hs)
 
     count = fs_read(hs->handle, hs->buf, count);
     if(count < 0) {
-      /* We reached the end of the file so this request is done.
-       * @todo: don't close here for HTTP/1.1? */
+      /* We reached the end of the file so this request is done. */
       LWIP_DEBUGF(HTTPD_DEBUG, ("End of file.\n"));
-      http_close_conn(pcb, hs);
+      http_eof(pcb, hs);
       return 1;
     }
 
@@ -1275,10 +1988,10 @@ http_send_data(struct tcp_pcb *pcb, struct http_state *hs)
 
   if((hs->left == 0) && (fs_bytes_left(hs->handle) <= 0)) {
     /* We reached the end of the file so this request is done.
-     * This adds the FIN flag right into the last data segment.
-     * @todo: don't close here for HTTP/1.1? */
+     * Unless the connection is kept open, this adds the FIN flag right into
+     * the last data segment. */
     LWIP_DEBUGF(HTTPD_DEBUG, ("End of file.\n"));
-    http_close_conn(pcb, hs);
+    http_eof(pcb, hs);
     return 0;
   }
   LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("send_data end.\n"));
@@ -1558,6 +2271,8 @@ void httpd_post_data_recved(void *connection, u16_t recved_len)
  * @param pcb the tcp_pcb which received this packet
  * @return ERR_OK if request was OK and hs has been initialized correctly
  *         ERR_INPROGRESS if request was OK so far but not fully received
+ *         ERR_ISCONN if the connection has been handed over to the WebSocket
+ *         server
  *         another err_t otherwise
  */
 static err_t
@@ -1585,6 +2300,13 @@ http_parse_request(struct pbuf **inp, struct http_state *hs, struct tcp_pcb *pcb
     return ERR_USE;
   }
 
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+  /* Close the connection after the response unless the request says
+     otherwise. */
+  hs->keepalive = 0;
+  hs->req_len = 0;
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
 #if LWIP_HTTPD_SUPPORT_REQUESTLIST
 
   LWIP_DEBUGF(HTTPD_DEBUG, ("Received %"U16_F" bytes\n", p->tot_len));
@@ -1626,6 +2348,26 @@ http_parse_request(struct pbuf **inp, struct http_state *hs, struct tcp_pcb *pcb
       char *sp1, *sp2;
       u16_t left_len, uri_len;
       LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("CRLF received, parsing request\n"));
+#if LWIP_HTTPD_SUPPORT_GZIP
+      {
+        const char *value;
+        u16_t value_len;
+        value = http_find_header(crlf + 2, data_len - (u16_t)((crlf + 2) - data),
+                                 "accept-encoding:", &value_len);
+        hs->accept_gzip = (value != NULL) && http_value_has(value, value_len, "gzip");
+      }
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+      {
+        /* The connection can only be kept open if we know where the request
+           ends, i.e. all of its headers have been received. */
+        const char *crlfcrlf = strnstr(data, CRLF CRLF, data_len);
+        if (crlfcrlf != NULL) {
+          hs->req_len = (u16_t)(crlfcrlf + 4 - data);
+          hs->keepalive = http_wants_keepalive(data, crlf, hs->req_len);
+        }
+      }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
       /* parse method */
       if (!strncmp(data, "GET ", 4)) {
         sp1 = data + 3;
@@ -1692,6 +2434,29 @@ http_parse_request(struct pbuf **inp, struct http_state *hs, struct tcp_pcb *pcb
         } else
 #endif /* LWIP_HTTPD_SUPPORT_POST */
         {
+#if LWIP_HTTPD_WEBSOCKET
+          if (!is_09 && !strcmp(uri, LWIP_HTTPD_WS_URI)) {
+            const char *headers = crlf + 2;
+            u16_t headers_len = data_len - (u16_t)(headers - data);
+            const char *value;
+            u16_t value_len;
+            value = http_find_header(headers, headers_len, "upgrade:", &value_len);
+            if ((value != NULL) && http_value_has(value, value_len, "websocket")) {
+              value = http_find_header(headers, headers_len, "sec-websocket-key:", &value_len);
+              if ((value != NULL) &&
+                  (httpd_websocket_open(pcb, value, value_len) == ERR_OK)) {
+                return ERR_ISCONN;
+              }
+              return http_find_error_file(hs, 400);
+            }
+          }
+#endif /* LWIP_HTTPD_WEBSOCKET */
+#if LWIP_HTTPD_SSE
+          if (!is_09 && !strcmp(uri, LWIP_HTTPD_SSE_URI) &&
+              (http_sse_open(pcb, hs) == ERR_OK)) {
+            return ERR_OK;
+          }
+#endif /* LWIP_HTTPD_SSE */
           return http_find_file(hs, uri, is_09);
         }
       } else {
@@ -1718,6 +2483,48 @@ badrequest:
   }
 }
 
+#if LWIP_HTTPD_SUPPORT_GZIP
+/** Open the pre-compressed variant of a file (the name with ".gz" appended)
+ * if the client accepts gzip content encoding. The variant is looked for
+ * either way: if it exists, the response depends on the Accept-Encoding
+ * header and says so with a Vary header, whichever variant is sent.
+ *
+ * @param hs http connection state
+ * @param name the name of the file, without parameters
+ * @param is_09 1 if the request is HTTP/0.9 (no HTTP headers in response)
+ * @return the opened variant or NULL if there is none or it cannot be used
+ */
+static struct fs_file *
+http_open_gzip(struct http_state *hs, const char *name, int is_09)
+{
+  char gz_name[LWIP_HTTPD_MAX_GZIP_NAME_LEN + 1];
+  size_t name_len;
+  struct fs_file *file;
+
+  /* HTTP/0.9 responses have no header to announce the encoding in */
+  if (is_09) {
+    return NULL;
+  }
+  name_len = strlen(name);
+  if (name_len + 3 > LWIP_HTTPD_MAX_GZIP_NAME_LEN) {
+    return NULL;
+  }
+  MEMCPY(gz_name, name, name_len);
+  MEMCPY(gz_name + name_len, ".gz", 4);
+  file = fs_open(gz_name);
+  if (file != NULL) {
+    hs->vary = 1;
+    if (!hs->accept_gzip) {
+      fs_close(file);
+      return NULL;
+    }
+    LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("Opened %s\n", gz_name));
+    hs->gzip = 1;
+  }
+  return file;
+}
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
+
 /** Try to find the file specified by uri and, if found, initialize hs
  * accordingly.
  *
@@ -1745,6 +2552,10 @@ http_find_file(struct http_state *hs, const char *uri, int is_09)
    */
   hs->tag_check = false;
 #endif /* LWIP_HTTPD_SSI */
+#if LWIP_HTTPD_SUPPORT_GZIP
+  hs->gzip = 0;
+  hs->vary = 0;
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
 
   /* Have we been asked for the default root file? */
   if((uri[0] == '/') &&  (uri[1] == 0)) {
@@ -1752,7 +2563,16 @@ http_find_file(struct http_state *hs, const char *uri, int is_09)
        that exists. */
     for (loop = 0; loop < NUM_DEFAULT_FILENAMES; loop++) {
       LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("Looking for %s...\n", g_psDefaultFilenames[loop].name));
-      file = fs_open((char *)g_psDefaultFilenames[loop].name);
+      file = NULL;
+#if LWIP_HTTPD_SUPPORT_GZIP
+      /* SSI files must be parsed, so they are never sent compressed */
+      if (!g_psDefaultFilenames[loop].shtml) {
+        file = http_open_gzip(hs, g_psDefaultFilenames[loop].name, is_09);
+      }
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
+      if (file == NULL) {
+        file = fs_open((char *)g_psDefaultFilenames[loop].name);
+      }
       uri = (char *)g_psDefaultFilenames[loop].name;
       if(file != NULL) {
         LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("Opened.\n"));
@@ -1799,7 +2619,22 @@ http_find_file(struct http_state *hs, const char *uri, int is_09)
 
     LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("Opening %s\n", uri));
 
-    file = fs_open(uri);
+    file = NULL;
+#if LWIP_HTTPD_SUPPORT_GZIP
+    file = http_open_gzip(hs, uri, is_09);
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
+    if (file == NULL) {
+      /* Hand the parameters to the file system as well, so that dynamic
+         files can use them. The base URI is only needed on its own again
+         below. */
+      if (params != NULL) {
+        params[-1] = '?';
+      }
+      file = fs_open(uri);
+      if (params != NULL) {
+        params[-1] = '\0';
+      }
+    }
     if (file == NULL) {
       file = http_get_404_file(&uri);
     }
@@ -1841,13 +2676,15 @@ http_init_file(struct http_state *hs, struct fs_file *file, int is_09, const cha
     hs->tag_index = 0;
     hs->tag_state = TAG_NONE;
     hs->parsed = file->data;
-    hs->parse_left = file->len;
+    hs->parse_left = (file->data != NULL) ? file->len : 0;
     hs->tag_end = file->data;
 #endif /* LWIP_HTTPD_SSI */
     hs->handle = file;
     hs->file = (char*)file->data;
     LWIP_ASSERT("File length must be positive!", (file->len >= 0));
-    hs->left = file->len;
+    /* A file without data in memory is generated by the file system while
+       it is sent: start with nothing left so that it is read by fs_read(). */
+    hs->left = (file->data != NULL) ? file->len : 0;
     hs->retries = 0;
 #if LWIP_HTTPD_TIMING
     hs->time_started = sys_now();
@@ -1955,6 +2792,31 @@ http_poll(void *arg, struct tcp_pcb *pcb)
     return ERR_OK;
   } else {
     hs->retries++;
+#if LWIP_HTTPD_SSE
+    if (hs->sse) {
+      /* Event streams stay open until the client goes away. Send the state
+       * if a message has been dropped, or a comment line if nothing has been
+       * sent since the last poll so that a dead client is noticed. */
+      hs->retries = 0;
+      if (!http_send_data(pcb, hs) && hs->sse_idle &&
+          (hs->hdr_index == NUM_FILE_HDR_STRINGS) && !hs->sse_resync) {
+        tcp_write(pcb, HTTPD_SSE_HEARTBEAT, sizeof(HTTPD_SSE_HEARTBEAT) - 1, 0);
+      }
+      hs->sse_idle = 1;
+      tcp_output(pcb);
+      return ERR_OK;
+    }
+#endif /* LWIP_HTTPD_SSE */
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+    if ((hs->handle == NULL) && hs->keepalive) {
+      /* A persistent connection waiting for its next request */
+      if (hs->retries >= HTTPD_KEEPALIVE_MAX_IDLE) {
+        LWIP_DEBUGF(HTTPD_DEBUG, ("http_poll: idle for too long, close\n"));
+        http_close_conn(pcb, hs);
+      }
+      return ERR_OK;
+    }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
     if (hs->retries == HTTPD_MAX_RETRIES) {
       LWIP_DEBUGF(HTTPD_DEBUG, ("http_poll: too many retries, close\n"));
       http_close_conn(pcb, hs);
@@ -1977,6 +2839,98 @@ http_poll(void *arg, struct tcp_pcb *pcb)
   return ERR_OK;
 }
 
+/**
+ * Parse a request received on the connection and start sending the response.
+ * On a persistent connection, requests received after it (pipelining) are
+ * served in turn for as long as their responses are sent completely here;
+ * the next one is left in hs->next_req for http_eof() otherwise.
+ *
+ * @param pcb the tcp pcb of the connection
+ * @param hs connection state
+ * @param p the received data, freed or kept by this function
+ */
+static void
+http_handle_request(struct tcp_pcb *pcb, struct http_state *hs, struct pbuf *p)
+{
+  err_t parsed;
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+  struct http_state *outer = http_handling;
+
+  http_handling = hs;
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
+  while (p != NULL) {
+    parsed = ERR_ABRT;
+    if (hs->handle == NULL) {
+#if !LWIP_HTTPD_SUPPORT_REQUESTLIST
+      p = http_pbuf_contiguous(p);
+#endif /* !LWIP_HTTPD_SUPPORT_REQUESTLIST */
+      parsed = http_parse_request(&p, hs, pcb);
+      LWIP_ASSERT("http_parse_request: unexpected return value", parsed == ERR_OK
+        || parsed == ERR_INPROGRESS ||parsed == ERR_ARG || parsed == ERR_USE
+        || parsed == ERR_ISCONN);
+    } else {
+      LWIP_DEBUGF(HTTPD_DEBUG, ("http_recv: already sending data\n"));
+    }
+#if LWIP_HTTPD_SUPPORT_REQUESTLIST
+    if (parsed != ERR_INPROGRESS) {
+      /* request fully parsed or error */
+      if (hs->req != NULL) {
+        pbuf_free(hs->req);
+        hs->req = NULL;
+      }
+    }
+#else /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+    if ((parsed == ERR_OK) && hs->keepalive && (p != NULL)) {
+      /* Anything following the request is the next one (pipelining): keep
+       * it until the response to this one has been sent. */
+      hs->next_req = http_pbuf_drop(p, hs->req_len);
+      p = NULL;
+    }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+    if (p != NULL) {
+      /* pbuf not passed to application, free it now */
+      pbuf_free(p);
+    }
+#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+    p = NULL;
+    if (parsed == ERR_OK) {
+#if LWIP_HTTPD_SUPPORT_POST
+      if (hs->post_content_len_left == 0)
+#endif /* LWIP_HTTPD_SUPPORT_POST */
+      {
+        LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("http_recv: data %p len %"S32_F"\n", hs->file, hs->left));
+        http_send_data(pcb, hs);
+      }
+    } else if (parsed == ERR_ARG) {
+      /* @todo: close on ERR_USE? */
+      http_close_conn(pcb, hs);
+#if LWIP_HTTPD_WEBSOCKET
+    } else if (parsed == ERR_ISCONN) {
+      /* The connection now belongs to the WebSocket server, which has
+         installed its own callbacks: only the state is left to free. */
+      http_state_free(hs);
+#endif /* LWIP_HTTPD_WEBSOCKET */
+    }
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+    if (http_handling != hs) {
+      /* the connection has been closed and hs freed */
+      break;
+    }
+    if (hs->keepalive && (hs->handle == NULL) && (hs->file == NULL)) {
+      /* The response has been sent completely: go on with the next
+         request, if it has been received already. */
+      p = http_take_next_req(pcb, hs);
+    }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+  }
+
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+  http_handling = outer;
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+}
+
 /**
  * Data has been received on this pcb.
  * For HTTP 1.0, this should normally only happen once (if the request fits in one packet).
@@ -1984,7 +2938,6 @@ http_poll(void *arg, struct tcp_pcb *pcb)
 static err_t
 http_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
 {
-  err_t parsed = ERR_ABRT;
   struct http_state *hs = (struct http_state *)arg;
   LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("http_recv: pcb=%p pbuf=%p err=%s\n", (void*)pcb,
     (void*)p, lwip_strerr(err)));
@@ -2004,6 +2957,23 @@ http_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
     return ERR_OK;
   }
 
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+  if ((hs->handle != NULL) && hs->keepalive
+#if LWIP_HTTPD_SUPPORT_POST
+      && (hs->post_content_len_left == 0)
+#endif /* LWIP_HTTPD_SUPPORT_POST */
+#if LWIP_HTTPD_SSE
+      && !hs->sse
+#endif /* LWIP_HTTPD_SSE */
+      ) {
+    /* A pipelined request arrived while the response to the previous one
+     * is still being sent: keep it until that one is done, without taking
+     * it from the receive window yet. */
+    LWIP_DEBUGF(HTTPD_DEBUG, ("http_recv: queueing next request\n"));
+    return http_queue_next_req(hs, p);
+  }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
 #if LWIP_HTTPD_SUPPORT_POST && LWIP_HTTPD_POST_MANUAL_WND
   if (hs->no_auto_wnd) {
      hs->unrecved_bytes += p->tot_len;
@@ -2029,39 +2999,14 @@ http_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
   } else
 #endif /* LWIP_HTTPD_SUPPORT_POST */
   {
-    if (hs->handle == NULL) {
-      parsed = http_parse_request(&p, hs, pcb);
-      LWIP_ASSERT("http_parse_request: unexpected return value", parsed == ERR_OK
-        || parsed == ERR_INPROGRESS ||parsed == ERR_ARG || parsed == ERR_USE);
-    } else {
-      LWIP_DEBUGF(HTTPD_DEBUG, ("http_recv: already sending data\n"));
-    }
-#if LWIP_HTTPD_SUPPORT_REQUESTLIST
-    if (parsed != ERR_INPROGRESS) {
-      /* request fully parsed or error */
-      if (hs->req != NULL) {
-        pbuf_free(hs->req);
-        hs->req = NULL;
-      }
-    }
-#else /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
-    if (p != NULL) {
-      /* pbuf not passed to application, free it now */
+#if LWIP_HTTPD_SSE
+    if (hs->sse) {
+      /* Nothing is expected from an event stream client. */
       pbuf_free(p);
+      return ERR_OK;
     }
-#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
-    if (parsed == ERR_OK) {
-#if LWIP_HTTPD_SUPPORT_POST
-      if (hs->post_content_len_left == 0)
-#endif /* LWIP_HTTPD_SUPPORT_POST */
-      {
-        LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("http_recv: data %p len %"S32_F"\n", hs->file, hs->left));
-        http_send_data(pcb, hs);
-      }
-    } else if (parsed == ERR_ARG) {
-      /* @todo: close on ERR_USE? */
-      http_close_conn(pcb, hs);
-    }
+#endif /* LWIP_HTTPD_SSE */
+    http_handle_request(pcb, hs, p);
   }
   return ERR_OK;
 }
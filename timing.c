@@ -0,0 +1,208 @@
+//*****************************************************************************
+//
+// timing.c - Cycle-accurate timing measurements based on the DWT cycle
+//            counter.
+//
+// Durations and intervals are collected into tTimingStats, usually from an
+// interrupt handler, and read and cleared with TimingStatsTake() from a task.
+// Durations may also be collected into a tTimingHistogram, which is never
+// cleared, so that readers can compare copies taken at different times.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_types.h"
+#include "driverlib/interrupt.h"
+#include "timing.h"
+
+//*****************************************************************************
+//
+// The registers that enable the cycle counter.
+//
+//*****************************************************************************
+#define TIMING_DEMCR            0xE000EDFC  // Debug Exception and Monitor Ctl
+#define TIMING_DEMCR_TRCENA     0x01000000  // Enable the DWT unit
+#define TIMING_DWT_CTRL         0xE0001000  // DWT Control
+#define TIMING_DWT_CTRL_CYCCNTENA                                             \
+                                0x00000001  // Enable the cycle counter
+
+//*****************************************************************************
+//
+// The system clock frequency.
+//
+//*****************************************************************************
+extern uint32_t g_ui32SysClock;
+
+//*****************************************************************************
+//
+//! Starts the cycle counter.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TimingInit(void)
+{
+    HWREG(TIMING_DEMCR) |= TIMING_DEMCR_TRCENA;
+    HWREG(TIMING_DWT_CYCCNT) = 0;
+    HWREG(TIMING_DWT_CTRL) |= TIMING_DWT_CTRL_CYCCNTENA;
+}
+
+//*****************************************************************************
+//
+//! Adds a measurement to a set of statistics.
+//!
+//! \param psStats is the set of statistics.
+//! \param ui32Cycles is the measured duration, in cycles.
+//!
+//! This function must not be interrupted by another update of the same
+//! statistics, which is the case when it is only called from one interrupt
+//! handler.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TimingStatsAdd(tTimingStats *psStats, uint32_t ui32Cycles)
+{
+    if((psStats->ui32Count == 0) || (ui32Cycles < psStats->ui32Min))
+    {
+        psStats->ui32Min = ui32Cycles;
+    }
+    if(ui32Cycles > psStats->ui32Max)
+    {
+        psStats->ui32Max = ui32Cycles;
+    }
+    psStats->ui64Total += ui32Cycles;
+    psStats->ui32Count++;
+}
+
+//*****************************************************************************
+//
+//! Reads and clears a set of statistics.
+//!
+//! \param psStats is the set of statistics.
+//! \param psCopy receives the statistics collected since the last call.
+//!
+//! Interrupts are disabled while the statistics are copied, so that an
+//! interrupt handler updating them does not leave them half updated.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TimingStatsTake(tTimingStats *psStats, tTimingStats *psCopy)
+{
+    bool bIntsOff;
+
+    bIntsOff = IntMasterDisable();
+
+    *psCopy = *psStats;
+    psStats->ui32Count = 0;
+    psStats->ui32Min = 0;
+    psStats->ui32Max = 0;
+    psStats->ui64Total = 0;
+
+    if(!bIntsOff)
+    {
+        IntMasterEnable();
+    }
+}
+
+//*****************************************************************************
+//
+//! Adds the interval since the previous event to a set of statistics.
+//!
+//! \param psInterval is the set of statistics.
+//! \param ui32Now is the time of the event, as read with TimingNow().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TimingIntervalAdd(tTimingInterval *psInterval, uint32_t ui32Now)
+{
+    if(psInterval->bStarted)
+    {
+        TimingStatsAdd(&psInterval->sStats, ui32Now - psInterval->ui32Last);
+    }
+
+    psInterval->ui32Last = ui32Now;
+    psInterval->bStarted = true;
+}
+
+//*****************************************************************************
+//
+//! Converts a number of cycles to microseconds.
+//!
+//! \param ui32Cycles is the number of cycles.
+//!
+//! \return The number of microseconds, rounded down.
+//
+//*****************************************************************************
+uint32_t
+TimingCyclesToUs(uint32_t ui32Cycles)
+{
+    return(ui32Cycles / (g_ui32SysClock / 1000000));
+}
+
+//*****************************************************************************
+//
+//! Adds a measurement to a histogram.
+//!
+//! \param psHistogram is the histogram.
+//! \param ui32Cycles is the measured duration, in cycles.
+//!
+//! Like TimingStatsAdd(), this function must not be interrupted by another
+//! update of the same histogram.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TimingHistogramAdd(tTimingHistogram *psHistogram, uint32_t ui32Cycles)
+{
+    uint32_t ui32Us, ui32Bin;
+
+    ui32Us = TimingCyclesToUs(ui32Cycles);
+
+    for(ui32Bin = 0; (ui32Bin < (TIMING_HISTOGRAM_BINS - 1)) &&
+                     (ui32Us >= TimingHistogramBinUs(ui32Bin + 1)); ui32Bin++)
+    {
+    }
+
+    psHistogram->pui32Bins[ui32Bin]++;
+    psHistogram->ui64TotalUs += ui32Us;
+    if(ui32Us > psHistogram->ui32MaxUs)
+    {
+        psHistogram->ui32MaxUs = ui32Us;
+    }
+}
+
+//*****************************************************************************
+//
+//! Reads a histogram.
+//!
+//! \param psHistogram is the histogram.
+//! \param psCopy receives a copy of it.
+//!
+//! Interrupts are disabled while the histogram is copied, so that the copy
+//! is not taken half way through an update.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TimingHistogramGet(tTimingHistogram *psHistogram, tTimingHistogram *psCopy)
+{
+    bool bIntsOff;
+
+    bIntsOff = IntMasterDisable();
+
+    *psCopy = *psHistogram;
+
+    if(!bIntsOff)
+    {
+        IntMasterEnable();
+    }
+}
@@ -0,0 +1,96 @@
+//*****************************************************************************
+//
+// timing.h - Prototypes for the cycle-accurate timing measurements.
+//
+//*****************************************************************************
+
+#ifndef __TIMING_H__
+#define __TIMING_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The cycle counter of the Data Watchpoint and Trace unit.  It counts system
+// clock cycles once TimingInit() has been called and wraps every 2^32 cycles
+// (about 36 s at 120 MHz), which differences of uint32_t values absorb.
+//
+//*****************************************************************************
+#define TIMING_DWT_CYCCNT       0xE0001004
+
+#define TimingNow()             (HWREG(TIMING_DWT_CYCCNT))
+
+//*****************************************************************************
+//
+// Statistics of a measured duration, in cycles.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Count;
+    uint32_t ui32Min;
+    uint32_t ui32Max;
+    uint64_t ui64Total;
+}
+tTimingStats;
+
+//*****************************************************************************
+//
+// Statistics of the intervals between successive events, in cycles.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The time of the last event, valid if bStarted is true.
+    //
+    uint32_t ui32Last;
+    bool bStarted;
+
+    tTimingStats sStats;
+}
+tTimingInterval;
+
+//*****************************************************************************
+//
+// A histogram of durations in microseconds, in bins of powers of two: bin 0
+// counts durations under 1 us, bin n those from 2^(n - 1) us up to 2^n us,
+// and the last bin everything from 2^(TIMING_HISTOGRAM_BINS - 2) us up.
+//
+//*****************************************************************************
+#define TIMING_HISTOGRAM_BINS   16
+
+#define TimingHistogramBinUs(ui32Bin)                                         \
+                                ((ui32Bin) ? (1u << ((ui32Bin) - 1)) : 0u)
+
+typedef struct
+{
+    uint64_t ui64TotalUs;
+    uint32_t ui32MaxUs;
+    uint32_t pui32Bins[TIMING_HISTOGRAM_BINS];
+}
+tTimingHistogram;
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.
+//
+//*****************************************************************************
+extern void TimingInit(void);
+extern void TimingStatsAdd(tTimingStats *psStats, uint32_t ui32Cycles);
+extern void TimingStatsTake(tTimingStats *psStats, tTimingStats *psCopy);
+extern void TimingIntervalAdd(tTimingInterval *psInterval, uint32_t ui32Now);
+extern uint32_t TimingCyclesToUs(uint32_t ui32Cycles);
+extern void TimingHistogramAdd(tTimingHistogram *psHistogram,
+                               uint32_t ui32Cycles);
+extern void TimingHistogramGet(tTimingHistogram *psHistogram,
+                               tTimingHistogram *psCopy);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __TIMING_H__
@@ -0,0 +1,730 @@
+//*****************************************************************************
+//
+// analog_test.c - Host test of the sampling of the speed potentiometer
+// (analog.c).
+//
+// This is not part of the firmware.  Build and run it on the host with:
+//
+//     cc -O2 -I. -IFreeRTOS/include tools/analog_test.c -lm -o analog_test &&
+//         ./analog_test
+//
+// The engine is compiled unchanged against a model of ADC0 and Timer 0
+// driven by a fake clock that counts microseconds.  Every millisecond the
+// timer triggers sequencer 0, which takes its eight steps of sixteen
+// conversions each, one conversion a microsecond, and averages each step in
+// hardware.  A conversion is the input at that moment with some noise,
+// rounded to 12 bits.  The steps go into the eight-deep FIFO, which
+// overflows if the interrupt handler has not emptied it by the next trigger,
+// and the interrupt is delivered at the end of the sequence unless it is
+// held off.  The task takes the blocks as it is notified of them, unless
+// the test holds it off too.
+//
+// The test checks that a steady input reads exactly, that noise and 50 Hz
+// hum on it are averaged out, how soon a step in it is followed, that the
+// speed in percent neither skips nor flickers, and that blocks the task
+// misses and samples lost to a late interrupt are counted.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+//*****************************************************************************
+//
+// The system clock, the microseconds a conversion takes and the FIFO depth
+// of sequencer 0.
+//
+//*****************************************************************************
+#define SYS_CLOCK               120000000
+#define CONVERSION_US           1
+#define FIFO_DEPTH              8
+#define PI                      3.14159265358979
+
+uint32_t g_ui32SysClock = SYS_CLOCK;
+
+//*****************************************************************************
+//
+// The model of ADC0 and Timer 0.  The FIFO holds ui32Count samples from
+// ui32Head on; bOverflow is the OV0 bit of the overflow status, which the
+// handler clears by writing a 1 to it.
+//
+//*****************************************************************************
+static struct
+{
+    uint32_t ui32CC;
+    uint32_t ui32PC;
+    uint32_t ui32ACTSS;
+    uint32_t ui32EMUX;
+    uint32_t ui32SSMUX0;
+    uint32_t ui32SSEMUX0;
+    uint32_t ui32SSCTL0;
+    uint32_t ui32SAC;
+    uint32_t ui32IM;
+    uint32_t ui32ISC;
+    uint32_t ui32OSTAT;
+    uint32_t ui32RCGCADC;
+    uint32_t ui32TimerCTL;
+    uint32_t ui32TimerCFG;
+    uint32_t ui32TimerTAMR;
+    uint32_t ui32TimerTAILR;
+    uint32_t ui32TimerADCEV;
+    uint32_t ui32RCGCTimer;
+    uint32_t pui32FIFO[FIFO_DEPTH];
+    uint32_t ui32Head;
+    uint32_t ui32Count;
+    bool bOverflow;
+}
+g_sADC;
+
+static volatile uint32_t *ADCOverflowStatus(void);
+static uint32_t ADCFIFOStatus(void);
+static uint32_t ADCFIFORead(void);
+
+#include "tm4c1294ncpdt.h"
+
+#undef ADC0_CC_R
+#undef ADC0_PC_R
+#undef ADC0_ACTSS_R
+#undef ADC0_EMUX_R
+#undef ADC0_SSMUX0_R
+#undef ADC0_SSEMUX0_R
+#undef ADC0_SSCTL0_R
+#undef ADC0_SAC_R
+#undef ADC0_IM_R
+#undef ADC0_ISC_R
+#undef ADC0_OSTAT_R
+#undef ADC0_SSFSTAT0_R
+#undef ADC0_SSFIFO0_R
+#undef SYSCTL_RCGCADC_R
+#undef SYSCTL_PRADC_R
+#undef TIMER0_CTL_R
+#undef TIMER0_CFG_R
+#undef TIMER0_TAMR_R
+#undef TIMER0_TAILR_R
+#undef TIMER0_ADCEV_R
+#undef SYSCTL_RCGCTIMER_R
+#undef SYSCTL_PRTIMER_R
+#define ADC0_CC_R               (g_sADC.ui32CC)
+#define ADC0_PC_R               (g_sADC.ui32PC)
+#define ADC0_ACTSS_R            (g_sADC.ui32ACTSS)
+#define ADC0_EMUX_R             (g_sADC.ui32EMUX)
+#define ADC0_SSMUX0_R           (g_sADC.ui32SSMUX0)
+#define ADC0_SSEMUX0_R          (g_sADC.ui32SSEMUX0)
+#define ADC0_SSCTL0_R           (g_sADC.ui32SSCTL0)
+#define ADC0_SAC_R              (g_sADC.ui32SAC)
+#define ADC0_IM_R               (g_sADC.ui32IM)
+#define ADC0_ISC_R              (g_sADC.ui32ISC)
+#define ADC0_OSTAT_R            (*ADCOverflowStatus())
+#define ADC0_SSFSTAT0_R         (ADCFIFOStatus())
+#define ADC0_SSFIFO0_R          (ADCFIFORead())
+#define SYSCTL_RCGCADC_R        (g_sADC.ui32RCGCADC)
+#define SYSCTL_PRADC_R          (g_sADC.ui32RCGCADC)
+#define TIMER0_CTL_R            (g_sADC.ui32TimerCTL)
+#define TIMER0_CFG_R            (g_sADC.ui32TimerCFG)
+#define TIMER0_TAMR_R           (g_sADC.ui32TimerTAMR)
+#define TIMER0_TAILR_R          (g_sADC.ui32TimerTAILR)
+#define TIMER0_ADCEV_R          (g_sADC.ui32TimerADCEV)
+#define SYSCTL_RCGCTIMER_R      (g_sADC.ui32RCGCTimer)
+#define SYSCTL_PRTIMER_R        (g_sADC.ui32RCGCTimer)
+
+//*****************************************************************************
+//
+// A stand-in for the parts of FreeRTOS used by analog.c, which counts the
+// notifications given to the task.
+//
+//*****************************************************************************
+#define INC_FREERTOS_H
+#define INC_TASK_H
+
+typedef long BaseType_t;
+typedef void *TaskHandle_t;
+
+#define pdFALSE                 0
+#define pdTRUE                  1
+
+static uint32_t g_ui32Notified;
+
+static void
+vTaskNotifyGiveFromISR(TaskHandle_t hTask, BaseType_t *pxWoken)
+{
+    g_ui32Notified++;
+    *pxWoken = pdTRUE;
+}
+
+#define portYIELD_FROM_ISR(x)   ((void)(x))
+
+#include "filter.c"
+#include "analog.c"
+
+//*****************************************************************************
+//
+// The input, in LSBs of the ADC: a level, a ramp of so many LSBs a second
+// from it, a sine of some amplitude and frequency, and random noise of some
+// standard deviation on every conversion.
+//
+//*****************************************************************************
+static struct
+{
+    double dLevel;
+    double dRamp;
+    double dHumAmplitude;
+    double dHumHz;
+    double dHumPhase;
+    double dNoise;
+    uint64_t ui64RampStart;
+}
+g_sInput;
+
+//*****************************************************************************
+//
+// The fake clock, in microseconds, the time the interrupt is held off to,
+// whether the task takes the blocks it is notified of, and the failures.
+//
+//*****************************************************************************
+static uint64_t g_ui64Now;
+static uint64_t g_ui64HeldOff;
+static bool g_bTaskAsleep;
+static uint32_t g_ui32TaskTaken;
+static uint32_t g_ui32Failures;
+
+//*****************************************************************************
+//
+// The model of the overflow status.  The handler reads it and writes it
+// through the same pointer, so it is handed a copy marked with a bit the
+// register does not have; a copy that comes back without the mark was
+// written, and the bits written as 1 are cleared.
+//
+//*****************************************************************************
+#define OSTAT_MARK              0x80000000
+
+static volatile uint32_t *
+ADCOverflowStatus(void)
+{
+    if(!(g_sADC.ui32OSTAT & OSTAT_MARK) && (g_sADC.ui32OSTAT & ADC_OSTAT_OV0))
+    {
+        g_sADC.bOverflow = false;
+    }
+
+    g_sADC.ui32OSTAT = OSTAT_MARK | (g_sADC.bOverflow ? ADC_OSTAT_OV0 : 0);
+
+    return(&g_sADC.ui32OSTAT);
+}
+
+static uint32_t
+ADCFIFOStatus(void)
+{
+    return(g_sADC.ui32Count ? 0 : ADC_SSFSTAT0_EMPTY);
+}
+
+static uint32_t
+ADCFIFORead(void)
+{
+    uint32_t ui32Sample;
+
+    if(!g_sADC.ui32Count)
+    {
+        return(0);
+    }
+
+    ui32Sample = g_sADC.pui32FIFO[g_sADC.ui32Head];
+    g_sADC.ui32Head = (g_sADC.ui32Head + 1) % FIFO_DEPTH;
+    g_sADC.ui32Count--;
+
+    return(ui32Sample);
+}
+
+//*****************************************************************************
+//
+// Check the outcome of a test.
+//
+//*****************************************************************************
+static void
+Check(const char *pcTest, bool bPass)
+{
+    printf("%-56s %s\n", pcTest, bPass ? "ok" : "FAILED");
+    if(!bPass)
+    {
+        g_ui32Failures++;
+    }
+}
+
+//
+// A normally distributed random number.
+//
+static double
+Gaussian(void)
+{
+    double dU, dV;
+
+    dU = (rand() + 1.0) / (RAND_MAX + 2.0);
+    dV = (rand() + 1.0) / (RAND_MAX + 2.0);
+
+    return(sqrt(-2.0 * log(dU)) * cos(2.0 * PI * dV));
+}
+
+//
+// The input at a time, without the noise.
+//
+static double
+Input(uint64_t ui64Us)
+{
+    return(g_sInput.dLevel +
+           (g_sInput.dRamp * (double)(ui64Us - g_sInput.ui64RampStart) /
+            1e6) +
+           (g_sInput.dHumAmplitude *
+            sin((2.0 * PI * g_sInput.dHumHz * ui64Us / 1e6) +
+                g_sInput.dHumPhase)));
+}
+
+//
+// One conversion at a time.
+//
+static uint32_t
+Convert(uint64_t ui64Us)
+{
+    double dValue;
+
+    dValue = floor(Input(ui64Us) + (g_sInput.dNoise * Gaussian()) + 0.5);
+    if(dValue < 0)
+    {
+        return(0);
+    }
+    if(dValue > 4095)
+    {
+        return(4095);
+    }
+
+    return((uint32_t)dValue);
+}
+
+//
+// The interrupt, delivered if it is pending, enabled and not held off.
+//
+static void
+Interrupt(void)
+{
+    if(!(g_sADC.ui32IM & ADC_IM_MASK0) || (g_ui64Now < g_ui64HeldOff) ||
+       !g_sADC.ui32Count)
+    {
+        return;
+    }
+
+    Analog_IntHandler();
+}
+
+//
+// Runs the model for a number of milliseconds, starting at a trigger.
+// Each millisecond the sequencer takes its steps, the interrupt handler
+// empties it and the task takes any block it was notified of.
+//
+static void
+Run(uint32_t ui32Ms, void (*pfnEachMs)(void))
+{
+    uint32_t ui32Ms0, ui32Step, ui32Conv, ui32Sum, ui32Notified;
+
+    for(ui32Ms0 = 0; ui32Ms0 < ui32Ms; ui32Ms0++)
+    {
+        //
+        // A held-off interrupt is taken before the next trigger if it is
+        // let go by then.
+        //
+        g_ui64Now += 1000 - (FIFO_DEPTH * 16 * CONVERSION_US);
+        Interrupt();
+
+        for(ui32Step = 0; ui32Step < FIFO_DEPTH; ui32Step++)
+        {
+            ui32Sum = 0;
+            for(ui32Conv = 0; ui32Conv < 16; ui32Conv++)
+            {
+                ui32Sum += Convert(g_ui64Now);
+                g_ui64Now += CONVERSION_US;
+            }
+
+            if(g_sADC.ui32Count == FIFO_DEPTH)
+            {
+                g_sADC.bOverflow = true;
+            }
+            else
+            {
+                g_sADC.pui32FIFO[(g_sADC.ui32Head + g_sADC.ui32Count) %
+                                 FIFO_DEPTH] = ui32Sum / 16;
+                g_sADC.ui32Count++;
+            }
+        }
+
+        ui32Notified = g_ui32Notified;
+        Interrupt();
+        if(!g_bTaskAsleep && (g_ui32Notified != ui32Notified))
+        {
+            while(Analog_Process())
+            {
+                g_ui32TaskTaken++;
+            }
+        }
+
+        if(pfnEachMs)
+        {
+            pfnEachMs();
+        }
+    }
+}
+
+//
+// Starts afresh with a steady input.
+//
+static void
+Start(double dLevel, double dNoise)
+{
+    g_sInput.dLevel = dLevel;
+    g_sInput.dRamp = 0;
+    g_sInput.dHumAmplitude = 0;
+    g_sInput.dNoise = dNoise;
+    g_ui64Now = 0;
+    g_ui64HeldOff = 0;
+    g_bTaskAsleep = false;
+    g_ui32TaskTaken = 0;
+    g_ui32Notified = 0;
+    g_sADC.ui32Head = 0;
+    g_sADC.ui32Count = 0;
+    g_sADC.bOverflow = false;
+
+    Analog_Init((TaskHandle_t)&g_sADC);
+}
+
+//*****************************************************************************
+//
+// The statistics of the readings taken after each block.
+//
+//*****************************************************************************
+static struct
+{
+    uint32_t ui32Blocks;
+    uint32_t ui32Count;
+    double dSum;
+    double dSquares;
+    double dMin;
+    double dMax;
+    uint32_t ui32Percent;
+    uint32_t ui32Changes;
+    uint32_t ui32RawPercent;
+    uint32_t ui32RawChanges;
+    bool bSkipped;
+    double dMaxLag;
+}
+g_sStats;
+
+static void
+StatsClear(void)
+{
+    g_sStats.ui32Blocks = g_ui32TaskTaken;
+    g_sStats.ui32Count = 0;
+    g_sStats.dSum = 0;
+    g_sStats.dSquares = 0;
+    g_sStats.dMin = 1e9;
+    g_sStats.dMax = -1e9;
+    g_sStats.ui32Percent = Analog_Get_Percent();
+    g_sStats.ui32Changes = 0;
+    g_sStats.ui32RawPercent = 0xFFFFFFFF;
+    g_sStats.ui32RawChanges = 0;
+    g_sStats.bSkipped = false;
+    g_sStats.dMaxLag = 0;
+}
+
+//
+// After each millisecond: the statistics of the reading if a block was
+// taken, and the changes of the speed.  The speed the previous firmware
+// gave, from a single conversion every 10 ms, is counted for comparison.
+//
+static void
+StatsEachMs(void)
+{
+    double dValue, dTrue;
+    double dLag;
+    uint32_t ui32Percent, ui32Raw;
+
+    if((g_ui64Now / 1000) % 10 == 0)
+    {
+        ui32Raw = (((Convert(g_ui64Now) * 100) + (4095 / 2)) / 4095);
+        if((g_sStats.ui32RawPercent != 0xFFFFFFFF) &&
+           (ui32Raw != g_sStats.ui32RawPercent))
+        {
+            g_sStats.ui32RawChanges++;
+        }
+        g_sStats.ui32RawPercent = ui32Raw;
+    }
+
+    if(g_ui32TaskTaken == g_sStats.ui32Blocks)
+    {
+        return;
+    }
+    g_sStats.ui32Blocks = g_ui32TaskTaken;
+
+    dValue = (double)Analog_Get_Value() / (1 << ANALOG_FRAC_BITS);
+    g_sStats.ui32Count++;
+    g_sStats.dSum += dValue;
+    g_sStats.dSquares += dValue * dValue;
+    g_sStats.dMin = (dValue < g_sStats.dMin) ? dValue : g_sStats.dMin;
+    g_sStats.dMax = (dValue > g_sStats.dMax) ? dValue : g_sStats.dMax;
+
+    ui32Percent = Analog_Get_Percent();
+    if(ui32Percent != g_sStats.ui32Percent)
+    {
+        g_sStats.ui32Changes++;
+        if((ui32Percent != g_sStats.ui32Percent + 1) &&
+           (ui32Percent + 1 != g_sStats.ui32Percent))
+        {
+            g_sStats.bSkipped = true;
+        }
+        g_sStats.ui32Percent = ui32Percent;
+    }
+
+    dTrue = Input(g_ui64Now) * 100 / 4095;
+    dLag = fabs(dTrue - ui32Percent);
+    g_sStats.dMaxLag = (dLag > g_sStats.dMaxLag) ? dLag : g_sStats.dMaxLag;
+}
+
+static double
+StatsDeviation(void)
+{
+    double dMean;
+
+    dMean = g_sStats.dSum / g_sStats.ui32Count;
+
+    return(sqrt((g_sStats.dSquares / g_sStats.ui32Count) - (dMean * dMean)));
+}
+
+//*****************************************************************************
+//
+// The tests.
+//
+//*****************************************************************************
+static void
+TestSetUp(void)
+{
+    Start(0, 0);
+
+    Check("sequencer 0 triggered by timer 0 with 16x averaging",
+          ((g_sADC.ui32EMUX & ADC_EMUX_EM0_M) == ADC_EMUX_EM0_TIMER) &&
+          (g_sADC.ui32SAC == ADC_SAC_AVG_16X) &&
+          (g_sADC.ui32SSMUX0 == 0) &&
+          (g_sADC.ui32SSCTL0 == (ADC_SSCTL0_END7 | ADC_SSCTL0_IE7)) &&
+          (g_sADC.ui32ACTSS & ADC_ACTSS_ASEN0) &&
+          (g_sADC.ui32IM & ADC_IM_MASK0));
+    Check("timer 0 triggers the ADC at 1 kHz",
+          (g_sADC.ui32TimerTAMR == TIMER_TAMR_TAMR_PERIOD) &&
+          (g_sADC.ui32TimerTAILR == (SYS_CLOCK / 1000) - 1) &&
+          (g_sADC.ui32TimerADCEV == TIMER_ADCEV_TATOADCEN) &&
+          (g_sADC.ui32TimerCTL & TIMER_CTL_TAOTE) &&
+          (g_sADC.ui32TimerCTL & TIMER_CTL_TAEN));
+}
+
+static void
+TestSteady(void)
+{
+    static const uint32_t pui32Level[] = { 0, 1, 2048, 4094, 4095 };
+    uint32_t ui32Idx, ui32Percent;
+    bool bValue, bPercent;
+
+    bValue = true;
+    bPercent = true;
+    for(ui32Idx = 0; ui32Idx < 5; ui32Idx++)
+    {
+        Start(pui32Level[ui32Idx], 0);
+        Run(1000, 0);
+
+        ui32Percent = ((pui32Level[ui32Idx] * 100) + 2047) / 4095;
+        if(Analog_Get_Value() != (pui32Level[ui32Idx] << ANALOG_FRAC_BITS))
+        {
+            bValue = false;
+        }
+        if(Analog_Get_Percent() != ui32Percent)
+        {
+            bPercent = false;
+        }
+    }
+
+    Check("a steady input reads exactly", bValue);
+    Check("a steady input gives the nearest percent", bPercent);
+}
+
+static void
+TestNoise(void)
+{
+    double dDeviation;
+
+    //
+    // The input sits on the boundary of 50% and 51%, at 2067.975 LSB, once
+    // the hardware averaging has truncated half an LSB off it.
+    //
+    Start(2068.475, 8);
+    Run(1000, 0);
+    StatsClear();
+    Run(20000, StatsEachMs);
+    dDeviation = StatsDeviation();
+
+    printf("  noise of 8 LSB on each conversion: reading %.3f LSB, "
+           "deviation %.3f LSB\n", g_sStats.dSum / g_sStats.ui32Count,
+           dDeviation);
+    printf("  speed changes in 20 s: %u, single conversions %u\n",
+           g_sStats.ui32Changes, g_sStats.ui32RawChanges);
+
+    Check("noise is averaged out to under 1/50 of it", dDeviation < 8.0 / 50);
+    Check("the speed does not flicker with noise",
+          g_sStats.ui32Changes == 0);
+}
+
+static void
+TestHum(void)
+{
+    static const double pdHz[] = { 50, 100, 150, 250 };
+    uint32_t ui32Idx;
+    double dRipple, dWorst;
+
+    dWorst = 0;
+    for(ui32Idx = 0; ui32Idx < 4; ui32Idx++)
+    {
+        Start(2000, 0);
+        g_sInput.dHumAmplitude = 100;
+        g_sInput.dHumHz = pdHz[ui32Idx];
+        g_sInput.dHumPhase = ui32Idx;
+        Run(1000, 0);
+        StatsClear();
+        Run(5000, StatsEachMs);
+
+        dRipple = g_sStats.dMax - g_sStats.dMin;
+        dWorst = (dRipple > dWorst) ? dRipple : dWorst;
+        printf("  hum of 100 LSB at %3.0f Hz: ripple %.3f LSB\n",
+               pdHz[ui32Idx], dRipple);
+    }
+
+    Check("50 Hz hum and its harmonics are averaged out", dWorst < 0.5);
+}
+
+static void
+TestStep(void)
+{
+    uint32_t ui32Ms, ui32Settled;
+
+    Start(0, 4);
+    Run(1000, 0);
+    g_sInput.dLevel = 4095;
+
+    ui32Settled = 0;
+    for(ui32Ms = 1; ui32Ms <= 1000; ui32Ms++)
+    {
+        Run(1, 0);
+        if(!ui32Settled && (Analog_Get_Percent() == 100))
+        {
+            ui32Settled = ui32Ms;
+        }
+    }
+
+    printf("  full scale step: speed at 100%% after %u ms\n", ui32Settled);
+    Check("a full scale step is followed within 200 ms",
+          ui32Settled && (ui32Settled <= 200));
+}
+
+static void
+TestRamp(void)
+{
+    Start(0, 8);
+    Run(1000, 0);
+    StatsClear();
+    g_sInput.dRamp = 4095.0 / 20;
+    g_sInput.ui64RampStart = g_ui64Now;
+    Run(20000, StatsEachMs);
+    g_sInput.dLevel = 4095;
+    g_sInput.dRamp = 0;
+    Run(1000, StatsEachMs);
+
+    printf("  20 s ramp over the full scale: %u speed changes, "
+           "lag up to %.2f%%\n", g_sStats.ui32Changes, g_sStats.dMaxLag);
+    Check("a ramp steps the speed a percent at a time",
+          !g_sStats.bSkipped && (g_sStats.ui32Changes == 100) &&
+          (Analog_Get_Percent() == 100));
+    Check("the speed lags a ramp by at most 1%", g_sStats.dMaxLag <= 1.0);
+}
+
+static void
+TestMissed(void)
+{
+    tAnalogStats sStats;
+    uint32_t ui32Idx;
+
+    //
+    // The task sleeps through every two blocks of three.
+    //
+    Start(3000, 0);
+    for(ui32Idx = 0; ui32Idx < 50; ui32Idx++)
+    {
+        g_bTaskAsleep = true;
+        Run(2 * ANALOG_BLOCK_TRIGGERS, 0);
+        g_bTaskAsleep = false;
+        Run(ANALOG_BLOCK_TRIGGERS, 0);
+    }
+    Analog_Get_Stats(&sStats);
+
+    Check("blocks the task sleeps through are counted as missed",
+          (sStats.ui32Blocks == 150) && (sStats.ui32Missed == 100) &&
+          (g_ui32TaskTaken == 50) && (sStats.ui32Overflows == 0));
+    Check("the task is notified of every block", g_ui32Notified == 150);
+    Check("the latest block is read after missed ones",
+          Analog_Get_Value() == (3000 << ANALOG_FRAC_BITS));
+}
+
+static void
+TestOverflow(void)
+{
+    tAnalogStats sStats;
+    uint32_t ui32Idx;
+
+    //
+    // The interrupt is held off over the next two triggers ten times, so
+    // that the second finds the FIFO still full.
+    //
+    Start(1234, 0);
+    Run(100, 0);
+    for(ui32Idx = 0; ui32Idx < 10; ui32Idx++)
+    {
+        g_ui64HeldOff = g_ui64Now + 2500;
+        Run(100, 0);
+    }
+    Analog_Get_Stats(&sStats);
+
+    Check("samples lost to a late interrupt are counted",
+          sStats.ui32Overflows == 10);
+    Check("the reading is unharmed by lost samples",
+          Analog_Get_Value() == (1234 << ANALOG_FRAC_BITS));
+}
+
+//*****************************************************************************
+//
+// Run the tests.
+//
+//*****************************************************************************
+int
+main(void)
+{
+    srand(1);
+
+    TestSetUp();
+    TestSteady();
+    TestNoise();
+    TestHum();
+    TestStep();
+    TestRamp();
+    TestMissed();
+    TestOverflow();
+
+    if(g_ui32Failures)
+    {
+        printf("%u checks failed\n", g_ui32Failures);
+        return(1);
+    }
+
+    printf("all checks passed\n");
+
+    return(0);
+}
@@ -0,0 +1,719 @@
+//*****************************************************************************
+//
+// capture_sim.c - Host model of the flow sensor input capture (capture.c).
+//
+// This is not part of the firmware.  Build and run it on the host with:
+//
+//     cc -O2 -I. tools/capture_sim.c -lm -o capture_sim && ./capture_sim
+//
+// The engine is compiled unchanged against a model of the Timer 1 registers
+// driven by a fake clock that counts system clock cycles.  The model latches
+// the count at every edge of a synthetic pulse train, as the timer does, and
+// delivers the interrupt after a random latency, standing for the other
+// interrupts and the critical sections that hold it off.  A second edge
+// before the interrupt handler reads the first overwrites it, as on the
+// timer.  Every read of a register costs some cycles, during which edges and
+// wraps may come.  The measuring task calls Capture_Measure() every 10 ms.
+//
+// The same pulse trains, with the same latencies, are fed to a model of the
+// previous GPIO interrupt handler, which read the time when it ran, and to
+// the same gated measurement on those times.  The three are compared for
+// the worst error of the frequency each measures against the true one.
+//
+// The test also checks that every edge is stored with its exact time across
+// the wraps of the timer, that a full ring drops edges without a period
+// being counted across the gap, and that a long silence does not spoil the
+// first measurement after it.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+//*****************************************************************************
+//
+// The system clock, the CPU cycles taken by a read of a register, the
+// period of the measuring task and the gate it measures over.
+//
+//*****************************************************************************
+#define SYS_CLOCK               120000000
+#define READ_CYCLES             4
+#define ENTRY_CYCLES            12
+#define TASK_CYCLES             (SYS_CLOCK / 100)
+#define GATE_CYCLES             2000000
+#define NEVER                   UINT64_MAX
+
+uint32_t g_ui32SysClock = SYS_CLOCK;
+
+//*****************************************************************************
+//
+// The fake clock.
+//
+//*****************************************************************************
+static uint64_t g_ui64Now;
+
+//*****************************************************************************
+//
+// The model of Timer 1.  The timer counts from the time it was enabled;
+// ui64Acked is the number of wraps whose interrupt has been cleared.  A
+// captured count waits in ui32Latched while bCaptured is set.
+//
+//*****************************************************************************
+static struct
+{
+    uint32_t ui32CTL;
+    uint32_t ui32CFG;
+    uint32_t ui32TAMR;
+    uint32_t ui32TAILR;
+    uint32_t ui32TAPR;
+    uint32_t ui32IMR;
+    uint32_t ui32ICR;
+    uint32_t ui32RCGC;
+    uint64_t ui64Start;
+    uint64_t ui64Acked;
+    uint32_t ui32Latched;
+    bool bCaptured;
+}
+g_sTimer;
+
+static uint32_t TimerRIS(void);
+static uint32_t TimerTAR(void);
+
+#include "tm4c1294ncpdt.h"
+
+#undef TIMER1_CTL_R
+#undef TIMER1_CFG_R
+#undef TIMER1_TAMR_R
+#undef TIMER1_TAILR_R
+#undef TIMER1_TAPR_R
+#undef TIMER1_IMR_R
+#undef TIMER1_ICR_R
+#undef TIMER1_RIS_R
+#undef TIMER1_MIS_R
+#undef TIMER1_TAR_R
+#undef SYSCTL_RCGCTIMER_R
+#undef SYSCTL_PRTIMER_R
+#define TIMER1_CTL_R            (g_sTimer.ui32CTL)
+#define TIMER1_CFG_R            (g_sTimer.ui32CFG)
+#define TIMER1_TAMR_R           (g_sTimer.ui32TAMR)
+#define TIMER1_TAILR_R          (g_sTimer.ui32TAILR)
+#define TIMER1_TAPR_R           (g_sTimer.ui32TAPR)
+#define TIMER1_IMR_R            (g_sTimer.ui32IMR)
+#define TIMER1_ICR_R            (g_sTimer.ui32ICR)
+#define TIMER1_RIS_R            (TimerRIS())
+#define TIMER1_MIS_R            (TimerRIS() & g_sTimer.ui32IMR)
+#define TIMER1_TAR_R            (TimerTAR())
+#define SYSCTL_RCGCTIMER_R      (g_sTimer.ui32RCGC)
+#define SYSCTL_PRTIMER_R        (g_sTimer.ui32RCGC)
+
+#include "sample_ring.c"
+#include "capture.c"
+
+//*****************************************************************************
+//
+// The pulse train: the period in cycles, the time of the next edge, and
+// the latency of the interrupts, up to ui32Jitter cycles on top of the entry.
+//
+//*****************************************************************************
+static struct
+{
+    bool bOn;
+    double dPeriod;
+    double dNext;
+    uint32_t ui32Jitter;
+}
+g_sInput;
+
+//*****************************************************************************
+//
+// The edges the engine has yet to store, in order, to check the ring
+// against, and the number of them it lost.
+//
+//*****************************************************************************
+#define EXPECTED_SIZE           4096
+
+static struct
+{
+    uint64_t pui64Edge[EXPECTED_SIZE];
+    uint32_t ui32Head;
+    uint32_t ui32Tail;
+    uint32_t ui32Wrong;
+    uint32_t ui32Checked;
+}
+g_sExpected;
+
+//*****************************************************************************
+//
+// The models of the previous GPIO interrupt handler.  The shipped one
+// started a gate at a pulse, ended it at the first pulse at least
+// 2000000 cycles later and took the span for one period, which pwmTask
+// averaged over 10 gates into a frequency in whole hertz.  The counted one
+// uses the times the handler read in the gated measurement of capture.c.
+//
+//*****************************************************************************
+static struct
+{
+    bool bFirst;
+    uint64_t ui64First;
+    uint32_t pui32Period[10];
+    uint32_t ui32Index;
+    uint32_t ui32Filled;
+    uint32_t ui32Hz;
+    bool bCounting;
+    uint64_t ui64Start;
+    uint32_t ui32Periods;
+    double dMilliHz;
+    bool bMeasured;
+}
+g_sGPIO;
+
+//*****************************************************************************
+//
+// The worst errors, in parts per million, of the measurements since the
+// errors were last cleared.
+//
+//*****************************************************************************
+static struct
+{
+    double dOld;
+    double dGPIO;
+    double dCapture;
+    uint32_t ui32Measured;
+    uint32_t ui32Rounding;
+}
+g_sErrors;
+
+static uint32_t g_ui32Failures;
+static uint64_t g_ui64IsrDue = NEVER;
+
+//*****************************************************************************
+//
+// The model of the counter.  It counts up through the prescaler to
+// TAPR:TAILR and wraps to 0.
+//
+//*****************************************************************************
+static uint64_t
+TimerRange(void)
+{
+    return((((uint64_t)g_sTimer.ui32TAPR << 16) |
+            (g_sTimer.ui32TAILR & 0xFFFF)) + 1);
+}
+
+static uint64_t
+TimerWraps(uint64_t ui64Time)
+{
+    return((ui64Time - g_sTimer.ui64Start) / TimerRange());
+}
+
+static uint32_t
+TimerCount(uint64_t ui64Time)
+{
+    return((uint32_t)((ui64Time - g_sTimer.ui64Start) % TimerRange()));
+}
+
+//
+// An interrupt latency.
+//
+static uint64_t
+Latency(void)
+{
+    return(ENTRY_CYCLES +
+           (g_sInput.ui32Jitter ?
+            ((((uint64_t)rand() << 16) ^ rand()) % g_sInput.ui32Jitter) : 0));
+}
+
+//
+// The gated measurement on the times the GPIO handler read, as
+// Capture_Measure() does it on the captured times.
+//
+static void
+GPIOCounted(uint64_t ui64Time)
+{
+    if(!g_sGPIO.bCounting)
+    {
+        g_sGPIO.bCounting = true;
+        g_sGPIO.ui64Start = ui64Time;
+        g_sGPIO.ui32Periods = 0;
+        return;
+    }
+
+    g_sGPIO.ui32Periods++;
+    if((ui64Time - g_sGPIO.ui64Start) >= GATE_CYCLES)
+    {
+        g_sGPIO.dMilliHz = ((double)g_sGPIO.ui32Periods * SYS_CLOCK * 1000) /
+                           (ui64Time - g_sGPIO.ui64Start);
+        g_sGPIO.bMeasured = true;
+        g_sGPIO.ui64Start = ui64Time;
+        g_sGPIO.ui32Periods = 0;
+    }
+}
+
+//
+// The previous handler, run at the time it read.
+//
+static void
+GPIOShipped(uint64_t ui64Time)
+{
+    uint64_t ui64Sum;
+    uint32_t ui32Idx;
+
+    if(g_sGPIO.bFirst)
+    {
+        g_sGPIO.ui64First = ui64Time;
+        g_sGPIO.bFirst = false;
+        return;
+    }
+
+    if((ui64Time - g_sGPIO.ui64First) >= 2000000)
+    {
+        g_sGPIO.pui32Period[g_sGPIO.ui32Index] =
+            (uint32_t)(ui64Time - g_sGPIO.ui64First);
+        g_sGPIO.ui32Index = (g_sGPIO.ui32Index + 1) % 10;
+        g_sGPIO.bFirst = true;
+
+        if(++g_sGPIO.ui32Filled >= 10)
+        {
+            for(ui32Idx = 0, ui64Sum = 0; ui32Idx < 10; ui32Idx++)
+            {
+                ui64Sum += g_sGPIO.pui32Period[ui32Idx];
+            }
+            g_sGPIO.ui32Hz = (uint32_t)(SYS_CLOCK / (ui64Sum / 10));
+        }
+    }
+}
+
+//
+// Latch the edges that have come by now, and run the GPIO models on them.
+//
+static void
+Advance(void)
+{
+    uint64_t ui64Edge;
+
+    while(g_sInput.bOn && (g_sInput.dNext <= (double)g_ui64Now))
+    {
+        ui64Edge = (uint64_t)g_sInput.dNext;
+        g_sInput.dNext += g_sInput.dPeriod;
+
+        g_sTimer.ui32Latched = TimerCount(ui64Edge);
+        g_sTimer.bCaptured = true;
+        g_sExpected.pui64Edge[g_sExpected.ui32Head++ % EXPECTED_SIZE] =
+            ui64Edge - g_sTimer.ui64Start;
+
+        ui64Edge += Latency();
+        GPIOShipped(ui64Edge);
+        GPIOCounted(ui64Edge);
+    }
+}
+
+static void
+Clear(void)
+{
+    if(g_sTimer.ui32ICR & TIMER_ICR_TATOCINT)
+    {
+        g_sTimer.ui64Acked = TimerWraps(g_ui64Now);
+    }
+    if(g_sTimer.ui32ICR & TIMER_ICR_CAECINT)
+    {
+        g_sTimer.bCaptured = false;
+    }
+    g_sTimer.ui32ICR = 0;
+}
+
+//
+// A read takes some cycles, during which edges may come.
+//
+static void
+Read(void)
+{
+    Clear();
+    g_ui64Now += READ_CYCLES;
+    Advance();
+}
+
+static uint32_t
+TimerRIS(void)
+{
+    Read();
+
+    return(((TimerWraps(g_ui64Now) > g_sTimer.ui64Acked) ?
+            TIMER_RIS_TATORIS : 0) |
+           (g_sTimer.bCaptured ? TIMER_RIS_CAERIS : 0));
+}
+
+static uint32_t
+TimerTAR(void)
+{
+    Read();
+
+    //
+    // The bits above the prescaler are not defined.
+    //
+    return(g_sTimer.ui32Latched | (rand() & 0xFF000000));
+}
+
+static bool
+Pending(void)
+{
+    Clear();
+
+    return(((g_sTimer.ui32IMR & TIMER_IMR_TATOIM) &&
+            (TimerWraps(g_ui64Now) > g_sTimer.ui64Acked)) ||
+           ((g_sTimer.ui32IMR & TIMER_IMR_CAEIM) && g_sTimer.bCaptured));
+}
+
+//*****************************************************************************
+//
+// Check the outcome of a test.
+//
+//*****************************************************************************
+static void
+Check(const char *pcTest, bool bPass)
+{
+    printf("%-56s %s\n", pcTest, bPass ? "ok" : "FAILED");
+    if(!bPass)
+    {
+        g_ui32Failures++;
+    }
+}
+
+//
+// The error of a measurement in millihertz, in parts per million.
+//
+static double
+ErrorPPM(double dMilliHz)
+{
+    double dTrue;
+
+    dTrue = (1000.0 * SYS_CLOCK) / g_sInput.dPeriod;
+
+    return(fabs(dMilliHz - dTrue) * 1e6 / dTrue);
+}
+
+//
+// The measuring task: check the times waiting in the ring against the true
+// edges, then measure.
+//
+static void
+Task(void)
+{
+    tCapturePeriod sPeriod;
+    uint32_t ui32Idx;
+    double dMilliHz;
+
+    for(ui32Idx = g_sEdges.ui32Tail; ui32Idx != g_sEdges.ui32Head; ui32Idx++)
+    {
+        if((g_sExpected.ui32Tail == g_sExpected.ui32Head) ||
+           (g_pui32Edges[ui32Idx & (CAPTURE_RING_SIZE - 1)] !=
+            (uint32_t)g_sExpected.pui64Edge[g_sExpected.ui32Tail %
+                                            EXPECTED_SIZE]))
+        {
+            g_sExpected.ui32Wrong++;
+        }
+        g_sExpected.ui32Tail++;
+        g_sExpected.ui32Checked++;
+    }
+
+    if(Capture_Measure(GATE_CYCLES, &sPeriod))
+    {
+        dMilliHz = ((double)sPeriod.ui32Periods * SYS_CLOCK * 1000) /
+                   sPeriod.ui32Cycles;
+        if(ErrorPPM(dMilliHz) > g_sErrors.dCapture)
+        {
+            g_sErrors.dCapture = ErrorPPM(dMilliHz);
+        }
+        if(fabs(dMilliHz - sPeriod.ui32MilliHz) > 0.5)
+        {
+            g_sErrors.ui32Rounding++;
+        }
+        g_sErrors.ui32Measured++;
+    }
+
+    if(g_sGPIO.bMeasured)
+    {
+        if(ErrorPPM(g_sGPIO.dMilliHz) > g_sErrors.dGPIO)
+        {
+            g_sErrors.dGPIO = ErrorPPM(g_sGPIO.dMilliHz);
+        }
+        g_sGPIO.bMeasured = false;
+    }
+
+    if(g_sGPIO.ui32Hz &&
+       (ErrorPPM(g_sGPIO.ui32Hz * 1000.0) > g_sErrors.dOld))
+    {
+        g_sErrors.dOld = ErrorPPM(g_sGPIO.ui32Hz * 1000.0);
+    }
+}
+
+//*****************************************************************************
+//
+// Run the model for a time, with the task running every 10 ms unless it is
+// stalled.
+//
+//*****************************************************************************
+static void
+Run(uint64_t ui64Cycles, bool bTask)
+{
+    uint64_t ui64End, ui64Next, ui64Wrap, ui64Task;
+
+    ui64End = g_ui64Now + ui64Cycles;
+    ui64Task = ((g_ui64Now / TASK_CYCLES) + 1) * TASK_CYCLES;
+
+    while(g_ui64Now < ui64End)
+    {
+        ui64Next = ui64End;
+        if(g_sInput.bOn && ((uint64_t)ceil(g_sInput.dNext) < ui64Next))
+        {
+            ui64Next = (uint64_t)ceil(g_sInput.dNext);
+        }
+        ui64Wrap = g_sTimer.ui64Start +
+                   ((TimerWraps(g_ui64Now) + 1) * TimerRange());
+        if(ui64Wrap < ui64Next)
+        {
+            ui64Next = ui64Wrap;
+        }
+        if(g_ui64IsrDue < ui64Next)
+        {
+            ui64Next = g_ui64IsrDue;
+        }
+        if(bTask && (ui64Task < ui64Next))
+        {
+            ui64Next = ui64Task;
+        }
+        if(ui64Next > g_ui64Now)
+        {
+            g_ui64Now = ui64Next;
+        }
+        Advance();
+
+        if(bTask && (g_ui64Now >= ui64Task))
+        {
+            Task();
+            ui64Task += TASK_CYCLES;
+        }
+
+        if(g_ui64IsrDue == NEVER)
+        {
+            if(Pending())
+            {
+                g_ui64IsrDue = g_ui64Now + Latency();
+            }
+        }
+        else if(g_ui64Now >= g_ui64IsrDue)
+        {
+            Capture_IntHandler();
+            g_ui64IsrDue = Pending() ? (g_ui64Now + ENTRY_CYCLES) : NEVER;
+        }
+    }
+}
+
+//
+// Start the engine and a pulse train at the given frequency.
+//
+static void
+Start(double dHz, uint32_t ui32JitterUs)
+{
+    g_ui64Now = 1000 + (rand() % 1000000);
+    g_sTimer.ui32CTL = 0;
+    g_sTimer.ui32ICR = 0;
+    g_sTimer.bCaptured = false;
+    g_ui64IsrDue = NEVER;
+
+    Capture_Init();
+    Clear();
+
+    g_sTimer.ui64Start = g_ui64Now;
+    g_sTimer.ui64Acked = 0;
+
+    g_sInput.bOn = true;
+    g_sInput.dPeriod = SYS_CLOCK / dHz;
+    g_sInput.dNext = g_ui64Now + (rand() % 1000000) + 0.37;
+    g_sInput.ui32Jitter = ui32JitterUs * (SYS_CLOCK / 1000000);
+
+    g_sExpected.ui32Head = 0;
+    g_sExpected.ui32Tail = 0;
+    g_sExpected.ui32Wrong = 0;
+    g_sExpected.ui32Checked = 0;
+
+    g_sGPIO.bFirst = true;
+    g_sGPIO.ui32Index = 0;
+    g_sGPIO.ui32Filled = 0;
+    g_sGPIO.ui32Hz = 0;
+    g_sGPIO.bCounting = false;
+    g_sGPIO.bMeasured = false;
+
+    g_sErrors.dOld = 0;
+    g_sErrors.dGPIO = 0;
+    g_sErrors.dCapture = 0;
+    g_sErrors.ui32Measured = 0;
+    g_sErrors.ui32Rounding = 0;
+}
+
+//*****************************************************************************
+//
+// The timer is set up as a 24-bit edge-time capture counting up.
+//
+//*****************************************************************************
+static void
+TestSetUp(void)
+{
+    Start(50, 0);
+    Check("timer set up as a 24-bit falling edge-time capture",
+          (g_sTimer.ui32CTL & TIMER_CTL_TAEN) &&
+          ((g_sTimer.ui32CTL & TIMER_CTL_TAEVENT_M) ==
+           TIMER_CTL_TAEVENT_NEG) &&
+          (g_sTimer.ui32CFG == TIMER_CFG_16_BIT) &&
+          (g_sTimer.ui32TAMR == (TIMER_TAMR_TAMR_CAP | TIMER_TAMR_TACMR |
+                                 TIMER_TAMR_TACDIR)) &&
+          (TimerRange() == (1 << CAPTURE_WRAP_SHIFT)) &&
+          (g_sTimer.ui32IMR == (TIMER_IMR_CAEIM | TIMER_IMR_TATOIM)));
+}
+
+//*****************************************************************************
+//
+// The error of the three measurements over pulse trains of several
+// frequencies and interrupt latencies.
+//
+//*****************************************************************************
+static void
+TestErrors(void)
+{
+    static const double pdHz[] = { 7.3, 50.0, 133.3, 512.7 };
+    static const uint32_t pui32JitterUs[] = { 1, 50, 500 };
+    uint32_t ui32Hz, ui32Jitter, ui32Wrong, ui32Measured;
+    double dWorst;
+
+    printf("\n  worst error of the measured frequency, ppm\n");
+    printf("  %8s %9s %14s %14s %10s\n", "input Hz", "jitter us",
+           "old isr", "isr + gate", "capture");
+
+    ui32Wrong = 0;
+    ui32Measured = 0;
+    dWorst = 0;
+    for(ui32Hz = 0; ui32Hz < (sizeof(pdHz) / sizeof(pdHz[0])); ui32Hz++)
+    {
+        for(ui32Jitter = 0;
+            ui32Jitter < (sizeof(pui32JitterUs) / sizeof(uint32_t));
+            ui32Jitter++)
+        {
+            Start(pdHz[ui32Hz], pui32JitterUs[ui32Jitter]);
+            Run((uint64_t)SYS_CLOCK * 10, true);
+
+            printf("  %8.1f %9u %14.0f %14.1f %10.2f\n", pdHz[ui32Hz],
+                   pui32JitterUs[ui32Jitter], g_sErrors.dOld,
+                   g_sErrors.dGPIO, g_sErrors.dCapture);
+
+            ui32Wrong += g_sExpected.ui32Wrong + Capture_Get_Overruns() +
+                         g_sErrors.ui32Rounding;
+            ui32Measured += g_sErrors.ui32Measured ? 1 : 0;
+            if(g_sErrors.dCapture > dWorst)
+            {
+                dWorst = g_sErrors.dCapture;
+            }
+        }
+    }
+    printf("\n");
+
+    Check("every edge stored with its exact time, frequency rounded",
+          !ui32Wrong);
+    Check("every input measured",
+          ui32Measured == ((sizeof(pdHz) / sizeof(pdHz[0])) *
+                           (sizeof(pui32JitterUs) / sizeof(uint32_t))));
+
+    //
+    // Each end of the gate is off by less than a cycle.
+    //
+    Check("captured frequency within 1 ppm", dWorst <= 1.0);
+}
+
+//*****************************************************************************
+//
+// Edges come close to the wraps of the timer, with the interrupt held off
+// past them.
+//
+//*****************************************************************************
+static void
+TestWraps(void)
+{
+    Start(4.1, 30000);
+    Run((uint64_t)SYS_CLOCK * 60, true);
+    Check("edge times exact with 30 ms interrupt latency",
+          !g_sExpected.ui32Wrong && (g_sExpected.ui32Checked > 200) &&
+          (g_sErrors.dCapture <= 1.0));
+}
+
+//*****************************************************************************
+//
+// A stalled reader makes the ring drop edges; no period is counted across
+// the gap.
+//
+//*****************************************************************************
+static void
+TestOverrun(void)
+{
+    Start(1000.0, 50);
+    Run(SYS_CLOCK / 2, true);
+    Run(SYS_CLOCK / 10, false);
+
+    //
+    // The ring holds the first edges of the stall, then skips to the ones
+    // after it, except one the handler has yet to read.
+    //
+    g_sErrors.dCapture = 0;
+    g_sErrors.ui32Measured = 0;
+    Task();
+    g_sExpected.ui32Tail = g_sExpected.ui32Head - (g_sTimer.bCaptured ? 1 : 0);
+    Run(SYS_CLOCK, true);
+
+    Check("full ring drops edges and counts them",
+          Capture_Get_Overruns() > 0);
+    Check("no period counted across the dropped edges",
+          g_sErrors.ui32Measured && (g_sErrors.dCapture <= 1.0) &&
+          !g_sExpected.ui32Wrong);
+}
+
+//*****************************************************************************
+//
+// The input stops for longer than a measurement can span, then starts
+// again.
+//
+//*****************************************************************************
+static void
+TestSilence(void)
+{
+    Start(20.0, 50);
+    Run(SYS_CLOCK, true);
+    g_sInput.bOn = false;
+    Run((uint64_t)SYS_CLOCK * 20, true);
+    g_sInput.bOn = true;
+    g_sInput.dNext = g_ui64Now + 1234.5;
+    g_sErrors.dCapture = 0;
+    g_sErrors.ui32Measured = 0;
+    Run(SYS_CLOCK, true);
+    Check("first measurement after 20 s of silence",
+          g_sErrors.ui32Measured && (g_sErrors.dCapture <= 1.0));
+}
+
+int
+main(void)
+{
+    srand(1);
+
+    TestSetUp();
+    TestErrors();
+    TestWraps();
+    TestOverrun();
+    TestSilence();
+
+    if(g_ui32Failures)
+    {
+        printf("%u failures\n", g_ui32Failures);
+        return(1);
+    }
+
+    printf("all passed\n");
+
+    return(0);
+}
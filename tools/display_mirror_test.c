@@ -0,0 +1,304 @@
+//*****************************************************************************
+//
+// display_mirror_test.c - Host test of the display mirror (display_mirror.c).
+//
+// This is not part of the firmware.  Build and run it on the host with:
+//
+//     cc -O2 -I. -pthread tools/display_mirror_test.c -o display_mirror_test
+//
+// The line ring is checked as it fills, wraps around and drops old lines,
+// with text longer than a line, and with a reader racing a writer in another
+// thread, where every line read must be the whole line written under that
+// number.  The frame buffers are checked for the frames they hold and for
+// when a reader must consider a frame overwritten.
+//
+//*****************************************************************************
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "display_mirror.c"
+
+//*****************************************************************************
+//
+// Check the outcome of a test.
+//
+//*****************************************************************************
+static uint32_t g_ui32Failures;
+
+static void
+Check(const char *pcTest, bool bPass)
+{
+    printf("%-44s %s\n", pcTest, bPass ? "ok" : "FAILED");
+    if(!bPass)
+    {
+        g_ui32Failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// The text of line n: its number, repeated up to the length of a line, so a
+// line mixed from two writes can be told apart.
+//
+//*****************************************************************************
+static void
+LineText(uint32_t ui32Line, char *pcText)
+{
+    char pcNumber[12];
+    uint32_t ui32Idx, ui32Len;
+
+    ui32Len = snprintf(pcNumber, sizeof(pcNumber), "%u.", ui32Line);
+    for(ui32Idx = 0; ui32Idx < DISPLAY_MIRROR_TEXT_LEN; ui32Idx++)
+    {
+        pcText[ui32Idx] = pcNumber[ui32Idx % ui32Len];
+    }
+    pcText[ui32Idx] = '\0';
+}
+
+static bool
+LineIs(const tDisplayMirrorLine *psLine, uint32_t ui32Line)
+{
+    char pcText[DISPLAY_MIRROR_TEXT_LEN + 1];
+
+    LineText(ui32Line, pcText);
+
+    return(!strcmp(psLine->pcText, pcText) &&
+           (psLine->ui8X == (ui32Line % 128)) &&
+           (psLine->ui8Y == ((ui32Line * 8) % 64)));
+}
+
+static void
+WriteLine(uint32_t ui32Line)
+{
+    char pcText[DISPLAY_MIRROR_TEXT_LEN + 1];
+
+    LineText(ui32Line, pcText);
+    Display_Mirror_Line(ui32Line % 128, (ui32Line * 8) % 64, pcText);
+}
+
+//*****************************************************************************
+//
+// The tests of the line ring.
+//
+//*****************************************************************************
+static void
+TestLines(void)
+{
+    tDisplayMirrorLine sLine;
+    uint32_t ui32Line;
+    bool bPass;
+
+    Check("empty ring", (Display_Mirror_Line_Count() == 0) &&
+          !Display_Mirror_Read_Line(0, &sLine));
+
+    //
+    // A few lines, and one not written yet.
+    //
+    bPass = true;
+    for(ui32Line = 0; ui32Line < 5; ui32Line++)
+    {
+        WriteLine(ui32Line);
+    }
+    for(ui32Line = 0; ui32Line < 5; ui32Line++)
+    {
+        bPass = bPass && Display_Mirror_Read_Line(ui32Line, &sLine) &&
+                LineIs(&sLine, ui32Line);
+    }
+    Check("lines read back", bPass && (Display_Mirror_Line_Count() == 5) &&
+          !Display_Mirror_Read_Line(5, &sLine));
+
+    //
+    // Wrap around more than twice: only the latest lines are left.
+    //
+    for(; ui32Line < ((DISPLAY_MIRROR_LINES * 2) + 7); ui32Line++)
+    {
+        WriteLine(ui32Line);
+    }
+    bPass = true;
+    for(ui32Line = 0; ui32Line < Display_Mirror_Line_Count(); ui32Line++)
+    {
+        if(ui32Line < (Display_Mirror_Line_Count() - DISPLAY_MIRROR_LINES))
+        {
+            bPass = bPass && !Display_Mirror_Read_Line(ui32Line, &sLine);
+        }
+        else
+        {
+            bPass = bPass && Display_Mirror_Read_Line(ui32Line, &sLine) &&
+                    LineIs(&sLine, ui32Line);
+        }
+    }
+    Check("wraparound drops the oldest lines", bPass);
+
+    //
+    // Text longer than a line is cut, and the slot after it is untouched.
+    //
+    ui32Line = Display_Mirror_Line_Count();
+    Display_Mirror_Line(0, 0, "0123456789abcdefOVERFLOWING THE LINE");
+    Check("long text is cut to a line",
+          Display_Mirror_Read_Line(ui32Line, &sLine) &&
+          !strcmp(sLine.pcText, "0123456789abcdef") &&
+          Display_Mirror_Read_Line(ui32Line - DISPLAY_MIRROR_LINES + 1,
+                                   &sLine) &&
+          LineIs(&sLine, ui32Line - DISPLAY_MIRROR_LINES + 1));
+
+    //
+    // The oldest line is refused once the writer has started to replace it,
+    // before the line count moves on.
+    //
+    ui32Line = Display_Mirror_Line_Count() - DISPLAY_MIRROR_LINES;
+    g_psSlots[ui32Line & (DISPLAY_MIRROR_LINES - 1)].ui32Tag =
+        ui32Line + DISPLAY_MIRROR_LINES + 1;
+    Check("slot being written is refused",
+          !Display_Mirror_Read_Line(ui32Line, &sLine));
+    g_psSlots[ui32Line & (DISPLAY_MIRROR_LINES - 1)].ui32Tag = ui32Line + 1;
+
+    //
+    // The line count wraps around 32 bits.
+    //
+    g_ui32Lines = 0xfffffffe;
+    WriteLine(0xfffffffe);
+    WriteLine(0xffffffff);
+    WriteLine(0);
+    Check("line numbers wrap around",
+          Display_Mirror_Read_Line(0xffffffff, &sLine) &&
+          LineIs(&sLine, 0xffffffff) &&
+          Display_Mirror_Read_Line(0, &sLine) && LineIs(&sLine, 0) &&
+          !Display_Mirror_Read_Line(1, &sLine));
+}
+
+//*****************************************************************************
+//
+// A writer and a reader racing each other.
+//
+//*****************************************************************************
+#define RACE_LINES              2000000
+
+static volatile bool g_bRaceDone;
+
+static void *
+RaceWriter(void *pvArg)
+{
+    uint32_t ui32Line;
+
+    for(ui32Line = 0; ui32Line < RACE_LINES; ui32Line++)
+    {
+        WriteLine(ui32Line);
+    }
+    g_bRaceDone = true;
+
+    return(NULL);
+}
+
+static void
+TestRace(void)
+{
+    tDisplayMirrorLine sLine;
+    pthread_t sThread;
+    uint32_t ui32Count, ui32Read, ui32Refused, ui32Torn, ui32Line;
+
+    memset(g_psSlots, 0, sizeof(g_psSlots));
+    g_ui32Lines = 0;
+    g_bRaceDone = false;
+    ui32Read = 0;
+    ui32Refused = 0;
+    ui32Torn = 0;
+
+    pthread_create(&sThread, NULL, RaceWriter, NULL);
+    while(!g_bRaceDone)
+    {
+        //
+        // Read the oldest line still in the ring, which is the one most
+        // likely to be overwritten while it is copied.
+        //
+        ui32Count = Display_Mirror_Line_Count();
+        if(ui32Count < DISPLAY_MIRROR_LINES)
+        {
+            continue;
+        }
+        ui32Line = ui32Count - DISPLAY_MIRROR_LINES;
+        if(!Display_Mirror_Read_Line(ui32Line, &sLine))
+        {
+            ui32Refused++;
+        }
+        else if(!LineIs(&sLine, ui32Line))
+        {
+            ui32Torn++;
+        }
+        else
+        {
+            ui32Read++;
+        }
+    }
+    pthread_join(sThread, NULL);
+
+    printf("  %u lines read, %u refused as overwritten, %u torn\n", ui32Read,
+           ui32Refused, ui32Torn);
+    Check("reader racing the writer", (ui32Torn == 0) && (ui32Read != 0));
+}
+
+//*****************************************************************************
+//
+// The tests of the frame buffers.
+//
+//*****************************************************************************
+static void
+TestFrames(void)
+{
+    uint8_t pui8Frame[OLED_FB_PAGES * OLED_FB_WIDTH];
+    uint32_t ui32Frame;
+    bool bPass;
+
+    //
+    // Frame 0 is blank.
+    //
+    Check("blank frame before the first one",
+          (Display_Mirror_Frame_Count() == 0) &&
+          Display_Mirror_Frame_Valid(0) &&
+          (Display_Mirror_Frame_Byte(0, 100) == 0) &&
+          !Display_Mirror_Frame_Valid(1));
+
+    //
+    // Publish frames filled with their number and read them back.
+    //
+    bPass = true;
+    for(ui32Frame = 1; ui32Frame <= 5; ui32Frame++)
+    {
+        memset(pui8Frame, ui32Frame, sizeof(pui8Frame));
+        Display_Mirror_Frame(pui8Frame);
+        bPass = bPass && (Display_Mirror_Frame_Count() == ui32Frame) &&
+                (Display_Mirror_Frame_Byte(ui32Frame, 0) == ui32Frame) &&
+                (Display_Mirror_Frame_Byte(ui32Frame,
+                                           sizeof(pui8Frame) - 1) ==
+                 ui32Frame) &&
+                Display_Mirror_Frame_Valid(ui32Frame) &&
+                Display_Mirror_Frame_Valid(ui32Frame - 1) &&
+                ((ui32Frame < 2) || !Display_Mirror_Frame_Valid(ui32Frame - 2));
+    }
+    Check("frames published and read back", bPass);
+
+    //
+    // While frame 6 is written, frame 4 is no longer valid but 5 is.
+    //
+    g_ui32FrameWriting = 6;
+    Check("frame being overwritten is invalid",
+          !Display_Mirror_Frame_Valid(4) && Display_Mirror_Frame_Valid(5));
+    g_ui32FrameWriting = 5;
+}
+
+int
+main(void)
+{
+    TestLines();
+    TestFrames();
+    TestRace();
+
+    if(g_ui32Failures)
+    {
+        printf("%u tests failed\n", g_ui32Failures);
+        return(1);
+    }
+
+    return(0);
+}
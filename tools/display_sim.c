@@ -0,0 +1,618 @@
+//*****************************************************************************
+//
+// display_sim.c - Host simulation of the queued display service (display.c).
+//
+// This is not part of the firmware.  Build and run it on the host with (on
+// one line):
+//
+//     cc -O2 -I. -IFreeRTOS/include tools/display_sim.c oled_fb.c
+//         oled_font.c oled_image.c display_mirror.c fonts/font_default.c
+//         images/images_rle.c -o display_sim && ./display_sim
+//
+// display.c is compiled unchanged against a minimal single-threaded
+// stand-in for the FreeRTOS queue, and the framebuffer flushes go to a
+// simulated I2C bus that only counts time at 400 kbit/s.
+//
+// The simulation replays what the lwIP host timer handler draws while the
+// board gets its IP address, together with a flow readout posted at 100 Hz
+// while the display task only runs at 10 Hz.  It reports how long the
+// network code is held up by drawing in each design:
+//
+//  - the original driver, which wrote text straight to the display with
+//    delays after every byte, inside the Ethernet interrupt with NO_SYS;
+//  - drawing into the framebuffer and flushing it in the caller;
+//  - posting to the display queue, measured on the host.
+//
+// It checks that the coalesced updates leave the display showing the latest
+// state, that a text is not replaced once a command that could draw over it
+// was queued after it, and that commands are refused when the queue is full.
+//
+// Then it plays the animations of the boot and status screens and counts the
+// bytes each of their frames puts on the bus: the progress bar under the
+// splash screen, which the display task fills while the boot goes on, and
+// the status line scrolled by the display's own scroll engine, against
+// redrawing it for every step.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//*****************************************************************************
+//
+// A stand-in for the parts of FreeRTOS used by display.c.  There is a single
+// thread, so critical sections only need to be balanced and a receive from
+// an empty queue fails at once.
+//
+//*****************************************************************************
+#define INC_FREERTOS_H
+#define QUEUE_H
+#define INC_TASK_H
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+typedef struct
+{
+    uint8_t *pui8Items;
+    uint32_t ui32Size;
+    uint32_t ui32Length;
+    uint32_t ui32Head;
+    uint32_t ui32Count;
+}
+tSimQueue;
+
+typedef tSimQueue *QueueHandle_t;
+
+#define pdPASS                  1
+#define pdFAIL                  0
+#define portMAX_DELAY           0xffffffff
+#define portTICK_PERIOD_MS      1
+
+static int32_t g_i32Critical;
+
+#define taskENTER_CRITICAL()    (g_i32Critical++)
+#define taskEXIT_CRITICAL()     (g_i32Critical--)
+
+static QueueHandle_t
+xQueueCreate(UBaseType_t uxLength, UBaseType_t uxSize)
+{
+    tSimQueue *psQueue;
+
+    psQueue = calloc(1, sizeof(tSimQueue));
+    psQueue->pui8Items = calloc(uxLength, uxSize);
+    psQueue->ui32Size = uxSize;
+    psQueue->ui32Length = uxLength;
+
+    return(psQueue);
+}
+
+static BaseType_t
+xQueueSendToBack(QueueHandle_t psQueue, const void *pvItem, TickType_t xWait)
+{
+    uint32_t ui32Slot;
+
+    if(psQueue->ui32Count == psQueue->ui32Length)
+    {
+        return(pdFAIL);
+    }
+
+    ui32Slot = (psQueue->ui32Head + psQueue->ui32Count) % psQueue->ui32Length;
+    memcpy(psQueue->pui8Items + (ui32Slot * psQueue->ui32Size), pvItem,
+           psQueue->ui32Size);
+    psQueue->ui32Count++;
+
+    return(pdPASS);
+}
+
+static BaseType_t
+xQueueReceive(QueueHandle_t psQueue, void *pvItem, TickType_t xWait)
+{
+    if(!psQueue->ui32Count)
+    {
+        return(pdFAIL);
+    }
+
+    memcpy(pvItem, psQueue->pui8Items + (psQueue->ui32Head * psQueue->ui32Size),
+           psQueue->ui32Size);
+    psQueue->ui32Head = (psQueue->ui32Head + 1) % psQueue->ui32Length;
+    psQueue->ui32Count--;
+
+    return(pdPASS);
+}
+
+//
+// A delay only moves the simulated time on, and ends an animation frame.
+//
+static TickType_t g_xSimTicks;
+static void FrameEnd(void);
+
+static void
+vTaskDelay(TickType_t xTicks)
+{
+    FrameEnd();
+    g_xSimTicks += xTicks;
+}
+
+#include "display.c"
+
+//*****************************************************************************
+//
+// The time of a byte on the bus at 400 kbit/s, and the delays of the
+// original driver after each command byte and each data byte, in ns.
+//
+//*****************************************************************************
+#define BYTE_NS                 22500
+#define ORIG_COMMAND_DELAY_NS   200000
+#define ORIG_DATA_DELAY_NS      50000
+
+//*****************************************************************************
+//
+// The simulated bus: the time the transfers flushed so far took.
+//
+//*****************************************************************************
+static uint64_t g_ui64BusNs;
+
+//*****************************************************************************
+//
+// The bytes of the scroll commands, as I2C_OLED_Scroll() and
+// I2C_OLED_Stop_Scroll() send them (tools/i2c_sim.c checks those), and the
+// state of the scroll engine.
+//
+//*****************************************************************************
+#define SCROLL_BYTES            (2 + 9)
+#define STOP_SCROLL_BYTES       (2 + 1)
+
+static bool g_bSimScrolling;
+static uint32_t g_ui32SimScrollPages;
+
+void
+I2C_OLED_Scroll(uint8_t direction, uint8_t first_page, uint8_t last_page,
+                uint8_t interval, uint8_t vertical_offset)
+{
+    g_ui64BusNs += SCROLL_BYTES * BYTE_NS;
+    g_bSimScrolling = true;
+    g_ui32SimScrollPages = last_page - first_page + 1;
+}
+
+void
+I2C_OLED_Stop_Scroll(void)
+{
+    g_ui64BusNs += STOP_SCROLL_BYTES * BYTE_NS;
+    g_bSimScrolling = false;
+}
+
+void
+I2C_OLED_Transfer_List(tI2CTransfer *psTransfers, uint32_t ui32Count)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < ui32Count; ui32Idx++)
+    {
+        g_ui64BusNs += (1 + psTransfers[ui32Idx].ui32HeaderSize +
+                        psTransfers[ui32Idx].ui32Size) * BYTE_NS;
+        psTransfers[ui32Idx].ui32Status = I2C_XFER_DONE;
+    }
+}
+
+//*****************************************************************************
+//
+// Return the time in nanoseconds.
+//
+//*****************************************************************************
+static uint64_t
+Now(void)
+{
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+
+    return(((uint64_t)sTime.tv_sec * 1000000000) + sTime.tv_nsec);
+}
+
+//*****************************************************************************
+//
+// The time the original driver took to print a string: six command
+// transactions to move the cursor, then for each character a data
+// transaction of 8 bytes, with its delays.
+//
+//*****************************************************************************
+static uint64_t
+OriginalText(const char *pcString)
+{
+    uint64_t ui64Send, ui64Char;
+
+    ui64Send = (3 * BYTE_NS) + (2 * ORIG_COMMAND_DELAY_NS);
+    ui64Char = (2 * BYTE_NS) + ORIG_COMMAND_DELAY_NS +
+               (8 * (BYTE_NS + ORIG_DATA_DELAY_NS));
+
+    return((6 * ui64Send) + (strlen(pcString) * ui64Char));
+}
+
+//*****************************************************************************
+//
+// The screens of the lwIP host timer handler while the board comes up: the
+// status line, and the address once there is one.
+//
+//*****************************************************************************
+typedef struct
+{
+    const char *pcStatus;
+    const char *pcAddress;
+}
+tScreen;
+
+static const tScreen g_psScreens[] =
+{
+    { "Inic. Ethernet  ", 0 },
+    { "Aguard. Conexao ", 0 },
+    { "Aguard. IP      ", 0 },
+    { "Endereco IP:    ", "192.168.100.200" },
+};
+
+#define NUM_SCREENS             (sizeof(g_psScreens) / sizeof(g_psScreens[0]))
+
+//*****************************************************************************
+//
+// Draw a screen of the host timer handler straight into the framebuffer, or
+// through the display queue.
+//
+//*****************************************************************************
+static void
+DrawDirect(const tScreen *psScreen)
+{
+    OLED_FB_Text(0, 0, psScreen->pcStatus);
+    if(psScreen->pcAddress)
+    {
+        OLED_FB_Fill_Rect(0, 8, OLED_FB_WIDTH, OLED_FB_CHAR_HEIGHT, BLACK);
+        OLED_FB_Text(0, 8, psScreen->pcAddress);
+    }
+}
+
+static void
+DrawQueued(const tScreen *psScreen)
+{
+    Display_Text(0, 0, psScreen->pcStatus);
+    if(psScreen->pcAddress)
+    {
+        Display_Fill_Rect(0, 8, OLED_FB_WIDTH, OLED_FB_CHAR_HEIGHT, BLACK);
+        Display_Text(0, 8, psScreen->pcAddress);
+    }
+}
+
+//*****************************************************************************
+//
+// The bytes of each animation frame: the bus time is sampled at the end of
+// every frame.
+//
+//*****************************************************************************
+#define MAX_FRAMES              64
+
+static uint64_t g_ui64FrameStartNs;
+static uint32_t g_pui32FrameBytes[MAX_FRAMES];
+static uint32_t g_ui32Frames;
+
+static void
+FrameEnd(void)
+{
+    if(g_ui32Frames < MAX_FRAMES)
+    {
+        g_pui32FrameBytes[g_ui32Frames++] =
+            (g_ui64BusNs - g_ui64FrameStartNs) / BYTE_NS;
+    }
+    g_ui64FrameStartNs = g_ui64BusNs;
+}
+
+static void
+FrameStart(void)
+{
+    g_ui32Frames = 0;
+    g_ui64FrameStartNs = g_ui64BusNs;
+}
+
+//*****************************************************************************
+//
+// The boot and status screen animations.
+//
+//*****************************************************************************
+static bool
+Animations(void)
+{
+    static uint8_t pui8Expected[OLED_FB_PAGES * OLED_FB_WIDTH];
+    uint32_t ui32Idx, ui32Max, ui32Total, ui32Steps;
+    uint64_t ui64Start;
+    bool bFailed;
+
+    bFailed = false;
+
+    //
+    // The splash screen, with the progress bar filling its bottom page for
+    // two seconds, then the first status line, which the boot posts at once.
+    //
+    OLED_FB_Init();
+    OLED_FB_Image(0, 0, &IMG_UTFPR);
+    OLED_FB_Flush();
+    Display_Init();
+    Display_Progress(0, OLED_FB_HEIGHT - 8, OLED_FB_WIDTH, 8, 2000);
+    Display_Clear();
+    Display_Text(0, 0, "Inic. Ethernet  ");
+
+    g_xSimTicks = 0;
+    FrameStart();
+    Display_Process(0);
+    FrameEnd();
+
+    ui32Max = 0;
+    ui32Total = 0;
+    for(ui32Idx = 1; ui32Idx < (g_ui32Frames - 1); ui32Idx++)
+    {
+        ui32Total += g_pui32FrameBytes[ui32Idx];
+        if(g_pui32FrameBytes[ui32Idx] > ui32Max)
+        {
+            ui32Max = g_pui32FrameBytes[ui32Idx];
+        }
+    }
+    printf("\nboot progress bar: %u frames over %u ms, the boot is not held "
+           "up (was 2000 ms)\n", g_ui32Frames, g_xSimTicks);
+    printf("  first frame (outline):  %4u bytes\n", g_pui32FrameBytes[0]);
+    printf("  each further frame:     %4u bytes on average, %u at most\n",
+           ui32Total / (g_ui32Frames - 2), ui32Max);
+    printf("  full screen redraw:     %4u bytes\n", 8 + 2 + SSD1306_BUFFER_SIZE);
+    printf("  last, clear, first text: %4u bytes\n",
+           g_pui32FrameBytes[g_ui32Frames - 1]);
+
+    if((g_xSimTicks != 2000) || (g_ui32Frames != (1 + (2000 / DISPLAY_FRAME_MS))) ||
+       (ui32Max > 32))
+    {
+        printf("the progress bar did not animate as expected\n");
+        bFailed = true;
+    }
+
+    memcpy(pui8Expected, OLED_FB_Buffer(), sizeof(pui8Expected));
+    OLED_FB_Clear();
+    OLED_FB_Text(0, 0, "Inic. Ethernet  ");
+    if(memcmp(pui8Expected, OLED_FB_Buffer(), sizeof(pui8Expected)))
+    {
+        printf("the boot screen does not end as expected\n");
+        bFailed = true;
+    }
+
+    //
+    // The status line scrolls while the board waits for its address.  The
+    // display task keeps running, but the scroll costs nothing after it
+    // starts.
+    //
+    ui64Start = g_ui64BusNs;
+    Display_Text(0, 0, "Aguard. Conexao ");
+    Display_Scroll(SSD1306_LEFT_HORIZONTAL_SCROLL, 0, 0,
+                   SSD1306_SCROLL_25_FRAMES, 0);
+    Display_Process(0);
+    printf("\nstatus line scroll:\n");
+    printf("  start (text and scroll): %4u bytes\n",
+           (uint32_t)((g_ui64BusNs - ui64Start) / BYTE_NS));
+    if(!g_bSimScrolling || (g_ui32SimScrollPages != 1))
+    {
+        printf("the status line does not scroll\n");
+        bFailed = true;
+    }
+
+    ui64Start = g_ui64BusNs;
+    for(ui32Idx = 0; ui32Idx < 100; ui32Idx++)
+    {
+        Display_Process(0);
+    }
+    printf("  each step:               %4u bytes\n",
+           (uint32_t)((g_ui64BusNs - ui64Start) / BYTE_NS / 100));
+
+    ui64Start = g_ui64BusNs;
+    Display_Text(0, 0, "Aguard. IP      ");
+    Display_Scroll(SSD1306_LEFT_HORIZONTAL_SCROLL, 0, 0,
+                   SSD1306_SCROLL_25_FRAMES, 0);
+    Display_Process(0);
+    printf("  new text, scrolling:     %4u bytes\n",
+           (uint32_t)((g_ui64BusNs - ui64Start) / BYTE_NS));
+
+    ui64Start = g_ui64BusNs;
+    Display_Scroll_Stop();
+    Display_Text(0, 0, "Endereco IP:    ");
+    Display_Process(0);
+    ui32Total = (g_ui64BusNs - ui64Start) / BYTE_NS;
+    printf("  stop, page sent again:   %4u bytes\n", ui32Total);
+    if(g_bSimScrolling || (ui32Total < OLED_FB_WIDTH))
+    {
+        printf("the status line was not restored\n");
+        bFailed = true;
+    }
+
+    //
+    // The same marquee drawn by the processor: the line rotated by a column
+    // and sent again at every step.  A 25 frame step is about 0.24 s.
+    //
+    ui64Start = g_ui64BusNs;
+    ui32Steps = 0;
+    for(ui32Idx = 0; ui32Idx < OLED_FB_WIDTH; ui32Idx++)
+    {
+        OLED_FB_Text(OLED_FB_WIDTH - ui32Idx, 0, "Aguard. Conexao ");
+        OLED_FB_Text(-(int32_t)ui32Idx, 0, "Aguard. Conexao ");
+        OLED_FB_Flush();
+        ui32Steps++;
+    }
+    printf("  drawn by the processor:  %4u bytes per step\n",
+           (uint32_t)((g_ui64BusNs - ui64Start) / BYTE_NS / ui32Steps));
+
+    return(bFailed);
+}
+
+int
+main(void)
+{
+    static uint8_t pui8Expected[OLED_FB_PAGES * OLED_FB_WIDTH];
+    tDisplayStats sStats;
+    uint64_t ui64Worst, ui64Time, ui64Start;
+    uint32_t ui32Idx, ui32Tick;
+    char pcFlow[DISPLAY_TEXT_LEN + 1];
+    bool bFailed;
+
+    bFailed = false;
+
+    //
+    // The original driver, in the Ethernet interrupt.
+    //
+    ui64Worst = 0;
+    for(ui32Idx = 0; ui32Idx < NUM_SCREENS; ui32Idx++)
+    {
+        ui64Time = OriginalText(g_psScreens[ui32Idx].pcStatus);
+        if(g_psScreens[ui32Idx].pcAddress)
+        {
+            ui64Time += OriginalText(g_psScreens[ui32Idx].pcAddress);
+        }
+        if(ui64Time > ui64Worst)
+        {
+            ui64Worst = ui64Time;
+        }
+    }
+    printf("worst case time the lwIP host timer spends drawing:\n");
+    printf("  original driver (in the Ethernet ISR): %10.3f ms\n",
+           ui64Worst / 1e6);
+
+    //
+    // Drawing into the framebuffer and flushing in the caller.
+    //
+    OLED_FB_Init();
+    OLED_FB_Flush();
+    ui64Worst = 0;
+    for(ui32Idx = 0; ui32Idx < NUM_SCREENS; ui32Idx++)
+    {
+        g_ui64BusNs = 0;
+        DrawDirect(&g_psScreens[ui32Idx]);
+        OLED_FB_Flush();
+        if(g_ui64BusNs > ui64Worst)
+        {
+            ui64Worst = g_ui64BusNs;
+        }
+    }
+    printf("  framebuffer flushed by the caller:     %10.3f ms\n",
+           ui64Worst / 1e6);
+
+    //
+    // Posting to the display queue, with the flow readout posted every
+    // 10 ms and the display task running every 100 ms.  The host timer runs
+    // every 100 ms too, and moves to the next screen every 500 ms.
+    //
+    OLED_FB_Init();
+    OLED_FB_Flush();
+    Display_Init();
+    ui64Worst = 0;
+    for(ui32Tick = 0; ui32Tick < 300; ui32Tick++)
+    {
+        if((ui32Tick % 10) == 0)
+        {
+            ui32Idx = ui32Tick / 50;
+            if(ui32Idx < NUM_SCREENS)
+            {
+                ui64Start = Now();
+                DrawQueued(&g_psScreens[ui32Idx]);
+                ui64Time = Now() - ui64Start;
+                if(ui64Time > ui64Worst)
+                {
+                    ui64Worst = ui64Time;
+                }
+            }
+        }
+
+        snprintf(pcFlow, sizeof(pcFlow), "Vazao: %3u ml/s",
+                 (unsigned)((ui32Tick * 7) % 1000));
+        Display_Text(0, 32, pcFlow);
+
+        if((ui32Tick % 10) == 9)
+        {
+            Display_Process(0);
+        }
+    }
+    Display_Process(0);
+    printf("  display queue (host time):             %10.3f us\n",
+           ui64Worst / 1e3);
+
+    Display_Get_Stats(&sStats);
+    printf("\ndisplay queue: %u commands queued, %u coalesced, %u dropped, "
+           "%u flushes, %u bytes\n", sStats.ui32Queued, sStats.ui32Coalesced,
+           sStats.ui32Dropped, sStats.ui32Flushes, sStats.ui32Bytes);
+
+    //
+    // The display must show the last screen and the last flow reading.
+    //
+    memcpy(pui8Expected, OLED_FB_Buffer(), sizeof(pui8Expected));
+    OLED_FB_Init();
+    DrawDirect(&g_psScreens[NUM_SCREENS - 1]);
+    OLED_FB_Text(0, 32, pcFlow);
+    if(memcmp(pui8Expected, OLED_FB_Buffer(), sizeof(pui8Expected)))
+    {
+        printf("the display does not show the latest state\n");
+        bFailed = true;
+    }
+    if(g_i32Critical)
+    {
+        printf("unbalanced critical sections\n");
+        bFailed = true;
+    }
+    if(sStats.ui32Dropped)
+    {
+        printf("commands were dropped\n");
+        bFailed = true;
+    }
+
+    //
+    // A text, a clear and a text at the same position: the second text must
+    // not replace the first one, or the clear would erase it.
+    //
+    Display_Text(0, 0, "first");
+    Display_Clear();
+    Display_Text(0, 0, "second");
+    Display_Process(0);
+    memcpy(pui8Expected, OLED_FB_Buffer(), sizeof(pui8Expected));
+    OLED_FB_Clear();
+    OLED_FB_Text(0, 0, "second");
+    if(memcmp(pui8Expected, OLED_FB_Buffer(), sizeof(pui8Expected)))
+    {
+        printf("a text replaced across a clear\n");
+        bFailed = true;
+    }
+
+    //
+    // Fill the queue, then check that one more command is refused and that
+    // the queued ones are all drawn.
+    //
+    for(ui32Idx = 0; ui32Idx < DISPLAY_QUEUE_LEN; ui32Idx++)
+    {
+        if(!Display_Line(ui32Idx, 0, ui32Idx, 63, WHITE))
+        {
+            printf("the queue refused command %u\n", ui32Idx);
+            bFailed = true;
+        }
+    }
+    if(Display_Line(127, 0, 127, 63, WHITE))
+    {
+        printf("the full queue accepted a command\n");
+        bFailed = true;
+    }
+    Display_Process(0);
+    if((OLED_FB_Buffer()[DISPLAY_QUEUE_LEN - 1] != 0xff) ||
+       (OLED_FB_Buffer()[127] != 0))
+    {
+        printf("the queued lines were not drawn as expected\n");
+        bFailed = true;
+    }
+
+    if(Animations())
+    {
+        bFailed = true;
+    }
+
+    printf("%s\n", bFailed ? "FAILED" : "all checks passed");
+
+    return(bFailed ? 1 : 0);
+}
@@ -0,0 +1,291 @@
+//*****************************************************************************
+//
+// filter_test.c - Host test of the sample filters (filter.c).
+//
+// This is not part of the firmware.  Build and run it on the host with:
+//
+//     cc -O2 -I. tools/filter_test.c -lm -o filter_test && ./filter_test
+//
+// The moving average and the median are checked against a direct
+// computation over the last samples, for every length and for samples over
+// the whole 32-bit range.  The exponential moving average is checked
+// against the same average in floating point.
+//
+// The test then feeds the three filters a flow reading with some noise and
+// an occasional wild sample, as a missed or doubled edge gives, and prints
+// how far each strays from the true value.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "filter.c"
+
+static uint32_t g_ui32Failures;
+
+//*****************************************************************************
+//
+// Check the outcome of a test.
+//
+//*****************************************************************************
+static void
+Check(const char *pcTest, bool bPass)
+{
+    printf("%-56s %s\n", pcTest, bPass ? "ok" : "FAILED");
+    if(!bPass)
+    {
+        g_ui32Failures++;
+    }
+}
+
+//
+// A random sample, over the whole range or below a limit.
+//
+static uint32_t
+Random(uint32_t ui32Limit)
+{
+    uint32_t ui32Sample;
+
+    ui32Sample = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+
+    return(ui32Limit ? (ui32Sample % ui32Limit) : ui32Sample);
+}
+
+static int
+Compare(const void *pvA, const void *pvB)
+{
+    uint32_t ui32A = *(const uint32_t *)pvA;
+    uint32_t ui32B = *(const uint32_t *)pvB;
+
+    return((ui32A > ui32B) - (ui32A < ui32B));
+}
+
+//*****************************************************************************
+//
+// The moving average and the median against a direct computation.
+//
+//*****************************************************************************
+static void
+TestWindows(void)
+{
+    uint32_t pui32History[1000], pui32Sorted[FILTER_MAX_LENGTH];
+    uint32_t ui32Length, ui32Idx, ui32Count, ui32Out, ui32Expected, ui32Pass;
+    uint32_t ui32Limit;
+    uint64_t ui64Sum;
+    bool bAverage, bMedian;
+    tFilter sAverage, sMedian;
+
+    bAverage = true;
+    bMedian = true;
+    for(ui32Pass = 0; ui32Pass < 3; ui32Pass++)
+    {
+        //
+        // Small values with many repeats, flow readings, and the full range.
+        //
+        ui32Limit = (ui32Pass == 0) ? 4 : ((ui32Pass == 1) ? 1000000 : 0);
+
+        for(ui32Length = 1; ui32Length <= FILTER_MAX_LENGTH; ui32Length++)
+        {
+            Filter_Init(&sAverage, FILTER_AVERAGE, ui32Length);
+            Filter_Init(&sMedian, FILTER_MEDIAN, ui32Length);
+
+            for(ui32Idx = 0; ui32Idx < 1000; ui32Idx++)
+            {
+                pui32History[ui32Idx] = Random(ui32Limit);
+                ui32Count = ((ui32Idx + 1) < ui32Length) ? (ui32Idx + 1) :
+                                                           ui32Length;
+
+                ui64Sum = 0;
+                for(ui32Out = 0; ui32Out < ui32Count; ui32Out++)
+                {
+                    pui32Sorted[ui32Out] = pui32History[ui32Idx - ui32Out];
+                    ui64Sum += pui32Sorted[ui32Out];
+                }
+
+                ui32Expected = (uint32_t)((ui64Sum + (ui32Count / 2)) /
+                                          ui32Count);
+                if(Filter_Add(&sAverage, pui32History[ui32Idx]) !=
+                   ui32Expected)
+                {
+                    bAverage = false;
+                }
+
+                qsort(pui32Sorted, ui32Count, sizeof(uint32_t), Compare);
+                ui32Expected = (ui32Count & 1) ?
+                    pui32Sorted[ui32Count / 2] :
+                    (uint32_t)(((uint64_t)pui32Sorted[(ui32Count / 2) - 1] +
+                                pui32Sorted[ui32Count / 2] + 1) / 2);
+                if(Filter_Add(&sMedian, pui32History[ui32Idx]) !=
+                   ui32Expected)
+                {
+                    bMedian = false;
+                }
+            }
+        }
+    }
+
+    Check("moving average matches, lengths 1 to 16", bAverage);
+    Check("median matches, lengths 1 to 16", bMedian);
+}
+
+//*****************************************************************************
+//
+// The exponential moving average against floating point.
+//
+//*****************************************************************************
+static void
+TestEMA(void)
+{
+    uint32_t ui32Shift, ui32Idx, ui32Sample, ui32Out;
+    double dAverage, dWeight, dWorst;
+    bool bFirst, bSteady;
+    tFilter sEMA;
+
+    dWorst = 0;
+    bFirst = true;
+    bSteady = true;
+    for(ui32Shift = 0; ui32Shift <= 8; ui32Shift++)
+    {
+        dWeight = 1.0 / (1 << ui32Shift);
+        Filter_Init(&sEMA, FILTER_EMA, ui32Shift);
+
+        for(ui32Idx = 0; ui32Idx < 5000; ui32Idx++)
+        {
+            ui32Sample = 500000 + Random(20000);
+            ui32Out = Filter_Add(&sEMA, ui32Sample);
+            if(!ui32Idx)
+            {
+                dAverage = ui32Sample;
+                bFirst = bFirst && (ui32Out == ui32Sample);
+            }
+            else
+            {
+                dAverage += (ui32Sample - dAverage) * dWeight;
+            }
+            if(fabs(ui32Out - dAverage) > dWorst)
+            {
+                dWorst = fabs(ui32Out - dAverage);
+            }
+        }
+
+        //
+        // A steady input is reached exactly.
+        //
+        for(ui32Idx = 0; ui32Idx < (200u << ui32Shift); ui32Idx++)
+        {
+            ui32Out = Filter_Add(&sEMA, 123456);
+        }
+        bSteady = bSteady && (ui32Out == 123456);
+    }
+
+    printf("  at most %.2f off floating point\n", dWorst);
+    Check("exponential moving average starts at the first sample", bFirst);
+    Check("exponential moving average within 2 of floating point",
+          dWorst <= 2.0);
+    Check("exponential moving average settles on a steady input", bSteady);
+}
+
+//*****************************************************************************
+//
+// Lengths out of range, and reset.
+//
+//*****************************************************************************
+static void
+TestLimits(void)
+{
+    tFilter sFilter;
+    bool bPass;
+
+    Filter_Init(&sFilter, FILTER_AVERAGE, 0);
+    bPass = (sFilter.ui32Length == 1);
+    Filter_Init(&sFilter, FILTER_MEDIAN, 100);
+    bPass = bPass && (sFilter.ui32Length == FILTER_MAX_LENGTH);
+    Filter_Init(&sFilter, FILTER_EMA, 40);
+    bPass = bPass && (sFilter.ui32Length == 16);
+    Check("lengths out of range clamped", bPass);
+
+    Filter_Init(&sFilter, FILTER_AVERAGE, 4);
+    bPass = Filter_Is_Empty(&sFilter) && (Filter_Get(&sFilter) == 0);
+    Filter_Add(&sFilter, 10);
+    Filter_Add(&sFilter, 20);
+    bPass = bPass && !Filter_Is_Empty(&sFilter) &&
+            (Filter_Get(&sFilter) == 15);
+    Filter_Reset(&sFilter);
+    bPass = bPass && Filter_Is_Empty(&sFilter) &&
+            (Filter_Get(&sFilter) == 0) && (Filter_Add(&sFilter, 7) == 7);
+    Check("reset forgets the samples", bPass);
+}
+
+//*****************************************************************************
+//
+// A flow reading of 50 Hz in millihertz with noise and the odd wild sample,
+// through each filter at the length the firmware uses.
+//
+//*****************************************************************************
+static void
+TestFlow(void)
+{
+    static const char * const ppcNames[] = { "average", "median", "ema" };
+    static const uint32_t pui32Lengths[] = { 10, 5, 3 };
+    uint32_t ui32Mode, ui32Idx, ui32Sample, ui32Out;
+    double dError, dWorst, dTotal;
+    tFilter sFilter;
+
+    printf("\n  50 Hz with 0.2%% noise and 1 sample in 50 doubled\n");
+    printf("  %-8s %6s %12s %12s\n", "filter", "length", "worst mHz",
+           "mean mHz");
+
+    for(ui32Mode = FILTER_AVERAGE; ui32Mode <= FILTER_EMA; ui32Mode++)
+    {
+        srand(2);
+        Filter_Init(&sFilter, ui32Mode, pui32Lengths[ui32Mode]);
+        dWorst = 0;
+        dTotal = 0;
+
+        for(ui32Idx = 0; ui32Idx < 10000; ui32Idx++)
+        {
+            ui32Sample = 49900 + Random(200);
+            if(!(Random(50)))
+            {
+                ui32Sample *= 2;
+            }
+            ui32Out = Filter_Add(&sFilter, ui32Sample);
+            if(ui32Idx >= 100)
+            {
+                dError = fabs((double)ui32Out - 50000);
+                dTotal += dError;
+                if(dError > dWorst)
+                {
+                    dWorst = dError;
+                }
+            }
+        }
+
+        printf("  %-8s %6u %12.0f %12.1f\n", ppcNames[ui32Mode],
+               pui32Lengths[ui32Mode], dWorst, dTotal / 9900);
+    }
+    printf("\n");
+}
+
+int
+main(void)
+{
+    srand(1);
+
+    TestWindows();
+    TestEMA();
+    TestLimits();
+    TestFlow();
+
+    if(g_ui32Failures)
+    {
+        printf("%u failures\n", g_ui32Failures);
+        return(1);
+    }
+
+    printf("all passed\n");
+
+    return(0);
+}
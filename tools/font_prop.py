@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+#
+# font_prop.py - Make the proportional font of fonts/ from font_default.
+#
+# Usage (from the project directory):
+#
+#     python3 tools/font_prop.py -o fonts/font_prop.c fonts/font_default.c
+#
+# The printable characters of font_default are trimmed of their blank columns
+# on both sides, and laid out as the tFont FONT_PROP of oled_font.h with a
+# blank column between glyphs.  The space keeps SPACE_WIDTH columns.  The
+# digits are all as wide as the widest of them, centered, so numbers do not
+# move around as their value changes.
+#
+# Pass --show to print every glyph.
+#
+
+import argparse
+import os
+import re
+import sys
+
+FIRST = 0x20
+LAST = 0x7e
+HEIGHT = 8
+SPACING = 1
+SPACE_WIDTH = 3
+
+#
+# The width of the glyphs of font_default, and the widest glyph that can be
+# scaled (OLED_FONT_MAX_WIDTH in oled_font.h).
+#
+FIXED_WIDTH = 8
+MAX_WIDTH = 8
+
+
+def load(path):
+    with open(path) as f:
+        text = f.read()
+    start = text.index('font_default[]')
+    body = text[start:text.index('};', start)]
+    data = bytes(int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+', body))
+    if len(data) < (LAST + 1) * FIXED_WIDTH:
+        sys.exit('%s: font_default is too short' % path)
+    return data
+
+
+def trim(columns):
+    start = 0
+    while (start < len(columns)) and not columns[start]:
+        start += 1
+    end = len(columns)
+    while (end > start) and not columns[end - 1]:
+        end -= 1
+    return columns[start:end]
+
+
+def pad(columns, width):
+    left = (width - len(columns)) // 2
+    return (bytes(left) + columns +
+            bytes(width - len(columns) - left))
+
+
+def make(data):
+    glyphs = []
+    for char in range(FIRST, LAST + 1):
+        columns = trim(data[char * FIXED_WIDTH:(char + 1) * FIXED_WIDTH])
+        if char == ord(' '):
+            columns = bytes(SPACE_WIDTH)
+        elif not columns:
+            columns = bytes(1)
+        glyphs.append(columns)
+
+    digits = range(ord('0') - FIRST, ord('9') - FIRST + 1)
+    width = max(len(glyphs[i]) for i in digits)
+    for i in digits:
+        glyphs[i] = pad(glyphs[i], width)
+
+    if max(len(g) for g in glyphs) > MAX_WIDTH:
+        sys.exit('a glyph is too wide to be scaled')
+
+    return glyphs
+
+
+def show(glyphs):
+    for i, columns in enumerate(glyphs):
+        print('%r, %u columns' % (chr(FIRST + i), len(columns)))
+        for row in range(HEIGHT):
+            print('    ' + ''.join('#' if (c >> row) & 1 else '.'
+                                   for c in columns))
+
+
+def char_name(char):
+    if char == ord(' '):
+        return 'space'
+    if char == ord('\\'):
+        return 'backslash'
+    return chr(char)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('-o', '--output', required=True)
+    parser.add_argument('--show', action='store_true')
+    parser.add_argument('input')
+    args = parser.parse_args()
+
+    glyphs = make(load(args.input))
+    if args.show:
+        show(glyphs)
+
+    offsets = []
+    offset = 0
+    for columns in glyphs:
+        offsets.append(offset)
+        offset += len(columns)
+
+    with open(args.output, 'w') as f:
+        f.write('//' + '*' * 77 + '\n')
+        f.write('//\n')
+        f.write('// %s - A proportional font made from font_default.\n' %
+                os.path.basename(args.output))
+        f.write('//\n')
+        f.write('// This file is generated by tools/font_prop.py:\n')
+        f.write('//\n')
+        f.write('//     python3 tools/font_prop.py -o fonts/font_prop.c '
+                'fonts/font_default.c\n')
+        f.write('//\n')
+        f.write('//' + '*' * 77 + '\n')
+        f.write('#include <stdint.h>\n')
+        f.write('#include "fonts.h"\n')
+
+        f.write('\nstatic const uint8_t g_pui8Widths[] =\n{\n')
+        for start in range(0, len(glyphs), 16):
+            f.write('    ' + ', '.join('%u' % len(g)
+                                       for g in glyphs[start:start + 16]) +
+                    ',\n')
+        f.write('};\n')
+
+        f.write('\nstatic const uint16_t g_pui16Offsets[] =\n{\n')
+        for start in range(0, len(offsets), 12):
+            f.write('    ' + ', '.join('%u' % o
+                                       for o in offsets[start:start + 12]) +
+                    ',\n')
+        f.write('};\n')
+
+        f.write('\nstatic const uint8_t g_pui8Data[] =\n{\n')
+        for i, columns in enumerate(glyphs):
+            f.write('    %-48s // %s\n' %
+                    (''.join('0x%02x, ' % c for c in columns).rstrip(),
+                     char_name(FIRST + i)))
+        f.write('};\n')
+
+        f.write('\nconst tFont FONT_PROP =\n{\n')
+        f.write('    %u, 0, %u, 0x%02x, 0x%02x, g_pui8Widths, g_pui16Offsets,'
+                ' g_pui8Data\n' % (HEIGHT, SPACING, FIRST, LAST))
+        f.write('};\n')
+
+
+if __name__ == '__main__':
+    main()
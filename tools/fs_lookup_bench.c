@@ -0,0 +1,361 @@
+//*****************************************************************************
+//
+// fs_lookup_bench.c - Host benchmark of the file name lookup of the web file
+// system (io_fs.c).
+//
+// This is not part of the firmware.  Build and run it on the host with:
+//
+//     cc -O2 -I. -Itools/host tools/fs_lookup_bench.c tools/host/io_host.c
+//         json.c display_mirror.c -o fs_lookup_bench && ./fs_lookup_bench
+//
+// io_fs.c is compiled unchanged against the stand-ins in tools/host.  The
+// benchmark checks that every file in the image and every dynamic file is
+// found through the hash index, with or without request parameters, that
+// unknown names and names that only share a prefix with a file are not,
+// and that the index is no more than half full.  It then reports how many
+// lookups per second the index and the list walk it replaced manage, over
+// all the names the web pages request.  The figures are for the host; scale
+// them by the clock and the instructions per cycle of the target to
+// estimate the cost on the board.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "io_fs.c"
+
+//*****************************************************************************
+//
+// The time each measurement runs for, in seconds.
+//
+//*****************************************************************************
+#define RUN_TIME                0.5
+
+//*****************************************************************************
+//
+// The dynamic files in the order the list walk that the index replaced tried
+// them, before it walked the file system image.
+//
+//*****************************************************************************
+static const char * const g_ppcDynamicNames[] =
+{
+    "/cgi-bin/toggle_led", "/get_speed", "/cgi-bin/set_speed",
+    "/status.json", "/display.pbm", "/display.json", "/boot.json",
+    "/loop.json"
+};
+
+#define NUM_DYNAMIC_NAMES       (sizeof(g_ppcDynamicNames) /                  \
+                                 sizeof(g_ppcDynamicNames[0]))
+
+//*****************************************************************************
+//
+// The names looked up: every file in the image and every dynamic file, plus
+// a few that are not there.
+//
+//*****************************************************************************
+#define MAX_NAMES               64
+
+static const char *g_ppcNames[MAX_NAMES];
+static uint32_t g_ui32NumNames;
+
+//*****************************************************************************
+//
+// The number of failed checks, and a sink that keeps the compiler from
+// optimizing the lookups away.
+//
+//*****************************************************************************
+static uint32_t g_ui32Failures;
+static volatile uintptr_t g_uiSink;
+
+//*****************************************************************************
+//
+// Stand-in for the web server's Server-Sent Events broadcast.
+//
+//*****************************************************************************
+void
+httpd_sse_broadcast(const char *pcData, u16_t ui16Len)
+{
+}
+
+//*****************************************************************************
+//
+// Check the outcome of a test.
+//
+//*****************************************************************************
+static void
+Check(const char *pcTest, bool bPass)
+{
+    printf("%-56s %s\n", pcTest, bPass ? "ok" : "FAILED");
+    if(!bPass)
+    {
+        g_ui32Failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// Return the time in seconds.
+//
+//*****************************************************************************
+static double
+Now(void)
+{
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+    return(sTime.tv_sec + (sTime.tv_nsec / 1e9));
+}
+
+//*****************************************************************************
+//
+// The lookup that the hash index replaced: the dynamic file names one after
+// the other, then a walk of the file system image.
+//
+//*****************************************************************************
+static const void *
+ListLookup(const char *pcName)
+{
+    const struct fsdata_file *psTree;
+    uint32_t ui32Idx, ui32Len;
+
+    for(ui32Idx = 0; ui32Idx < NUM_DYNAMIC_NAMES; ui32Idx++)
+    {
+        ui32Len = strlen(g_ppcDynamicNames[ui32Idx]);
+        if(ustrncmp(pcName, g_ppcDynamicNames[ui32Idx], ui32Len) == 0)
+        {
+            return(g_ppcDynamicNames[ui32Idx]);
+        }
+    }
+
+    for(psTree = FS_ROOT; psTree != NULL; psTree = psTree->next)
+    {
+        if(ustrcmp(pcName, (const char *)psTree->name) == 0)
+        {
+            return(psTree);
+        }
+    }
+
+    return(NULL);
+}
+
+//*****************************************************************************
+//
+// Return the number of lookups per second made by one of the lookups over
+// all the names.
+//
+//*****************************************************************************
+static double
+Measure(const void *(*pfnLookup)(const char *pcName))
+{
+    double dStart, dTime;
+    uint32_t ui32Lookups, ui32Idx, ui32Pass;
+
+    ui32Lookups = 0;
+    dStart = Now();
+    do
+    {
+        for(ui32Pass = 0; ui32Pass < 1000; ui32Pass++)
+        {
+            for(ui32Idx = 0; ui32Idx < g_ui32NumNames; ui32Idx++)
+            {
+                g_uiSink += (uintptr_t)pfnLookup(g_ppcNames[ui32Idx]);
+            }
+        }
+        ui32Lookups += 1000 * g_ui32NumNames;
+        dTime = Now() - dStart;
+    }
+    while(dTime < RUN_TIME);
+
+    return(ui32Lookups / dTime);
+}
+
+//*****************************************************************************
+//
+// The index lookup, in the form Measure() takes.
+//
+//*****************************************************************************
+static const void *
+IndexLookup(const char *pcName)
+{
+    return(FSIndexLookup(pcName));
+}
+
+//*****************************************************************************
+//
+// Open and close a file, in the form Measure() takes.  This is what the web
+// server does for every request.
+//
+//*****************************************************************************
+static const void *
+OpenClose(const char *pcName)
+{
+    struct fs_file *psFile;
+
+    psFile = fs_open(pcName);
+    if(psFile)
+    {
+        fs_close(psFile);
+    }
+
+    return(psFile);
+}
+
+//*****************************************************************************
+//
+// Check that every name in the image and every dynamic file is found, and
+// that names that are not there are not.
+//
+//*****************************************************************************
+static void
+TestLookup(void)
+{
+    const struct fsdata_file *psTree;
+    const tFSIndexEntry *psEntry;
+    struct fs_file *psFile;
+    uint32_t ui32Idx, ui32Files;
+    bool bPass;
+
+    bPass = true;
+    ui32Files = 0;
+    for(psTree = FS_ROOT; psTree != NULL; psTree = psTree->next)
+    {
+        ui32Files++;
+        g_ppcNames[g_ui32NumNames++] = (const char *)psTree->name;
+
+        psEntry = FSIndexLookup((const char *)psTree->name);
+        psFile = fs_open((const char *)psTree->name);
+        if(!psEntry || (psEntry->psFile != psTree) || !psFile ||
+           (psFile->data != (const char *)psTree->data) ||
+           (psFile->len != psTree->len))
+        {
+            printf("  %s not found\n", psTree->name);
+            bPass = false;
+        }
+        if(psFile)
+        {
+            fs_close(psFile);
+        }
+    }
+    Check("every file in the image is found", bPass);
+    Check("FS_NUMFILES counts the files in the image",
+          ui32Files == FS_NUMFILES);
+
+    bPass = true;
+    for(ui32Idx = 0; ui32Idx < NUM_DYNAMIC_NAMES; ui32Idx++)
+    {
+        g_ppcNames[g_ui32NumNames++] = g_ppcDynamicNames[ui32Idx];
+
+        psEntry = FSIndexLookup(g_ppcDynamicNames[ui32Idx]);
+        if(!psEntry || (psEntry->ui32Handler != (ui32Idx + 1)))
+        {
+            printf("  %s not found\n", g_ppcDynamicNames[ui32Idx]);
+            bPass = false;
+        }
+    }
+    Check("every dynamic file is found", bPass);
+
+    psEntry = FSIndexLookup("/cgi-bin/set_speed?percent=40");
+    Check("parameters after the name are ignored",
+          psEntry && (psEntry->ui32Handler == 3));
+
+    g_ppcNames[g_ui32NumNames++] = "/missing.htm";
+    g_ppcNames[g_ui32NumNames++] = "/index";
+    g_ppcNames[g_ui32NumNames++] = "/index.htm.bak";
+    Check("unknown names are not found",
+          !FSIndexLookup("/missing.htm") && !fs_open("/missing.htm"));
+    Check("a prefix of a name is not found", !FSIndexLookup("/index"));
+    Check("a name with a known prefix is not found",
+          !FSIndexLookup("/index.htm.bak") && !FSIndexLookup("/get_speeds"));
+}
+
+//*****************************************************************************
+//
+// Check how full the index is and how far entries are from their slot.
+//
+//*****************************************************************************
+static void
+TestIndex(void)
+{
+    uint32_t ui32Idx, ui32Used, ui32Probes, ui32MaxProbes, ui32Total;
+    uint32_t ui32Len;
+
+    ui32Used = 0;
+    ui32Total = 0;
+    ui32MaxProbes = 0;
+    for(ui32Idx = 0; ui32Idx < FS_INDEX_SIZE; ui32Idx++)
+    {
+        if(!g_psFSIndex[ui32Idx].pcName)
+        {
+            continue;
+        }
+
+        ui32Used++;
+        ui32Probes = ((ui32Idx - (FSNameHash(g_psFSIndex[ui32Idx].pcName,
+                                             &ui32Len) &
+                                  (FS_INDEX_SIZE - 1))) &
+                      (FS_INDEX_SIZE - 1)) + 1;
+        ui32Total += ui32Probes;
+        if(ui32Probes > ui32MaxProbes)
+        {
+            ui32MaxProbes = ui32Probes;
+        }
+    }
+
+    printf("index: %u of %u slots used, %.2f probes on average, %u at most\n",
+           ui32Used, FS_INDEX_SIZE, (double)ui32Total / ui32Used,
+           ui32MaxProbes);
+    Check("the index holds the image and the dynamic files",
+          ui32Used == (FS_NUMFILES + NUM_DYNAMIC_NAMES));
+    Check("the index is at most half full",
+          (ui32Used * 2) <= FS_INDEX_SIZE);
+}
+
+//*****************************************************************************
+//
+// Compare the speed of the lookups.
+//
+//*****************************************************************************
+static void
+TestSpeed(void)
+{
+    double dList, dIndex, dOpen;
+
+    dList = Measure(ListLookup);
+    dIndex = Measure(IndexLookup);
+    dOpen = Measure(OpenClose);
+
+    printf("list walk:        %12.0f lookups/s\n", dList);
+    printf("hash index:       %12.0f lookups/s (%.1f times the list walk)\n",
+           dIndex, dIndex / dList);
+    printf("fs_open/fs_close: %12.0f opens/s\n", dOpen);
+
+    Check("the index is faster than the list walk", dIndex > dList);
+}
+
+//*****************************************************************************
+//
+// Run the tests.
+//
+//*****************************************************************************
+int
+main(void)
+{
+    io_fs_init();
+
+    TestLookup();
+    TestIndex();
+    TestSpeed();
+
+    if(g_ui32Failures)
+    {
+        printf("%u checks failed\n", g_ui32Failures);
+        return(1);
+    }
+
+    printf("all checks passed\n");
+
+    return(0);
+}
@@ -0,0 +1,10 @@
+//*****************************************************************************
+//
+// rom.h - Host stand-in for the TivaWare ROM function table, which is not
+// used on the host.
+//
+//*****************************************************************************
+#ifndef __DRIVERLIB_ROM_H__
+#define __DRIVERLIB_ROM_H__
+
+#endif // __DRIVERLIB_ROM_H__
@@ -0,0 +1,10 @@
+//*****************************************************************************
+//
+// ssi.h - Host stand-in for the TivaWare SSI driver, which is not used on the
+// host.
+//
+//*****************************************************************************
+#ifndef __DRIVERLIB_SSI_H__
+#define __DRIVERLIB_SSI_H__
+
+#endif // __DRIVERLIB_SSI_H__
@@ -0,0 +1,246 @@
+//*****************************************************************************
+//
+// http_host.c - A minimal HTTP client for the host tests of the web server.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "lwip/tcp.h"
+#include "lwip_host.h"
+#include "http_host.h"
+
+//*****************************************************************************
+//
+// The number of times in a row the server may be polled without sending
+// anything before a read gives up on it.
+//
+//*****************************************************************************
+#define HTTP_MAX_IDLE_POLLS     8
+
+//*****************************************************************************
+//
+// Read what the server sends on a connection into pcBuf, acknowledging it as
+// it arrives, until ui32Want bytes have been read (or, if ui32Want is 0,
+// until the server has closed the connection and everything it sent has
+// been acknowledged).  The server's poll timer is run whenever it has
+// nothing unacknowledged; if it then sends nothing several times in a row,
+// the read gives up.  Returns the number of bytes read.
+//
+//*****************************************************************************
+uint32_t
+HTTPRead(struct tcp_pcb *psPCB, char *pcBuf, uint32_t ui32Size,
+         uint32_t ui32Want)
+{
+    uint32_t ui32Len, ui32Idle;
+
+    ui32Len = 0;
+    ui32Idle = 0;
+    while(ui32Idle < HTTP_MAX_IDLE_POLLS)
+    {
+        ui32Len += HostTCPRead(psPCB, pcBuf + ui32Len, ui32Size - ui32Len);
+        if(ui32Want && (ui32Len >= ui32Want))
+        {
+            break;
+        }
+
+        if(HostTCPUnacked(psPCB))
+        {
+            HostTCPAck(psPCB);
+            ui32Idle = 0;
+            continue;
+        }
+
+        if(!HostTCPIsOpen(psPCB))
+        {
+            ui32Len += HostTCPRead(psPCB, pcBuf + ui32Len,
+                                   ui32Size - ui32Len);
+            break;
+        }
+
+        HostTCPPoll(psPCB);
+        if(!HostTCPUnacked(psPCB))
+        {
+            ui32Idle++;
+        }
+    }
+
+    return(ui32Len);
+}
+
+//*****************************************************************************
+//
+// Find the end of the headers of a response in pcBuf.  Returns true if the
+// headers are there and so is all of the body that the Content-Length
+// header announces.
+//
+//*****************************************************************************
+bool
+HTTPParse(tHTTPResponse *psResponse, char *pcBuf, uint32_t ui32Len)
+{
+    const char *pcValue;
+    uint32_t ui32Idx;
+
+    psResponse->pcData = pcBuf;
+    psResponse->ui32Len = ui32Len;
+    psResponse->ui32HeaderLen = 0;
+
+    for(ui32Idx = 0; (ui32Idx + 4) <= ui32Len; ui32Idx++)
+    {
+        if(memcmp(pcBuf + ui32Idx, "\r\n\r\n", 4) == 0)
+        {
+            psResponse->ui32HeaderLen = ui32Idx + 4;
+            break;
+        }
+    }
+    if(!psResponse->ui32HeaderLen)
+    {
+        return(false);
+    }
+
+    pcValue = HTTPHeader(psResponse, "Content-Length", NULL);
+    if(pcValue)
+    {
+        psResponse->ui32Len = LWIP_MIN(ui32Len, psResponse->ui32HeaderLen +
+                                       strtoul(pcValue, NULL, 10));
+        return(psResponse->ui32Len == (psResponse->ui32HeaderLen +
+                                       strtoul(pcValue, NULL, 10)));
+    }
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Read from a connection until pcBuf, which already holds *pui32Len bytes,
+// starts with a whole response, and update *pui32Len.  Anything after the
+// response is the start of the next one.  Returns true if a whole response
+// came in.
+//
+//*****************************************************************************
+bool
+HTTPReadResponse(struct tcp_pcb *psPCB, char *pcBuf, uint32_t ui32Size,
+                 uint32_t *pui32Len, tHTTPResponse *psResponse)
+{
+    uint32_t ui32Read;
+
+    while(!HTTPParse(psResponse, pcBuf, *pui32Len))
+    {
+        if(*pui32Len == ui32Size)
+        {
+            return(false);
+        }
+
+        ui32Read = HTTPRead(psPCB, pcBuf + *pui32Len, ui32Size - *pui32Len,
+                            1);
+        if(!ui32Read)
+        {
+            return(false);
+        }
+        *pui32Len += ui32Read;
+    }
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Return the value of a header of a response, or NULL if it has none.  The
+// length of the value is stored in *pui32Len unless that is NULL.
+//
+//*****************************************************************************
+const char *
+HTTPHeader(const tHTTPResponse *psResponse, const char *pcName,
+           uint32_t *pui32Len)
+{
+    const char *pcLine, *pcEnd, *pcHeaders;
+    uint32_t ui32NameLen;
+
+    ui32NameLen = strlen(pcName);
+    pcHeaders = psResponse->pcData + psResponse->ui32HeaderLen;
+    pcLine = memchr(psResponse->pcData, '\n', psResponse->ui32HeaderLen);
+    while(pcLine && ((pcLine + 1) < pcHeaders))
+    {
+        pcLine++;
+        pcEnd = memchr(pcLine, '\r', pcHeaders - pcLine);
+        if(!pcEnd)
+        {
+            break;
+        }
+        if(((uint32_t)(pcEnd - pcLine) > ui32NameLen) &&
+           (pcLine[ui32NameLen] == ':') &&
+           (strncasecmp(pcLine, pcName, ui32NameLen) == 0))
+        {
+            pcLine += ui32NameLen + 1;
+            while(*pcLine == ' ')
+            {
+                pcLine++;
+            }
+            if(pui32Len)
+            {
+                *pui32Len = pcEnd - pcLine;
+            }
+            return(pcLine);
+        }
+        pcLine = memchr(pcLine, '\n', pcHeaders - pcLine);
+    }
+
+    return(NULL);
+}
+
+//*****************************************************************************
+//
+// Return the status code of a response, or 0 if it has no status line.
+//
+//*****************************************************************************
+uint32_t
+HTTPStatus(const tHTTPResponse *psResponse)
+{
+    if((psResponse->ui32HeaderLen < 12) ||
+       (strncmp(psResponse->pcData, "HTTP/1.", 7) != 0))
+    {
+        return(0);
+    }
+
+    return(strtoul(psResponse->pcData + 9, NULL, 10));
+}
+
+//*****************************************************************************
+//
+// Open a connection, send a request on it in pbufs of ui32PbufSize bytes
+// and read the response into pcBuf.  The request must ask for the
+// connection to be closed, which the client does too once the server has.
+// The control block is left in TIME_WAIT.  Returns true if a whole response
+// came back.
+//
+//*****************************************************************************
+bool
+HTTPGet(const char *pcRequest, uint32_t ui32PbufSize, char *pcBuf,
+        uint32_t ui32Size, tHTTPResponse *psResponse)
+{
+    struct tcp_pcb *psPCB;
+    uint32_t ui32Len;
+
+    psResponse->pcData = pcBuf;
+    psResponse->ui32Len = 0;
+    psResponse->ui32HeaderLen = 0;
+
+    psPCB = HostTCPConnect();
+    if(!psPCB)
+    {
+        return(false);
+    }
+
+    if(HostTCPSend(psPCB, pcRequest, strlen(pcRequest),
+                   ui32PbufSize) != ERR_OK)
+    {
+        return(false);
+    }
+
+    ui32Len = HTTPRead(psPCB, pcBuf, ui32Size, 0);
+    HostTCPClose(psPCB);
+
+    return(HTTPParse(psResponse, pcBuf, ui32Len));
+}
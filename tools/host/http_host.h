@@ -0,0 +1,51 @@
+//*****************************************************************************
+//
+// http_host.h - A minimal HTTP client for the host tests of the web server.
+//
+// The client runs on top of the lwIP stand-in (lwip_host.h): it sends a
+// request on a connection, then reads and acknowledges what the server sends
+// until it has a whole response, the way a browser would.
+//
+//*****************************************************************************
+#ifndef __HTTP_HOST_H__
+#define __HTTP_HOST_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "lwip/tcp.h"
+
+//*****************************************************************************
+//
+// A response, as read from a connection.  pcData holds ui32Len bytes, of
+// which the first ui32HeaderLen are the status line and headers, including
+// the blank line that ends them.
+//
+//*****************************************************************************
+typedef struct
+{
+    char *pcData;
+    uint32_t ui32Len;
+    uint32_t ui32HeaderLen;
+}
+tHTTPResponse;
+
+//*****************************************************************************
+//
+// Prototypes of the functions exported by the client.
+//
+//*****************************************************************************
+extern uint32_t HTTPRead(struct tcp_pcb *psPCB, char *pcBuf,
+                         uint32_t ui32Size, uint32_t ui32Want);
+extern bool HTTPReadResponse(struct tcp_pcb *psPCB, char *pcBuf,
+                             uint32_t ui32Size, uint32_t *pui32Len,
+                             tHTTPResponse *psResponse);
+extern bool HTTPParse(tHTTPResponse *psResponse, char *pcBuf,
+                      uint32_t ui32Len);
+extern const char *HTTPHeader(const tHTTPResponse *psResponse,
+                              const char *pcName, uint32_t *pui32Len);
+extern uint32_t HTTPStatus(const tHTTPResponse *psResponse);
+extern bool HTTPGet(const char *pcRequest, uint32_t ui32PbufSize,
+                    char *pcBuf, uint32_t ui32Size,
+                    tHTTPResponse *psResponse);
+
+#endif // __HTTP_HOST_H__
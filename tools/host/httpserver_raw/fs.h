@@ -0,0 +1,25 @@
+//*****************************************************************************
+//
+// fs.h - Host stand-in for the file system interface of the lwIP web server.
+//
+//*****************************************************************************
+#ifndef __FS_H__
+#define __FS_H__
+
+#include "lwip/opt.h"
+
+struct fs_file
+{
+    const char *data;
+    int len;
+    int index;
+    void *pextension;
+    u8_t http_header_included;
+};
+
+struct fs_file *fs_open(const char *name);
+void fs_close(struct fs_file *file);
+int fs_read(struct fs_file *file, char *buffer, int count);
+int fs_bytes_left(struct fs_file *file);
+
+#endif // __FS_H__
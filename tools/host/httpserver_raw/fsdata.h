@@ -0,0 +1,21 @@
+//*****************************************************************************
+//
+// fsdata.h - Host stand-in for the layout of the web server's file system
+// image, as generated by tools/makefsdata.py.
+//
+//*****************************************************************************
+#ifndef __FSDATA_H__
+#define __FSDATA_H__
+
+#include "lwip/opt.h"
+#include "fs.h"
+
+struct fsdata_file
+{
+    const struct fsdata_file *next;
+    const unsigned char *name;
+    const unsigned char *data;
+    int len;
+};
+
+#endif // __FSDATA_H__
@@ -0,0 +1,59 @@
+//*****************************************************************************
+//
+// httpd.h - Host stand-in for the interface of the lwIP web server.
+//
+//*****************************************************************************
+#ifndef __HTTPD_H__
+#define __HTTPD_H__
+
+#include "lwip/opt.h"
+#include "lwip/err.h"
+
+#ifndef LWIP_HTTPD_CGI
+#define LWIP_HTTPD_CGI                  0
+#endif
+
+#ifndef LWIP_HTTPD_SSI
+#define LWIP_HTTPD_SSI                  0
+#endif
+
+#ifndef LWIP_HTTPD_SUPPORT_POST
+#define LWIP_HTTPD_SUPPORT_POST         0
+#endif
+
+#ifndef LWIP_HTTPD_MAX_CGI_PARAMETERS
+#define LWIP_HTTPD_MAX_CGI_PARAMETERS   16
+#endif
+
+#ifndef LWIP_HTTPD_SSI_MULTIPART
+#define LWIP_HTTPD_SSI_MULTIPART        0
+#endif
+
+#ifndef LWIP_HTTPD_MAX_TAG_NAME_LEN
+#define LWIP_HTTPD_MAX_TAG_NAME_LEN     8
+#endif
+
+#ifndef LWIP_HTTPD_MAX_TAG_INSERT_LEN
+#define LWIP_HTTPD_MAX_TAG_INSERT_LEN   192
+#endif
+
+typedef const char *(*tCGIHandler)(int iIndex, int iNumParams,
+                                   char *pcParam[], char *pcValue[]);
+
+typedef struct
+{
+    const char *pcCGIName;
+    tCGIHandler pfnCGIHandler;
+}
+tCGI;
+
+void http_set_cgi_handlers(const tCGI *pCGIs, int iNumHandlers);
+
+typedef u16_t (*tSSIHandler)(int iIndex, char *pcInsert, int iInsertLen);
+
+void http_set_ssi_handler(tSSIHandler pfnSSIHandler, const char **ppcTags,
+                          int iNumTags);
+
+void httpd_init(void);
+
+#endif // __HTTPD_H__
@@ -0,0 +1,10 @@
+//*****************************************************************************
+//
+// hw_memmap.h - Host stand-in for the TivaWare memory map.  Nothing on the
+// host touches the peripherals.
+//
+//*****************************************************************************
+#ifndef __HW_MEMMAP_H__
+#define __HW_MEMMAP_H__
+
+#endif // __HW_MEMMAP_H__
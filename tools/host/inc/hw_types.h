@@ -0,0 +1,13 @@
+//*****************************************************************************
+//
+// hw_types.h - Host stand-in for the TivaWare register access macros.
+//
+//*****************************************************************************
+#ifndef __HW_TYPES_H__
+#define __HW_TYPES_H__
+
+#define HWREG(x)                        (*((volatile uint32_t *)(x)))
+#define HWREGH(x)                       (*((volatile uint16_t *)(x)))
+#define HWREGB(x)                       (*((volatile uint8_t *)(x)))
+
+#endif // __HW_TYPES_H__
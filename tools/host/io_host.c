@@ -0,0 +1,168 @@
+//*****************************************************************************
+//
+// io_host.c - Host stand-ins for the application state that io_fs.c serves.
+//
+// These replace io.c, boot.c, timing.c, io_ws.c and the globals of
+// enet_io.c, which all need the board or FreeRTOS.  They keep just enough
+// state for the dynamic files to give deterministic, checkable responses.
+// display_mirror.c and json.c are linked in unchanged.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "io.h"
+#include "boot.h"
+#include "timing.h"
+#include "io_host.h"
+
+//*****************************************************************************
+//
+// The state the stand-ins report.
+//
+//*****************************************************************************
+bool g_bHostLEDOn = false;
+uint32_t g_ui32HostSpeed = 50;
+int32_t g_i32HostFrequency = 1000;
+
+//*****************************************************************************
+//
+// The globals of enet_io.c that io_fs.c uses.
+//
+//*****************************************************************************
+bool systemOnline = true;
+bool automaticMode = false;
+uint32_t automaticModeSpeed = 0;
+uint32_t manualModeSpeed = 50;
+tTimingHistogram loopJitter;
+tTimingHistogram loopExec;
+
+uint32_t
+getSpeed(void)
+{
+    return(g_ui32HostSpeed);
+}
+
+//*****************************************************************************
+//
+// Stand-ins for io.c.
+//
+//*****************************************************************************
+void
+io_toggle_led(void)
+{
+    g_bHostLEDOn = !g_bHostLEDOn;
+}
+
+void
+io_get_ledstate(char *pcBuf, int iBufLen)
+{
+    snprintf(pcBuf, iBufLen, g_bHostLEDOn ? "ON" : "OFF");
+}
+
+void
+io_set_animation_speed_string(char *pcBuf)
+{
+    unsigned long ulSpeed;
+
+    ulSpeed = 0;
+    while((*pcBuf >= '0') && (*pcBuf <= '9'))
+    {
+        ulSpeed = (ulSpeed * 10) + (*pcBuf++ - '0');
+    }
+
+    if(ulSpeed <= 100)
+    {
+        g_ui32HostSpeed = ulSpeed;
+        manualModeSpeed = ulSpeed;
+    }
+}
+
+void
+io_get_animation_speed_string(char *pcBuf, int iBufLen)
+{
+    snprintf(pcBuf, iBufLen, "%d%%", (int)g_ui32HostSpeed);
+}
+
+void
+io_get_status(tIOStatus *psStatus)
+{
+    psStatus->ui32Speed = g_ui32HostSpeed;
+    psStatus->i32Frequency = g_i32HostFrequency;
+    psStatus->bAutomatic = automaticMode;
+    psStatus->bLEDOn = g_bHostLEDOn;
+}
+
+void
+io_get_system_status(tIOSystemStatus *psStatus)
+{
+    uint32_t ui32Task;
+
+    memset(psStatus, 0, sizeof(*psStatus));
+    io_get_status(&psStatus->sStatus);
+    psStatus->ui32PulseWidth = 1200;
+    psStatus->ui32ADC = 2048;
+    psStatus->ui32IPAddress = 0x0a01a8c0;
+    psStatus->ui32Uptime = 123456;
+    psStatus->ui32FreeHeap = 20480;
+    psStatus->ui32NumTasks = 6;
+    psStatus->ui32TotalTasks = 6;
+    for(ui32Task = 0; ui32Task < psStatus->ui32NumTasks; ui32Task++)
+    {
+        snprintf(psStatus->psTasks[ui32Task].pcName, IO_TASK_NAME_LEN,
+                 "Task %c", (char)('A' + ui32Task));
+        psStatus->psTasks[ui32Task].ui16StackFree = 100 + ui32Task;
+        psStatus->psTasks[ui32Task].ui8Priority = ui32Task % 4;
+        psStatus->psTasks[ui32Task].ui8State = 1;
+    }
+}
+
+//*****************************************************************************
+//
+// Stand-ins for boot.c and timing.c.
+//
+//*****************************************************************************
+void
+Boot_Mark(uint32_t ui32Stage)
+{
+}
+
+void
+Boot_Get_Trace(tBootTrace *psTrace)
+{
+    uint32_t ui32Stage;
+
+    psTrace->ui32Reached = (1 << BOOT_NUM_STAGES) - 1;
+    for(ui32Stage = 0; ui32Stage < BOOT_NUM_STAGES; ui32Stage++)
+    {
+        psTrace->pui32Us[ui32Stage] = ui32Stage * 100000;
+    }
+}
+
+const char *
+Boot_Stage_Name(uint32_t ui32Stage)
+{
+    static const char * const ppcNames[BOOT_NUM_STAGES] =
+    {
+        "clock", "ethernet", "scheduler", "display", "link", "ip", "http"
+    };
+
+    return((ui32Stage < BOOT_NUM_STAGES) ? ppcNames[ui32Stage] : NULL);
+}
+
+void
+TimingHistogramGet(tTimingHistogram *psHistogram, tTimingHistogram *psCopy)
+{
+    *psCopy = *psHistogram;
+}
+
+//*****************************************************************************
+//
+// Stand-ins for the event channels to the browser.
+//
+//*****************************************************************************
+void
+io_ws_send_status(void)
+{
+}
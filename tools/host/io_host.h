@@ -0,0 +1,21 @@
+//*****************************************************************************
+//
+// io_host.h - Host stand-ins for the application state that io_fs.c serves.
+//
+//*****************************************************************************
+#ifndef __IO_HOST_H__
+#define __IO_HOST_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+//*****************************************************************************
+//
+// The state the stand-ins report, which a test may change.
+//
+//*****************************************************************************
+extern bool g_bHostLEDOn;
+extern uint32_t g_ui32HostSpeed;
+extern int32_t g_i32HostFrequency;
+
+#endif // __IO_HOST_H__
@@ -0,0 +1,30 @@
+//*****************************************************************************
+//
+// arch.h - Host stand-in for the lwIP architecture types.
+//
+//*****************************************************************************
+#ifndef __LWIP_ARCH_H__
+#define __LWIP_ARCH_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint8_t u8_t;
+typedef int8_t s8_t;
+typedef uint16_t u16_t;
+typedef int16_t s16_t;
+typedef uint32_t u32_t;
+typedef int32_t s32_t;
+typedef uintptr_t mem_ptr_t;
+
+#define LWIP_UNUSED_ARG(x)              (void)(x)
+
+#define U16_F                           "u"
+#define S16_F                           "d"
+#define X16_F                           "x"
+#define U32_F                           "u"
+#define S32_F                           "d"
+#define X32_F                           "x"
+#define SZT_F                           "zu"
+
+#endif // __LWIP_ARCH_H__
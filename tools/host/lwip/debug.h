@@ -0,0 +1,51 @@
+//*****************************************************************************
+//
+// debug.h - Host stand-in for the lwIP debug macros.
+//
+// Unlike on the target, a failed assertion always stops the test.
+//
+//*****************************************************************************
+#ifndef __LWIP_DEBUG_H__
+#define __LWIP_DEBUG_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "lwip/arch.h"
+
+#define LWIP_DBG_LEVEL_ALL              0x00
+#define LWIP_DBG_LEVEL_OFF              LWIP_DBG_LEVEL_ALL
+#define LWIP_DBG_LEVEL_WARNING          0x01
+#define LWIP_DBG_LEVEL_SERIOUS          0x02
+#define LWIP_DBG_LEVEL_SEVERE           0x03
+#define LWIP_DBG_ON                     0x80U
+#define LWIP_DBG_OFF                    0x00U
+#define LWIP_DBG_TRACE                  0x40U
+#define LWIP_DBG_STATE                  0x20U
+#define LWIP_DBG_FRESH                  0x10U
+#define LWIP_DBG_HALT                   0x08U
+
+#define LWIP_ASSERT(message, assertion)                                       \
+    do                                                                        \
+    {                                                                         \
+        if(!(assertion))                                                      \
+        {                                                                     \
+            fprintf(stderr, "%s:%d: assertion \"%s\" failed\n", __FILE__,     \
+                    __LINE__, message);                                       \
+            abort();                                                          \
+        }                                                                     \
+    }                                                                         \
+    while(0)
+
+#define LWIP_ERROR(message, expression, handler)                              \
+    do                                                                        \
+    {                                                                         \
+        if(!(expression))                                                     \
+        {                                                                     \
+            handler;                                                          \
+        }                                                                     \
+    }                                                                         \
+    while(0)
+
+#define LWIP_DEBUGF(debug, message)     do { } while(0)
+
+#endif // __LWIP_DEBUG_H__
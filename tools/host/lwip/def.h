@@ -0,0 +1,16 @@
+//*****************************************************************************
+//
+// def.h - Host stand-in for the lwIP helper macros.
+//
+//*****************************************************************************
+#ifndef __LWIP_DEF_H__
+#define __LWIP_DEF_H__
+
+#include "lwip/arch.h"
+
+#define LWIP_MAX(x, y)                  (((x) > (y)) ? (x) : (y))
+#define LWIP_MIN(x, y)                  (((x) < (y)) ? (x) : (y))
+#define LWIP_MEM_ALIGN_SIZE(size)       (((size) + MEM_ALIGNMENT - 1) &       \
+                                         ~(MEM_ALIGNMENT - 1))
+
+#endif // __LWIP_DEF_H__
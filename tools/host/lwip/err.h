@@ -0,0 +1,32 @@
+//*****************************************************************************
+//
+// err.h - Host stand-in for the lwIP error codes.
+//
+//*****************************************************************************
+#ifndef __LWIP_ERR_H__
+#define __LWIP_ERR_H__
+
+#include "lwip/arch.h"
+
+typedef s8_t err_t;
+
+#define ERR_OK                          0
+#define ERR_MEM                         -1
+#define ERR_BUF                         -2
+#define ERR_TIMEOUT                     -3
+#define ERR_RTE                         -4
+#define ERR_INPROGRESS                  -5
+#define ERR_VAL                         -6
+#define ERR_WOULDBLOCK                  -7
+#define ERR_USE                         -8
+#define ERR_ISCONN                      -9
+#define ERR_ABRT                        -10
+#define ERR_RST                         -11
+#define ERR_CLSD                        -12
+#define ERR_CONN                        -13
+#define ERR_ARG                         -14
+#define ERR_IF                          -15
+
+extern const char *lwip_strerr(err_t err);
+
+#endif // __LWIP_ERR_H__
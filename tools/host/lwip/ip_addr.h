@@ -0,0 +1,21 @@
+//*****************************************************************************
+//
+// ip_addr.h - Host stand-in for the lwIP IP address type.
+//
+//*****************************************************************************
+#ifndef __LWIP_IP_ADDR_H__
+#define __LWIP_IP_ADDR_H__
+
+#include "lwip/arch.h"
+
+typedef struct ip_addr
+{
+    u32_t addr;
+}
+ip_addr_t;
+
+extern const ip_addr_t ip_addr_any;
+
+#define IP_ADDR_ANY                     ((ip_addr_t *)&ip_addr_any)
+
+#endif // __LWIP_IP_ADDR_H__
@@ -0,0 +1,18 @@
+//*****************************************************************************
+//
+// mem.h - Host stand-in for the lwIP heap, which lwip_host.c runs on the C
+// library heap while counting the blocks in use.
+//
+//*****************************************************************************
+#ifndef __LWIP_MEM_H__
+#define __LWIP_MEM_H__
+
+#include "lwip/opt.h"
+#include "lwip/arch.h"
+
+typedef u32_t mem_size_t;
+
+extern void *mem_malloc(mem_size_t size);
+extern void mem_free(void *mem);
+
+#endif // __LWIP_MEM_H__
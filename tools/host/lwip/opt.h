@@ -0,0 +1,43 @@
+//*****************************************************************************
+//
+// opt.h - Host stand-in for the lwIP options header.
+//
+// The headers under tools/host let the host tests in tools/ compile io_fs.c
+// and the web server (httpd.c) without lwIP, TivaWare or the board.  They
+// declare only what those files use.  The options come from the
+// application's lwipopts.h, as on the target.
+//
+//*****************************************************************************
+#ifndef __LWIP_OPT_H__
+#define __LWIP_OPT_H__
+
+#include <string.h>
+#include "lwipopts.h"
+#include "lwip/debug.h"
+
+#ifndef MEMCPY
+#define MEMCPY(dst, src, len)           memcpy(dst, src, len)
+#endif
+
+#ifndef SMEMCPY
+#define SMEMCPY(dst, src, len)          memcpy(dst, src, len)
+#endif
+
+#ifndef LWIP_TCP
+#define LWIP_TCP                        1
+#endif
+
+#ifndef TCP_PRIO_MIN
+#define TCP_PRIO_MIN                    1
+#endif
+
+#ifndef TCP_PRIO_NORMAL
+#define TCP_PRIO_NORMAL                 64
+#endif
+
+#ifndef TCP_SND_QUEUELEN
+#define TCP_SND_QUEUELEN                ((4 * (TCP_SND_BUF) + ((TCP_MSS) - 1)) / \
+                                         (TCP_MSS))
+#endif
+
+#endif // __LWIP_OPT_H__
@@ -0,0 +1,64 @@
+//*****************************************************************************
+//
+// pbuf.h - Host stand-in for the lwIP packet buffers.
+//
+// lwip_host.c implements these with the same reference counting and chain
+// semantics as lwIP 1.4.1; only the memory comes from the C library heap.
+//
+//*****************************************************************************
+#ifndef __LWIP_PBUF_H__
+#define __LWIP_PBUF_H__
+
+#include "lwip/opt.h"
+#include "lwip/def.h"
+#include "lwip/err.h"
+
+typedef enum
+{
+    PBUF_TRANSPORT,
+    PBUF_IP,
+    PBUF_LINK,
+    PBUF_RAW
+}
+pbuf_layer;
+
+typedef enum
+{
+    PBUF_RAM,
+    PBUF_ROM,
+    PBUF_REF,
+    PBUF_POOL
+}
+pbuf_type;
+
+struct pbuf
+{
+    struct pbuf *next;
+    void *payload;
+    u16_t tot_len;
+    u16_t len;
+    u8_t type;
+    u8_t flags;
+    u16_t ref;
+};
+
+extern struct pbuf *pbuf_alloc(pbuf_layer layer, u16_t length,
+                               pbuf_type type);
+extern u8_t pbuf_header(struct pbuf *p, s16_t header_size_increment);
+extern void pbuf_ref(struct pbuf *p);
+extern u8_t pbuf_free(struct pbuf *p);
+extern u8_t pbuf_clen(struct pbuf *p);
+extern void pbuf_cat(struct pbuf *head, struct pbuf *tail);
+extern void pbuf_chain(struct pbuf *head, struct pbuf *tail);
+extern struct pbuf *pbuf_dechain(struct pbuf *p);
+extern err_t pbuf_copy(struct pbuf *p_to, struct pbuf *p_from);
+extern u16_t pbuf_copy_partial(struct pbuf *p, void *dataptr, u16_t len,
+                               u16_t offset);
+extern struct pbuf *pbuf_coalesce(struct pbuf *p, pbuf_layer layer);
+extern u8_t pbuf_get_at(struct pbuf *p, u16_t offset);
+extern u16_t pbuf_memcmp(struct pbuf *p, u16_t offset, const void *s2,
+                         u16_t n);
+extern u16_t pbuf_memfind(struct pbuf *p, const void *mem, u16_t mem_len,
+                          u16_t start_offset);
+
+#endif // __LWIP_PBUF_H__
@@ -0,0 +1,12 @@
+//*****************************************************************************
+//
+// stats.h - Host stand-in for the lwIP statistics, which are not kept.
+//
+//*****************************************************************************
+#ifndef __LWIP_STATS_H__
+#define __LWIP_STATS_H__
+
+#include "lwip/opt.h"
+#include "lwip/mem.h"
+
+#endif // __LWIP_STATS_H__
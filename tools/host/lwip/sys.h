@@ -0,0 +1,18 @@
+//*****************************************************************************
+//
+// sys.h - Host stand-in for the lwIP system layer.  The host tests are
+// single threaded, so the critical sections are empty.
+//
+//*****************************************************************************
+#ifndef __LWIP_SYS_H__
+#define __LWIP_SYS_H__
+
+#include "lwip/arch.h"
+
+#define SYS_ARCH_DECL_PROTECT(lev)      int lev
+#define SYS_ARCH_PROTECT(lev)           ((lev) = 0)
+#define SYS_ARCH_UNPROTECT(lev)         ((void)(lev))
+
+extern u32_t sys_now(void);
+
+#endif // __LWIP_SYS_H__
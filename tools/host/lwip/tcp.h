@@ -0,0 +1,128 @@
+//*****************************************************************************
+//
+// tcp.h - Host stand-in for the lwIP raw TCP API.
+//
+// lwip_host.c implements the server side of the API on top of a model of
+// the connection that a test drives through lwip_host.h: it connects,
+// sends requests, reads and acknowledges what the server sent, polls and
+// closes.  Nothing goes on a network.
+//
+//*****************************************************************************
+#ifndef __LWIP_TCP_H__
+#define __LWIP_TCP_H__
+
+#include "lwip/opt.h"
+#include "lwip/def.h"
+#include "lwip/err.h"
+#include "lwip/pbuf.h"
+#include "lwip/ip_addr.h"
+
+struct tcp_pcb;
+struct tcp_pcb_listen;
+
+typedef err_t (*tcp_accept_fn)(void *arg, struct tcp_pcb *newpcb, err_t err);
+typedef err_t (*tcp_recv_fn)(void *arg, struct tcp_pcb *tpcb, struct pbuf *p,
+                             err_t err);
+typedef err_t (*tcp_sent_fn)(void *arg, struct tcp_pcb *tpcb, u16_t len);
+typedef err_t (*tcp_poll_fn)(void *arg, struct tcp_pcb *tpcb);
+typedef void (*tcp_err_fn)(void *arg, err_t err);
+
+enum tcp_state
+{
+    CLOSED = 0,
+    LISTEN = 1,
+    SYN_SENT = 2,
+    SYN_RCVD = 3,
+    ESTABLISHED = 4,
+    FIN_WAIT_1 = 5,
+    FIN_WAIT_2 = 6,
+    CLOSE_WAIT = 7,
+    CLOSING = 8,
+    LAST_ACK = 9,
+    TIME_WAIT = 10
+};
+
+#define TCP_WRITE_FLAG_COPY             0x01
+#define TCP_WRITE_FLAG_MORE             0x02
+
+#define TF_NODELAY                      0x40
+
+//*****************************************************************************
+//
+// A write the server made that has not been acknowledged yet.  pui8Copy
+// holds the data as it was when a write by reference was made, to check
+// that it did not change before the acknowledgement.
+//
+//*****************************************************************************
+typedef struct
+{
+    const void *pvData;
+    u8_t *pui8Copy;
+    u32_t ui32Len;
+    u16_t ui16Pbufs;
+}
+tHostTCPWrite;
+
+struct tcp_pcb
+{
+    enum tcp_state state;
+    u8_t prio;
+    u8_t flags;
+    u8_t pollinterval;
+    void *callback_arg;
+    tcp_accept_fn accept;
+    tcp_recv_fn recv;
+    tcp_sent_fn sent;
+    tcp_poll_fn poll;
+    tcp_err_fn errf;
+    u16_t mss;
+    u16_t snd_buf;
+    u16_t snd_queuelen;
+
+    //
+    // The receive window, which tcp_recved() opens again, and the data the
+    // server's receive callback refused, which is held until it takes it.
+    //
+    u16_t rcv_wnd;
+    struct pbuf *refused_data;
+
+    //
+    // The host side of the connection: whether the server has closed it,
+    // the order it was opened in, the bytes sent by the server that the
+    // test has not read yet and the writes that are not acknowledged.
+    //
+    u8_t ui8Closed;
+    u32_t ui32Serial;
+    u8_t *pui8Out;
+    u32_t ui32OutLen;
+    u32_t ui32OutSize;
+    tHostTCPWrite *psWrites;
+    u32_t ui32NumWrites;
+    u32_t ui32MaxWrites;
+};
+
+#define tcp_mss(pcb)                    ((pcb)->mss)
+#define tcp_sndbuf(pcb)                 ((pcb)->snd_buf)
+#define tcp_sndqueuelen(pcb)            ((pcb)->snd_queuelen)
+#define tcp_nagle_disable(pcb)          ((pcb)->flags |= TF_NODELAY)
+#define tcp_accepted(pcb)               ((void)(pcb))
+
+extern struct tcp_pcb *tcp_new(void);
+extern err_t tcp_bind(struct tcp_pcb *pcb, ip_addr_t *ipaddr, u16_t port);
+extern struct tcp_pcb *tcp_listen(struct tcp_pcb *pcb);
+extern void tcp_accept(struct tcp_pcb *pcb, tcp_accept_fn accept);
+extern void tcp_arg(struct tcp_pcb *pcb, void *arg);
+extern void tcp_recv(struct tcp_pcb *pcb, tcp_recv_fn recv);
+extern void tcp_sent(struct tcp_pcb *pcb, tcp_sent_fn sent);
+extern void tcp_poll(struct tcp_pcb *pcb, tcp_poll_fn poll, u8_t interval);
+extern void tcp_err(struct tcp_pcb *pcb, tcp_err_fn err);
+extern void tcp_setprio(struct tcp_pcb *pcb, u8_t prio);
+extern void tcp_recved(struct tcp_pcb *pcb, u16_t len);
+extern err_t tcp_write(struct tcp_pcb *pcb, const void *dataptr, u16_t len,
+                       u8_t apiflags);
+extern err_t tcp_output(struct tcp_pcb *pcb);
+extern err_t tcp_close(struct tcp_pcb *pcb);
+extern void tcp_abort(struct tcp_pcb *pcb);
+extern const char *tcp_debug_state_str(enum tcp_state s);
+
+#endif // __LWIP_TCP_H__
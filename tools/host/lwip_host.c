@@ -0,0 +1,1225 @@
+//*****************************************************************************
+//
+// lwip_host.c - Host stand-in for the parts of lwIP used by the web server.
+//
+// The packet buffers follow lwIP 1.4.1: reference counts, chains and the
+// tot_len invariant behave the same, so a server that misuses them fails
+// here as it would on the target.  The TCP side models one end of each
+// connection from the server's point of view.  Control blocks come from a
+// pool of MEMP_NUM_TCP_PCB, TIME_WAIT blocks are reused when the pool runs
+// out, tcp_write() enforces TCP_SND_BUF and TCP_SND_QUEUELEN, and writes
+// made by reference are checked against the data they pointed to when they
+// are acknowledged.  The receive window is TCP_WND, opened again by
+// tcp_recved(), and data the server refuses is held and offered again with
+// the next segment or poll, while segments with data that arrive meanwhile
+// are dropped, as lwIP does.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lwip/opt.h"
+#include "lwip/def.h"
+#include "lwip/err.h"
+#include "lwip/mem.h"
+#include "lwip/pbuf.h"
+#include "lwip/sys.h"
+#include "lwip/tcp.h"
+#include "lwip_host.h"
+
+//*****************************************************************************
+//
+// The room kept in front of the payload of a new pbuf for the headers of the
+// layers below, as lwIP does.
+//
+//*****************************************************************************
+#define HOST_TCP_HLEN           20
+#define HOST_IP_HLEN            20
+
+//*****************************************************************************
+//
+// The control blocks of the connections, the listening one, the order the
+// connections were opened in and the server's accept callback.
+//
+//*****************************************************************************
+static struct tcp_pcb g_psPCBs[MEMP_NUM_TCP_PCB];
+static struct tcp_pcb g_sListen;
+static uint32_t g_ui32Serial;
+
+//*****************************************************************************
+//
+// The counts, the blocks of memory and pbufs in use, the time and the stack
+// address the test called into the server from.
+//
+//*****************************************************************************
+static tHostStats g_sStats;
+static uint32_t g_ui32MemInUse;
+static uint32_t g_ui32PbufsInUse;
+static uint32_t g_ui32Now;
+static uintptr_t g_uiStackBase;
+
+const ip_addr_t ip_addr_any = { 0 };
+
+//*****************************************************************************
+//
+// Note the depth of the stack below the call into the server.
+//
+//*****************************************************************************
+static void
+StackCheck(void)
+{
+    volatile uint8_t ui8Marker;
+    uintptr_t uiDepth;
+
+    if(g_uiStackBase)
+    {
+        uiDepth = g_uiStackBase - (uintptr_t)&ui8Marker;
+        if(uiDepth > g_sStats.ui32MaxStack)
+        {
+            g_sStats.ui32MaxStack = uiDepth;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Mark the stack address the test calls into the server from.  This must be
+// a function of its own so that the marker is in the caller's frame.
+//
+//*****************************************************************************
+static __attribute__((noinline)) void
+StackBase(volatile uint8_t *pui8Marker)
+{
+    g_uiStackBase = (uintptr_t)pui8Marker;
+}
+
+//*****************************************************************************
+//
+// The heap.
+//
+//*****************************************************************************
+void *
+mem_malloc(mem_size_t size)
+{
+    void *pvMem;
+
+    StackCheck();
+
+    pvMem = malloc(size);
+    if(pvMem)
+    {
+        g_ui32MemInUse++;
+    }
+
+    return(pvMem);
+}
+
+void
+mem_free(void *mem)
+{
+    if(mem)
+    {
+        g_ui32MemInUse--;
+        free(mem);
+    }
+}
+
+uint32_t
+HostMemInUse(void)
+{
+    return(g_ui32MemInUse);
+}
+
+//*****************************************************************************
+//
+// The time.
+//
+//*****************************************************************************
+u32_t
+sys_now(void)
+{
+    return(g_ui32Now);
+}
+
+void
+HostTimeAdvance(uint32_t ui32Ms)
+{
+    g_ui32Now += ui32Ms;
+}
+
+const char *
+lwip_strerr(err_t err)
+{
+    static char pcBuf[16];
+
+    snprintf(pcBuf, sizeof(pcBuf), "error %d", err);
+    return(pcBuf);
+}
+
+//*****************************************************************************
+//
+// The packet buffers.
+//
+//*****************************************************************************
+struct pbuf *
+pbuf_alloc(pbuf_layer layer, u16_t length, pbuf_type type)
+{
+    struct pbuf *p;
+    uint32_t ui32Offset;
+
+    StackCheck();
+
+    switch(layer)
+    {
+        case PBUF_TRANSPORT:
+        {
+            ui32Offset = PBUF_LINK_HLEN + HOST_IP_HLEN + HOST_TCP_HLEN;
+            break;
+        }
+        case PBUF_IP:
+        {
+            ui32Offset = PBUF_LINK_HLEN + HOST_IP_HLEN;
+            break;
+        }
+        case PBUF_LINK:
+        {
+            ui32Offset = PBUF_LINK_HLEN;
+            break;
+        }
+        default:
+        {
+            ui32Offset = 0;
+            break;
+        }
+    }
+
+    //
+    // A ROM or REF pbuf only points at data the caller provides.
+    //
+    if((type == PBUF_ROM) || (type == PBUF_REF))
+    {
+        p = malloc(sizeof(struct pbuf));
+    }
+    else
+    {
+        p = malloc(sizeof(struct pbuf) + ui32Offset + length);
+    }
+    if(!p)
+    {
+        return(NULL);
+    }
+
+    p->next = NULL;
+    p->payload = ((type == PBUF_ROM) || (type == PBUF_REF)) ? NULL :
+                 ((u8_t *)(p + 1) + ui32Offset);
+    p->tot_len = length;
+    p->len = length;
+    p->type = type;
+    p->flags = 0;
+    p->ref = 1;
+    g_ui32PbufsInUse++;
+    if(g_ui32PbufsInUse > g_sStats.ui32PeakPbufs)
+    {
+        g_sStats.ui32PeakPbufs = g_ui32PbufsInUse;
+    }
+
+    return(p);
+}
+
+u8_t
+pbuf_header(struct pbuf *p, s16_t header_size_increment)
+{
+    u16_t ui16Magnitude;
+
+    if((p == NULL) || (header_size_increment == 0))
+    {
+        return(0);
+    }
+
+    if(header_size_increment < 0)
+    {
+        ui16Magnitude = -header_size_increment;
+        LWIP_ERROR("increment_magnitude <= p->len", (ui16Magnitude <= p->len),
+                   return(1));
+    }
+    else if((p->type == PBUF_RAM) || (p->type == PBUF_POOL))
+    {
+        if(((u8_t *)p->payload - header_size_increment) < (u8_t *)(p + 1))
+        {
+            return(1);
+        }
+    }
+    else
+    {
+        return(1);
+    }
+
+    p->payload = (u8_t *)p->payload - header_size_increment;
+    p->len += header_size_increment;
+    p->tot_len += header_size_increment;
+
+    return(0);
+}
+
+void
+pbuf_ref(struct pbuf *p)
+{
+    if(p)
+    {
+        p->ref++;
+    }
+}
+
+u8_t
+pbuf_free(struct pbuf *p)
+{
+    struct pbuf *q;
+    u8_t ui8Count;
+
+    LWIP_ASSERT("pbuf_free: p != NULL", p != NULL);
+
+    ui8Count = 0;
+    while(p != NULL)
+    {
+        LWIP_ASSERT("pbuf_free: p->ref > 0", p->ref > 0);
+        if(--p->ref != 0)
+        {
+            break;
+        }
+
+        q = p->next;
+        free(p);
+        g_ui32PbufsInUse--;
+        ui8Count++;
+        p = q;
+    }
+
+    return(ui8Count);
+}
+
+u8_t
+pbuf_clen(struct pbuf *p)
+{
+    u8_t ui8Len;
+
+    for(ui8Len = 0; p != NULL; p = p->next)
+    {
+        ui8Len++;
+    }
+
+    return(ui8Len);
+}
+
+void
+pbuf_cat(struct pbuf *h, struct pbuf *t)
+{
+    struct pbuf *p;
+
+    LWIP_ERROR("(h != NULL) && (t != NULL) (programmer violates API)",
+               ((h != NULL) && (t != NULL)), return);
+
+    for(p = h; p->next != NULL; p = p->next)
+    {
+        p->tot_len += t->tot_len;
+    }
+
+    LWIP_ASSERT("p->tot_len == p->len (of last pbuf in chain)",
+                p->tot_len == p->len);
+    p->tot_len += t->tot_len;
+    p->next = t;
+}
+
+void
+pbuf_chain(struct pbuf *h, struct pbuf *t)
+{
+    pbuf_cat(h, t);
+    pbuf_ref(t);
+}
+
+struct pbuf *
+pbuf_dechain(struct pbuf *p)
+{
+    struct pbuf *q;
+    u8_t ui8TailGone;
+
+    ui8TailGone = 1;
+    q = p->next;
+    if(q != NULL)
+    {
+        LWIP_ASSERT("p->tot_len == p->len + q->tot_len",
+                    q->tot_len == p->tot_len - p->len);
+        p->next = NULL;
+        p->tot_len = p->len;
+
+        //
+        // The chain held a reference to the tail, which is given up.
+        //
+        ui8TailGone = pbuf_free(q);
+    }
+
+    return((ui8TailGone > 0) ? NULL : q);
+}
+
+u16_t
+pbuf_copy_partial(struct pbuf *buf, void *dataptr, u16_t len, u16_t offset)
+{
+    struct pbuf *p;
+    u16_t ui16Copied, ui16Len;
+
+    ui16Copied = 0;
+    for(p = buf; (len != 0) && (p != NULL); p = p->next)
+    {
+        if(offset >= p->len)
+        {
+            offset -= p->len;
+            continue;
+        }
+
+        ui16Len = LWIP_MIN(p->len - offset, len);
+        memcpy((u8_t *)dataptr + ui16Copied, (u8_t *)p->payload + offset,
+               ui16Len);
+        ui16Copied += ui16Len;
+        len -= ui16Len;
+        offset = 0;
+    }
+
+    return(ui16Copied);
+}
+
+err_t
+pbuf_copy(struct pbuf *p_to, struct pbuf *p_from)
+{
+    LWIP_ERROR("pbuf_copy: target not big enough to hold source",
+               ((p_to != NULL) && (p_from != NULL) &&
+                (p_to->tot_len >= p_from->tot_len)), return(ERR_ARG));
+    LWIP_ASSERT("pbuf_copy: target is a single pbuf", p_to->next == NULL);
+
+    pbuf_copy_partial(p_from, p_to->payload, p_from->tot_len, 0);
+
+    return(ERR_OK);
+}
+
+struct pbuf *
+pbuf_coalesce(struct pbuf *p, pbuf_layer layer)
+{
+    struct pbuf *q;
+
+    if(p->next == NULL)
+    {
+        return(p);
+    }
+
+    q = pbuf_alloc(layer, p->tot_len, PBUF_RAM);
+    if(q == NULL)
+    {
+        return(p);
+    }
+
+    pbuf_copy(q, p);
+    pbuf_free(p);
+
+    return(q);
+}
+
+u8_t
+pbuf_get_at(struct pbuf *p, u16_t offset)
+{
+    while((p != NULL) && (offset >= p->len))
+    {
+        offset -= p->len;
+        p = p->next;
+    }
+
+    return((p != NULL) ? ((u8_t *)p->payload)[offset] : 0);
+}
+
+u16_t
+pbuf_memcmp(struct pbuf *p, u16_t offset, const void *s2, u16_t n)
+{
+    u16_t ui16Idx;
+
+    if(p->tot_len < (offset + n))
+    {
+        return(0xffff);
+    }
+
+    //
+    // Like lwIP, return one more than the offset of the first difference.
+    //
+    for(ui16Idx = 0; ui16Idx < n; ui16Idx++)
+    {
+        if(pbuf_get_at(p, offset + ui16Idx) !=
+           ((const u8_t *)s2)[ui16Idx])
+        {
+            return(ui16Idx + 1);
+        }
+    }
+
+    return(0);
+}
+
+u16_t
+pbuf_memfind(struct pbuf *p, const void *mem, u16_t mem_len,
+             u16_t start_offset)
+{
+    u16_t ui16Idx, ui16Plus;
+
+    if(p->tot_len >= (mem_len + start_offset))
+    {
+        for(ui16Idx = start_offset; ui16Idx <= (p->tot_len - mem_len); )
+        {
+            ui16Plus = pbuf_memcmp(p, ui16Idx, mem, mem_len);
+            if(ui16Plus == 0)
+            {
+                return(ui16Idx);
+            }
+            ui16Idx += ui16Plus;
+        }
+    }
+
+    return(0xffff);
+}
+
+uint32_t
+HostPbufsInUse(void)
+{
+    return(g_ui32PbufsInUse);
+}
+
+//*****************************************************************************
+//
+// Give a control block back to the pool.  What the server sent is kept so
+// that the test can still read it.
+//
+//*****************************************************************************
+static void
+PCBFree(struct tcp_pcb *pcb)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < pcb->ui32NumWrites; ui32Idx++)
+    {
+        free(pcb->psWrites[ui32Idx].pui8Copy);
+    }
+    pcb->ui32NumWrites = 0;
+
+    if(pcb->refused_data)
+    {
+        pbuf_free(pcb->refused_data);
+        pcb->refused_data = NULL;
+    }
+
+    if(pcb->state == TIME_WAIT)
+    {
+        g_sStats.ui32TimeWait--;
+    }
+    if(pcb->state != CLOSED)
+    {
+        g_sStats.ui32PCBs--;
+    }
+    pcb->state = CLOSED;
+}
+
+//*****************************************************************************
+//
+// Take a control block from the pool, reusing the oldest one in TIME_WAIT if
+// there is no free one.  Returns NULL if all are in use.
+//
+//*****************************************************************************
+static struct tcp_pcb *
+PCBAlloc(void)
+{
+    struct tcp_pcb *pcb, *psOldest;
+    uint32_t ui32Idx;
+
+    pcb = NULL;
+    psOldest = NULL;
+    for(ui32Idx = 0; ui32Idx < MEMP_NUM_TCP_PCB; ui32Idx++)
+    {
+        if(g_psPCBs[ui32Idx].state == CLOSED)
+        {
+            pcb = &g_psPCBs[ui32Idx];
+            break;
+        }
+        if((g_psPCBs[ui32Idx].state == TIME_WAIT) &&
+           (!psOldest ||
+            (g_psPCBs[ui32Idx].ui32Serial < psOldest->ui32Serial)))
+        {
+            psOldest = &g_psPCBs[ui32Idx];
+        }
+    }
+
+    if(!pcb && psOldest)
+    {
+        PCBFree(psOldest);
+        g_sStats.ui32Recycled++;
+        pcb = psOldest;
+    }
+
+    if(!pcb)
+    {
+        return(NULL);
+    }
+
+    free(pcb->pui8Out);
+    free(pcb->psWrites);
+    memset(pcb, 0, sizeof(*pcb));
+    pcb->state = SYN_RCVD;
+    pcb->prio = TCP_PRIO_NORMAL;
+    pcb->mss = TCP_MSS;
+    pcb->snd_buf = TCP_SND_BUF;
+    pcb->rcv_wnd = TCP_WND;
+    pcb->ui32Serial = ++g_ui32Serial;
+
+    g_sStats.ui32PCBs++;
+    if(g_sStats.ui32PCBs > g_sStats.ui32PeakPCBs)
+    {
+        g_sStats.ui32PeakPCBs = g_sStats.ui32PCBs;
+    }
+
+    return(pcb);
+}
+
+//*****************************************************************************
+//
+// The raw TCP API, as the server sees it.
+//
+//*****************************************************************************
+struct tcp_pcb *
+tcp_new(void)
+{
+    return(PCBAlloc());
+}
+
+err_t
+tcp_bind(struct tcp_pcb *pcb, ip_addr_t *ipaddr, u16_t port)
+{
+    return(ERR_OK);
+}
+
+struct tcp_pcb *
+tcp_listen(struct tcp_pcb *pcb)
+{
+    memset(&g_sListen, 0, sizeof(g_sListen));
+    g_sListen.state = LISTEN;
+    g_sListen.prio = pcb->prio;
+    g_sListen.callback_arg = pcb->callback_arg;
+
+    PCBFree(pcb);
+
+    return(&g_sListen);
+}
+
+void
+tcp_accept(struct tcp_pcb *pcb, tcp_accept_fn accept)
+{
+    pcb->accept = accept;
+}
+
+void
+tcp_arg(struct tcp_pcb *pcb, void *arg)
+{
+    pcb->callback_arg = arg;
+}
+
+void
+tcp_recv(struct tcp_pcb *pcb, tcp_recv_fn recv)
+{
+    pcb->recv = recv;
+}
+
+void
+tcp_sent(struct tcp_pcb *pcb, tcp_sent_fn sent)
+{
+    pcb->sent = sent;
+}
+
+void
+tcp_poll(struct tcp_pcb *pcb, tcp_poll_fn poll, u8_t interval)
+{
+    pcb->poll = poll;
+    pcb->pollinterval = interval;
+}
+
+void
+tcp_err(struct tcp_pcb *pcb, tcp_err_fn err)
+{
+    pcb->errf = err;
+}
+
+void
+tcp_setprio(struct tcp_pcb *pcb, u8_t prio)
+{
+    pcb->prio = prio;
+}
+
+void
+tcp_recved(struct tcp_pcb *pcb, u16_t len)
+{
+    LWIP_ASSERT("tcp_recved: window too large",
+                (pcb->rcv_wnd + len) <= TCP_WND);
+    pcb->rcv_wnd += len;
+}
+
+err_t
+tcp_write(struct tcp_pcb *pcb, const void *dataptr, u16_t len, u8_t apiflags)
+{
+    tHostTCPWrite *psWrite;
+    uint32_t ui32Pbufs;
+
+    StackCheck();
+    g_sStats.ui32Writes++;
+
+    if((pcb->state != ESTABLISHED) && (pcb->state != CLOSE_WAIT))
+    {
+        return(ERR_CONN);
+    }
+    if(len == 0)
+    {
+        return(ERR_OK);
+    }
+
+    //
+    // A copied segment takes one pbuf, a segment sent by reference a pbuf
+    // for the data plus one for the header.
+    //
+    ui32Pbufs = (len + pcb->mss - 1) / pcb->mss;
+    if(!(apiflags & TCP_WRITE_FLAG_COPY))
+    {
+        ui32Pbufs *= 2;
+    }
+    if((len > pcb->snd_buf) ||
+       ((pcb->snd_queuelen + ui32Pbufs) > TCP_SND_QUEUELEN))
+    {
+        g_sStats.ui32WritesFull++;
+        return(ERR_MEM);
+    }
+
+    if(pcb->ui32NumWrites == pcb->ui32MaxWrites)
+    {
+        pcb->ui32MaxWrites = pcb->ui32MaxWrites ? (pcb->ui32MaxWrites * 2) :
+                             16;
+        pcb->psWrites = realloc(pcb->psWrites,
+                                pcb->ui32MaxWrites * sizeof(tHostTCPWrite));
+    }
+    psWrite = &pcb->psWrites[pcb->ui32NumWrites++];
+    psWrite->pvData = dataptr;
+    psWrite->ui32Len = len;
+    psWrite->ui16Pbufs = ui32Pbufs;
+    psWrite->pui8Copy = NULL;
+    if(!(apiflags & TCP_WRITE_FLAG_COPY))
+    {
+        psWrite->pui8Copy = malloc(len);
+        memcpy(psWrite->pui8Copy, dataptr, len);
+        g_sStats.ui64Referenced += len;
+    }
+    else
+    {
+        g_sStats.ui64Copied += len;
+    }
+
+    if((pcb->ui32OutLen + len) > pcb->ui32OutSize)
+    {
+        pcb->ui32OutSize = (pcb->ui32OutLen + len) * 2;
+        pcb->pui8Out = realloc(pcb->pui8Out, pcb->ui32OutSize);
+    }
+    memcpy(pcb->pui8Out + pcb->ui32OutLen, dataptr, len);
+    pcb->ui32OutLen += len;
+
+    pcb->snd_buf -= len;
+    pcb->snd_queuelen += ui32Pbufs;
+
+    return(ERR_OK);
+}
+
+err_t
+tcp_output(struct tcp_pcb *pcb)
+{
+    StackCheck();
+
+    return(ERR_OK);
+}
+
+err_t
+tcp_close(struct tcp_pcb *pcb)
+{
+    StackCheck();
+
+    switch(pcb->state)
+    {
+        case LISTEN:
+        {
+            pcb->state = CLOSED;
+            break;
+        }
+        case SYN_RCVD:
+        case ESTABLISHED:
+        {
+            pcb->state = FIN_WAIT_1;
+            break;
+        }
+        case CLOSE_WAIT:
+        {
+            pcb->state = LAST_ACK;
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+
+    //
+    // Data that arrives from now on resets the connection.
+    //
+    pcb->ui8Closed = 1;
+    pcb->recv = NULL;
+
+    return(ERR_OK);
+}
+
+void
+tcp_abort(struct tcp_pcb *pcb)
+{
+    tcp_err_fn pfnErr;
+    void *pvArg;
+
+    StackCheck();
+
+    pfnErr = pcb->errf;
+    pvArg = pcb->callback_arg;
+    g_sStats.ui32Aborted++;
+    PCBFree(pcb);
+
+    if(pfnErr)
+    {
+        pfnErr(pvArg, ERR_ABRT);
+    }
+}
+
+const char *
+tcp_debug_state_str(enum tcp_state s)
+{
+    static const char * const ppcStates[] =
+    {
+        "CLOSED", "LISTEN", "SYN_SENT", "SYN_RCVD", "ESTABLISHED",
+        "FIN_WAIT_1", "FIN_WAIT_2", "CLOSE_WAIT", "CLOSING", "LAST_ACK",
+        "TIME_WAIT"
+    };
+
+    return(ppcStates[s]);
+}
+
+//*****************************************************************************
+//
+// The test's side of the connections.
+//
+//*****************************************************************************
+void
+HostStatsGet(tHostStats *psStats)
+{
+    *psStats = g_sStats;
+}
+
+void
+HostStatsClear(void)
+{
+    uint32_t ui32PCBs, ui32TimeWait;
+
+    ui32PCBs = g_sStats.ui32PCBs;
+    ui32TimeWait = g_sStats.ui32TimeWait;
+    memset(&g_sStats, 0, sizeof(g_sStats));
+    g_sStats.ui32PCBs = ui32PCBs;
+    g_sStats.ui32PeakPCBs = ui32PCBs;
+    g_sStats.ui32TimeWait = ui32TimeWait;
+    g_sStats.ui32PeakPbufs = g_ui32PbufsInUse;
+}
+
+//*****************************************************************************
+//
+// Offer the data the server refused to its receive callback again, as lwIP
+// does for each segment that arrives and from its fast timer.  Returns true
+// if there is no refused data left.
+//
+//*****************************************************************************
+static bool
+RefusedDataDeliver(struct tcp_pcb *pcb)
+{
+    struct pbuf *p;
+    err_t err;
+
+    if(!pcb->refused_data)
+    {
+        return(true);
+    }
+
+    p = pcb->refused_data;
+    pcb->refused_data = NULL;
+    if(!pcb->recv)
+    {
+        pbuf_free(p);
+        return(true);
+    }
+    err = pcb->recv(pcb->callback_arg, pcb, p, ERR_OK);
+    if((err != ERR_OK) && (err != ERR_ABRT) && (pcb->state != CLOSED))
+    {
+        pcb->refused_data = p;
+        return(false);
+    }
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Open a connection to the server.  Returns NULL if there is no control
+// block for it or the server refuses it.
+//
+//*****************************************************************************
+struct tcp_pcb *
+HostTCPConnect(void)
+{
+    volatile uint8_t ui8Marker;
+    struct tcp_pcb *pcb;
+    err_t err;
+
+    pcb = PCBAlloc();
+    if(!pcb)
+    {
+        g_sStats.ui32Refused++;
+        return(NULL);
+    }
+
+    pcb->state = ESTABLISHED;
+    pcb->callback_arg = g_sListen.callback_arg;
+
+    StackBase(&ui8Marker);
+    err = g_sListen.accept(g_sListen.callback_arg, pcb, ERR_OK);
+    g_uiStackBase = 0;
+    if(err != ERR_OK)
+    {
+        if(pcb->state != CLOSED)
+        {
+            tcp_abort(pcb);
+        }
+        g_sStats.ui32Refused++;
+        return(NULL);
+    }
+
+    g_sStats.ui32Accepted++;
+
+    return(pcb);
+}
+
+//*****************************************************************************
+//
+// Send data to the server in a chain of pbufs of at most ui32PbufSize bytes
+// each, as the Ethernet driver hands over a segment in pool pbufs.  If the
+// data does not fit in the receive window, or the server is still refusing
+// earlier data, the segment is dropped and ERR_MEM returned: the test has to
+// send it again.  Otherwise the segment is received and ERR_OK returned,
+// even if the server refuses the data, which is then held for it, or
+// ERR_ABRT if the server aborted the connection.
+//
+//*****************************************************************************
+err_t
+HostTCPSend(struct tcp_pcb *pcb, const void *pvData, uint32_t ui32Len,
+            uint32_t ui32PbufSize)
+{
+    volatile uint8_t ui8Marker;
+    struct pbuf *p, *q;
+    uint32_t ui32Offset, ui32Chunk;
+    err_t err;
+
+    if(pcb->state == CLOSED)
+    {
+        return(ERR_CLSD);
+    }
+
+    //
+    // The server has closed the connection: lwIP answers with a reset.
+    //
+    if(pcb->ui8Closed)
+    {
+        g_sStats.ui32Reset++;
+        PCBFree(pcb);
+        return(ERR_RST);
+    }
+
+    StackBase(&ui8Marker);
+    if(!RefusedDataDeliver(pcb) || (ui32Len > pcb->rcv_wnd))
+    {
+        g_uiStackBase = 0;
+        g_sStats.ui32Dropped++;
+        return(ERR_MEM);
+    }
+    g_uiStackBase = 0;
+    if(pcb->state == CLOSED)
+    {
+        return(ERR_CLSD);
+    }
+    pcb->rcv_wnd -= ui32Len;
+
+    p = NULL;
+    for(ui32Offset = 0; ui32Offset < ui32Len; ui32Offset += ui32Chunk)
+    {
+        ui32Chunk = LWIP_MIN(ui32PbufSize, ui32Len - ui32Offset);
+        q = pbuf_alloc(PBUF_RAW, ui32Chunk, PBUF_POOL);
+        memcpy(q->payload, (const uint8_t *)pvData + ui32Offset, ui32Chunk);
+        if(p)
+        {
+            pbuf_cat(p, q);
+        }
+        else
+        {
+            p = q;
+        }
+    }
+
+    if(!pcb->recv)
+    {
+        pbuf_free(p);
+        return(ERR_OK);
+    }
+
+    StackBase(&ui8Marker);
+    err = pcb->recv(pcb->callback_arg, pcb, p, ERR_OK);
+    g_uiStackBase = 0;
+
+    //
+    // The server did not take the data: hold it until it does.
+    //
+    if((err != ERR_OK) && (err != ERR_ABRT))
+    {
+        if(pcb->state != CLOSED)
+        {
+            pcb->refused_data = p;
+        }
+        else
+        {
+            pbuf_free(p);
+        }
+        err = ERR_OK;
+    }
+
+    return(err);
+}
+
+//*****************************************************************************
+//
+// Take up to ui32Size bytes of what the server has sent.  Returns the number
+// of bytes taken.
+//
+//*****************************************************************************
+uint32_t
+HostTCPRead(struct tcp_pcb *pcb, void *pvBuf, uint32_t ui32Size)
+{
+    uint32_t ui32Len;
+
+    ui32Len = LWIP_MIN(ui32Size, pcb->ui32OutLen);
+    memcpy(pvBuf, pcb->pui8Out, ui32Len);
+    memmove(pcb->pui8Out, pcb->pui8Out + ui32Len, pcb->ui32OutLen - ui32Len);
+    pcb->ui32OutLen -= ui32Len;
+
+    return(ui32Len);
+}
+
+//*****************************************************************************
+//
+// Return the number of bytes the server has sent that are not acknowledged.
+//
+//*****************************************************************************
+uint32_t
+HostTCPUnacked(struct tcp_pcb *pcb)
+{
+    uint32_t ui32Idx, ui32Len;
+
+    ui32Len = 0;
+    for(ui32Idx = 0; ui32Idx < pcb->ui32NumWrites; ui32Idx++)
+    {
+        ui32Len += pcb->psWrites[ui32Idx].ui32Len;
+    }
+
+    return(ui32Len);
+}
+
+//*****************************************************************************
+//
+// Acknowledge everything the server has sent and tell it so.
+//
+//*****************************************************************************
+void
+HostTCPAck(struct tcp_pcb *pcb)
+{
+    volatile uint8_t ui8Marker;
+    tHostTCPWrite *psWrite;
+    uint32_t ui32Idx, ui32Acked, ui32Byte;
+    err_t err;
+
+    if(pcb->state == CLOSED)
+    {
+        return;
+    }
+
+    //
+    // The acknowledgement is a segment too, and brings on any data the server
+    // refused before it is processed.
+    //
+    StackBase(&ui8Marker);
+    RefusedDataDeliver(pcb);
+    g_uiStackBase = 0;
+    if(pcb->state == CLOSED)
+    {
+        return;
+    }
+
+    ui32Acked = 0;
+    for(ui32Idx = 0; ui32Idx < pcb->ui32NumWrites; ui32Idx++)
+    {
+        psWrite = &pcb->psWrites[ui32Idx];
+        if(psWrite->pui8Copy)
+        {
+            for(ui32Byte = 0; ui32Byte < psWrite->ui32Len; ui32Byte++)
+            {
+                if(((const uint8_t *)psWrite->pvData)[ui32Byte] !=
+                   psWrite->pui8Copy[ui32Byte])
+                {
+                    g_sStats.ui64Stale++;
+                }
+            }
+            free(psWrite->pui8Copy);
+        }
+        ui32Acked += psWrite->ui32Len;
+        pcb->snd_queuelen -= psWrite->ui16Pbufs;
+    }
+    pcb->ui32NumWrites = 0;
+    pcb->snd_buf += ui32Acked;
+
+    //
+    // The FIN is acknowledged along with the data.
+    //
+    if(pcb->state == FIN_WAIT_1)
+    {
+        pcb->state = FIN_WAIT_2;
+    }
+    else if(pcb->state == LAST_ACK)
+    {
+        PCBFree(pcb);
+        return;
+    }
+
+    StackBase(&ui8Marker);
+    while(ui32Acked && pcb->sent)
+    {
+        err = pcb->sent(pcb->callback_arg, pcb, LWIP_MIN(ui32Acked, 0xffff));
+        if((err == ERR_ABRT) || (pcb->state == CLOSED))
+        {
+            break;
+        }
+        ui32Acked -= LWIP_MIN(ui32Acked, 0xffff);
+    }
+    g_uiStackBase = 0;
+}
+
+//*****************************************************************************
+//
+// Run the server's poll callback for a connection.
+//
+//*****************************************************************************
+void
+HostTCPPoll(struct tcp_pcb *pcb)
+{
+    volatile uint8_t ui8Marker;
+
+    //
+    // The fast timer, which runs more often than the poll, offers refused
+    // data again first.
+    //
+    if(pcb->state != CLOSED)
+    {
+        StackBase(&ui8Marker);
+        RefusedDataDeliver(pcb);
+        g_uiStackBase = 0;
+    }
+    if((pcb->state != CLOSED) && pcb->poll)
+    {
+        StackBase(&ui8Marker);
+        pcb->poll(pcb->callback_arg, pcb);
+        g_uiStackBase = 0;
+    }
+}
+
+//*****************************************************************************
+//
+// Close a connection from the test's side.  If the server has closed it
+// already, its control block goes into TIME_WAIT.
+//
+//*****************************************************************************
+void
+HostTCPClose(struct tcp_pcb *pcb)
+{
+    volatile uint8_t ui8Marker;
+
+    switch(pcb->state)
+    {
+        case ESTABLISHED:
+        {
+            pcb->state = CLOSE_WAIT;
+            if(pcb->recv)
+            {
+                StackBase(&ui8Marker);
+                pcb->recv(pcb->callback_arg, pcb, NULL, ERR_OK);
+                g_uiStackBase = 0;
+            }
+            else
+            {
+                tcp_close(pcb);
+            }
+            break;
+        }
+        case FIN_WAIT_1:
+        case FIN_WAIT_2:
+        {
+            pcb->state = TIME_WAIT;
+            g_sStats.ui32TimeWait++;
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Return true if a connection is open from the server's side.
+//
+//*****************************************************************************
+bool
+HostTCPIsOpen(struct tcp_pcb *pcb)
+{
+    return(((pcb->state == ESTABLISHED) || (pcb->state == CLOSE_WAIT)) &&
+           !pcb->ui8Closed);
+}
+
+//*****************************************************************************
+//
+// Let the control blocks in TIME_WAIT go, as the 2 MSL timer would.
+//
+//*****************************************************************************
+void
+HostTCPExpireTimeWait(void)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < MEMP_NUM_TCP_PCB; ui32Idx++)
+    {
+        if(g_psPCBs[ui32Idx].state == TIME_WAIT)
+        {
+            PCBFree(&g_psPCBs[ui32Idx]);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+//*****************************************************************************
+//
+// lwip_host.h - The test side of the host stand-in for lwIP (lwip_host.c).
+//
+// A test plays the clients of the web server: it opens connections, sends
+// requests in pbufs of a chosen size, reads and acknowledges what the server
+// sent, runs the server's poll timer and closes connections.  Everything
+// happens in the calling thread, so the server runs to completion inside
+// each of these calls, as it does in the tcpip thread on the target.
+//
+//*****************************************************************************
+#ifndef __LWIP_HOST_H__
+#define __LWIP_HOST_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "lwip/tcp.h"
+
+//*****************************************************************************
+//
+// The counts kept by the stand-in.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // Connections accepted by the server, and those refused because all
+    // MEMP_NUM_TCP_PCB control blocks were in use.
+    //
+    uint32_t ui32Accepted;
+    uint32_t ui32Refused;
+
+    //
+    // Control blocks in use now, the most that were in use at once, those
+    // in TIME_WAIT now and those taken from TIME_WAIT for a new connection,
+    // as lwIP does when it runs out.
+    //
+    uint32_t ui32PCBs;
+    uint32_t ui32PeakPCBs;
+    uint32_t ui32TimeWait;
+    uint32_t ui32Recycled;
+
+    //
+    // Connections the server aborted, and connections reset because data
+    // arrived after the server closed them.
+    //
+    uint32_t ui32Aborted;
+    uint32_t ui32Reset;
+
+    //
+    // Bytes the server passed to tcp_write() to be copied and by reference,
+    // and bytes sent by reference that changed before they were
+    // acknowledged.
+    //
+    uint64_t ui64Copied;
+    uint64_t ui64Referenced;
+    uint64_t ui64Stale;
+
+    //
+    // The calls to tcp_write() and how many of them failed for want of
+    // send buffer or queue space.
+    //
+    uint32_t ui32Writes;
+    uint32_t ui32WritesFull;
+
+    //
+    // The most pbufs in use at once, and the segments dropped because the
+    // receive window was closed or the server was still refusing data, which
+    // the test has to send again.
+    //
+    uint32_t ui32PeakPbufs;
+    uint32_t ui32Dropped;
+
+    //
+    // The deepest the stack went below the test's call into the server,
+    // measured at every call the server made into lwIP, in bytes.
+    //
+    uint32_t ui32MaxStack;
+}
+tHostStats;
+
+//*****************************************************************************
+//
+// Prototypes of the functions exported by the stand-in.
+//
+//*****************************************************************************
+extern void HostStatsGet(tHostStats *psStats);
+extern void HostStatsClear(void);
+extern uint32_t HostMemInUse(void);
+extern uint32_t HostPbufsInUse(void);
+extern void HostTimeAdvance(uint32_t ui32Ms);
+extern struct tcp_pcb *HostTCPConnect(void);
+extern err_t HostTCPSend(struct tcp_pcb *psPCB, const void *pvData,
+                         uint32_t ui32Len, uint32_t ui32PbufSize);
+extern uint32_t HostTCPRead(struct tcp_pcb *psPCB, void *pvBuf,
+                            uint32_t ui32Size);
+extern uint32_t HostTCPUnacked(struct tcp_pcb *psPCB);
+extern void HostTCPAck(struct tcp_pcb *psPCB);
+extern void HostTCPPoll(struct tcp_pcb *psPCB);
+extern void HostTCPClose(struct tcp_pcb *psPCB);
+extern bool HostTCPIsOpen(struct tcp_pcb *psPCB);
+extern void HostTCPExpireTimeWait(void);
+
+#endif // __LWIP_HOST_H__
@@ -0,0 +1,17 @@
+//*****************************************************************************
+//
+// lwiplib.h - Host stand-in for the TivaWare lwIP wrapper.
+//
+//*****************************************************************************
+#ifndef __LWIPLIB_H__
+#define __LWIPLIB_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "lwip/opt.h"
+#include "lwip/def.h"
+#include "lwip/err.h"
+#include "lwip/mem.h"
+#include "lwip/sys.h"
+
+#endif // __LWIPLIB_H__
@@ -0,0 +1,27 @@
+//*****************************************************************************
+//
+// ustdlib.h - Host stand-in for the TivaWare string functions, mapped onto
+// the C library.  usnprintf() only differs from snprintf() in formats that
+// the firmware does not use.
+//
+//*****************************************************************************
+#ifndef __USTDLIB_H__
+#define __USTDLIB_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#define usnprintf                       snprintf
+#define usprintf                        sprintf
+#define uvsnprintf                      vsnprintf
+#define ustrlen                         strlen
+#define ustrcmp                         strcmp
+#define ustrncmp                        strncmp
+#define ustrcasecmp                     strcasecmp
+#define ustrncasecmp                    strncasecmp
+#define ustrstr                         strstr
+#define ustrtoul(s, e, b)               strtoul(s, (char **)(e), b)
+
+#endif // __USTDLIB_H__
@@ -0,0 +1,296 @@
+//*****************************************************************************
+//
+// httpd_copy_test.c - Host check of which bytes of each response the web
+// server copies into the TCP send buffer and which it sends by reference.
+//
+// This is not part of the firmware.  Build and run it on the host with:
+//
+//     cc -O2 -I. -Itools/host -Itools/host/httpserver_raw
+//         tools/httpd_copy_test.c io_fs.c tools/host/lwip_host.c
+//         tools/host/http_host.c tools/host/io_host.c json.c
+//         display_mirror.c -o httpd_copy_test && ./httpd_copy_test
+//
+// httpd.c is compiled unchanged, with LWIP_HTTPD_COPY_STATS turned on,
+// against the lwIP stand-in in tools/host, which counts the bytes passed to
+// tcp_write() with and without TCP_WRITE_FLAG_COPY and checks that data
+// sent by reference has not changed by the time it is acknowledged.  On the
+// host, the end of the read-only data of the program takes the place of
+// HTTPD_SRAM_BASE: the file system image, the fixed headers and the code
+// are below it, like flash on the target, and the heap, the file handles
+// and the stack are above it, like SRAM.
+//
+// For each kind of response the check splits the bytes into header and
+// body.  The only header the server builds in RAM is Content-Length, so
+// that is the only header line that may be copied.  The body of a file in
+// the image must go entirely by reference, that of an SSI file by reference
+// except for the strings the SSI handler inserts, and that of a generated
+// file must be copied in full.  The bytes that the rule before user-003
+// copied (all of every SSI file) are shown alongside.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+//*****************************************************************************
+//
+// Count the bytes in httpd.c as well, and take the end of the read-only data
+// for the start of SRAM.  __data_start is the first symbol of the writable
+// data of the program.
+//
+//*****************************************************************************
+extern char __data_start[];
+
+#define LWIP_HTTPD_COPY_STATS   1
+#define HTTPD_SRAM_BASE         __data_start
+
+#include "third_party/lwip-1.4.1/apps/httpserver_raw/httpd.c"
+#include "lwip_host.h"
+#include "http_host.h"
+#include "io_fs.h"
+#include "io_host.h"
+
+//*****************************************************************************
+//
+// The largest response read.
+//
+//*****************************************************************************
+#define MAX_RESPONSE            32768
+
+//*****************************************************************************
+//
+// The number of failed checks.
+//
+//*****************************************************************************
+static uint32_t g_ui32Failures;
+
+//*****************************************************************************
+//
+// The SSI tags of the web pages, as enet_io.c names them, and the bytes the
+// SSI handler has inserted.
+//
+//*****************************************************************************
+static const char *g_ppcSSITags[] =
+{
+    "LEDtxt",
+    "FormVars",
+    "speed"
+};
+
+#define NUM_SSI_TAGS            (sizeof(g_ppcSSITags) / sizeof(g_ppcSSITags[0]))
+
+static uint32_t g_ui32Inserted;
+
+//*****************************************************************************
+//
+// The kinds of response, by where the body comes from.
+//
+//*****************************************************************************
+typedef enum
+{
+    BODY_IMAGE,
+    BODY_SSI,
+    BODY_GENERATED
+}
+tBodyKind;
+
+//*****************************************************************************
+//
+// The responses checked.
+//
+//*****************************************************************************
+typedef struct
+{
+    const char *pcName;
+    const char *pcRequest;
+    tBodyKind eKind;
+}
+tCopyCase;
+
+static const tCopyCase g_psCases[] =
+{
+    { "/index.htm", "GET /index.htm HTTP/1.0\r\n\r\n", BODY_IMAGE },
+    { "/index.htm (gzip)",
+      "GET /index.htm HTTP/1.0\r\nAccept-Encoding: gzip\r\n\r\n",
+      BODY_IMAGE },
+    { "/styles.css", "GET /styles.css HTTP/1.0\r\n\r\n", BODY_IMAGE },
+    { "/utfpr.png", "GET /utfpr.png HTTP/1.0\r\n\r\n", BODY_IMAGE },
+    { "/missing.htm (404)", "GET /missing.htm HTTP/1.0\r\n\r\n", BODY_IMAGE },
+    { "/io_cgi.ssi", "GET /io_cgi.ssi HTTP/1.0\r\n\r\n", BODY_SSI },
+    { "/get_speed", "GET /get_speed HTTP/1.0\r\n\r\n", BODY_GENERATED },
+    { "/status.json", "GET /status.json HTTP/1.0\r\n\r\n", BODY_GENERATED },
+    { "/display.pbm", "GET /display.pbm HTTP/1.0\r\n\r\n", BODY_GENERATED }
+};
+
+#define NUM_CASES               (sizeof(g_psCases) / sizeof(g_psCases[0]))
+
+//*****************************************************************************
+//
+// Stand-in for the WebSocket server, which refuses every upgrade.
+//
+//*****************************************************************************
+err_t
+httpd_websocket_open(struct tcp_pcb *pcb, const char *key, u16_t key_len)
+{
+    return(ERR_VAL);
+}
+
+//*****************************************************************************
+//
+// The SSI handler.  It inserts a string of a different length for each tag
+// and counts the bytes.
+//
+//*****************************************************************************
+static u16_t
+SSIHandler(int iIndex, char *pcInsert, int iInsertLen)
+{
+    int iLen;
+
+    iLen = snprintf(pcInsert, iInsertLen, "[%s=%u]", g_ppcSSITags[iIndex],
+                    g_ui32HostSpeed);
+    iLen = LWIP_MIN(iLen, iInsertLen - 1);
+    g_ui32Inserted += iLen;
+
+    return((u16_t)iLen);
+}
+
+//*****************************************************************************
+//
+// Check the outcome of a test.
+//
+//*****************************************************************************
+static void
+Check(const char *pcTest, bool bPass)
+{
+    printf("%-56s %s\n", pcTest, bPass ? "ok" : "FAILED");
+    if(!bPass)
+    {
+        g_ui32Failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// Fetch one response and check how its bytes were sent.
+//
+//*****************************************************************************
+static void
+TestCase(const tCopyCase *psCase)
+{
+    static char pcBuf[MAX_RESPONSE];
+    tHTTPResponse sResponse;
+    tHostStats sStats;
+    char pcTest[64];
+    const char *pcValue;
+    uint32_t ui32Len, ui32Body, ui32HdrCopied, ui32BodyCopied, ui32BodyRef;
+    uint32_t ui32Before;
+    u32_t ui32HttpdCopied, ui32HttpdRef;
+    bool bOK, bPass;
+
+    HostStatsClear();
+    g_ui32Inserted = 0;
+    ui32HttpdCopied = httpd_bytes_copied;
+    ui32HttpdRef = httpd_bytes_zero_copy;
+
+    bOK = HTTPGet(psCase->pcRequest, PBUF_POOL_BUFSIZE, pcBuf, sizeof(pcBuf),
+                  &sResponse);
+    HostStatsGet(&sStats);
+    ui32HttpdCopied = httpd_bytes_copied - ui32HttpdCopied;
+    ui32HttpdRef = httpd_bytes_zero_copy - ui32HttpdRef;
+
+    //
+    // Only the Content-Length line is built in RAM.  Take it off the
+    // copied bytes and the rest of the headers off the referenced ones.
+    //
+    ui32Body = sResponse.ui32Len - sResponse.ui32HeaderLen;
+    ui32HdrCopied = 0;
+    pcValue = HTTPHeader(&sResponse, "Content-Length", &ui32Len);
+    if(pcValue)
+    {
+        ui32HdrCopied = strlen("Content-Length: ") + ui32Len + 2;
+    }
+    ui32BodyCopied = sStats.ui64Copied - ui32HdrCopied;
+    ui32BodyRef = sStats.ui64Referenced -
+                  (sResponse.ui32HeaderLen - ui32HdrCopied);
+    ui32Before = ui32HdrCopied +
+                 ((psCase->eKind == BODY_IMAGE) ? ui32BodyCopied : ui32Body);
+
+    printf("%-20s %6u wire %6u body %6u copied %6u by reference "
+           "(%u copied before)\n", psCase->pcName, sResponse.ui32Len,
+           ui32Body, (uint32_t)sStats.ui64Copied,
+           (uint32_t)sStats.ui64Referenced, ui32Before);
+
+    snprintf(pcTest, sizeof(pcTest), "%s: whole response", psCase->pcName);
+    Check(pcTest, bOK && (sResponse.ui32Len == (sStats.ui64Copied +
+                                                sStats.ui64Referenced)));
+
+    switch(psCase->eKind)
+    {
+        case BODY_IMAGE:
+        {
+            bPass = (ui32BodyCopied == 0) && (ui32BodyRef == ui32Body);
+            snprintf(pcTest, sizeof(pcTest), "%s: body by reference",
+                     psCase->pcName);
+            break;
+        }
+        case BODY_SSI:
+        {
+            bPass = g_ui32Inserted && (ui32BodyCopied == g_ui32Inserted) &&
+                    ((ui32BodyRef + g_ui32Inserted) == ui32Body);
+            snprintf(pcTest, sizeof(pcTest), "%s: only the inserts copied",
+                     psCase->pcName);
+            break;
+        }
+        default:
+        {
+            bPass = (ui32BodyCopied == ui32Body) && (ui32BodyRef == 0);
+            snprintf(pcTest, sizeof(pcTest), "%s: body copied",
+                     psCase->pcName);
+            break;
+        }
+    }
+    Check(pcTest, bPass);
+
+    snprintf(pcTest, sizeof(pcTest), "%s: httpd counts agree", psCase->pcName);
+    Check(pcTest, (ui32HttpdCopied == sStats.ui64Copied) &&
+                  (ui32HttpdRef == sStats.ui64Referenced));
+
+    snprintf(pcTest, sizeof(pcTest), "%s: no stale reference",
+             psCase->pcName);
+    Check(pcTest, sStats.ui64Stale == 0);
+}
+
+//*****************************************************************************
+//
+// Run the tests.
+//
+//*****************************************************************************
+int
+main(void)
+{
+    uint32_t ui32Idx;
+
+    Check("io_fs_init registers every dynamic file", io_fs_init());
+    http_set_ssi_handler(SSIHandler, g_ppcSSITags, NUM_SSI_TAGS);
+    httpd_init();
+
+    for(ui32Idx = 0; ui32Idx < NUM_CASES; ui32Idx++)
+    {
+        TestCase(&g_psCases[ui32Idx]);
+        HostTCPExpireTimeWait();
+    }
+
+    Check("no memory left allocated", HostMemInUse() == 0);
+    Check("no pbufs left allocated", HostPbufsInUse() == 0);
+
+    if(g_ui32Failures)
+    {
+        printf("%u checks failed\n", g_ui32Failures);
+        return(1);
+    }
+
+    printf("all checks passed\n");
+
+    return(0);
+}
@@ -0,0 +1,399 @@
+//*****************************************************************************
+//
+// httpd_gzip_test.c - Host check of the pre-compressed variants of the web
+// pages, and of what they cost in flash and save on the wire.
+//
+// This is not part of the firmware.  Build and run it on the host with:
+//
+//     cc -O2 -I. -Itools/host -Itools/host/httpserver_raw
+//         tools/httpd_gzip_test.c
+//         third_party/lwip-1.4.1/apps/httpserver_raw/httpd.c
+//         tools/host/lwip_host.c tools/host/http_host.c tools/host/io_host.c
+//         json.c display_mirror.c -lz -o httpd_gzip_test && ./httpd_gzip_test
+//
+// httpd.c and io_fs.c are compiled unchanged against the lwIP stand-in in
+// tools/host.  The test loads the home page the way a browser does, the
+// page and everything it pulls in, once from a client that accepts gzip and
+// once from one that does not.  Every response must carry the original file
+// (inflated with zlib if it was sent compressed), files with a .gz variant
+// must say "Vary: Accept-Encoding" both ways and those without must not.
+// It then reports the bytes on the wire for each load and the flash the
+// file system image spends on the variants.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <zlib.h>
+#include "io_fs.c"
+#include "lwip_host.h"
+#include "http_host.h"
+
+//*****************************************************************************
+//
+// The largest response read.
+//
+//*****************************************************************************
+#define MAX_RESPONSE            32768
+
+//*****************************************************************************
+//
+// The requests a browser makes to show the home page, and the files in the
+// image that answer them.
+//
+//*****************************************************************************
+typedef struct
+{
+    const char *pcURI;
+    const char *pcFile;
+}
+tPageRequest;
+
+static const tPageRequest g_psPage[] =
+{
+    { "/", "/index.htm" },
+    { "/styles.css", "/styles.css" },
+    { "/favicon.ico", "/favicon.ico" },
+    { "/javascript.js", "/javascript.js" },
+    { "/utfpr.png", "/utfpr.png" }
+};
+
+#define NUM_PAGE_REQUESTS       (sizeof(g_psPage) / sizeof(g_psPage[0]))
+
+//*****************************************************************************
+//
+// Two requests for the same file on a persistent connection, the first
+// accepting gzip and the second not.
+//
+//*****************************************************************************
+static const char g_pcGzipRequest[] =
+    "GET /styles.css HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n";
+static const char g_pcPlainRequest[] =
+    "GET /styles.css HTTP/1.1\r\n\r\n";
+
+//*****************************************************************************
+//
+// The number of failed checks.
+//
+//*****************************************************************************
+static uint32_t g_ui32Failures;
+
+//*****************************************************************************
+//
+// Stand-in for the WebSocket server, which refuses every upgrade.
+//
+//*****************************************************************************
+err_t
+httpd_websocket_open(struct tcp_pcb *pcb, const char *key, u16_t key_len)
+{
+    return(ERR_VAL);
+}
+
+//*****************************************************************************
+//
+// Check the outcome of a test.
+//
+//*****************************************************************************
+static void
+Check(const char *pcTest, bool bPass)
+{
+    printf("%-56s %s\n", pcTest, bPass ? "ok" : "FAILED");
+    if(!bPass)
+    {
+        g_ui32Failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// Find a file in the image.  Returns NULL if it is not there.
+//
+//*****************************************************************************
+static const struct fsdata_file *
+FindFile(const char *pcName)
+{
+    const struct fsdata_file *psTree;
+
+    for(psTree = FS_ROOT; psTree != NULL; psTree = psTree->next)
+    {
+        if(strcmp((const char *)psTree->name, pcName) == 0)
+        {
+            return(psTree);
+        }
+    }
+
+    return(NULL);
+}
+
+//*****************************************************************************
+//
+// Return true if a response has a header with the given value.
+//
+//*****************************************************************************
+static bool
+HasHeader(const tHTTPResponse *psResponse, const char *pcName,
+          const char *pcValue)
+{
+    const char *pcFound;
+    uint32_t ui32Len;
+
+    pcFound = HTTPHeader(psResponse, pcName, &ui32Len);
+
+    return(pcFound && (ui32Len == strlen(pcValue)) &&
+           (strncmp(pcFound, pcValue, ui32Len) == 0));
+}
+
+//*****************************************************************************
+//
+// Inflate a gzip stream.  Returns the length of the data, or 0 if the stream
+// is not valid.
+//
+//*****************************************************************************
+static uint32_t
+Gunzip(const char *pcIn, uint32_t ui32InLen, uint8_t *pui8Out,
+       uint32_t ui32OutSize)
+{
+    z_stream sStream;
+    uint32_t ui32Len;
+    int iRet;
+
+    memset(&sStream, 0, sizeof(sStream));
+    if(inflateInit2(&sStream, 16 + MAX_WBITS) != Z_OK)
+    {
+        return(0);
+    }
+
+    sStream.next_in = (Bytef *)pcIn;
+    sStream.avail_in = ui32InLen;
+    sStream.next_out = pui8Out;
+    sStream.avail_out = ui32OutSize;
+    iRet = inflate(&sStream, Z_FINISH);
+    ui32Len = sStream.total_out;
+    inflateEnd(&sStream);
+
+    return((iRet == Z_STREAM_END) ? ui32Len : 0);
+}
+
+//*****************************************************************************
+//
+// Load the home page.  Returns the number of bytes on the wire, requests
+// and responses, or 0 if a check failed.
+//
+//*****************************************************************************
+static uint32_t
+LoadPage(bool bGzip)
+{
+    static char pcBuf[MAX_RESPONSE];
+    static uint8_t pui8Plain[MAX_RESPONSE];
+    const struct fsdata_file *psFile, *psVariant;
+    tHTTPResponse sResponse;
+    char pcRequest[128], pcName[64];
+    const char *pcBody;
+    uint32_t ui32Idx, ui32Wire, ui32Body, ui32Len;
+    bool bOK, bHeaders, bBody;
+
+    bHeaders = true;
+    bBody = true;
+    ui32Wire = 0;
+    for(ui32Idx = 0; ui32Idx < NUM_PAGE_REQUESTS; ui32Idx++)
+    {
+        snprintf(pcName, sizeof(pcName), "%s.gz", g_psPage[ui32Idx].pcFile);
+        psFile = FindFile(g_psPage[ui32Idx].pcFile);
+        psVariant = FindFile(pcName);
+
+        snprintf(pcRequest, sizeof(pcRequest),
+                 "GET %s HTTP/1.1\r\nHost: 192.168.0.2\r\n%s"
+                 "Connection: close\r\n\r\n", g_psPage[ui32Idx].pcURI,
+                 bGzip ? "Accept-Encoding: gzip, deflate\r\n" : "");
+        bOK = HTTPGet(pcRequest, PBUF_POOL_BUFSIZE, pcBuf, sizeof(pcBuf),
+                      &sResponse);
+        ui32Wire += strlen(pcRequest) + sResponse.ui32Len;
+        if(!bOK || !psFile || (HTTPStatus(&sResponse) != 200))
+        {
+            printf("  %s: no response\n", g_psPage[ui32Idx].pcURI);
+            return(0);
+        }
+
+        //
+        // Only files with a variant depend on Accept-Encoding, and only the
+        // variant is compressed.
+        //
+        if((HasHeader(&sResponse, "Vary", "Accept-Encoding") !=
+            (psVariant != NULL)) ||
+           (HasHeader(&sResponse, "Content-Encoding", "gzip") !=
+            (bGzip && (psVariant != NULL))))
+        {
+            printf("  %s: wrong headers\n", g_psPage[ui32Idx].pcURI);
+            bHeaders = false;
+        }
+
+        pcBody = sResponse.pcData + sResponse.ui32HeaderLen;
+        ui32Body = sResponse.ui32Len - sResponse.ui32HeaderLen;
+        if(HTTPHeader(&sResponse, "Content-Encoding", &ui32Len))
+        {
+            ui32Body = Gunzip(pcBody, ui32Body, pui8Plain, sizeof(pui8Plain));
+            pcBody = (const char *)pui8Plain;
+        }
+        if((ui32Body != (uint32_t)psFile->len) ||
+           (memcmp(pcBody, psFile->data, ui32Body) != 0))
+        {
+            printf("  %s: wrong body\n", g_psPage[ui32Idx].pcURI);
+            bBody = false;
+        }
+
+        HostTCPExpireTimeWait();
+    }
+
+    Check(bGzip ? "gzip load: headers" : "plain load: headers", bHeaders);
+    Check(bGzip ? "gzip load: every file arrives intact" :
+                  "plain load: every file arrives intact", bBody);
+
+    return((bHeaders && bBody) ? ui32Wire : 0);
+}
+
+//*****************************************************************************
+//
+// Check the responses that must never be compressed.
+//
+//*****************************************************************************
+static void
+TestUncompressed(void)
+{
+    static char pcBuf[MAX_RESPONSE];
+    tHTTPResponse sResponse;
+    struct tcp_pcb *psPCB;
+    uint32_t ui32Len;
+    bool bOK;
+
+    bOK = HTTPGet("GET /io_cgi.ssi HTTP/1.0\r\nAccept-Encoding: gzip\r\n\r\n",
+                  PBUF_POOL_BUFSIZE, pcBuf, sizeof(pcBuf), &sResponse);
+    Check("SSI files are not compressed",
+          bOK && !HTTPHeader(&sResponse, "Content-Encoding", NULL) &&
+          !HTTPHeader(&sResponse, "Vary", NULL));
+
+    bOK = HTTPGet("GET /status.json HTTP/1.0\r\nAccept-Encoding: gzip\r\n\r\n",
+                  PBUF_POOL_BUFSIZE, pcBuf, sizeof(pcBuf), &sResponse);
+    Check("generated files are not compressed",
+          bOK && !HTTPHeader(&sResponse, "Content-Encoding", NULL) &&
+          !HTTPHeader(&sResponse, "Vary", NULL));
+
+    //
+    // On a persistent connection, each request is answered by what it
+    // accepts.
+    //
+    psPCB = HostTCPConnect();
+    HostTCPSend(psPCB, g_pcGzipRequest, strlen(g_pcGzipRequest),
+                PBUF_POOL_BUFSIZE);
+    ui32Len = 0;
+    bOK = HTTPReadResponse(psPCB, pcBuf, sizeof(pcBuf), &ui32Len, &sResponse);
+    bOK = bOK && HasHeader(&sResponse, "Content-Encoding", "gzip");
+    HostTCPSend(psPCB, g_pcPlainRequest, strlen(g_pcPlainRequest),
+                PBUF_POOL_BUFSIZE);
+    ui32Len = 0;
+    bOK = bOK && HTTPReadResponse(psPCB, pcBuf, sizeof(pcBuf), &ui32Len,
+                                  &sResponse);
+    Check("the encoding is chosen afresh for each request",
+          bOK && !HTTPHeader(&sResponse, "Content-Encoding", NULL) &&
+          HasHeader(&sResponse, "Vary", "Accept-Encoding") &&
+          ((sResponse.ui32Len - sResponse.ui32HeaderLen) ==
+           (uint32_t)FindFile("/styles.css")->len));
+    HostTCPClose(psPCB);
+    HTTPRead(psPCB, pcBuf, sizeof(pcBuf), 0);
+
+    HostTCPExpireTimeWait();
+}
+
+//*****************************************************************************
+//
+// Report the flash the variants take up in the file system image.
+//
+//*****************************************************************************
+static void
+ReportFlash(void)
+{
+    const struct fsdata_file *psTree, *psPlain;
+    char pcName[64];
+    uint32_t ui32Image, ui32Variants, ui32Plain, ui32Len;
+    bool bPass;
+
+    bPass = true;
+    ui32Image = 0;
+    ui32Variants = 0;
+    ui32Plain = 0;
+    for(psTree = FS_ROOT; psTree != NULL; psTree = psTree->next)
+    {
+        ui32Image += psTree->len;
+
+        ui32Len = strlen((const char *)psTree->name);
+        if((ui32Len < 3) ||
+           (strcmp((const char *)psTree->name + ui32Len - 3, ".gz") != 0))
+        {
+            continue;
+        }
+
+        snprintf(pcName, sizeof(pcName), "%.*s", (int)(ui32Len - 3),
+                 (const char *)psTree->name);
+        psPlain = FindFile(pcName);
+        if(!psPlain)
+        {
+            printf("  %s has no plain file\n", psTree->name);
+            bPass = false;
+        }
+        else
+        {
+            printf("%-20s %6u bytes, %6u compressed (%3u%%)\n", pcName,
+                   psPlain->len, psTree->len,
+                   (100 * psTree->len) / psPlain->len);
+            ui32Variants += psTree->len;
+            ui32Plain += psPlain->len;
+        }
+    }
+
+    printf("flash: %u bytes in the image, %u (%u%%) spent on .gz variants "
+           "of %u bytes of files\n", ui32Image, ui32Variants,
+           (100 * ui32Variants) / ui32Image, ui32Plain);
+
+    Check("every .gz variant has a plain file", bPass);
+}
+
+//*****************************************************************************
+//
+// Run the tests.
+//
+//*****************************************************************************
+int
+main(void)
+{
+    uint32_t ui32Plain, ui32Gzip;
+
+    Check("io_fs_init registers every dynamic file", io_fs_init());
+    httpd_init();
+
+    ReportFlash();
+
+    ui32Plain = LoadPage(false);
+    ui32Gzip = LoadPage(true);
+    if(ui32Plain && ui32Gzip)
+    {
+        printf("page load: %u bytes on the wire plain, %u with gzip "
+               "(%u%% saved)\n", ui32Plain, ui32Gzip,
+               (100 * (ui32Plain - ui32Gzip)) / ui32Plain);
+    }
+    Check("gzip takes fewer bytes on the wire", ui32Gzip < ui32Plain);
+
+    TestUncompressed();
+
+    Check("no memory left allocated", HostMemInUse() == 0);
+    Check("no pbufs left allocated", HostPbufsInUse() == 0);
+
+    if(g_ui32Failures)
+    {
+        printf("%u checks failed\n", g_ui32Failures);
+        return(1);
+    }
+
+    printf("all checks passed\n");
+
+    return(0);
+}
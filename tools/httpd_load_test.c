@@ -0,0 +1,657 @@
+//*****************************************************************************
+//
+// httpd_load_test.c - Host load test of the web server: connection rate,
+// control block usage and pipelined requests.
+//
+// This is not part of the firmware.  Build and run it on the host with:
+//
+//     cc -O2 -I. -Itools/host -Itools/host/httpserver_raw
+//         tools/httpd_load_test.c
+//         third_party/lwip-1.4.1/apps/httpserver_raw/httpd.c io_fs.c
+//         tools/host/lwip_host.c tools/host/http_host.c tools/host/io_host.c
+//         json.c display_mirror.c -o httpd_load_test && ./httpd_load_test
+//
+// httpd.c and io_fs.c are compiled unchanged against the lwIP stand-in in
+// tools/host, which has MEMP_NUM_TCP_PCB control blocks and reuses the
+// oldest one in TIME_WAIT when they run out, as lwIP does.
+//
+// The test fetches a page over a new connection per request and over a few
+// persistent ones, and reports the connections and requests per second the
+// host manages and the control blocks each way takes.  It checks that the
+// server refuses connections cleanly when the blocks run out, and that
+// pipelined requests are all answered, in order, when they straddle or span
+// pbufs, follow a response too large for the send buffer or come in the
+// hundreds, without the stack growing with their number.  A client that
+// pipelines faster than a response drains must be held off by TCP flow
+// control, with only a few pbufs held for it, while other connections are
+// served.  Rates are for the host; the block and pbuf counts are what the
+// target would see.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lwip/opt.h"
+#include "lwip/tcp.h"
+#include "httpserver_raw/httpd.h"
+#include "httpserver_raw/fs.h"
+#include "lwip_host.h"
+#include "http_host.h"
+#include "io_fs.h"
+
+//*****************************************************************************
+//
+// The largest amount of responses read at once, the number of requests made
+// for the rate measurements and the number of persistent connections they
+// are spread over.
+//
+//*****************************************************************************
+#define MAX_RESPONSE            (256 * 1024)
+#define NUM_RATE_REQUESTS       20000
+#define NUM_KEEPALIVE_CONNS     4
+
+//*****************************************************************************
+//
+// The files requested, and their lengths in the file system.
+//
+//*****************************************************************************
+static const char * const g_ppcFiles[] =
+{
+    "/index.htm",
+    "/get_speed",
+    "/styles.css",
+    "/utfpr.png",
+    "/favicon.ico",
+    "/status.json"
+};
+
+#define NUM_FILES               (sizeof(g_ppcFiles) / sizeof(g_ppcFiles[0]))
+
+//*****************************************************************************
+//
+// The index in g_ppcFiles of the file larger than the send buffer.
+//
+//*****************************************************************************
+#define FILE_LARGE              3
+
+//*****************************************************************************
+//
+// The number of requests a client pipelines behind a large response without
+// reading it, and the most pbufs the server may hold on to for them: the
+// requests it queues and the segment it refuses after that.  The rest of the
+// PBUF_POOL_SIZE pbufs are left for the other connections.
+//
+//*****************************************************************************
+#define NUM_FLOOD_REQUESTS      200
+#define MAX_HELD_PBUFS          8
+
+//*****************************************************************************
+//
+// The responses read, the requests sent and the number of failed checks.
+//
+//*****************************************************************************
+static char g_pcResponses[MAX_RESPONSE];
+static char g_pcRequests[64 * 1024];
+static uint32_t g_ui32Failures;
+
+//*****************************************************************************
+//
+// Stand-in for the WebSocket server, which refuses every upgrade.
+//
+//*****************************************************************************
+err_t
+httpd_websocket_open(struct tcp_pcb *pcb, const char *key, u16_t key_len)
+{
+    return(ERR_VAL);
+}
+
+//*****************************************************************************
+//
+// Check the outcome of a test.
+//
+//*****************************************************************************
+static void
+Check(const char *pcTest, bool bPass)
+{
+    printf("%-56s %s\n", pcTest, bPass ? "ok" : "FAILED");
+    if(!bPass)
+    {
+        g_ui32Failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// Return the time in seconds.
+//
+//*****************************************************************************
+static double
+Now(void)
+{
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+    return(sTime.tv_sec + (sTime.tv_nsec / 1e9));
+}
+
+//*****************************************************************************
+//
+// Return the length of a file, as the server should announce it.
+//
+//*****************************************************************************
+static uint32_t
+FileLength(const char *pcName)
+{
+    struct fs_file *psFile;
+    uint32_t ui32Len;
+
+    psFile = fs_open(pcName);
+    if(!psFile)
+    {
+        return(0);
+    }
+    ui32Len = psFile->len;
+    fs_close(psFile);
+
+    return(ui32Len);
+}
+
+//*****************************************************************************
+//
+// Close a persistent connection from the client's side and acknowledge the
+// server's FIN, which releases its control block.
+//
+//*****************************************************************************
+static void
+CloseConnection(struct tcp_pcb *psPCB)
+{
+    HostTCPClose(psPCB);
+    HostTCPAck(psPCB);
+}
+
+//*****************************************************************************
+//
+// Build a request for a file.  The request is padded with a header of
+// ui32Pad bytes so that requests do not line up with pbufs.
+//
+//*****************************************************************************
+static uint32_t
+BuildRequest(char *pcBuf, uint32_t ui32Size, const char *pcName,
+             uint32_t ui32Pad, bool bClose)
+{
+    uint32_t ui32Len;
+
+    ui32Len = snprintf(pcBuf, ui32Size, "GET %s HTTP/1.1\r\n"
+                       "Host: 192.168.0.2\r\nX-Pad: ", pcName);
+    while(ui32Pad-- && (ui32Len < (ui32Size - 64)))
+    {
+        pcBuf[ui32Len++] = 'a' + (ui32Pad % 26);
+    }
+    ui32Len += snprintf(pcBuf + ui32Len, ui32Size - ui32Len, "\r\n%s\r\n",
+                        bClose ? "Connection: close\r\n" : "");
+
+    return(ui32Len);
+}
+
+//*****************************************************************************
+//
+// Send the requests in g_pcRequests that have not been sent yet, ending at
+// the offsets in pui32Ends, as a client does: as many whole requests per
+// segment as fit in ui32Segment bytes (at least one), for as long as the
+// server takes the segments.  *pui32Sent is the number of requests sent so
+// far, and is updated.
+//
+//*****************************************************************************
+static void
+SendRequests(struct tcp_pcb *psPCB, const uint32_t *pui32Ends,
+             uint32_t ui32Num, uint32_t *pui32Sent, uint32_t ui32Segment,
+             uint32_t ui32PbufSize)
+{
+    uint32_t ui32Start, ui32End;
+
+    while(*pui32Sent < ui32Num)
+    {
+        ui32Start = *pui32Sent ? pui32Ends[*pui32Sent - 1] : 0;
+        ui32End = *pui32Sent + 1;
+        while((ui32End < ui32Num) &&
+              ((pui32Ends[ui32End] - ui32Start) <= ui32Segment))
+        {
+            ui32End++;
+        }
+
+        if(HostTCPSend(psPCB, g_pcRequests + ui32Start,
+                       pui32Ends[ui32End - 1] - ui32Start,
+                       ui32PbufSize) != ERR_OK)
+        {
+            break;
+        }
+        *pui32Sent = ui32End;
+    }
+}
+
+//*****************************************************************************
+//
+// Build ui32Num pipelined requests in g_pcRequests, the file of request i
+// being g_ppcFiles[pui32Files[i]], and note where each ends in pui32Ends.
+//
+//*****************************************************************************
+static void
+BuildRequests(const uint32_t *pui32Files, uint32_t ui32Num, uint32_t ui32Pad,
+              uint32_t *pui32Ends)
+{
+    uint32_t ui32Idx, ui32Len;
+
+    ui32Len = 0;
+    for(ui32Idx = 0; ui32Idx < ui32Num; ui32Idx++)
+    {
+        ui32Len += BuildRequest(g_pcRequests + ui32Len,
+                                sizeof(g_pcRequests) - ui32Len,
+                                g_ppcFiles[pui32Files[ui32Idx]],
+                                ui32Pad ? (ui32Pad + ((ui32Idx * 37) % 101)) :
+                                0, false);
+        pui32Ends[ui32Idx] = ui32Len;
+    }
+}
+
+//*****************************************************************************
+//
+// Read the response to request ui32Idx of a pipeline into g_pcResponses,
+// which holds *pui32Len bytes read already, and check it.  The response is
+// taken out of the buffer.  Returns true if it was the response expected.
+//
+//*****************************************************************************
+static bool
+ReadPipelined(struct tcp_pcb *psPCB, const uint32_t *pui32Files,
+              uint32_t ui32Idx, uint32_t *pui32Len)
+{
+    tHTTPResponse sResponse;
+    const char *pcName;
+
+    pcName = g_ppcFiles[pui32Files[ui32Idx]];
+    if(!HTTPReadResponse(psPCB, g_pcResponses, sizeof(g_pcResponses),
+                         pui32Len, &sResponse) ||
+       (HTTPStatus(&sResponse) != 200) ||
+       ((sResponse.ui32Len - sResponse.ui32HeaderLen) != FileLength(pcName)))
+    {
+        printf("  request %u for %s: no matching response\n", ui32Idx,
+               pcName);
+        return(false);
+    }
+
+    *pui32Len -= sResponse.ui32Len;
+    memmove(g_pcResponses, g_pcResponses + sResponse.ui32Len, *pui32Len);
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Send ui32Num pipelined requests on a new persistent connection, in
+// segments of up to TCP_MSS bytes in pbufs of ui32PbufSize bytes, and check
+// that all are answered in order.  Segments are sent ahead of the responses
+// for as long as the server takes them.  Returns true if all were answered.
+//
+//*****************************************************************************
+static bool
+Pipeline(const uint32_t *pui32Files, uint32_t ui32Num, uint32_t ui32Pad,
+         uint32_t ui32PbufSize)
+{
+    static uint32_t pui32Ends[512];
+    struct tcp_pcb *psPCB;
+    uint32_t ui32Idx, ui32Len, ui32Sent;
+    bool bOK;
+
+    BuildRequests(pui32Files, ui32Num, ui32Pad, pui32Ends);
+
+    psPCB = HostTCPConnect();
+    if(!psPCB)
+    {
+        return(false);
+    }
+
+    bOK = true;
+    ui32Len = 0;
+    ui32Sent = 0;
+    for(ui32Idx = 0; bOK && (ui32Idx < ui32Num); ui32Idx++)
+    {
+        SendRequests(psPCB, pui32Ends, ui32Num, &ui32Sent, TCP_MSS,
+                     ui32PbufSize);
+        bOK = ReadPipelined(psPCB, pui32Files, ui32Idx, &ui32Len);
+    }
+
+    bOK = bOK && (ui32Len == 0) && HostTCPIsOpen(psPCB);
+    CloseConnection(psPCB);
+
+    return(bOK);
+}
+
+//*****************************************************************************
+//
+// Fetch a page over a new connection per request, then over a few persistent
+// connections, and report the rates and the control blocks used.
+//
+//*****************************************************************************
+static void
+TestRate(void)
+{
+    struct tcp_pcb *ppsPCBs[NUM_KEEPALIVE_CONNS];
+    tHTTPResponse sResponse;
+    tHostStats sStats;
+    char pcRequest[128];
+    uint32_t ui32Idx, ui32Len, ui32Conn, ui32Served;
+    double dStart, dTime;
+
+    //
+    // A new connection per request, which the server closes.  Its control
+    // block stays in TIME_WAIT until it is reused.
+    //
+    HostStatsClear();
+    ui32Served = 0;
+    BuildRequest(pcRequest, sizeof(pcRequest), "/get_speed", 0, true);
+    dStart = Now();
+    for(ui32Idx = 0; ui32Idx < NUM_RATE_REQUESTS; ui32Idx++)
+    {
+        if(HTTPGet(pcRequest, PBUF_POOL_BUFSIZE, g_pcResponses,
+                   sizeof(g_pcResponses), &sResponse) &&
+           (HTTPStatus(&sResponse) == 200))
+        {
+            ui32Served++;
+        }
+    }
+    dTime = Now() - dStart;
+    HostStatsGet(&sStats);
+
+    printf("new connection per request: %8.0f connections/s, %u control "
+           "blocks at most, %u in TIME_WAIT, %u reused from TIME_WAIT\n",
+           NUM_RATE_REQUESTS / dTime, sStats.ui32PeakPCBs,
+           sStats.ui32TimeWait, sStats.ui32Recycled);
+    Check("every request over a new connection is served",
+          (ui32Served == NUM_RATE_REQUESTS) && !sStats.ui32Refused);
+    Check("TIME_WAIT blocks are reused rather than refusing",
+          (sStats.ui32PeakPCBs == MEMP_NUM_TCP_PCB) &&
+          (sStats.ui32Recycled > 0));
+    HostTCPExpireTimeWait();
+
+    //
+    // The same requests over a few persistent connections.
+    //
+    HostStatsClear();
+    ui32Served = 0;
+    BuildRequest(pcRequest, sizeof(pcRequest), "/get_speed", 0, false);
+    dStart = Now();
+    for(ui32Conn = 0; ui32Conn < NUM_KEEPALIVE_CONNS; ui32Conn++)
+    {
+        ppsPCBs[ui32Conn] = HostTCPConnect();
+    }
+    for(ui32Idx = 0; ui32Idx < NUM_RATE_REQUESTS; ui32Idx++)
+    {
+        ui32Conn = ui32Idx % NUM_KEEPALIVE_CONNS;
+        ui32Len = 0;
+        if(ppsPCBs[ui32Conn] &&
+           (HostTCPSend(ppsPCBs[ui32Conn], pcRequest, strlen(pcRequest),
+                        PBUF_POOL_BUFSIZE) == ERR_OK) &&
+           HTTPReadResponse(ppsPCBs[ui32Conn], g_pcResponses,
+                            sizeof(g_pcResponses), &ui32Len, &sResponse) &&
+           (HTTPStatus(&sResponse) == 200) &&
+           (ui32Len == sResponse.ui32Len))
+        {
+            ui32Served++;
+        }
+    }
+    for(ui32Conn = 0; ui32Conn < NUM_KEEPALIVE_CONNS; ui32Conn++)
+    {
+        if(ppsPCBs[ui32Conn])
+        {
+            CloseConnection(ppsPCBs[ui32Conn]);
+        }
+    }
+    dTime = Now() - dStart;
+    HostStatsGet(&sStats);
+
+    printf("%u persistent connections:   %8.0f requests/s, %u control "
+           "blocks at most, %u in TIME_WAIT\n", NUM_KEEPALIVE_CONNS,
+           NUM_RATE_REQUESTS / dTime, sStats.ui32PeakPCBs,
+           sStats.ui32TimeWait);
+    Check("every request over a persistent connection is served",
+          ui32Served == NUM_RATE_REQUESTS);
+    Check("persistent connections take one block each",
+          (sStats.ui32PeakPCBs == NUM_KEEPALIVE_CONNS) &&
+          (sStats.ui32PCBs == 0) && (sStats.ui32Accepted ==
+                                     NUM_KEEPALIVE_CONNS));
+}
+
+//*****************************************************************************
+//
+// Open more connections than there are control blocks.
+//
+//*****************************************************************************
+static void
+TestExhaustion(void)
+{
+    struct tcp_pcb *ppsPCBs[MEMP_NUM_TCP_PCB + 4];
+    tHTTPResponse sResponse;
+    tHostStats sStats;
+    char pcRequest[128];
+    uint32_t ui32Idx, ui32Open, ui32Served, ui32Len;
+
+    HostStatsClear();
+    ui32Open = 0;
+    for(ui32Idx = 0; ui32Idx < (MEMP_NUM_TCP_PCB + 4); ui32Idx++)
+    {
+        ppsPCBs[ui32Idx] = HostTCPConnect();
+        if(ppsPCBs[ui32Idx])
+        {
+            ui32Open++;
+        }
+    }
+    HostStatsGet(&sStats);
+    Check("connections beyond the control blocks are refused",
+          (ui32Open == MEMP_NUM_TCP_PCB) && (sStats.ui32Refused == 4));
+
+    ui32Served = 0;
+    BuildRequest(pcRequest, sizeof(pcRequest), "/index.htm", 0, false);
+    for(ui32Idx = 0; ui32Idx < (MEMP_NUM_TCP_PCB + 4); ui32Idx++)
+    {
+        ui32Len = 0;
+        if(ppsPCBs[ui32Idx] &&
+           (HostTCPSend(ppsPCBs[ui32Idx], pcRequest, strlen(pcRequest),
+                        PBUF_POOL_BUFSIZE) == ERR_OK) &&
+           HTTPReadResponse(ppsPCBs[ui32Idx], g_pcResponses,
+                            sizeof(g_pcResponses), &ui32Len, &sResponse) &&
+           (HTTPStatus(&sResponse) == 200))
+        {
+            ui32Served++;
+        }
+        if(ppsPCBs[ui32Idx])
+        {
+            CloseConnection(ppsPCBs[ui32Idx]);
+        }
+    }
+    Check("the connections that were accepted are served",
+          ui32Served == MEMP_NUM_TCP_PCB);
+}
+
+//*****************************************************************************
+//
+// Pipelined requests.
+//
+//*****************************************************************************
+static void
+TestPipelining(void)
+{
+    static uint32_t pui32Files[512];
+    tHostStats sStats;
+    uint32_t ui32Idx, ui32Stack;
+
+    //
+    // Requests of a few hundred bytes in pool pbufs, so that most of them
+    // straddle two pbufs, and in pbufs so small that every request spans
+    // several.
+    //
+    for(ui32Idx = 0; ui32Idx < 16; ui32Idx++)
+    {
+        pui32Files[ui32Idx] = (ui32Idx * 5) % NUM_FILES;
+    }
+    Check("requests straddling pool pbufs are all answered",
+          Pipeline(pui32Files, 16, 200, PBUF_POOL_BUFSIZE));
+    Check("requests spanning many small pbufs are all answered",
+          Pipeline(pui32Files, 16, 200, 60));
+
+    //
+    // A single request larger than a pool pbuf.
+    //
+    Check("a request larger than a pbuf is answered",
+          Pipeline(pui32Files, 1, 2 * PBUF_POOL_BUFSIZE, PBUF_POOL_BUFSIZE));
+
+    //
+    // Requests behind a response that does not fit in the send buffer wait
+    // for it to be acknowledged.
+    //
+    pui32Files[0] = FILE_LARGE;
+    pui32Files[1] = 1;
+    pui32Files[2] = FILE_LARGE;
+    pui32Files[3] = 0;
+    Check("requests behind a large response are answered",
+          Pipeline(pui32Files, 4, 0, PBUF_POOL_BUFSIZE));
+
+    //
+    // Many small responses that all fit in the send buffer: each ends
+    // within the call that starts it, which used to start the next one a
+    // level deeper.
+    //
+    for(ui32Idx = 0; ui32Idx < 512; ui32Idx++)
+    {
+        pui32Files[ui32Idx] = 1;
+    }
+    HostStatsClear();
+    Check("a single small request is answered",
+          Pipeline(pui32Files, 1, 0, PBUF_POOL_BUFSIZE));
+    HostStatsGet(&sStats);
+    ui32Stack = sStats.ui32MaxStack;
+
+    HostStatsClear();
+    Check("64 pipelined small requests are answered",
+          Pipeline(pui32Files, 64, 0, PBUF_POOL_BUFSIZE));
+    HostStatsGet(&sStats);
+    printf("stack below the receive callback: %u bytes for 1 request, %u for "
+           "64 pipelined\n", ui32Stack, sStats.ui32MaxStack);
+    Check("the stack does not grow with the pipeline",
+          sStats.ui32MaxStack <= (ui32Stack + 256));
+}
+
+//*****************************************************************************
+//
+// Pipeline requests behind a large response faster than it drains: the
+// client sends segments of up to ui32Segment bytes, named pcName, for as
+// long as the server takes them before it reads anything.
+//
+//*****************************************************************************
+static void
+TestFlood(uint32_t ui32Segment, const char *pcName)
+{
+    static uint32_t pui32Files[NUM_FLOOD_REQUESTS + 1];
+    static uint32_t pui32Ends[NUM_FLOOD_REQUESTS + 1];
+    struct tcp_pcb *psPCB;
+    tHTTPResponse sResponse;
+    tHostStats sStats;
+    char pcRequest[128], pcTest[64];
+    uint32_t ui32Idx, ui32Len, ui32Sent, ui32Base, ui32Held, ui32Ahead;
+    bool bOK, bHeld, bServed;
+
+    pui32Files[0] = FILE_LARGE;
+    for(ui32Idx = 1; ui32Idx <= NUM_FLOOD_REQUESTS; ui32Idx++)
+    {
+        pui32Files[ui32Idx] = 1;
+    }
+    BuildRequests(pui32Files, NUM_FLOOD_REQUESTS + 1, 0, pui32Ends);
+
+    //
+    // Start the large response, then send everything the server takes,
+    // twice over as a client retrying would.
+    //
+    psPCB = HostTCPConnect();
+    ui32Sent = 0;
+    SendRequests(psPCB, pui32Ends, 1, &ui32Sent, ui32Segment,
+                 PBUF_POOL_BUFSIZE);
+    ui32Base = HostPbufsInUse();
+    HostStatsClear();
+    SendRequests(psPCB, pui32Ends, NUM_FLOOD_REQUESTS + 1, &ui32Sent,
+                 ui32Segment, PBUF_POOL_BUFSIZE);
+    ui32Held = HostPbufsInUse() - ui32Base;
+    ui32Ahead = ui32Sent - 1;
+    SendRequests(psPCB, pui32Ends, NUM_FLOOD_REQUESTS + 1, &ui32Sent,
+                 ui32Segment, PBUF_POOL_BUFSIZE);
+    bHeld = (ui32Sent == (ui32Ahead + 1)) &&
+            ((HostPbufsInUse() - ui32Base) == ui32Held);
+
+    //
+    // Another client is served meanwhile.
+    //
+    BuildRequest(pcRequest, sizeof(pcRequest), "/index.htm", 0, true);
+    bServed = HTTPGet(pcRequest, PBUF_POOL_BUFSIZE, g_pcResponses,
+                      sizeof(g_pcResponses), &sResponse) &&
+              (HTTPStatus(&sResponse) == 200);
+    HostStatsGet(&sStats);
+
+    //
+    // Read the responses, sending the rest of the requests as the server
+    // takes them.
+    //
+    bOK = true;
+    ui32Len = 0;
+    for(ui32Idx = 0; bOK && (ui32Idx <= NUM_FLOOD_REQUESTS); ui32Idx++)
+    {
+        SendRequests(psPCB, pui32Ends, NUM_FLOOD_REQUESTS + 1, &ui32Sent,
+                     ui32Segment, PBUF_POOL_BUFSIZE);
+        bOK = ReadPipelined(psPCB, pui32Files, ui32Idx, &ui32Len);
+    }
+    bOK = bOK && (ui32Len == 0) && HostTCPIsOpen(psPCB);
+    CloseConnection(psPCB);
+    HostTCPExpireTimeWait();
+
+    printf("pipelining ahead in %s: %u of %u requests taken, %u pbufs "
+           "held, %u segments dropped\n", pcName, ui32Ahead,
+           NUM_FLOOD_REQUESTS, ui32Held, sStats.ui32Dropped);
+    snprintf(pcTest, sizeof(pcTest), "%s: the client is held off", pcName);
+    Check(pcTest, bHeld && (ui32Ahead < NUM_FLOOD_REQUESTS) &&
+                  (ui32Held <= MAX_HELD_PBUFS));
+    snprintf(pcTest, sizeof(pcTest), "%s: other clients served", pcName);
+    Check(pcTest, bServed);
+    snprintf(pcTest, sizeof(pcTest), "%s: all requests answered", pcName);
+    Check(pcTest, bOK);
+}
+
+//*****************************************************************************
+//
+// Run the tests.
+//
+//*****************************************************************************
+int
+main(void)
+{
+    Check("io_fs_init registers every dynamic file", io_fs_init());
+    httpd_init();
+
+    TestRate();
+    TestExhaustion();
+    TestPipelining();
+    TestFlood(0, "a request per segment");
+    TestFlood(TCP_MSS, "full segments");
+
+    HostTCPExpireTimeWait();
+    Check("no memory left allocated", HostMemInUse() == 0);
+    Check("no pbufs left allocated", HostPbufsInUse() == 0);
+
+    if(g_ui32Failures)
+    {
+        printf("%u checks failed\n", g_ui32Failures);
+        return(1);
+    }
+
+    printf("all checks passed\n");
+
+    return(0);
+}
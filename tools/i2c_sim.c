@@ -0,0 +1,907 @@
+//*****************************************************************************
+//
+// i2c_sim.c - Host simulator for the I2C0 transfer engine (i2c_xfer.c).
+//
+// This is not part of the firmware.  Build and run it on the host with (on
+// one line):
+//
+//     cc -O2 -I. -IFreeRTOS/include tools/i2c_sim.c oled_fb.c oled_font.c
+//         oled_image.c fonts/font_default.c images/images_rle.c -o i2c_sim &&
+//         ./i2c_sim
+//
+// The engine is compiled unchanged against a model of the I2C0 master
+// registers.  The model executes each command the engine writes to I2CMCS,
+// records the resulting bus traffic, raises the master interrupt and calls
+// the engine's interrupt handler, checking that the engine only issues
+// commands when the controller is idle and always clears the interrupt.
+// Faults (NACKs and lost arbitration) can be injected at any byte.
+//
+// The SSD1306 driver (i2c.c) runs on top of the engine as it does before the
+// scheduler starts, polling it, so the sequences it sends to the display can
+// be checked on the bus.
+//
+// After the functional checks it sends full 1024-byte SSD1306 frames and
+// reports the interrupts and CPU time spent per frame, next to the bus time
+// at 400 kbit/s that the previous polling driver spent spinning.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//*****************************************************************************
+//
+// The model of the I2C0 master registers, which replace the real ones in the
+// engine.  I2CMCS is a status register when read and a command register when
+// written; the model presents the status before every call into the engine
+// and treats any change of the value as a command.
+//
+//*****************************************************************************
+static struct
+{
+    uint32_t ui32MSA;
+    uint32_t ui32MCS;
+    uint32_t ui32MDR;
+    uint32_t ui32MIMR;
+    uint32_t ui32MRIS;
+    uint32_t ui32MMIS;
+    uint32_t ui32MICR;
+}
+g_sRegs;
+
+#include "tm4c1294ncpdt.h"
+
+#undef I2C0_MSA_R
+#undef I2C0_MCS_R
+#undef I2C0_MDR_R
+#undef I2C0_MIMR_R
+#undef I2C0_MRIS_R
+#undef I2C0_MMIS_R
+#undef I2C0_MICR_R
+#define I2C0_MSA_R              (g_sRegs.ui32MSA)
+#define I2C0_MCS_R              (g_sRegs.ui32MCS)
+#define I2C0_MDR_R              (g_sRegs.ui32MDR)
+#define I2C0_MIMR_R             (g_sRegs.ui32MIMR)
+#define I2C0_MRIS_R             (g_sRegs.ui32MRIS)
+#define I2C0_MMIS_R             (g_sRegs.ui32MMIS)
+#define I2C0_MICR_R             (g_sRegs.ui32MICR)
+
+#include "i2c_xfer.c"
+
+//*****************************************************************************
+//
+// The bus traffic is logged as one entry per event: a START with the address
+// byte, a data byte or a STOP.
+//
+//*****************************************************************************
+#define BUS_START               0x100
+#define BUS_STOP                0x200
+#define BUS_LOG_SIZE            4096
+
+//*****************************************************************************
+//
+// The faults that can be injected.
+//
+//*****************************************************************************
+#define FAULT_NONE              0
+#define FAULT_NACK              1       // The byte is not acknowledged
+#define FAULT_ARBLST            2       // Arbitration is lost on the byte
+
+//*****************************************************************************
+//
+// The time of one bit at 400 kbit/s, in nanoseconds.
+//
+//*****************************************************************************
+#define BIT_NS                  2500
+
+//*****************************************************************************
+//
+// The state of the controller model.
+//
+//*****************************************************************************
+static struct
+{
+    //
+    // The status presented in I2CMCS and whether a command is in progress.
+    //
+    uint32_t ui32Status;
+    bool bBusy;
+    uint32_t ui32Command;
+
+    //
+    // Whether this master holds the bus (between its START and STOP).
+    //
+    bool bOwned;
+
+    //
+    // Interrupts are delivered through I2C_Xfer_IntHandler() unless
+    // bPolled is set, which models an interrupt masked in the NVIC.
+    //
+    bool bPolled;
+
+    //
+    // The fault to inject on the byte with index ui32FaultByte (counting
+    // address and data bytes from the start of the run).
+    //
+    uint32_t ui32Fault;
+    uint32_t ui32FaultByte;
+    uint32_t ui32Bytes;
+
+    //
+    // The bus log, the bus time and the statistics of the engine.  The
+    // handler time excludes ui64TimerNs, the cost of reading the clock.
+    //
+    uint16_t pui16Log[BUS_LOG_SIZE];
+    uint32_t ui32LogLen;
+    uint64_t ui64BusNs;
+    uint32_t ui32Interrupts;
+    uint64_t ui64HandlerNs;
+    uint64_t ui64TimerNs;
+    uint32_t ui32Violations;
+}
+g_sSim;
+
+//*****************************************************************************
+//
+// Return the time in nanoseconds.
+//
+//*****************************************************************************
+static uint64_t
+Now(void)
+{
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+
+    return(((uint64_t)sTime.tv_sec * 1000000000) + sTime.tv_nsec);
+}
+
+//*****************************************************************************
+//
+// Report a protocol violation by the engine.
+//
+//*****************************************************************************
+static void
+Violation(const char *pcMessage)
+{
+    fprintf(stderr, "violation: %s\n", pcMessage);
+    g_sSim.ui32Violations++;
+}
+
+//*****************************************************************************
+//
+// Add an event to the bus log.
+//
+//*****************************************************************************
+static void
+BusLog(uint16_t ui16Event)
+{
+    if(g_sSim.ui32LogLen < BUS_LOG_SIZE)
+    {
+        g_sSim.pui16Log[g_sSim.ui32LogLen++] = ui16Event;
+    }
+}
+
+//*****************************************************************************
+//
+// Put a byte on the bus and return the fault it meets, if any.
+//
+//*****************************************************************************
+static uint32_t
+BusByte(uint16_t ui16Event)
+{
+    uint32_t ui32Fault;
+
+    ui32Fault = FAULT_NONE;
+    if(g_sSim.ui32Bytes == g_sSim.ui32FaultByte)
+    {
+        ui32Fault = g_sSim.ui32Fault;
+    }
+    g_sSim.ui32Bytes++;
+
+    BusLog(ui16Event);
+    g_sSim.ui64BusNs += 9 * BIT_NS;
+
+    return(ui32Fault);
+}
+
+//*****************************************************************************
+//
+// Present the controller status to the engine before calling it.
+//
+//*****************************************************************************
+static void
+PresentRegisters(void)
+{
+    g_sRegs.ui32MCS = g_sSim.ui32Status;
+    g_sRegs.ui32MICR = 0;
+    g_sRegs.ui32MMIS = (g_sRegs.ui32MRIS & g_sRegs.ui32MIMR) ? I2C_MMIS_MIS :
+                       0;
+}
+
+//*****************************************************************************
+//
+// Look at the registers after a call into the engine: acknowledge a cleared
+// interrupt and accept a new command.
+//
+//*****************************************************************************
+static void
+CollectRegisters(void)
+{
+    if(g_sRegs.ui32MICR & I2C_MICR_IC)
+    {
+        g_sRegs.ui32MRIS = 0;
+    }
+
+    if(g_sRegs.ui32MCS != g_sSim.ui32Status)
+    {
+        if(g_sSim.bBusy)
+        {
+            Violation("command written while the controller is busy");
+        }
+        if(g_sRegs.ui32MRIS)
+        {
+            Violation("command written before the interrupt was cleared");
+        }
+        g_sSim.bBusy = true;
+        g_sSim.ui32Command = g_sRegs.ui32MCS;
+    }
+}
+
+//*****************************************************************************
+//
+// Execute the command in progress and raise the interrupt.
+//
+//*****************************************************************************
+static void
+Execute(void)
+{
+    uint32_t ui32Command, ui32Fault, ui32Error;
+
+    ui32Command = g_sSim.ui32Command;
+    ui32Fault = FAULT_NONE;
+    ui32Error = 0;
+
+    if(ui32Command & I2C_MCS_RUN)
+    {
+        if(ui32Command & I2C_MCS_START)
+        {
+            if(g_sSim.bOwned)
+            {
+                Violation("repeated START");
+            }
+            if(g_sRegs.ui32MSA & 1)
+            {
+                Violation("read transfer");
+            }
+            g_sSim.bOwned = true;
+            g_sSim.ui64BusNs += BIT_NS;
+            ui32Fault = BusByte(BUS_START | (g_sRegs.ui32MSA >> 1));
+            ui32Error = I2C_MCS_ADRACK;
+        }
+        else if(!g_sSim.bOwned)
+        {
+            Violation("data sent without a START");
+        }
+
+        if(ui32Fault == FAULT_NONE)
+        {
+            ui32Fault = BusByte(g_sRegs.ui32MDR & 0xff);
+            ui32Error = I2C_MCS_DATACK;
+        }
+    }
+    else if(ui32Command != I2C_MCS_STOP)
+    {
+        Violation("unknown command");
+    }
+    else if(!g_sSim.bOwned)
+    {
+        Violation("STOP without a START");
+    }
+
+    //
+    // A lost arbitration hands the bus to the other master.  A NACK leaves
+    // it held, unless the command asked for the STOP.
+    //
+    if(ui32Fault == FAULT_ARBLST)
+    {
+        g_sSim.bOwned = false;
+        g_sSim.ui32Status = I2C_MCS_ERROR | I2C_MCS_ARBLST;
+    }
+    else
+    {
+        if(ui32Fault == FAULT_NACK)
+        {
+            g_sSim.ui32Status = I2C_MCS_ERROR | ui32Error;
+        }
+        else
+        {
+            g_sSim.ui32Status = 0;
+        }
+
+        if(g_sSim.bOwned && (ui32Command & I2C_MCS_STOP))
+        {
+            BusLog(BUS_STOP);
+            g_sSim.ui64BusNs += BIT_NS;
+            g_sSim.bOwned = false;
+        }
+        g_sSim.ui32Status |= g_sSim.bOwned ? I2C_MCS_BUSBSY : I2C_MCS_IDLE;
+    }
+
+    g_sSim.bBusy = false;
+    g_sRegs.ui32MRIS = I2C_MRIS_RIS;
+}
+
+//*****************************************************************************
+//
+// Deliver the interrupt to the engine, or poll it.
+//
+//*****************************************************************************
+static void
+Deliver(void)
+{
+    uint64_t ui64Start;
+
+    PresentRegisters();
+    ui64Start = Now();
+    if(g_sSim.bPolled)
+    {
+        I2C_Xfer_Poll();
+    }
+    else if(g_sRegs.ui32MMIS)
+    {
+        I2C_Xfer_IntHandler();
+        g_sSim.ui32Interrupts++;
+    }
+    g_sSim.ui64HandlerNs += Now() - ui64Start - g_sSim.ui64TimerNs;
+    CollectRegisters();
+
+    if(g_sRegs.ui32MRIS && !g_sSim.bBusy)
+    {
+        Violation("interrupt left raised");
+        g_sRegs.ui32MRIS = 0;
+    }
+}
+
+//*****************************************************************************
+//
+// Run the controller until the engine has nothing left to do.
+//
+//*****************************************************************************
+static void
+Run(void)
+{
+    while(g_sSim.bBusy)
+    {
+        Execute();
+        Deliver();
+    }
+
+    if(I2C_Xfer_Busy())
+    {
+        Violation("engine busy with an idle controller");
+    }
+    if(g_sSim.bOwned)
+    {
+        Violation("bus left held");
+    }
+}
+
+//*****************************************************************************
+//
+// Queue a transfer through the engine's API, as a task would.
+//
+//*****************************************************************************
+static void
+Submit(tI2CTransfer *psTransfer)
+{
+    PresentRegisters();
+    I2C_Xfer_Submit(psTransfer);
+    CollectRegisters();
+}
+
+//*****************************************************************************
+//
+// Reset the model and the engine, with a fault injected on a byte.
+//
+//*****************************************************************************
+static void
+Reset(uint32_t ui32Fault, uint32_t ui32FaultByte, bool bPolled)
+{
+    uint64_t ui64TimerNs;
+
+    ui64TimerNs = g_sSim.ui64TimerNs;
+    memset(&g_sRegs, 0, sizeof(g_sRegs));
+    memset(&g_sSim, 0, sizeof(g_sSim));
+    g_sSim.ui64TimerNs = ui64TimerNs;
+    g_sSim.ui32Status = I2C_MCS_IDLE;
+    g_sSim.ui32Fault = ui32Fault;
+    g_sSim.ui32FaultByte = ui32FaultByte;
+    g_sSim.bPolled = bPolled;
+
+    PresentRegisters();
+    I2C_Xfer_Init();
+    CollectRegisters();
+}
+
+//*****************************************************************************
+//
+// The SSD1306 driver, compiled against a stand-in for the parts of FreeRTOS
+// it uses that reports the scheduler as not started.  Its calls into the
+// engine go through the model: a submit as above, and a poll runs the
+// controller for one command.
+//
+//*****************************************************************************
+#define INC_FREERTOS_H
+#define INC_TASK_H
+#define __UTILS_H__
+
+typedef long BaseType_t;
+typedef void *TaskHandle_t;
+
+#define pdFALSE                 0
+#define pdTRUE                  1
+#define portMAX_DELAY           0xffffffff
+#define taskSCHEDULER_NOT_STARTED 1
+#define taskSCHEDULER_RUNNING   2
+
+#define xTaskGetSchedulerState()        taskSCHEDULER_NOT_STARTED
+#define xTaskGetCurrentTaskHandle()     ((TaskHandle_t)0)
+#define vTaskNotifyGiveFromISR(t, w)    ((void)(t), (void)(w))
+#define portYIELD_FROM_ISR(w)           ((void)(w))
+
+static uint32_t
+ulTaskNotifyTake(BaseType_t xClear, uint32_t ui32Wait)
+{
+    return(0);
+}
+
+static void
+PollOnce(void)
+{
+    if(!g_sSim.bBusy)
+    {
+        Violation("driver waiting on an idle controller");
+        exit(1);
+    }
+
+    Execute();
+    Deliver();
+}
+
+#define I2C_Xfer_Submit         Submit
+#define I2C_Xfer_Poll           PollOnce
+
+#include "i2c.c"
+
+#undef I2C_Xfer_Submit
+#undef I2C_Xfer_Poll
+
+//*****************************************************************************
+//
+// The callback of the test transfers counts its calls in pvCallbackData and
+// submits the transfer chained to it, if any.
+//
+//*****************************************************************************
+static tI2CTransfer *g_psChained;
+
+static void
+Callback(tI2CTransfer *psTransfer)
+{
+    tI2CTransfer *psChained;
+
+    (*(uint32_t *)psTransfer->pvCallbackData)++;
+
+    if(g_psChained)
+    {
+        psChained = g_psChained;
+        g_psChained = 0;
+        I2C_Xfer_Submit(psChained);
+    }
+}
+
+//*****************************************************************************
+//
+// Fill in a transfer to the display.
+//
+//*****************************************************************************
+static void
+Transfer(tI2CTransfer *psTransfer, const uint8_t *pui8Header,
+         uint32_t ui32HeaderSize, const uint8_t *pui8Data, uint32_t ui32Size,
+         uint32_t *pui32Calls)
+{
+    psTransfer->ui8Address = 0x3c;
+    psTransfer->pui8Header = pui8Header;
+    psTransfer->ui32HeaderSize = ui32HeaderSize;
+    psTransfer->pui8Data = pui8Data;
+    psTransfer->ui32Size = ui32Size;
+    psTransfer->pfnCallback = Callback;
+    psTransfer->pvCallbackData = pui32Calls;
+}
+
+//*****************************************************************************
+//
+// Append the bus traffic expected for a complete transfer to a log.
+//
+//*****************************************************************************
+static uint32_t
+Expect(uint16_t *pui16Log, uint32_t ui32Len, const tI2CTransfer *psTransfer,
+       uint32_t ui32Count, bool bStop)
+{
+    uint32_t ui32Idx;
+
+    pui16Log[ui32Len++] = BUS_START | psTransfer->ui8Address;
+    for(ui32Idx = 0; ui32Idx < ui32Count; ui32Idx++)
+    {
+        pui16Log[ui32Len++] = I2C_Xfer_Byte(psTransfer, ui32Idx);
+    }
+    if(bStop)
+    {
+        pui16Log[ui32Len++] = BUS_STOP;
+    }
+
+    return(ui32Len);
+}
+
+//*****************************************************************************
+//
+// Check the outcome of a test.
+//
+//*****************************************************************************
+static uint32_t g_ui32Failures;
+
+static void
+Check(const char *pcTest, bool bPass)
+{
+    if(g_sSim.ui32Violations)
+    {
+        bPass = false;
+    }
+
+    printf("%-44s %s\n", pcTest, bPass ? "ok" : "FAILED");
+    if(!bPass)
+    {
+        g_ui32Failures++;
+    }
+}
+
+static bool
+LogIs(const uint16_t *pui16Log, uint32_t ui32Len)
+{
+    return((g_sSim.ui32LogLen == ui32Len) &&
+           !memcmp(g_sSim.pui16Log, pui16Log, ui32Len * sizeof(uint16_t)));
+}
+
+//*****************************************************************************
+//
+// The tests.
+//
+//*****************************************************************************
+static const uint8_t g_pui8Command[] = { 0x00, 0xae };
+static const uint8_t g_pui8Data = 0x40;
+static uint8_t g_pui8Frame[1024];
+static uint16_t g_pui16Expect[BUS_LOG_SIZE];
+
+static void
+TestSingle(void)
+{
+    tI2CTransfer sTransfer;
+    uint32_t ui32Calls, ui32Len;
+
+    //
+    // A command: control byte and command byte.
+    //
+    Reset(FAULT_NONE, ~0, false);
+    ui32Calls = 0;
+    Transfer(&sTransfer, g_pui8Command, 1, g_pui8Command + 1, 1, &ui32Calls);
+    Submit(&sTransfer);
+    Run();
+    ui32Len = Expect(g_pui16Expect, 0, &sTransfer, 2, true);
+    Check("command", LogIs(g_pui16Expect, ui32Len) && (ui32Calls == 1) &&
+          (sTransfer.ui32Status == I2C_XFER_DONE));
+
+    //
+    // A single byte, sent with START and STOP in one command.
+    //
+    Reset(FAULT_NONE, ~0, false);
+    ui32Calls = 0;
+    Transfer(&sTransfer, g_pui8Command, 1, 0, 0, &ui32Calls);
+    Submit(&sTransfer);
+    Run();
+    ui32Len = Expect(g_pui16Expect, 0, &sTransfer, 1, true);
+    Check("single byte", LogIs(g_pui16Expect, ui32Len) && (ui32Calls == 1) &&
+          (g_sSim.ui32Interrupts == 1));
+
+    //
+    // No bytes at all.
+    //
+    Reset(FAULT_NONE, ~0, false);
+    ui32Calls = 0;
+    Transfer(&sTransfer, 0, 0, 0, 0, &ui32Calls);
+    Submit(&sTransfer);
+    Run();
+    Check("empty transfer", (g_sSim.ui32LogLen == 0) && (ui32Calls == 1) &&
+          (sTransfer.ui32Status == I2C_XFER_DONE));
+}
+
+static void
+TestFrame(bool bPolled)
+{
+    tI2CTransfer sTransfer;
+    uint32_t ui32Calls, ui32Len;
+
+    Reset(FAULT_NONE, ~0, bPolled);
+    ui32Calls = 0;
+    Transfer(&sTransfer, &g_pui8Data, 1, g_pui8Frame, sizeof(g_pui8Frame),
+             &ui32Calls);
+    Submit(&sTransfer);
+    Run();
+    ui32Len = Expect(g_pui16Expect, 0, &sTransfer, 1 + sizeof(g_pui8Frame),
+                     true);
+    Check(bPolled ? "frame, polled" : "frame, interrupt driven",
+          LogIs(g_pui16Expect, ui32Len) && (ui32Calls == 1) &&
+          (sTransfer.ui32Status == I2C_XFER_DONE));
+}
+
+static void
+TestQueue(void)
+{
+    tI2CTransfer psTransfers[4];
+    uint32_t ui32Calls, ui32Len, ui32Idx;
+
+    //
+    // Three transfers queued at once and a fourth submitted by the callback
+    // of the first go out in that order.
+    //
+    Reset(FAULT_NONE, ~0, false);
+    ui32Calls = 0;
+    for(ui32Idx = 0; ui32Idx < 4; ui32Idx++)
+    {
+        Transfer(&psTransfers[ui32Idx], &g_pui8Data, 1,
+                 g_pui8Frame + (ui32Idx * 16), 16, &ui32Calls);
+    }
+    g_psChained = &psTransfers[3];
+    for(ui32Idx = 0; ui32Idx < 3; ui32Idx++)
+    {
+        Submit(&psTransfers[ui32Idx]);
+    }
+    Run();
+
+    ui32Len = 0;
+    for(ui32Idx = 0; ui32Idx < 4; ui32Idx++)
+    {
+        ui32Len = Expect(g_pui16Expect, ui32Len, &psTransfers[ui32Idx], 17,
+                         true);
+    }
+    Check("queued and chained transfers",
+          LogIs(g_pui16Expect, ui32Len) && (ui32Calls == 4) &&
+          (psTransfers[3].ui32Status == I2C_XFER_DONE));
+}
+
+static void
+TestFault(const char *pcTest, uint32_t ui32Fault, uint32_t ui32FaultByte)
+{
+    tI2CTransfer psTransfers[2];
+    uint32_t ui32Calls, ui32Len, ui32Sent;
+    bool bStop;
+
+    //
+    // The fault hits the first transfer of 10 bytes plus its address; the
+    // second must still go out whole.
+    //
+    Reset(ui32Fault, ui32FaultByte, false);
+    ui32Calls = 0;
+    Transfer(&psTransfers[0], &g_pui8Data, 1, g_pui8Frame, 9, &ui32Calls);
+    Transfer(&psTransfers[1], &g_pui8Data, 1, g_pui8Frame, 9, &ui32Calls);
+    Submit(&psTransfers[0]);
+    Submit(&psTransfers[1]);
+    Run();
+
+    //
+    // The bytes up to the faulty one are on the bus, followed by a STOP
+    // unless the arbitration was lost.
+    //
+    ui32Sent = ui32FaultByte;
+    bStop = (ui32Fault == FAULT_NACK);
+    ui32Len = Expect(g_pui16Expect, 0, &psTransfers[0], ui32Sent, bStop);
+    ui32Len = Expect(g_pui16Expect, ui32Len, &psTransfers[1], 10, true);
+    Check(pcTest, LogIs(g_pui16Expect, ui32Len) && (ui32Calls == 2) &&
+          (psTransfers[0].ui32Status == I2C_XFER_ERROR) &&
+          (psTransfers[1].ui32Status == I2C_XFER_DONE));
+}
+
+//*****************************************************************************
+//
+// Check that the display driver sends a command sequence as one transaction,
+// and report what it costs next to sending each byte on its own as the driver
+// did before, with the delay it added after each transaction.
+//
+//*****************************************************************************
+#define OLD_COMMAND_DELAY_NS    200000
+
+static uint32_t
+Transactions(void)
+{
+    uint32_t ui32Idx, ui32Count;
+
+    ui32Count = 0;
+    for(ui32Idx = 0; ui32Idx < g_sSim.ui32LogLen; ui32Idx++)
+    {
+        if(g_sSim.pui16Log[ui32Idx] & BUS_START)
+        {
+            ui32Count++;
+        }
+    }
+
+    return(ui32Count);
+}
+
+static void
+TestOLED(const char *pcTest, void (*pfnSequence)(void),
+         const uint8_t *pui8Commands, uint32_t ui32Count)
+{
+    uint32_t ui32Len, ui32Idx, ui32Transactions;
+    uint64_t ui64BusNs;
+
+    //
+    // The sequence as the driver sends it: one transaction with a single
+    // command control byte.
+    //
+    Reset(FAULT_NONE, ~0, true);
+    pfnSequence();
+    ui32Len = 0;
+    g_pui16Expect[ui32Len++] = BUS_START | SSD1306_I2C_ADDRESS;
+    g_pui16Expect[ui32Len++] = SSD1306_COMMAND;
+    for(ui32Idx = 0; ui32Idx < ui32Count; ui32Idx++)
+    {
+        g_pui16Expect[ui32Len++] = pui8Commands[ui32Idx];
+    }
+    g_pui16Expect[ui32Len++] = BUS_STOP;
+    Check(pcTest, LogIs(g_pui16Expect, ui32Len) && (Transactions() == 1) &&
+          !error);
+    ui64BusNs = g_sSim.ui64BusNs;
+
+    //
+    // The same bytes one command per transaction.
+    //
+    Reset(FAULT_NONE, ~0, true);
+    for(ui32Idx = 0; ui32Idx < ui32Count; ui32Idx++)
+    {
+        I2C_OLED_Send(SSD1306_COMMAND, pui8Commands[ui32Idx]);
+    }
+    ui32Transactions = Transactions();
+
+    printf("  %u -> 1 transactions, %u -> %u bytes, %.1f -> %.1f us "
+           "(%.1f us with the old delays)\n", ui32Transactions,
+           ui32Transactions * 3, ui32Count + 2, g_sSim.ui64BusNs / 1e3,
+           ui64BusNs / 1e3, (g_sSim.ui64BusNs / 1e3) +
+           (ui32Transactions * 2 * OLD_COMMAND_DELAY_NS / 1e3));
+}
+
+static void
+MoveCursor(void)
+{
+    I2C_OLED_Move_Cursor(2, 16);
+}
+
+static const uint8_t g_pui8MoveCursor[] =
+{
+    SSD1306_PAGEADDR, 2, 7, SSD1306_COLUMNADDR, 16, SSD1306_LCDWIDTH - 1
+};
+
+static void
+StartScroll(void)
+{
+    I2C_OLED_Scroll(SSD1306_LEFT_HORIZONTAL_SCROLL, 0, 1,
+                    SSD1306_SCROLL_25_FRAMES, 0);
+}
+
+static const uint8_t g_pui8StartScroll[] =
+{
+    SSD1306_DEACTIVATE_SCROLL, SSD1306_LEFT_HORIZONTAL_SCROLL, 0x00, 0,
+    SSD1306_SCROLL_25_FRAMES, 1, 0x00, 0xFF, SSD1306_ACTIVATE_SCROLL
+};
+
+static void
+StartDiagonalScroll(void)
+{
+    I2C_OLED_Scroll(SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL, 2, 5,
+                    SSD1306_SCROLL_5_FRAMES, 1);
+}
+
+static const uint8_t g_pui8StartDiagonalScroll[] =
+{
+    SSD1306_DEACTIVATE_SCROLL, SSD1306_SET_VERTICAL_SCROLL_AREA, 0,
+    SSD1306_LCDHEIGHT, SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL, 0x00, 2,
+    SSD1306_SCROLL_5_FRAMES, 5, 1, SSD1306_ACTIVATE_SCROLL
+};
+
+//*****************************************************************************
+//
+// Measure the engine sending frames.
+//
+//*****************************************************************************
+static void
+Measure(void)
+{
+    tI2CTransfer sTransfer;
+    uint32_t ui32Calls, ui32Frames;
+    uint64_t ui64Handler, ui64Bus;
+
+    //
+    // Calibrate the cost of timing a call.
+    //
+    ui64Handler = Now();
+    for(ui32Frames = 0; ui32Frames < 1000000; ui32Frames++)
+    {
+        Now();
+    }
+    g_sSim.ui64TimerNs = (Now() - ui64Handler) / 1000000;
+
+    ui64Handler = 0;
+    ui64Bus = 0;
+    for(ui32Frames = 0; ui32Frames < 2000; ui32Frames++)
+    {
+        Reset(FAULT_NONE, ~0, false);
+        ui32Calls = 0;
+        Transfer(&sTransfer, &g_pui8Data, 1, g_pui8Frame, sizeof(g_pui8Frame),
+                 &ui32Calls);
+        Submit(&sTransfer);
+        Run();
+        ui64Handler += g_sSim.ui64HandlerNs;
+        ui64Bus += g_sSim.ui64BusNs;
+    }
+
+    printf("\nper 1024-byte frame:\n");
+    printf("  interrupts:              %u\n", g_sSim.ui32Interrupts);
+    printf("  engine CPU time (host):  %.1f us (%.1f ns per interrupt)\n",
+           ui64Handler / 1e3 / ui32Frames,
+           (double)ui64Handler / ui32Frames / g_sSim.ui32Interrupts);
+    printf("  bus time at 400 kbit/s:  %.1f ms\n", ui64Bus / 1e6 / ui32Frames);
+    printf("  polling driver CPU time: %.1f ms (bus time plus 50 us per "
+           "byte)\n", (ui64Bus / 1e6 / ui32Frames) +
+           (sizeof(g_pui8Frame) * 0.05));
+}
+
+int
+main(void)
+{
+    uint32_t ui32Idx;
+
+    srand(1);
+    for(ui32Idx = 0; ui32Idx < sizeof(g_pui8Frame); ui32Idx++)
+    {
+        g_pui8Frame[ui32Idx] = rand();
+    }
+
+    TestSingle();
+    TestFrame(false);
+    TestFrame(true);
+    TestQueue();
+    TestFault("address NACK", FAULT_NACK, 0);
+    TestFault("data NACK", FAULT_NACK, 4);
+    TestFault("NACK on the last byte", FAULT_NACK, 10);
+    TestFault("arbitration lost on the address", FAULT_ARBLST, 0);
+    TestFault("arbitration lost on data", FAULT_ARBLST, 6);
+    TestOLED("display init sequence", I2C_OLED_Init, init_commands,
+             sizeof(init_commands));
+    TestOLED("display cursor move", MoveCursor, g_pui8MoveCursor,
+             sizeof(g_pui8MoveCursor));
+    TestOLED("display scroll start", StartScroll, g_pui8StartScroll,
+             sizeof(g_pui8StartScroll));
+    TestOLED("display diagonal scroll start", StartDiagonalScroll,
+             g_pui8StartDiagonalScroll, sizeof(g_pui8StartDiagonalScroll));
+
+    if(g_ui32Failures)
+    {
+        printf("%u tests failed\n", g_ui32Failures);
+        return(1);
+    }
+
+    Measure();
+
+    return(0);
+}
@@ -0,0 +1,541 @@
+//*****************************************************************************
+//
+// io_fs_test.c - Host test of the dynamic files and open file handles of the
+// web file system (io_fs.c).
+//
+// This is not part of the firmware.  Build and run it on the host with:
+//
+//     cc -O2 -I. -Itools/host tools/io_fs_test.c io_fs.c tools/host/io_host.c
+//         json.c display_mirror.c -o io_fs_test && ./io_fs_test
+//
+// io_fs.c is compiled unchanged against the stand-ins in tools/host.  The
+// test checks the registration of dynamic files: that io_fs_init() succeeds
+// and leaves room for more, and that duplicate names, names of files in the
+// image, oversized stream state and a full table are refused.
+//
+// It then runs many simulated requests at once, as the web server does with
+// one open file per connection.  Requests are opened, read a little at a
+// time and closed in a random order, while the state that the dynamic files
+// show keeps changing.  Every response must be the one that its file gave
+// when it was opened, whatever the other requests did meanwhile.  Opens
+// beyond the pool of handles must fail cleanly and succeed again once a
+// handle is closed.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "httpserver_raw/fs.h"
+#include "io_fs.h"
+#include "io_host.h"
+
+//*****************************************************************************
+//
+// The number of steps of the simulation and the largest response checked.
+//
+//*****************************************************************************
+#define NUM_STEPS               200000
+#define MAX_RESPONSE            32768
+
+//*****************************************************************************
+//
+// The dynamic files io_fs_init() registers.
+//
+//*****************************************************************************
+#define NUM_BUILT_IN            8
+
+//*****************************************************************************
+//
+// The kinds of request the simulation makes.
+//
+//*****************************************************************************
+#define REQ_STATIC              0
+#define REQ_SPEED               1
+#define REQ_ECHO                2
+#define REQ_STREAM              3
+#define REQ_STATUS              4
+#define NUM_REQ_KINDS           5
+
+//*****************************************************************************
+//
+// A simulated request: its open file, the response it must give and how
+// much of it has been read.
+//
+//*****************************************************************************
+typedef struct
+{
+    struct fs_file *psFile;
+    uint32_t ui32Kind;
+    char pcExpected[MAX_RESPONSE];
+    uint32_t ui32Len;
+    char pcRead[MAX_RESPONSE];
+    uint32_t ui32Read;
+}
+tRequest;
+
+static tRequest g_psRequests[IO_FS_MAX_OPEN_FILES];
+
+//*****************************************************************************
+//
+// The state of the streamed test file: a sequence number that changes all
+// the time, and the length of the file, which depends on it.
+//
+//*****************************************************************************
+static uint32_t g_ui32Sequence;
+
+#define StreamLength(ui32Seq)   (100 + ((ui32Seq) % 900))
+
+//*****************************************************************************
+//
+// The number of failed checks.
+//
+//*****************************************************************************
+static uint32_t g_ui32Failures;
+
+//*****************************************************************************
+//
+// Stand-in for the web server's Server-Sent Events broadcast.
+//
+//*****************************************************************************
+void
+httpd_sse_broadcast(const char *pcData, u16_t ui16Len)
+{
+}
+
+//*****************************************************************************
+//
+// Check the outcome of a test.
+//
+//*****************************************************************************
+static void
+Check(const char *pcTest, bool bPass)
+{
+    printf("%-56s %s\n", pcTest, bPass ? "ok" : "FAILED");
+    if(!bPass)
+    {
+        g_ui32Failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// A dynamic file that echoes its parameters.
+//
+//*****************************************************************************
+static int
+EchoHandler(const char *pcParams, char *pcBuf, int iBufLen)
+{
+    return(snprintf(pcBuf, iBufLen, "echo:%s", pcParams));
+}
+
+//*****************************************************************************
+//
+// The byte of the streamed test file at an offset, for a sequence number.
+//
+//*****************************************************************************
+static char
+StreamByte(uint32_t ui32Seq, uint32_t ui32Offset)
+{
+    return('a' + ((ui32Seq * 7 + ui32Offset * 13) % 26));
+}
+
+//*****************************************************************************
+//
+// A streamed file generated from the sequence number it was opened with.
+//
+//*****************************************************************************
+static void
+StreamSnapshot(void *pvState)
+{
+    *(uint32_t *)pvState = g_ui32Sequence;
+}
+
+static uint32_t
+StreamWrite(const void *pvState, char *pcBuf, uint32_t ui32Skip,
+            uint32_t ui32Size)
+{
+    uint32_t ui32Seq, ui32Idx;
+
+    ui32Seq = *(const uint32_t *)pvState;
+    for(ui32Idx = 0; pcBuf && (ui32Idx < ui32Size); ui32Idx++)
+    {
+        pcBuf[ui32Idx] = StreamByte(ui32Seq, ui32Skip + ui32Idx);
+    }
+
+    return(StreamLength(ui32Seq));
+}
+
+//*****************************************************************************
+//
+// Read a whole file into a buffer and close it.  Returns the length read, or
+// MAX_RESPONSE + 1 if it does not fit.
+//
+//*****************************************************************************
+static uint32_t
+ReadAll(struct fs_file *psFile, char *pcBuf)
+{
+    uint32_t ui32Len;
+    int iRead;
+
+    if(psFile->index == psFile->len)
+    {
+        ui32Len = psFile->len;
+        if(ui32Len <= MAX_RESPONSE)
+        {
+            memcpy(pcBuf, psFile->data, ui32Len);
+        }
+    }
+    else
+    {
+        ui32Len = 0;
+        while((ui32Len < MAX_RESPONSE) &&
+              ((iRead = fs_read(psFile, pcBuf + ui32Len,
+                                MAX_RESPONSE - ui32Len)) > 0))
+        {
+            ui32Len += iRead;
+        }
+        if(fs_bytes_left(psFile))
+        {
+            ui32Len = MAX_RESPONSE + 1;
+        }
+    }
+
+    fs_close(psFile);
+
+    return(ui32Len);
+}
+
+//*****************************************************************************
+//
+// Check the registration of dynamic files.
+//
+//*****************************************************************************
+static void
+TestRegister(void)
+{
+    char pcName[32];
+    uint32_t ui32Idx, ui32Room;
+
+    Check("io_fs_init() registers all its files", io_fs_init());
+
+    Check("a name already registered is refused",
+          !io_fs_register("/get_speed", EchoHandler));
+    Check("the name of a file in the image is refused",
+          !io_fs_register("/index.htm", EchoHandler));
+    Check("a stream with too much state is refused",
+          !io_fs_register_stream("/big.txt", IO_FS_STATE_SIZE + 1,
+                                 StreamSnapshot, StreamWrite));
+
+    Check("the test files are registered",
+          io_fs_register("/echo", EchoHandler) &&
+          io_fs_register_stream("/stream.txt", sizeof(uint32_t),
+                                StreamSnapshot, StreamWrite));
+
+    //
+    // Fill the rest of the table.
+    //
+    ui32Room = 0;
+    for(ui32Idx = 0; ui32Idx < IO_FS_MAX_HANDLERS; ui32Idx++)
+    {
+        snprintf(pcName, sizeof(pcName), "/extra%u", ui32Idx);
+        if(io_fs_register(strdup(pcName), EchoHandler))
+        {
+            ui32Room++;
+        }
+    }
+    printf("room for %u more dynamic files after the test files\n",
+           ui32Room);
+    Check("io_fs_init() leaves room for more dynamic files",
+          (NUM_BUILT_IN + 2 + ui32Room) == IO_FS_MAX_HANDLERS);
+    Check("a full table refuses more files",
+          !io_fs_register("/one_too_many", EchoHandler));
+}
+
+//*****************************************************************************
+//
+// Start a request of a random kind in a free slot, and work out the
+// response it must give.  Returns false if there was no handle for it.
+//
+//*****************************************************************************
+static bool
+RequestOpen(tRequest *psRequest)
+{
+    static const char * const ppcStatic[] =
+    {
+        "/index.htm", "/styles.css", "/utfpr.png", "/javascript.js"
+    };
+    struct fs_file *psCheck;
+    char pcName[64];
+    uint32_t ui32Kind;
+
+    ui32Kind = rand() % NUM_REQ_KINDS;
+    switch(ui32Kind)
+    {
+        case REQ_STATIC:
+        {
+            strcpy(pcName, ppcStatic[rand() % 4]);
+            break;
+        }
+
+        case REQ_SPEED:
+        {
+            strcpy(pcName, "/get_speed");
+            psRequest->ui32Len = sprintf(psRequest->pcExpected, "%d%%",
+                                         (int)g_ui32HostSpeed);
+            break;
+        }
+
+        case REQ_ECHO:
+        {
+            sprintf(pcName, "/echo?id=%d", rand());
+            psRequest->ui32Len = sprintf(psRequest->pcExpected, "echo:%s",
+                                         pcName + 6);
+            break;
+        }
+
+        case REQ_STREAM:
+        {
+            uint32_t ui32Idx;
+
+            strcpy(pcName, "/stream.txt");
+            psRequest->ui32Len = StreamLength(g_ui32Sequence);
+            for(ui32Idx = 0; ui32Idx < psRequest->ui32Len; ui32Idx++)
+            {
+                psRequest->pcExpected[ui32Idx] =
+                    StreamByte(g_ui32Sequence, ui32Idx);
+            }
+            break;
+        }
+
+        default:
+        {
+            strcpy(pcName, "/status.json");
+            break;
+        }
+    }
+
+    psRequest->psFile = fs_open(pcName);
+    if(!psRequest->psFile)
+    {
+        return(false);
+    }
+
+    //
+    // Files in the image and the status are checked against a second open
+    // made at the same time, which must have its own handle.
+    //
+    if((ui32Kind == REQ_STATIC) || (ui32Kind == REQ_STATUS))
+    {
+        psCheck = fs_open(pcName);
+        if(!psCheck)
+        {
+            fs_close(psRequest->psFile);
+            psRequest->psFile = NULL;
+            return(false);
+        }
+        psRequest->ui32Len = ReadAll(psCheck, psRequest->pcExpected);
+    }
+
+    psRequest->ui32Kind = ui32Kind;
+    psRequest->ui32Read = 0;
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Read a random amount of a request's response, the way the web server does:
+// straight from the data of a file held in memory, or through fs_read().
+// Returns true once the whole response has been read.
+//
+//*****************************************************************************
+static bool
+RequestRead(tRequest *psRequest)
+{
+    struct fs_file *psFile;
+    uint32_t ui32Count;
+    int iRead;
+
+    psFile = psRequest->psFile;
+    ui32Count = 1 + (rand() % 300);
+
+    if(psFile->index == psFile->len)
+    {
+        if(ui32Count > (psFile->len - psRequest->ui32Read))
+        {
+            ui32Count = psFile->len - psRequest->ui32Read;
+        }
+        if((psRequest->ui32Read + ui32Count) <= MAX_RESPONSE)
+        {
+            memcpy(psRequest->pcRead + psRequest->ui32Read,
+                   psFile->data + psRequest->ui32Read, ui32Count);
+        }
+        psRequest->ui32Read += ui32Count;
+
+        return(psRequest->ui32Read == (uint32_t)psFile->len);
+    }
+
+    if(ui32Count > (MAX_RESPONSE - psRequest->ui32Read))
+    {
+        ui32Count = MAX_RESPONSE - psRequest->ui32Read;
+    }
+    iRead = fs_read(psFile, psRequest->pcRead + psRequest->ui32Read,
+                    ui32Count);
+    if(iRead > 0)
+    {
+        psRequest->ui32Read += iRead;
+    }
+
+    return((iRead < 0) || (fs_bytes_left(psFile) == 0) ||
+           (psRequest->ui32Read == MAX_RESPONSE));
+}
+
+//*****************************************************************************
+//
+// Run many requests at once and check every response.
+//
+//*****************************************************************************
+static void
+TestConcurrent(void)
+{
+    tRequest *psRequest;
+    uint32_t ui32Step, ui32Slot, ui32Open, ui32MaxOpen, ui32Done;
+    uint32_t ui32Refused, ui32Corrupt, ui32Kinds[NUM_REQ_KINDS];
+    bool bRefusedWhenFull, bFreedAfterFull;
+
+    ui32Open = 0;
+    ui32MaxOpen = 0;
+    ui32Done = 0;
+    ui32Refused = 0;
+    ui32Corrupt = 0;
+    bRefusedWhenFull = true;
+    bFreedAfterFull = true;
+    memset(ui32Kinds, 0, sizeof(ui32Kinds));
+
+    for(ui32Step = 0; ui32Step < NUM_STEPS; ui32Step++)
+    {
+        //
+        // Keep the state the dynamic files show changing.
+        //
+        g_ui32Sequence++;
+        g_ui32HostSpeed = rand() % 101;
+        g_i32HostFrequency = rand() % 5000;
+        g_bHostLEDOn = rand() & 1;
+
+        psRequest = &g_psRequests[rand() % IO_FS_MAX_OPEN_FILES];
+        if(!psRequest->psFile)
+        {
+            if(RequestOpen(psRequest))
+            {
+                ui32Open++;
+                if(ui32Open > ui32MaxOpen)
+                {
+                    ui32MaxOpen = ui32Open;
+                }
+            }
+            else
+            {
+                ui32Refused++;
+                if(ui32Open < (IO_FS_MAX_OPEN_FILES - 1))
+                {
+                    bRefusedWhenFull = false;
+                }
+            }
+            continue;
+        }
+
+        if(!RequestRead(psRequest))
+        {
+            continue;
+        }
+
+        if((psRequest->ui32Read != psRequest->ui32Len) ||
+           memcmp(psRequest->pcRead, psRequest->pcExpected,
+                  psRequest->ui32Len))
+        {
+            if(ui32Corrupt++ < 5)
+            {
+                printf("  response of kind %u differs: %u bytes, %u "
+                       "expected\n", psRequest->ui32Kind, psRequest->ui32Read,
+                       psRequest->ui32Len);
+            }
+        }
+        ui32Kinds[psRequest->ui32Kind]++;
+        ui32Done++;
+
+        fs_close(psRequest->psFile);
+        psRequest->psFile = NULL;
+        ui32Open--;
+    }
+
+    printf("%u responses (%u static, %u speed, %u echo, %u stream, "
+           "%u status), %u at once at most, %u opens refused\n", ui32Done,
+           ui32Kinds[REQ_STATIC], ui32Kinds[REQ_SPEED], ui32Kinds[REQ_ECHO],
+           ui32Kinds[REQ_STREAM], ui32Kinds[REQ_STATUS], ui32MaxOpen,
+           ui32Refused);
+    Check("every response is the one its file gave when opened",
+          (ui32Corrupt == 0) && (ui32Done > (NUM_STEPS / 20)));
+    Check("every open file has a handle of its own",
+          ui32MaxOpen == IO_FS_MAX_OPEN_FILES);
+    Check("opens fail only once the handles run out", bRefusedWhenFull);
+
+    //
+    // Close everything, then check that every handle can be taken again.
+    //
+    for(ui32Slot = 0; ui32Slot < IO_FS_MAX_OPEN_FILES; ui32Slot++)
+    {
+        if(g_psRequests[ui32Slot].psFile)
+        {
+            fs_close(g_psRequests[ui32Slot].psFile);
+            g_psRequests[ui32Slot].psFile = NULL;
+        }
+    }
+    for(ui32Slot = 0; ui32Slot < IO_FS_MAX_OPEN_FILES; ui32Slot++)
+    {
+        g_psRequests[ui32Slot].psFile = fs_open("/get_speed");
+        if(!g_psRequests[ui32Slot].psFile)
+        {
+            bFreedAfterFull = false;
+        }
+    }
+    Check("the pool is full after all the handles are taken",
+          fs_open("/get_speed") == NULL);
+    fs_close(g_psRequests[0].psFile);
+    g_psRequests[0].psFile = fs_open("/index.htm");
+    Check("a closed handle can be taken again",
+          bFreedAfterFull && g_psRequests[0].psFile);
+    for(ui32Slot = 0; ui32Slot < IO_FS_MAX_OPEN_FILES; ui32Slot++)
+    {
+        if(g_psRequests[ui32Slot].psFile)
+        {
+            fs_close(g_psRequests[ui32Slot].psFile);
+            g_psRequests[ui32Slot].psFile = NULL;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Run the tests.
+//
+//*****************************************************************************
+int
+main(void)
+{
+    srand(1);
+
+    TestRegister();
+    TestConcurrent();
+
+    if(g_ui32Failures)
+    {
+        printf("%u checks failed\n", g_ui32Failures);
+        return(1);
+    }
+
+    printf("all checks passed\n");
+
+    return(0);
+}
@@ -0,0 +1,200 @@
+//*****************************************************************************
+//
+// json_bench.c - Host benchmark of the streaming JSON writer (json.c).
+//
+// This is not part of the firmware.  Build and run it on the host with:
+//
+//     cc -O2 -I. tools/json_bench.c json.c -o json_bench && ./json_bench
+//
+// It generates a document shaped like /status.json the way the web server
+// does: once to find its length, then once for every block that is sent.  It
+// checks that the blocks put together give the whole document, then reports
+// how many documents and bytes per second are produced for several block
+// sizes.  The figures are for the host; scale them by the clock and the
+// instructions per cycle of the target to estimate the cost on the board.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "json.h"
+
+//*****************************************************************************
+//
+// The number of tasks in the sample document and the time each measurement
+// runs for, in seconds.
+//
+//*****************************************************************************
+#define NUM_TASKS               6
+#define RUN_TIME                1.0
+
+//*****************************************************************************
+//
+// The tasks in the sample document.
+//
+//*****************************************************************************
+static const char * const g_ppcNames[NUM_TASKS] =
+{
+    "Ethernet ", "Serial Ta", "PWM Task", "OLED Task", "IDLE", "Tmr Svc"
+};
+
+//*****************************************************************************
+//
+// Keeps the compiler from optimizing the generated output away.
+//
+//*****************************************************************************
+static volatile uint32_t g_ui32Sink;
+
+//*****************************************************************************
+//
+// Generate a window of the sample document and return its length.
+//
+//*****************************************************************************
+static uint32_t
+SampleWrite(uint32_t ui32Seed, char *pcBuf, uint32_t ui32Skip,
+            uint32_t ui32Size)
+{
+    tJSONWriter sWriter;
+    uint32_t ui32Idx;
+
+    JSONInit(&sWriter, pcBuf, ui32Skip, ui32Size);
+    JSONObjectStart(&sWriter, NULL);
+    JSONUInt(&sWriter, "speed", ui32Seed % 101);
+    JSONInt(&sWriter, "freq", (int32_t)(ui32Seed % 500) - 10);
+    JSONBool(&sWriter, "auto", ui32Seed & 1);
+    JSONBool(&sWriter, "led", ui32Seed & 2);
+    JSONObjectStart(&sWriter, "pwm");
+    JSONUInt(&sWriter, "pulse", ui32Seed % 400);
+    JSONUInt(&sWriter, "period", 400);
+    JSONObjectEnd(&sWriter);
+    JSONUInt(&sWriter, "adc", ui32Seed & 0xfff);
+    JSONString(&sWriter, "ip", "192.168.100.200");
+    JSONUInt(&sWriter, "uptime", ui32Seed * 10);
+    JSONUInt(&sWriter, "heap", 23456);
+    JSONArrayStart(&sWriter, "tasks");
+    for(ui32Idx = 0; ui32Idx < NUM_TASKS; ui32Idx++)
+    {
+        JSONObjectStart(&sWriter, NULL);
+        JSONString(&sWriter, "name", g_ppcNames[ui32Idx]);
+        JSONString(&sWriter, "state", "blocked");
+        JSONUInt(&sWriter, "priority", ui32Idx);
+        JSONUInt(&sWriter, "stack", 100 + ui32Idx);
+        JSONObjectEnd(&sWriter);
+    }
+    JSONArrayEnd(&sWriter);
+    JSONObjectEnd(&sWriter);
+
+    return(JSONLength(&sWriter));
+}
+
+//*****************************************************************************
+//
+// Send the sample document in blocks of ui32Block bytes into pcBuf, the way
+// the web server does, and return its length.
+//
+//*****************************************************************************
+static uint32_t
+SampleSend(uint32_t ui32Seed, char *pcBuf, uint32_t ui32Block)
+{
+    uint32_t ui32Len, ui32Pos, ui32Count;
+
+    ui32Len = SampleWrite(ui32Seed, NULL, 0, 0);
+
+    for(ui32Pos = 0; ui32Pos < ui32Len; ui32Pos += ui32Count)
+    {
+        ui32Count = ui32Len - ui32Pos;
+        if(ui32Count > ui32Block)
+        {
+            ui32Count = ui32Block;
+        }
+        SampleWrite(ui32Seed, pcBuf + ui32Pos, ui32Pos, ui32Count);
+    }
+
+    return(ui32Len);
+}
+
+//*****************************************************************************
+//
+// Return the time in seconds.
+//
+//*****************************************************************************
+static double
+Now(void)
+{
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+
+    return(sTime.tv_sec + (sTime.tv_nsec / 1e9));
+}
+
+int
+main(void)
+{
+    static const uint32_t pui32Blocks[] = { 2920, 1460, 536, 64 };
+    char pcWhole[1024], pcBlocks[1024];
+    uint32_t ui32Len, ui32Idx, ui32Seed, ui32Docs;
+    uint64_t ui64Bytes;
+    double dStart, dTime;
+
+    //
+    // Check that the blocks make up the document for every block size.
+    //
+    for(ui32Seed = 0; ui32Seed < 100; ui32Seed++)
+    {
+        ui32Len = SampleWrite(ui32Seed, pcWhole, 0, sizeof(pcWhole));
+        if(ui32Len > sizeof(pcWhole))
+        {
+            fprintf(stderr, "document too long: %u bytes\n", ui32Len);
+            return(1);
+        }
+
+        for(ui32Idx = 1; ui32Idx <= ui32Len; ui32Idx++)
+        {
+            memset(pcBlocks, 0, sizeof(pcBlocks));
+            if((SampleSend(ui32Seed, pcBlocks, ui32Idx) != ui32Len) ||
+               memcmp(pcWhole, pcBlocks, ui32Len))
+            {
+                fprintf(stderr, "blocks of %u bytes differ from document\n",
+                        ui32Idx);
+                return(1);
+            }
+        }
+    }
+
+    printf("%.*s\n\n", (int)ui32Len, pcWhole);
+    printf("document: %u bytes\n", ui32Len);
+
+    //
+    // Measure the throughput for each block size.
+    //
+    for(ui32Idx = 0; ui32Idx < (sizeof(pui32Blocks) / sizeof(pui32Blocks[0]));
+        ui32Idx++)
+    {
+        ui32Docs = 0;
+        ui64Bytes = 0;
+        dStart = Now();
+        do
+        {
+            for(ui32Seed = 0; ui32Seed < 1000; ui32Seed++)
+            {
+                ui64Bytes += SampleSend(ui32Docs + ui32Seed, pcBlocks,
+                                        pui32Blocks[ui32Idx]);
+            }
+            ui32Docs += 1000;
+            dTime = Now() - dStart;
+        }
+        while(dTime < RUN_TIME);
+
+        g_ui32Sink += pcBlocks[0];
+
+        printf("blocks of %4u bytes: %9.0f documents/s %8.1f MB/s "
+               "%7.3f us/document\n", pui32Blocks[ui32Idx], ui32Docs / dTime,
+               ui64Bytes / dTime / 1e6, dTime * 1e6 / ui32Docs);
+    }
+
+    return(0);
+}
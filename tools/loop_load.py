@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+#
+# loop_load.py - Measure the timing of the control loop on the board, idle
+# and under network load.
+#
+# The board keeps histograms of how far each pass of the control loop in
+# pwmTask starts from a period after the one before (the jitter) and of how
+# long each pass takes, since boot, and serves them as /loop.json.  This
+# reads them before and after a quiet spell and a spell of load, and prints
+# what was added during each.
+#
+# The load is HTTP requests on several keep-alive connections at once,
+# optionally with a flood of UDP datagrams, which the Ethernet interrupt and
+# the lwIP thread have to handle and drop.
+#
+# Usage:
+#
+#     python3 tools/loop_load.py <board address> [-t 30] [-c 8] [--udp 5000]
+#
+
+import argparse
+import json
+import socket
+import sys
+import threading
+import time
+
+
+def get(sock, host, path):
+    sock.sendall(('GET %s HTTP/1.1\r\nHost: %s\r\n\r\n' %
+                  (path, host)).encode())
+    response = b''
+    while b'\r\n\r\n' not in response:
+        chunk = sock.recv(4096)
+        if not chunk:
+            raise EOFError('connection closed by the board')
+        response += chunk
+    header, body = response.split(b'\r\n\r\n', 1)
+    length = 0
+    for line in header.split(b'\r\n')[1:]:
+        name, _, value = line.partition(b':')
+        if name.strip().lower() == b'content-length':
+            length = int(value)
+    while len(body) < length:
+        chunk = sock.recv(4096)
+        if not chunk:
+            raise EOFError('connection closed by the board')
+        body += chunk
+    return body
+
+
+def loop_json(host, port):
+    sock = socket.create_connection((host, port), timeout=5)
+    try:
+        return json.loads(get(sock, host, '/loop.json'))
+    finally:
+        sock.close()
+
+
+def http_load(host, port, path, stop, counts, index):
+    while not stop.is_set():
+        try:
+            sock = socket.create_connection((host, port), timeout=5)
+            while not stop.is_set():
+                get(sock, host, path)
+                counts[index] += 1
+            sock.close()
+        except (OSError, EOFError):
+            time.sleep(0.1)
+
+
+def udp_load(host, rate, stop):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    payload = bytes(512)
+    interval = 1.0 / rate
+    next_time = time.perf_counter()
+    while not stop.is_set():
+        sock.sendto(payload, (host, 9))
+        next_time += interval
+        delay = next_time - time.perf_counter()
+        if delay > 0:
+            time.sleep(delay)
+
+
+def added(before, after, key):
+    # The passes added between two reads of /loop.json, bin by bin, and
+    # their average time.  The longest time is only known since boot.
+    old, new = before[key], after[key]
+    counts = [b - a for a, b in zip(old['counts'], new['counts'])]
+    passes = sum(counts)
+    total = new['avg_us'] * new['count'] - old['avg_us'] * old['count']
+    return counts, passes, (total / passes if passes else 0), new['max_us']
+
+
+def report(title, before, after, bins):
+    sys.stdout.write('\n%s\n' % title)
+    for key in ('jitter', 'exec'):
+        counts, passes, avg, peak = added(before, after, key)
+        sys.stdout.write('  %-6s %d passes, avg %.0f us, max since boot %d '
+                         'us\n' % (key, passes, avg, peak))
+        for low, count in zip(bins, counts):
+            if count:
+                sys.stdout.write('    %6d us+ %8d  %6.2f%%\n' %
+                                 (low, count, 100.0 * count / passes))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='control loop timing')
+    parser.add_argument('host', help='address of the board')
+    parser.add_argument('-p', dest='port', type=int, default=80,
+                        help='web server port')
+    parser.add_argument('-t', dest='seconds', type=float, default=30,
+                        help='length of each spell, in seconds')
+    parser.add_argument('-c', dest='connections', type=int, default=8,
+                        help='number of HTTP connections during the load')
+    parser.add_argument('--path', default='/index.htm',
+                        help='file requested during the load')
+    parser.add_argument('--udp', type=int, default=0,
+                        help='UDP datagrams a second during the load')
+    args = parser.parse_args()
+
+    first = loop_json(args.host, args.port)
+    bins = first['bin_us']
+    sys.stdout.write('control loop period %d us\n' % first['period_us'])
+
+    time.sleep(args.seconds)
+    idle = loop_json(args.host, args.port)
+    report('idle, %.0f s' % args.seconds, first, idle, bins)
+
+    stop = threading.Event()
+    counts = [0] * args.connections
+    threads = [threading.Thread(target=http_load,
+                                args=(args.host, args.port, args.path, stop,
+                                      counts, i))
+               for i in range(args.connections)]
+    if args.udp:
+        threads.append(threading.Thread(target=udp_load,
+                                        args=(args.host, args.udp, stop)))
+    start = loop_json(args.host, args.port)
+    for thread in threads:
+        thread.start()
+    time.sleep(args.seconds)
+    loaded = loop_json(args.host, args.port)
+    stop.set()
+    for thread in threads:
+        thread.join()
+
+    report('%d HTTP connections (%.0f requests/s)%s, %.0f s' %
+           (args.connections, sum(counts) / args.seconds,
+            ', %d UDP datagrams/s' % args.udp if args.udp else '',
+            args.seconds), start, loaded, bins)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+#
+# makefsdata.py - Build the web file system image (io_fsdata.h) from fs/.
+#
+# Produces the same image layout as the TivaWare makefsfile utility run as
+#
+#     makefsfile -i fs -o io_fsdata.h -r -h -q
+#
+# and additionally stores a gzip-compressed variant ("<name>.gz") next to
+# each compressible file.  The web server sends the variant with a
+# "Content-Encoding: gzip" header to clients that accept it.
+#
+# Usage (from the project directory):
+#
+#     python3 tools/makefsdata.py -i fs -o io_fsdata.h
+#
+# Pass --stats to print the flash footprint of the image and the number of
+# bytes sent per full page load with and without compression.
+#
+
+import argparse
+import gzip
+import os
+import sys
+
+#
+# Files with these extensions are stored as-is, without CRLF conversion.
+#
+BINARY_EXTENSIONS = ('.png', '.ico', '.gif', '.jpg', '.bmp', '.gz')
+
+#
+# Files with these extensions get a gzip variant.  SSI files are excluded
+# since the server has to scan them for tags.
+#
+GZIP_EXTENSIONS = ('.htm', '.html', '.js', '.css')
+
+#
+# Files that are only ever sent by the error handling path of the server,
+# which does not negotiate the content encoding.
+#
+GZIP_EXCLUDE = ('404.htm', '404.html')
+
+#
+# The files requested by a browser for a full load of the dashboard.
+#
+PAGE_LOAD = ('index.htm', 'styles.css', 'javascript.js', 'favicon.ico',
+             'utfpr.png', 'about.htm', 'io_http.htm')
+
+
+def ident(name):
+    return name.replace('.', '_').replace('-', '_')
+
+
+def load(path, name):
+    with open(os.path.join(path, name), 'rb') as f:
+        data = f.read()
+    if not name.lower().endswith(BINARY_EXTENSIONS):
+        data = data.replace(b'\r\n', b'\n').replace(b'\n', b'\r\n')
+    return data
+
+
+def compress(data):
+    # mtime=0 keeps the output reproducible from build to build.
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def build(path):
+    files = []
+    for name in sorted(os.listdir(path)):
+        if not os.path.isfile(os.path.join(path, name)):
+            continue
+        data = load(path, name)
+        files.append((name, data))
+        if (name.lower().endswith(GZIP_EXTENSIONS) and
+                name not in GZIP_EXCLUDE):
+            packed = compress(data)
+            if len(packed) < len(data):
+                files.append((name + '.gz', packed))
+    return files
+
+
+def render(files):
+    out = []
+    out.append('//' + '*' * 75 + '\n//\n// File System Image.\n//\n'
+               '// This file was automatically generated using the '
+               'makefsdata.py utility.\n//\n//' + '*' * 75 + '\n')
+    for name, data in files:
+        out.append('\nstatic const uint8_t data_%s[] =\n{\n    /* /%s */\n' %
+                   (ident(name), name))
+        for blob in (('/' + name).encode() + b'\0', data):
+            for i in range(0, len(blob), 8):
+                out.append('    ' + ', '.join('0x%02x' % b
+                                             for b in blob[i:i + 8]) + ',\n')
+        out.append('};\n')
+    prev = 'NULL'
+    for name, data in reversed(files):
+        skip = len(name) + 2
+        out.append('\nconst struct fsdata_file file_%s[] =\n{\n\t{\n\t\t%s,\n'
+                   '\t\tdata_%s,\n\t\tdata_%s + %d,\n'
+                   '\t\tsizeof(data_%s) - %d\n\t}\n};\n' %
+                   (ident(name), prev, ident(name), ident(name), skip,
+                    ident(name), skip))
+        prev = 'file_' + ident(name)
+    out.append('\n#define FS_ROOT %s\n\n#define FS_NUMFILES %d\n\n' %
+               (prev, len(files)))
+    return ''.join(out)
+
+
+def stats(files):
+    sizes = dict((name, len(data)) for name, data in files)
+    plain = sum(v for k, v in sizes.items() if not k.endswith('.gz'))
+    packed = sum(v for k, v in sizes.items() if k.endswith('.gz'))
+    sys.stderr.write('Flash: %d bytes of file data (%d original, %d gzip)\n' %
+                     (plain + packed, plain, packed))
+    wire = 0
+    wire_gz = 0
+    for name in PAGE_LOAD:
+        if name not in sizes:
+            continue
+        wire += sizes[name]
+        wire_gz += sizes.get(name + '.gz', sizes[name])
+    sys.stderr.write('Page load: %d bytes uncompressed, %d bytes with gzip\n'
+                     % (wire, wire_gz))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('-i', dest='input', default='fs',
+                        help='directory holding the web files')
+    parser.add_argument('-o', dest='output', default='io_fsdata.h',
+                        help='file system image to write')
+    parser.add_argument('--stats', action='store_true',
+                        help='print flash and page load sizes')
+    args = parser.parse_args()
+
+    files = build(args.input)
+    with open(args.output, 'w', newline='\n') as f:
+        f.write(render(files))
+    if args.stats:
+        stats(files)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,299 @@
+//*****************************************************************************
+//
+// oled_fb_test.c - Host test of the OLED framebuffer (oled_fb.c).
+//
+// This is not part of the firmware.  Build and run it on the host with (on
+// one line):
+//
+//     cc -O2 -I. tools/oled_fb_test.c oled_fb.c oled_font.c oled_image.c
+//         fonts/font_default.c images/utfpr_bar.c -o oled_fb_test &&
+//         ./oled_fb_test
+//
+// The transfers of each flush go to a model of the SSD1306 memory and its
+// column and page address window instead of the I2C engine.  After every
+// flush the model must hold the same pixels as the framebuffer.
+//
+// The test renders the screens the application shows, and for each update
+// prints the bytes put on the bus by the flush, by a full redraw of the
+// framebuffer, and by the previous driver, which wrote the text straight to
+// the display (six command transactions to move the cursor, then one data
+// transaction per character) and whole images and clears as 1024 bytes.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "i2c.h"
+#include "oled_fb.h"
+
+//*****************************************************************************
+//
+// The bytes the previous driver sent to move the cursor, to draw a character
+// and to draw a whole screen, and the bytes of a full redraw.
+//
+//*****************************************************************************
+#define OLD_CURSOR              (6 * 3)
+#define OLD_CHAR                (2 + 8)
+#define OLD_SCREEN              (OLD_CURSOR + 2 + SSD1306_BUFFER_SIZE)
+#define FULL_REDRAW             (8 + 2 + SSD1306_BUFFER_SIZE)
+
+//*****************************************************************************
+//
+// The model of the display: its memory, its address window and the position
+// of the next byte written.
+//
+//*****************************************************************************
+static uint8_t g_pui8Display[OLED_FB_PAGES][OLED_FB_WIDTH];
+static uint32_t g_ui32ColStart, g_ui32ColEnd, g_ui32PageStart, g_ui32PageEnd;
+static uint32_t g_ui32Col, g_ui32Page;
+
+//*****************************************************************************
+//
+// The bytes and transactions seen on the bus since the last update.
+//
+//*****************************************************************************
+static uint32_t g_ui32Bytes;
+static uint32_t g_ui32Transactions;
+static uint32_t g_ui32Failures;
+
+//*****************************************************************************
+//
+// Execute the commands of a command transaction.  Only the addressing
+// commands the framebuffer sends are expected.
+//
+//*****************************************************************************
+static void
+Commands(const uint8_t *pui8Data, uint32_t ui32Size)
+{
+    while(ui32Size)
+    {
+        if((pui8Data[0] == SSD1306_COLUMNADDR) && (ui32Size >= 3))
+        {
+            g_ui32ColStart = pui8Data[1];
+            g_ui32ColEnd = pui8Data[2];
+            g_ui32Col = g_ui32ColStart;
+            pui8Data += 3;
+            ui32Size -= 3;
+        }
+        else if((pui8Data[0] == SSD1306_PAGEADDR) && (ui32Size >= 3))
+        {
+            g_ui32PageStart = pui8Data[1];
+            g_ui32PageEnd = pui8Data[2];
+            g_ui32Page = g_ui32PageStart;
+            pui8Data += 3;
+            ui32Size -= 3;
+        }
+        else
+        {
+            printf("unexpected command 0x%02x\n", pui8Data[0]);
+            g_ui32Failures++;
+            return;
+        }
+
+        if((g_ui32ColStart > g_ui32ColEnd) ||
+           (g_ui32ColEnd >= OLED_FB_WIDTH) ||
+           (g_ui32PageStart > g_ui32PageEnd) ||
+           (g_ui32PageEnd >= OLED_FB_PAGES))
+        {
+            printf("bad window\n");
+            g_ui32Failures++;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Write display data at the current position, which moves through the
+// window in horizontal addressing mode.
+//
+//*****************************************************************************
+static void
+Data(const uint8_t *pui8Data, uint32_t ui32Size)
+{
+    while(ui32Size--)
+    {
+        g_pui8Display[g_ui32Page][g_ui32Col] = *pui8Data++;
+
+        if(g_ui32Col++ == g_ui32ColEnd)
+        {
+            g_ui32Col = g_ui32ColStart;
+            if(g_ui32Page++ == g_ui32PageEnd)
+            {
+                g_ui32Page = g_ui32PageStart;
+            }
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Take the place of the I2C driver: feed the transfers to the model.
+//
+//*****************************************************************************
+void
+I2C_OLED_Transfer_List(tI2CTransfer *psTransfers, uint32_t ui32Count)
+{
+    tI2CTransfer *psTransfer;
+
+    for(psTransfer = psTransfers; psTransfer < (psTransfers + ui32Count);
+        psTransfer++)
+    {
+        g_ui32Bytes += 1 + psTransfer->ui32HeaderSize + psTransfer->ui32Size;
+        g_ui32Transactions++;
+
+        if((psTransfer->ui32HeaderSize != 1) ||
+           ((psTransfer->pui8Header[0] != SSD1306_COMMAND) &&
+            (psTransfer->pui8Header[0] != SSD1306_DATA)))
+        {
+            printf("bad control byte\n");
+            g_ui32Failures++;
+        }
+        else if(psTransfer->pui8Header[0] == SSD1306_COMMAND)
+        {
+            Commands(psTransfer->pui8Data, psTransfer->ui32Size);
+        }
+        else
+        {
+            Data(psTransfer->pui8Data, psTransfer->ui32Size);
+        }
+
+        psTransfer->ui32Status = I2C_XFER_DONE;
+    }
+}
+
+//*****************************************************************************
+//
+// Flush the framebuffer, check the display and report the update.  ui32Old
+// is what the previous driver sent for it, or 0 if it could not draw it.
+//
+//*****************************************************************************
+static uint32_t g_ui32TotalOld, g_ui32TotalFull, g_ui32TotalFlush;
+
+static void
+Update(const char *pcName, uint32_t ui32Old)
+{
+    uint32_t ui32Flush;
+    bool bMatch;
+
+    g_ui32Bytes = 0;
+    g_ui32Transactions = 0;
+    ui32Flush = OLED_FB_Flush();
+
+    bMatch = !memcmp(g_pui8Display, OLED_FB_Buffer(), sizeof(g_pui8Display));
+    if(!bMatch || (ui32Flush != g_ui32Bytes))
+    {
+        g_ui32Failures++;
+    }
+
+    if(!ui32Old)
+    {
+        ui32Old = FULL_REDRAW;
+    }
+    g_ui32TotalOld += ui32Old;
+    g_ui32TotalFull += FULL_REDRAW;
+    g_ui32TotalFlush += g_ui32Bytes;
+
+    printf("%-28s %6u %6u %6u %4u  %s\n", pcName, ui32Old, FULL_REDRAW,
+           g_ui32Bytes, g_ui32Transactions, bMatch ? "ok" : "MISMATCH");
+}
+
+//*****************************************************************************
+//
+// The bytes the previous driver sent to print a string at a position.
+//
+//*****************************************************************************
+static uint32_t
+OldText(const char *pcString)
+{
+    return(OLD_CURSOR + (strlen(pcString) * OLD_CHAR));
+}
+
+int
+main(void)
+{
+    char pcBuf[17];
+    uint32_t ui32Idx, ui32Old;
+
+    //
+    // Start with a display full of noise, as at power up.
+    //
+    for(ui32Idx = 0; ui32Idx < sizeof(g_pui8Display); ui32Idx++)
+    {
+        (&g_pui8Display[0][0])[ui32Idx] = ui32Idx * 37;
+    }
+
+    printf("%-28s %6s %6s %6s %4s\n", "update", "old", "full", "flush",
+           "xfer");
+
+    //
+    // The boot sequence.
+    //
+    OLED_FB_Init();
+    OLED_FB_Blit(0, 0, BMP_UTFPR, OLED_FB_WIDTH, OLED_FB_HEIGHT);
+    Update("splash screen", OLD_SCREEN);
+    OLED_FB_Clear();
+    Update("clear", OLD_SCREEN);
+
+    //
+    // The network status screens.
+    //
+    OLED_FB_Text(0, 0, "Inic. Ethernet  ");
+    Update("Inic. Ethernet", OldText("Inic. Ethernet  "));
+    OLED_FB_Text(0, 0, "Aguard. Conexao ");
+    Update("Aguard. Conexao", OldText("Aguard. Conexao "));
+    OLED_FB_Text(0, 0, "Aguard. IP      ");
+    Update("Aguard. IP", OldText("Aguard. IP      "));
+    OLED_FB_Text(0, 0, "Endereco IP:    ");
+    OLED_FB_Fill_Rect(0, 8, OLED_FB_WIDTH, OLED_FB_CHAR_HEIGHT, BLACK);
+    OLED_FB_Text(0, 8, "192.168.0.15");
+    Update("Endereco IP + address", OldText("Endereco IP:    ") +
+           OldText("192.168.0.15"));
+
+    //
+    // A flow readout refreshed every second, and the same value again.
+    //
+    for(ui32Idx = 0; ui32Idx < 6; ui32Idx++)
+    {
+        snprintf(pcBuf, sizeof(pcBuf), "Vazao: %3u ml/s",
+                 (unsigned)(ui32Idx < 5 ? (ui32Idx * 7) + 95 : 123));
+        OLED_FB_Text(0, 32, pcBuf);
+        Update(pcBuf, OldText(pcBuf));
+    }
+
+    //
+    // A progress bar, which the previous driver could only draw as an image.
+    //
+    for(ui32Idx = 0; ui32Idx <= 100; ui32Idx += 20)
+    {
+        OLED_FB_Bar(0, 48, OLED_FB_WIDTH, 12, ui32Idx, 100);
+        snprintf(pcBuf, sizeof(pcBuf), "bar %u%%", (unsigned)ui32Idx);
+        Update(pcBuf, 0);
+    }
+
+    //
+    // Lines and a blit that is not aligned to a page.
+    //
+    OLED_FB_Line(0, 63, 127, 40, WHITE);
+    Update("diagonal line", 0);
+    OLED_FB_Blit(100, 13, font_default + ('A' * 8), 8, 8);
+    Update("unaligned character", OLD_CURSOR + OLD_CHAR);
+    OLED_FB_Fill_Rect(-4, -4, 140, 80, INVERSE);
+    Update("inverted screen", 0);
+
+    printf("%-28s %6u %6u %6u\n", "total", g_ui32TotalOld, g_ui32TotalFull,
+           g_ui32TotalFlush);
+
+    ui32Old = g_ui32TotalOld;
+    printf("\nflushes send %u%% of the bytes of the previous driver and %u%% "
+           "of full redraws\n", (unsigned)((g_ui32TotalFlush * 100) / ui32Old),
+           (unsigned)((g_ui32TotalFlush * 100) / g_ui32TotalFull));
+
+    if(g_ui32Failures)
+    {
+        printf("%u failures\n", g_ui32Failures);
+        return(1);
+    }
+
+    return(0);
+}
@@ -0,0 +1,383 @@
+//*****************************************************************************
+//
+// oled_font_test.c - Host test of the fonts (oled_font.c and the text drawing
+// of oled_fb.c).
+//
+// This is not part of the firmware.  Build and run it on the host with (on
+// one line):
+//
+//     cc -O2 -I. tools/oled_font_test.c oled_fb.c oled_font.c oled_image.c
+//         fonts/font_default.c fonts/font_prop.c -o oled_font_test &&
+//         ./oled_font_test
+//
+// Text is drawn into the framebuffer and compared with golden bitmaps, in
+// which '#' is a lit pixel and '.' a dark one, at aligned and unaligned
+// positions and at both scales.  The fixed font must still draw exactly what
+// OLED_FB_Text() drew before fonts, every glyph scaled twice must be its
+// pixels doubled, the string widths must match what is drawn, and the glyph
+// cache must keep giving the right glyphs as entries are replaced.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "i2c.h"
+#include "oled_fb.h"
+
+static uint32_t g_ui32Failures;
+
+//*****************************************************************************
+//
+// Take the place of the I2C driver.  Nothing is flushed by these tests.
+//
+//*****************************************************************************
+void
+I2C_OLED_Transfer_List(tI2CTransfer *psTransfers, uint32_t ui32Count)
+{
+}
+
+//*****************************************************************************
+//
+// Check the outcome of a test.
+//
+//*****************************************************************************
+static void
+Check(const char *pcTest, bool bPass)
+{
+    printf("%-44s %s\n", pcTest, bPass ? "ok" : "FAILED");
+    if(!bPass)
+    {
+        g_ui32Failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// Read a pixel of the framebuffer.
+//
+//*****************************************************************************
+static bool
+Pixel(int32_t i32X, int32_t i32Y)
+{
+    return((OLED_FB_Buffer()[((i32Y / 8) * OLED_FB_WIDTH) + i32X] >>
+            (i32Y % 8)) & 1);
+}
+
+//*****************************************************************************
+//
+// Compare the framebuffer with a golden bitmap, whose top left corner is at
+// (i32X, i32Y), and print what was drawn if they differ.
+//
+//*****************************************************************************
+static bool
+Matches(int32_t i32X, int32_t i32Y, const char * const *ppcGolden,
+        uint32_t ui32Rows)
+{
+    uint32_t ui32Row, ui32Col;
+    bool bMatch;
+
+    bMatch = true;
+    for(ui32Row = 0; ui32Row < ui32Rows; ui32Row++)
+    {
+        for(ui32Col = 0; ppcGolden[ui32Row][ui32Col]; ui32Col++)
+        {
+            if(Pixel(i32X + ui32Col, i32Y + ui32Row) !=
+               (ppcGolden[ui32Row][ui32Col] == '#'))
+            {
+                bMatch = false;
+            }
+        }
+    }
+
+    if(!bMatch)
+    {
+        for(ui32Row = 0; ui32Row < ui32Rows; ui32Row++)
+        {
+            printf("    \"");
+            for(ui32Col = 0; ppcGolden[ui32Row][ui32Col]; ui32Col++)
+            {
+                putchar(Pixel(i32X + ui32Col, i32Y + ui32Row) ? '#' : '.');
+            }
+            printf("\"\n");
+        }
+    }
+
+    return(bMatch);
+}
+
+//*****************************************************************************
+//
+// The golden bitmaps.
+//
+//*****************************************************************************
+static const char * const g_ppcHi42[] =
+{
+    ".................................",
+    ".................................",
+    ".##..##..............##...####...",
+    ".##..##..##.........###..##..##..",
+    ".##..##............####......##..",
+    ".######.###......##..##.....##...",
+    ".##..##..##......#######..##.....",
+    ".##..##..##..........##..##......",
+    ".##..##.####.........##..######..",
+    ".................................",
+};
+
+static const char * const g_ppc7m[] =
+{
+    "................................",
+    ".############...................",
+    ".############...................",
+    ".####....####...................",
+    ".####....####...................",
+    ".......####......####....####...",
+    ".......####......####....####...",
+    ".....####........##############.",
+    ".....####........##############.",
+    ".....####........##############.",
+    ".....####........##############.",
+    ".....####........####..##..####.",
+    ".....####........####..##..####.",
+    ".....####........####......####.",
+    ".....####........####......####.",
+    "................................",
+};
+
+#define ROWS(x)                 (sizeof(x) / sizeof((x)[0]))
+
+//*****************************************************************************
+//
+// Text against the golden bitmaps.
+//
+//*****************************************************************************
+static void
+TestGolden(void)
+{
+    int32_t i32End;
+
+    OLED_FB_Clear();
+    i32End = OLED_FB_Text_Font(1, 2, 0, &FONT_PROP, 1, "Hi 42");
+    Check("proportional text, unaligned",
+          Matches(0, 0, g_ppcHi42, ROWS(g_ppcHi42)) && (i32End == 32));
+
+    OLED_FB_Clear();
+    i32End = OLED_FB_Text_Font(1, 5, 0, &FONT_PROP, 2, "7m");
+    Check("proportional text at twice the size",
+          Matches(0, 4, g_ppc7m, ROWS(g_ppc7m)) && (i32End == 31));
+}
+
+//*****************************************************************************
+//
+// The fixed font draws what font_default drew as 8x8 blocks.
+//
+//*****************************************************************************
+static void
+TestFixed(void)
+{
+    static const char pcString[] = "Ab1 ~\x80";
+    uint8_t pui8Expected[SSD1306_BUFFER_SIZE];
+    uint32_t ui32Idx;
+    int32_t i32X;
+    uint8_t ui8Char;
+
+    OLED_FB_Clear();
+    OLED_FB_Fill_Rect(0, 0, OLED_FB_WIDTH, OLED_FB_HEIGHT, WHITE);
+    for(ui32Idx = 0, i32X = 3; pcString[ui32Idx]; ui32Idx++, i32X += 8)
+    {
+        ui8Char = (uint8_t)pcString[ui32Idx];
+        OLED_FB_Blit(i32X, 5, font_default + ((ui8Char > 127 ? '?' : ui8Char) *
+                                              8), 8, 8);
+    }
+    memcpy(pui8Expected, OLED_FB_Buffer(), sizeof(pui8Expected));
+
+    OLED_FB_Clear();
+    OLED_FB_Fill_Rect(0, 0, OLED_FB_WIDTH, OLED_FB_HEIGHT, WHITE);
+    i32X = OLED_FB_Text(3, 5, pcString);
+    Check("fixed font matches font_default",
+          !memcmp(pui8Expected, OLED_FB_Buffer(), sizeof(pui8Expected)) &&
+          (i32X == (3 + (8 * 6))));
+}
+
+//*****************************************************************************
+//
+// Every glyph at twice the size is its pixels doubled, and the string widths
+// match what is drawn.
+//
+//*****************************************************************************
+static void
+TestScaled(const char *pcName, const tFont *psFont)
+{
+    char pcChar[2], pcTest[48];
+    int32_t i32End, i32X, i32Y;
+    uint32_t ui32Width;
+    bool bPass;
+    uint8_t pui8Small[OLED_FONT_MAX_WIDTH][OLED_FONT_MAX_HEIGHT];
+
+    bPass = true;
+    pcChar[1] = '\0';
+    for(pcChar[0] = ' '; pcChar[0] < 0x7f; pcChar[0]++)
+    {
+        OLED_FB_Clear();
+        i32End = OLED_FB_Text_Font(0, 0, 0, psFont, 1, pcChar);
+        ui32Width = OLED_Font_String_Width(psFont, 1, pcChar);
+        bPass = bPass && (i32End == (int32_t)ui32Width);
+        for(i32X = 0; i32X < i32End; i32X++)
+        {
+            for(i32Y = 0; i32Y < psFont->ui8Height; i32Y++)
+            {
+                pui8Small[i32X][i32Y] = Pixel(i32X, i32Y);
+            }
+        }
+
+        OLED_FB_Clear();
+        i32End = OLED_FB_Text_Font(0, 3, 0, psFont, 2, pcChar);
+        bPass = bPass && (i32End == (int32_t)(ui32Width * 2)) &&
+                (OLED_Font_String_Width(psFont, 2, pcChar) == (ui32Width * 2));
+        for(i32X = 0; i32X < i32End; i32X++)
+        {
+            for(i32Y = 0; i32Y < (psFont->ui8Height * 2); i32Y++)
+            {
+                bPass = bPass &&
+                        (Pixel(i32X, 3 + i32Y) == pui8Small[i32X / 2][i32Y / 2]);
+            }
+        }
+    }
+
+    snprintf(pcTest, sizeof(pcTest), "%s glyphs scale to twice the size",
+             pcName);
+    Check(pcTest, bPass);
+
+    OLED_FB_Clear();
+    snprintf(pcTest, sizeof(pcTest), "%s string widths", pcName);
+    Check(pcTest,
+          (OLED_FB_Text_Font(5, 0, 0, psFont, 1, "Vazao: 123 ml/s") ==
+           (int32_t)(5 + OLED_Font_String_Width(psFont, 1,
+                                                "Vazao: 123 ml/s"))) &&
+          (OLED_FB_Text_Font(2, 20, 0, psFont, 2, "0.5 Hz") ==
+           (int32_t)(2 + OLED_Font_String_Width(psFont, 2, "0.5 Hz"))) &&
+          (OLED_Font_String_Width(psFont, 2, "") == 0));
+}
+
+//*****************************************************************************
+//
+// A string centered in a box clears the rest of the box and nothing else.
+//
+//*****************************************************************************
+static void
+TestBox(void)
+{
+    int32_t i32End, i32Start, i32X, i32Y;
+    uint32_t ui32Width;
+    bool bPass;
+
+    OLED_FB_Fill_Rect(0, 0, OLED_FB_WIDTH, OLED_FB_HEIGHT, WHITE);
+    ui32Width = OLED_Font_String_Width(&FONT_PROP, 2, "1 ml/s");
+    i32End = OLED_FB_Text_Font(8, 40, 112, &FONT_PROP, 2, "1 ml/s");
+    i32Start = 8 + ((112 - ui32Width) / 2);
+
+    bPass = (i32End == (int32_t)(i32Start + ui32Width));
+    for(i32Y = 0; i32Y < OLED_FB_HEIGHT; i32Y++)
+    {
+        for(i32X = 0; i32X < OLED_FB_WIDTH; i32X++)
+        {
+            if((i32Y < 40) || (i32Y >= 56) || (i32X < 8) || (i32X >= 120))
+            {
+                bPass = bPass && Pixel(i32X, i32Y);
+            }
+            else if((i32X < i32Start) || (i32X >= i32End))
+            {
+                bPass = bPass && !Pixel(i32X, i32Y);
+            }
+        }
+    }
+    Check("centered text clears its box", bPass);
+
+    //
+    // The same at the other side of the box: a longer value replaces a
+    // shorter one and the other way around.
+    //
+    OLED_FB_Text_Font(8, 40, 112, &FONT_PROP, 2, "1234 ml/s");
+    OLED_FB_Text_Font(8, 40, 112, &FONT_PROP, 2, "1 ml/s");
+    bPass = true;
+    for(i32Y = 40; i32Y < 56; i32Y++)
+    {
+        for(i32X = 8; i32X < i32Start; i32X++)
+        {
+            bPass = bPass && !Pixel(i32X, i32Y);
+        }
+        for(i32X = i32End; i32X < 120; i32X++)
+        {
+            bPass = bPass && !Pixel(i32X, i32Y);
+        }
+    }
+    Check("shorter value replaces a longer one", bPass);
+}
+
+//*****************************************************************************
+//
+// The cache gives the same glyphs whether they are hits, misses or replaced.
+//
+//*****************************************************************************
+static void
+TestCache(void)
+{
+    static const char pcReadout[] = "123 ml/s";
+    static const char pcMany[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnop";
+    uint8_t pui8Expected[SSD1306_BUFFER_SIZE];
+    tOLEDFontStats sBefore, sAfter;
+    bool bPass;
+
+    OLED_FB_Clear();
+    OLED_FB_Text_Font(0, 16, 0, &FONT_PROP, 2, pcReadout);
+    memcpy(pui8Expected, OLED_FB_Buffer(), sizeof(pui8Expected));
+
+    OLED_Font_Get_Stats(&sBefore);
+    OLED_FB_Clear();
+    OLED_FB_Text_Font(0, 16, 0, &FONT_PROP, 2, pcReadout);
+    OLED_Font_Get_Stats(&sAfter);
+    Check("redrawn readout hits the cache",
+          !memcmp(pui8Expected, OLED_FB_Buffer(), sizeof(pui8Expected)) &&
+          ((sAfter.ui32Hits - sBefore.ui32Hits) == strlen(pcReadout)) &&
+          (sAfter.ui32Misses == sBefore.ui32Misses));
+
+    //
+    // Push the readout out of the cache, then draw it again.
+    //
+    OLED_FB_Text_Font(0, 0, 0, &FONT_PROP, 2, pcMany);
+    OLED_FB_Text_Font(0, 0, 0, &FONT_FIXED, 2, pcMany);
+    OLED_Font_Get_Stats(&sBefore);
+    OLED_FB_Clear();
+    OLED_FB_Text_Font(0, 16, 0, &FONT_PROP, 2, pcReadout);
+    OLED_Font_Get_Stats(&sAfter);
+    bPass = !memcmp(pui8Expected, OLED_FB_Buffer(), sizeof(pui8Expected)) &&
+            (sAfter.ui32Misses > sBefore.ui32Misses);
+    Check("replaced glyphs are scaled again", bPass);
+
+    printf("  glyph cache: %u hits, %u misses\n", sAfter.ui32Hits,
+           sAfter.ui32Misses);
+}
+
+int
+main(void)
+{
+    OLED_FB_Init();
+
+    TestGolden();
+    TestFixed();
+    TestScaled("fixed", &FONT_FIXED);
+    TestScaled("proportional", &FONT_PROP);
+    TestBox();
+    TestCache();
+
+    if(g_ui32Failures)
+    {
+        printf("%u tests failed\n", g_ui32Failures);
+        return(1);
+    }
+
+    printf("all tests passed\n");
+
+    return(0);
+}
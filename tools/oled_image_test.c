@@ -0,0 +1,309 @@
+//*****************************************************************************
+//
+// oled_image_test.c - Host test of the compressed images (oled_image.c).
+//
+// This is not part of the firmware.  Build and run it on the host with (on
+// one line):
+//
+//     cc -O2 -I. tools/oled_image_test.c oled_image.c oled_fb.c oled_font.c
+//         fonts/font_default.c images/images_rle.c images/74LS00.c
+//         images/74LS08.c images/74LS32.c images/74LSXX.c
+//         images/loading_empty.c images/utfpr_bar.c -o oled_image_test &&
+//         ./oled_image_test
+//
+// Every compressed image must decode to the LCD Assistant image it was made
+// from, both into a buffer and when drawn into the framebuffer at aligned,
+// unaligned and partly off-screen positions, where it must give the same
+// pixels as drawing the original image.  Compressed data cut short or filled
+// with garbage must never be decoded past the end of the image.
+//
+// The test then reports the flash taken by each image and the bytes sent to
+// the display to draw the splash screen on a blank display.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "i2c.h"
+#include "oled_fb.h"
+
+//*****************************************************************************
+//
+// The images and the originals they were made from.
+//
+//*****************************************************************************
+typedef struct
+{
+    const char *pcName;
+    const tOLEDImage *psImage;
+    const uint8_t *pui8Raw;
+}
+tTestImage;
+
+static const tTestImage g_psImages[] =
+{
+    { "74LS00", &IMG_74LS00, BMP_74LS00 },
+    { "74LS08", &IMG_74LS08, BMP_74LS08 },
+    { "74LS32", &IMG_74LS32, BMP_74LS32 },
+    { "74LSXX", &IMG_74LSXX, BMP_74LSXX },
+    { "LOADING_EMPTY", &IMG_LOADING_EMPTY, BMP_LOADING_EMPTY },
+    { "UTFPR", &IMG_UTFPR, BMP_UTFPR },
+};
+
+#define NUM_IMAGES              (sizeof(g_psImages) / sizeof(g_psImages[0]))
+
+//*****************************************************************************
+//
+// The bytes seen on the bus.
+//
+//*****************************************************************************
+static uint32_t g_ui32Bytes;
+static uint32_t g_ui32Failures;
+
+//*****************************************************************************
+//
+// Take the place of the I2C driver: only count the bytes.
+//
+//*****************************************************************************
+void
+I2C_OLED_Transfer_List(tI2CTransfer *psTransfers, uint32_t ui32Count)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < ui32Count; ui32Idx++)
+    {
+        g_ui32Bytes += 1 + psTransfers[ui32Idx].ui32HeaderSize +
+                       psTransfers[ui32Idx].ui32Size;
+        psTransfers[ui32Idx].ui32Status = I2C_XFER_DONE;
+    }
+}
+
+//*****************************************************************************
+//
+// Check the outcome of a test.
+//
+//*****************************************************************************
+static void
+Check(const char *pcTest, bool bPass)
+{
+    printf("%-44s %s\n", pcTest, bPass ? "ok" : "FAILED");
+    if(!bPass)
+    {
+        g_ui32Failures++;
+    }
+}
+
+static uint32_t
+ImageSize(const tOLEDImage *psImage)
+{
+    return((uint32_t)psImage->ui16Width * (psImage->ui16Height / 8));
+}
+
+//*****************************************************************************
+//
+// Every image decodes to its original.
+//
+//*****************************************************************************
+static void
+TestDecode(void)
+{
+    uint8_t pui8Out[SSD1306_BUFFER_SIZE];
+    uint32_t ui32Idx, ui32Size;
+    char pcTest[48];
+
+    for(ui32Idx = 0; ui32Idx < NUM_IMAGES; ui32Idx++)
+    {
+        ui32Size = ImageSize(g_psImages[ui32Idx].psImage);
+        memset(pui8Out, 0x55, sizeof(pui8Out));
+
+        snprintf(pcTest, sizeof(pcTest), "%s decodes to the original",
+                 g_psImages[ui32Idx].pcName);
+        Check(pcTest,
+              (OLED_Image_Decode(g_psImages[ui32Idx].psImage, pui8Out,
+                                 sizeof(pui8Out)) == ui32Size) &&
+              !memcmp(pui8Out, g_psImages[ui32Idx].pui8Raw, ui32Size) &&
+              ((ui32Size == sizeof(pui8Out)) || (pui8Out[ui32Size] == 0x55)));
+    }
+}
+
+//*****************************************************************************
+//
+// Drawing an image into the framebuffer gives the same pixels as drawing its
+// original, over a screen that is not blank.
+//
+//*****************************************************************************
+static void
+TestDraw(void)
+{
+    static const int32_t pi32Positions[][2] =
+    {
+        { 0, 0 }, { 5, 3 }, { 17, 8 }, { -7, -5 }, { 100, 60 }, { -30, 13 },
+    };
+    uint8_t pui8Expected[SSD1306_BUFFER_SIZE];
+    uint32_t ui32Idx, ui32Pos;
+    int32_t i32X, i32Y;
+    bool bPass;
+
+    bPass = true;
+    for(ui32Idx = 0; ui32Idx < NUM_IMAGES; ui32Idx++)
+    {
+        for(ui32Pos = 0;
+            ui32Pos < (sizeof(pi32Positions) / sizeof(pi32Positions[0]));
+            ui32Pos++)
+        {
+            i32X = pi32Positions[ui32Pos][0];
+            i32Y = pi32Positions[ui32Pos][1];
+
+            OLED_FB_Clear();
+            OLED_FB_Fill_Rect(10, 10, 80, 40, WHITE);
+            OLED_FB_Blit(i32X, i32Y, g_psImages[ui32Idx].pui8Raw,
+                         g_psImages[ui32Idx].psImage->ui16Width,
+                         g_psImages[ui32Idx].psImage->ui16Height);
+            memcpy(pui8Expected, OLED_FB_Buffer(), sizeof(pui8Expected));
+
+            OLED_FB_Clear();
+            OLED_FB_Fill_Rect(10, 10, 80, 40, WHITE);
+            OLED_FB_Image(i32X, i32Y, g_psImages[ui32Idx].psImage);
+            if(memcmp(pui8Expected, OLED_FB_Buffer(), sizeof(pui8Expected)))
+            {
+                printf("  %s differs at (%d, %d)\n",
+                       g_psImages[ui32Idx].pcName, i32X, i32Y);
+                bPass = false;
+            }
+        }
+    }
+    Check("framebuffer drawing matches the originals", bPass);
+}
+
+//*****************************************************************************
+//
+// Damaged data is never decoded past the end of the image.
+//
+//*****************************************************************************
+static void
+TestDamaged(void)
+{
+    uint8_t pui8Out[SSD1306_BUFFER_SIZE + 64], pui8Garbage[256];
+    tOLEDImage sImage;
+    uint32_t ui32Idx, ui32Len, ui32Size;
+    bool bPass;
+
+    //
+    // Every image cut short at every length.
+    //
+    bPass = true;
+    for(ui32Idx = 0; ui32Idx < NUM_IMAGES; ui32Idx++)
+    {
+        sImage = *g_psImages[ui32Idx].psImage;
+        ui32Size = ImageSize(&sImage);
+        for(ui32Len = 0; ui32Len < g_psImages[ui32Idx].psImage->ui32Size;
+            ui32Len++)
+        {
+            sImage.ui32Size = ui32Len;
+            memset(pui8Out, 0x55, sizeof(pui8Out));
+            bPass = bPass &&
+                    (OLED_Image_Decode(&sImage, pui8Out, sizeof(pui8Out)) <
+                     ui32Size) &&
+                    (pui8Out[ui32Size] == 0x55);
+            OLED_FB_Image(0, 0, &sImage);
+        }
+    }
+    Check("truncated data stops early", bPass);
+
+    //
+    // Garbage, which mostly codes runs longer than what is left of the image.
+    //
+    bPass = true;
+    srand(1);
+    for(ui32Idx = 0; ui32Idx < 1000; ui32Idx++)
+    {
+        for(ui32Len = 0; ui32Len < sizeof(pui8Garbage); ui32Len++)
+        {
+            pui8Garbage[ui32Len] = rand();
+        }
+        sImage.ui16Width = 1 + (rand() % 128);
+        sImage.ui16Height = 8 * (1 + (rand() % 8));
+        sImage.pui8Data = pui8Garbage;
+        sImage.ui32Size = rand() % sizeof(pui8Garbage);
+        ui32Size = ImageSize(&sImage);
+
+        memset(pui8Out, 0x55, sizeof(pui8Out));
+        bPass = bPass &&
+                (OLED_Image_Decode(&sImage, pui8Out, sizeof(pui8Out)) <=
+                 ui32Size) &&
+                (pui8Out[ui32Size] == 0x55);
+        OLED_FB_Image(rand() % 128, rand() % 64, &sImage);
+    }
+    Check("garbage stays within the image", bPass);
+
+    //
+    // A buffer smaller than the image.
+    //
+    memset(pui8Out, 0x55, sizeof(pui8Out));
+    Check("small buffer is not overrun",
+          (OLED_Image_Decode(&IMG_UTFPR, pui8Out, 100) == 100) &&
+          !memcmp(pui8Out, BMP_UTFPR, 100) && (pui8Out[100] == 0x55));
+}
+
+//*****************************************************************************
+//
+// Report the flash taken by the images and the cost of the splash screen.
+//
+//*****************************************************************************
+static void
+Report(void)
+{
+    uint32_t ui32Idx, ui32Raw, ui32Packed, ui32Full;
+
+    printf("\n%-16s %8s %8s %12s\n", "image", "raw", "packed", "struct");
+    ui32Raw = 0;
+    ui32Packed = 0;
+    for(ui32Idx = 0; ui32Idx < NUM_IMAGES; ui32Idx++)
+    {
+        printf("%-16s %8u %8u %12u\n", g_psImages[ui32Idx].pcName,
+               ImageSize(g_psImages[ui32Idx].psImage),
+               g_psImages[ui32Idx].psImage->ui32Size,
+               (uint32_t)sizeof(tOLEDImage));
+        ui32Raw += ImageSize(g_psImages[ui32Idx].psImage);
+        ui32Packed += g_psImages[ui32Idx].psImage->ui32Size +
+                      sizeof(tOLEDImage);
+    }
+    printf("%-16s %8u %8u (%u%%)\n", "total", ui32Raw, ui32Packed,
+           (ui32Packed * 100) / ui32Raw);
+
+    //
+    // The splash screen on a blank display, against the previous driver's
+    // whole-screen write.
+    //
+    OLED_FB_Init();
+    OLED_FB_Flush();
+    g_ui32Bytes = 0;
+    OLED_FB_Image(0, 0, &IMG_UTFPR);
+    OLED_FB_Flush();
+    ui32Full = 8 + 2 + SSD1306_BUFFER_SIZE;
+    printf("\nsplash on a blank display: %u bytes on the bus, %u for a full "
+           "screen\n", g_ui32Bytes, ui32Full);
+}
+
+int
+main(void)
+{
+    OLED_FB_Init();
+
+    TestDecode();
+    TestDraw();
+    TestDamaged();
+    Report();
+
+    if(g_ui32Failures)
+    {
+        printf("%u tests failed\n", g_ui32Failures);
+        return(1);
+    }
+
+    printf("all tests passed\n");
+
+    return(0);
+}
@@ -0,0 +1,571 @@
+//*****************************************************************************
+//
+// pid_sim.c - Host simulation of the flow controller (pid.c).
+//
+// This is not part of the firmware.  Build and run it on the host with:
+//
+//     cc -O2 -I. tools/pid_sim.c -lm -o pid_sim && ./pid_sim
+//
+// The pump is a first-order plant: the flow it settles at is a gain times
+// the duty cycle above a dead band, and it gets there with a time constant.
+// The flow sensor gives an edge per litre, which the model times with some
+// jitter.  The edges are measured the way Capture_Measure() does, over a
+// gate of whole periods, and the controller runs every CONTROL_PERIOD_MS on
+// the latest measurement, as pwmTask does, with the same gains and limits
+// as the firmware.
+//
+// The controller is run through a sequence of setpoint steps with the
+// firmware tuning, with feed-forward alone and with a derivative term, then
+// against a pump too weak to reach the top setpoint, where the output
+// saturates, and against pumps faster, slower, stronger and weaker than the
+// one it was tuned on.  Settling time is to within SETTLE_BAND_MHZ of the
+// setpoint for good; overshoot is past the setpoint, as a share of the step.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "pid.c"
+
+//*****************************************************************************
+//
+// The firmware's constants, from enet_io.c and main.h.
+//
+//*****************************************************************************
+#define SYSTEM_CLOCK            120000000
+#define PWM_PERIOD              400
+#define FLOW_GATE_CYCLES        2000000
+#define FLOW_TIMEOUT_MS         1000
+#define FLOW_FULL_SCALE_MHZ     50000
+#define CONTROL_PERIOD_MS       10
+#define CONTROL_KP              0.006
+#define CONTROL_TI_MS           250
+#define CONTROL_TD_MS           0
+#define CONTROL_RATE            8
+
+static const tPIDConfig g_sFirmware =
+{
+    PID_GAIN(CONTROL_KP),
+    PID_GAIN(CONTROL_KP * CONTROL_PERIOD_MS / CONTROL_TI_MS),
+    PID_GAIN(CONTROL_KP * CONTROL_TD_MS / CONTROL_PERIOD_MS),
+    PID_GAIN((double)PWM_PERIOD / FLOW_FULL_SCALE_MHZ),
+    1,
+    PWM_PERIOD - 1,
+    CONTROL_RATE
+};
+
+//*****************************************************************************
+//
+// The variants compared with the firmware tuning.
+//
+//*****************************************************************************
+static tPIDConfig g_sFeedForward;
+static tPIDConfig g_sDerivative;
+
+//*****************************************************************************
+//
+// The simulation runs in steps of SIM_STEP_S; a result is settled once it
+// stays within SETTLE_BAND_MHZ of the setpoint.
+//
+//*****************************************************************************
+#define SIM_STEP_S              0.00005
+#define SETTLE_BAND_MHZ         1000
+#define SEGMENT_MS              5000
+
+static uint32_t g_ui32Failures;
+
+//*****************************************************************************
+//
+// Check the outcome of a test.
+//
+//*****************************************************************************
+static void
+Check(const char *pcTest, bool bPass)
+{
+    printf("%-56s %s\n", pcTest, bPass ? "ok" : "FAILED");
+    if(!bPass)
+    {
+        g_ui32Failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// The pump: its flow in hertz of the sensor, the flow it settles at per
+// tick of duty above the dead band, and its time constant.
+//
+//*****************************************************************************
+typedef struct
+{
+    double dGain;
+    double dDeadBand;
+    double dTau;
+    double dFlow;
+}
+tPump;
+
+//*****************************************************************************
+//
+// The sensor and the measurement of its edges: the phase of the sensor, in
+// periods, the jitter of its edges, and the gate of Capture_Measure(), in
+// system clock cycles.
+//
+//*****************************************************************************
+static struct
+{
+    double dPhase;
+    uint32_t ui32Seed;
+    bool bOpen;
+    double dFirst;
+    double dLast;
+    uint32_t ui32Periods;
+    bool bMeasured;
+    uint32_t ui32MilliHz;
+}
+g_sSensor;
+
+//
+// A random number from -1 to 1.
+//
+static double
+Jitter(void)
+{
+    g_sSensor.ui32Seed = (g_sSensor.ui32Seed * 1103515245) + 12345;
+
+    return((((g_sSensor.ui32Seed >> 8) & 0xFFFF) / 32768.0) - 1.0);
+}
+
+//
+// An edge of the sensor, at a time in cycles.  The gate closes at the first
+// edge at least FLOW_GATE_CYCLES after it opened, and the next one opens
+// there.
+//
+static void
+Edge(double dCycles)
+{
+    if(!g_sSensor.bOpen)
+    {
+        g_sSensor.bOpen = true;
+        g_sSensor.dFirst = dCycles;
+        g_sSensor.ui32Periods = 0;
+        return;
+    }
+
+    g_sSensor.dLast = dCycles;
+    g_sSensor.ui32Periods++;
+
+    if((g_sSensor.dLast - g_sSensor.dFirst) >= FLOW_GATE_CYCLES)
+    {
+        g_sSensor.ui32MilliHz =
+            (uint32_t)((g_sSensor.ui32Periods * 1000.0 * SYSTEM_CLOCK /
+                        (g_sSensor.dLast - g_sSensor.dFirst)) + 0.5);
+        g_sSensor.bMeasured = true;
+        g_sSensor.dFirst = g_sSensor.dLast;
+        g_sSensor.ui32Periods = 0;
+    }
+}
+
+//*****************************************************************************
+//
+// pwmTask: the controller and the state of the input.
+//
+//*****************************************************************************
+static tPID g_sPID;
+static bool g_bSignal;
+static uint32_t g_ui32FlowMilliHz;
+static uint32_t g_ui32LastMs;
+
+//
+// One step of pwmTask, as updateFlow() and the control loop do it.
+//
+static int32_t
+Control(uint32_t ui32Now, uint32_t ui32Setpoint)
+{
+    if(g_sSensor.bMeasured)
+    {
+        g_sSensor.bMeasured = false;
+        g_ui32FlowMilliHz = g_sSensor.ui32MilliHz;
+        g_ui32LastMs = ui32Now;
+        g_bSignal = true;
+    }
+    else if(g_bSignal && ((ui32Now - g_ui32LastMs) >= FLOW_TIMEOUT_MS))
+    {
+        g_bSignal = false;
+        g_ui32FlowMilliHz = 0;
+    }
+
+    if(!ui32Setpoint)
+    {
+        PID_Reset(&g_sPID);
+        return(g_sPID.i32Out);
+    }
+
+    if(!g_bSignal)
+    {
+        return(PID_Feed_Forward(&g_sPID, ui32Setpoint));
+    }
+
+    return(PID_Update(&g_sPID, ui32Setpoint, g_ui32FlowMilliHz));
+}
+
+//*****************************************************************************
+//
+// The response to one step of the setpoint.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32From;
+    uint32_t ui32To;
+    double dSettleMs;
+    double dOvershoot;
+    double dError;
+    int32_t i32MaxChange;
+}
+tStep;
+
+//
+// Run the pump and the controller through a sequence of setpoints, each
+// held for SEGMENT_MS, and measure the response to each step.
+//
+static void
+Run(const tPIDConfig *psConfig, tPump *psPump, const uint32_t *pui32Setpoints,
+    uint32_t ui32Steps, tStep *psSteps)
+{
+    uint32_t ui32Step, ui32Tick, ui32Now, ui32From, ui32To, ui32PerTick;
+    int32_t i32Duty, i32LastDuty;
+    double dTime, dFlow, dPeak, dLastOut;
+    tStep *psStep;
+
+    g_sSensor.dPhase = 0;
+    g_sSensor.ui32Seed = 1;
+    g_sSensor.bOpen = false;
+    g_sSensor.bMeasured = false;
+    PID_Init(&g_sPID, psConfig);
+    g_bSignal = false;
+    g_ui32FlowMilliHz = 0;
+    psPump->dFlow = 0;
+
+    ui32Now = 0;
+    i32Duty = 1;
+    ui32From = 0;
+
+    for(ui32Step = 0; ui32Step < ui32Steps; ui32Step++)
+    {
+        ui32To = pui32Setpoints[ui32Step];
+        psStep = &psSteps[ui32Step];
+        psStep->ui32From = ui32From;
+        psStep->ui32To = ui32To;
+        psStep->dSettleMs = 0;
+        psStep->dError = 0;
+        psStep->i32MaxChange = 0;
+        dPeak = ui32From;
+        dLastOut = 0;
+
+        for(ui32Tick = 0; ui32Tick < (SEGMENT_MS / CONTROL_PERIOD_MS);
+            ui32Tick++, ui32Now += CONTROL_PERIOD_MS)
+        {
+            i32LastDuty = i32Duty;
+            i32Duty = Control(ui32Now, ui32To);
+            if(abs(i32Duty - i32LastDuty) > psStep->i32MaxChange)
+            {
+                psStep->i32MaxChange = abs(i32Duty - i32LastDuty);
+            }
+
+            //
+            // The pump and the sensor until the next step of the loop.
+            //
+            for(ui32PerTick = 0;
+                ui32PerTick < (CONTROL_PERIOD_MS / 1000.0 / SIM_STEP_S);
+                ui32PerTick++)
+            {
+                dFlow = psPump->dGain * (i32Duty - psPump->dDeadBand);
+                dFlow = (dFlow < 0) ? 0 : dFlow;
+                psPump->dFlow += (dFlow - psPump->dFlow) * SIM_STEP_S /
+                                 psPump->dTau;
+
+                g_sSensor.dPhase += psPump->dFlow * SIM_STEP_S;
+                if(g_sSensor.dPhase >= 1.0)
+                {
+                    //
+                    // The edge fell part way through the step, jittered by
+                    // up to 1% of the period.
+                    //
+                    g_sSensor.dPhase -= 1.0;
+                    dTime = (ui32Now / 1000.0) +
+                            ((ui32PerTick + 1) * SIM_STEP_S) -
+                            (g_sSensor.dPhase / psPump->dFlow) +
+                            (Jitter() * 0.01 / psPump->dFlow);
+                    Edge(dTime * SYSTEM_CLOCK);
+                }
+            }
+
+            //
+            // The response, against the true flow.
+            //
+            dFlow = psPump->dFlow * 1000;
+            if(((ui32To >= ui32From) && (dFlow > dPeak)) ||
+               ((ui32To < ui32From) && (dFlow < dPeak)))
+            {
+                dPeak = dFlow;
+            }
+            if(fabs(dFlow - ui32To) > SETTLE_BAND_MHZ)
+            {
+                psStep->dSettleMs = (ui32Tick + 1) * CONTROL_PERIOD_MS;
+            }
+            if(ui32Tick >= ((SEGMENT_MS / CONTROL_PERIOD_MS) - 100))
+            {
+                dLastOut = fabs(dFlow - ui32To);
+                if(dLastOut > psStep->dError)
+                {
+                    psStep->dError = dLastOut;
+                }
+            }
+        }
+
+        psStep->dOvershoot = 0;
+        if(ui32To != ui32From)
+        {
+            psStep->dOvershoot = ((ui32To > ui32From) ? (dPeak - ui32To) :
+                                                        (ui32To - dPeak)) *
+                                 100.0 / fabs((double)ui32To - ui32From);
+            if(psStep->dOvershoot < 0)
+            {
+                psStep->dOvershoot = 0;
+            }
+        }
+
+        ui32From = ui32To;
+    }
+}
+
+//
+// Print the responses.
+//
+static void
+Print(const char *pcName, tStep *psSteps, uint32_t ui32Steps)
+{
+    uint32_t ui32Step;
+
+    printf("\n  %s\n", pcName);
+    printf("  %8s %8s %10s %10s %10s %8s\n", "from Hz", "to Hz", "settle ms",
+           "overshoot", "error mHz", "max step");
+    for(ui32Step = 0; ui32Step < ui32Steps; ui32Step++)
+    {
+        printf("  %8.1f %8.1f %10.0f %9.1f%% %10.0f %8d\n",
+               psSteps[ui32Step].ui32From / 1000.0,
+               psSteps[ui32Step].ui32To / 1000.0,
+               psSteps[ui32Step].dSettleMs, psSteps[ui32Step].dOvershoot,
+               psSteps[ui32Step].dError, psSteps[ui32Step].i32MaxChange);
+    }
+}
+
+//*****************************************************************************
+//
+// The controller parts on their own.
+//
+//*****************************************************************************
+static void
+TestParts(void)
+{
+    static const tPIDConfig sConfig =
+    {
+        PID_GAIN(1.0), PID_GAIN(0.5), 0, 0, -100, 100, 0
+    };
+    static const tPIDConfig sRate =
+    {
+        0, 0, 0, PID_GAIN(1.0), 0, 1000, 10
+    };
+    uint32_t ui32Idx;
+    int32_t i32Out;
+    tPID sPID;
+    bool bPass;
+
+    //
+    // A constant error winds the integral up to the limit and no further:
+    // once the error turns, the output leaves the limit on the next step.
+    //
+    PID_Init(&sPID, &sConfig);
+    for(ui32Idx = 0; ui32Idx < 1000; ui32Idx++)
+    {
+        i32Out = PID_Update(&sPID, 50, 0);
+    }
+    bPass = (i32Out == 100) && (PID_Get_Integral(&sPID) == 50);
+    i32Out = PID_Update(&sPID, 0, 10);
+    bPass = bPass && (i32Out < 100);
+    Check("integral held at the limit, released when the error turns",
+          bPass);
+
+    //
+    // The same below the limit.
+    //
+    PID_Init(&sPID, &sConfig);
+    for(ui32Idx = 0; ui32Idx < 1000; ui32Idx++)
+    {
+        i32Out = PID_Update(&sPID, -50, 0);
+    }
+    bPass = (i32Out == -100) && (PID_Get_Integral(&sPID) == -50);
+    Check("integral held at the lower limit", bPass);
+
+    //
+    // The output ramps at the rate limit, up and down, and the feed-forward
+    // alone follows the setpoint.
+    //
+    PID_Init(&sPID, &sRate);
+    bPass = true;
+    for(ui32Idx = 1; ui32Idx <= 50; ui32Idx++)
+    {
+        i32Out = PID_Update(&sPID, 200, 200);
+        bPass = bPass && (i32Out == (int32_t)((ui32Idx * 10) < 200 ?
+                                              (ui32Idx * 10) : 200));
+    }
+    bPass = bPass && (PID_Get_Integral(&sPID) == 0);
+    i32Out = PID_Feed_Forward(&sPID, 0);
+    bPass = bPass && (i32Out == 190);
+    PID_Reset(&sPID);
+    bPass = bPass && (sPID.i32Out == 0);
+    Check("output ramps at the rate limit, integral untouched", bPass);
+}
+
+//
+// The worst response to the steps to a flow, leaving out the stop at the
+// end.
+//
+static void
+Worst(tStep *psSteps, uint32_t ui32Steps, tStep *psWorst)
+{
+    uint32_t ui32Step;
+
+    psWorst->dSettleMs = 0;
+    psWorst->dOvershoot = 0;
+    psWorst->dError = 0;
+    psWorst->i32MaxChange = 0;
+    for(ui32Step = 0; ui32Step < ui32Steps; ui32Step++)
+    {
+        if(!psSteps[ui32Step].ui32To)
+        {
+            continue;
+        }
+        psWorst->dSettleMs = fmax(psWorst->dSettleMs,
+                                  psSteps[ui32Step].dSettleMs);
+        psWorst->dOvershoot = fmax(psWorst->dOvershoot,
+                                   psSteps[ui32Step].dOvershoot);
+        psWorst->dError = fmax(psWorst->dError, psSteps[ui32Step].dError);
+        if(psSteps[ui32Step].i32MaxChange > psWorst->i32MaxChange)
+        {
+            psWorst->i32MaxChange = psSteps[ui32Step].i32MaxChange;
+        }
+    }
+}
+
+int
+main(void)
+{
+    static const uint32_t pui32Setpoints[] =
+    {
+        25000, 40000, 10000, 50000, 30000, 0
+    };
+    static const uint32_t pui32Saturate[] = { 25000, 50000, 20000 };
+    static const uint32_t pui32Reachable[] =
+    {
+        25000, 40000, 10000, 45000, 30000, 0
+    };
+    static const double pdGains[] = { 0.125, 0.14, 0.16 };
+    static const double pdTaus[] = { 0.15, 0.3, 0.6 };
+    tStep psSteps[6], psFeedForward[6], psDerivative[6], psWeak[3];
+    tStep sWorst, sRobust, sPump1;
+    uint32_t ui32Gain, ui32Tau;
+    tPump sPump;
+
+    TestParts();
+
+    //
+    // The pump reaches about 53 Hz at full duty, a little off what the
+    // feed-forward assumes, with a dead band and a time constant of 300 ms.
+    //
+    sPump.dGain = 0.14;
+    sPump.dDeadBand = 20;
+    sPump.dTau = 0.3;
+
+    Run(&g_sFirmware, &sPump, pui32Setpoints, 6, psSteps);
+    Print("firmware tuning", psSteps, 6);
+    Worst(psSteps, 6, &sWorst);
+
+    g_sFeedForward = g_sFirmware;
+    g_sFeedForward.i32Kp = 0;
+    g_sFeedForward.i32Ki = 0;
+    g_sFeedForward.i32Kd = 0;
+    Run(&g_sFeedForward, &sPump, pui32Setpoints, 6, psFeedForward);
+    Print("feed-forward alone", psFeedForward, 6);
+
+    //
+    // The flow is measured once a period at low flows, so the derivative
+    // has little to work on.
+    //
+    g_sDerivative = g_sFirmware;
+    g_sDerivative.i32Kd = PID_GAIN(CONTROL_KP * 30 / CONTROL_PERIOD_MS);
+    Run(&g_sDerivative, &sPump, pui32Setpoints, 6, psDerivative);
+    Print("with a derivative term, Td of 30 ms", psDerivative, 6);
+
+    //
+    // A pump that only reaches about 38 Hz: the output saturates at the top
+    // setpoint, and must come off the limit as soon as the setpoint drops.
+    //
+    sPump.dGain = 0.10;
+    Run(&g_sFirmware, &sPump, pui32Saturate, 3, psWeak);
+    Print("weak pump, saturated at 50 Hz", psWeak, 3);
+
+    //
+    // The same tuning on pumps from 10% weaker to 15% stronger and from
+    // twice as fast to twice as slow, up to a flow they all reach.
+    //
+    printf("\n  other pumps, worst of the steps up to 45 Hz\n");
+    printf("  %8s %8s %10s %10s %10s\n", "Hz/tick", "tau ms", "settle ms",
+           "overshoot", "error mHz");
+    sRobust.dSettleMs = 0;
+    sRobust.dOvershoot = 0;
+    sRobust.dError = 0;
+    for(ui32Gain = 0; ui32Gain < 3; ui32Gain++)
+    {
+        for(ui32Tau = 0; ui32Tau < 3; ui32Tau++)
+        {
+            sPump.dGain = pdGains[ui32Gain];
+            sPump.dTau = pdTaus[ui32Tau];
+            Run(&g_sFirmware, &sPump, pui32Reachable, 6, psDerivative);
+            Worst(psDerivative, 6, &sPump1);
+            printf("  %8.3f %8.0f %10.0f %9.1f%% %10.0f\n", sPump.dGain,
+                   sPump.dTau * 1000, sPump1.dSettleMs, sPump1.dOvershoot,
+                   sPump1.dError);
+            sRobust.dSettleMs = fmax(sRobust.dSettleMs, sPump1.dSettleMs);
+            sRobust.dOvershoot = fmax(sRobust.dOvershoot,
+                                      sPump1.dOvershoot);
+            sRobust.dError = fmax(sRobust.dError, sPump1.dError);
+        }
+    }
+    printf("\n");
+
+    Check("settles within 2.5 s of every step", sWorst.dSettleMs <= 2500);
+    Check("overshoots by at most 20% of the step", sWorst.dOvershoot <= 20.0);
+    Check("settled error within 0.2 Hz", sWorst.dError <= 200);
+    Check("output changes by at most the rate limit a step",
+          sWorst.i32MaxChange <= CONTROL_RATE);
+    Check("stops at a setpoint of 0", psSteps[5].dError <= 100);
+    Check("feed-forward alone leaves an error",
+          psFeedForward[1].dError > SETTLE_BAND_MHZ);
+    Check("no windup: settles within 1.5 s after saturating",
+          (psWeak[2].dSettleMs <= 1500) && (psWeak[2].dOvershoot <= 10.0));
+    Check("settles on the other pumps within 3 s, to 0.2 Hz",
+          (sRobust.dSettleMs <= 3000) && (sRobust.dError <= 200));
+
+    if(g_ui32Failures)
+    {
+        printf("%u failures\n", g_ui32Failures);
+        return(1);
+    }
+
+    printf("all passed\n");
+
+    return(0);
+}
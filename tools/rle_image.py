@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+#
+# rle_image.py - Compress the LCD Assistant images in images/ into the
+# run-length format of oled_image.h.
+#
+# Usage (from the project directory):
+#
+#     python3 tools/rle_image.py -o images/images_rle.c images/*.c
+#
+# Each input is a C file generated by LCD Assistant holding one or more
+# "const unsigned char BMP_<NAME> []" arrays in the layout of the display
+# memory.  The size of the image is taken from the .bmp file of the same name
+# and every array of that size becomes a tOLEDImage called IMG_<NAME>; other
+# arrays, and files not generated by LCD Assistant (such as the output), are
+# skipped.  The result is checked by decoding it again.
+#
+# Pass --stats to print the size of each image before and after.
+#
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+LITERAL_MAX = 128
+RUN_MAX = 64
+ZEROS = 0x80
+REPEAT = 0xc0
+
+#
+# The shortest run of a value other than zero worth a token of its own.  A
+# shorter one costs fewer bytes as part of a literal.
+#
+REPEAT_MIN = 3
+
+ARRAY = re.compile(r'const\s+unsigned\s+char\s+(BMP_\w+)\s*\[\s*\]\s*=\s*'
+                   r'\{([^}]*)\}', re.S)
+
+
+def bmp_size(path):
+    with open(path, 'rb') as f:
+        header = f.read(26)
+    if header[:2] != b'BM':
+        raise ValueError('%s is not a BMP file' % path)
+    width, height = struct.unpack('<ii', header[18:26])
+    return width, abs(height)
+
+
+def load(path):
+    with open(path) as f:
+        text = f.read()
+    if 'LCD Assistant' not in text:
+        return []
+    return [(name, bytes(int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+',
+                                                        body)))
+            for name, body in ARRAY.findall(text)]
+
+
+def run_length(data, pos):
+    end = pos
+    while (end < len(data)) and (data[end] == data[pos]):
+        end += 1
+    return end - pos
+
+
+def encode(data):
+    out = bytearray()
+    literal = bytearray()
+
+    def flush():
+        for start in range(0, len(literal), LITERAL_MAX):
+            chunk = literal[start:start + LITERAL_MAX]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+        literal.clear()
+
+    pos = 0
+    while pos < len(data):
+        count = run_length(data, pos)
+        if (data[pos] == 0) or (count >= REPEAT_MIN):
+            flush()
+            for start in range(0, count, RUN_MAX):
+                chunk = min(RUN_MAX, count - start)
+                if data[pos] == 0:
+                    out.append(ZEROS | (chunk - 1))
+                else:
+                    out.append(REPEAT | (chunk - 1))
+                    out.append(data[pos])
+            pos += count
+        else:
+            literal.extend(data[pos:pos + count])
+            pos += count
+    flush()
+
+    return bytes(out)
+
+
+def decode(data):
+    out = bytearray()
+    pos = 0
+    while pos < len(data):
+        token = data[pos]
+        pos += 1
+        if not token & ZEROS:
+            count = token + 1
+            out.extend(data[pos:pos + count])
+            pos += count
+        elif (token & REPEAT) == ZEROS:
+            out.extend(bytes((token & (RUN_MAX - 1)) + 1))
+        else:
+            out.extend(bytes([data[pos]]) * ((token & (RUN_MAX - 1)) + 1))
+            pos += 1
+    return bytes(out)
+
+
+def c_array(data):
+    lines = []
+    for start in range(0, len(data), 16):
+        lines.append('    ' + ', '.join('0x%02x' % b
+                                        for b in data[start:start + 16]) +
+                     ',')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('-o', '--output', required=True)
+    parser.add_argument('--stats', action='store_true')
+    parser.add_argument('inputs', nargs='+')
+    args = parser.parse_args()
+
+    images = []
+    for path in sorted(args.inputs):
+        if os.path.abspath(path) == os.path.abspath(args.output):
+            continue
+        arrays = load(path)
+        if not arrays:
+            continue
+        width, height = bmp_size(os.path.splitext(path)[0] + '.bmp')
+        for name, data in arrays:
+            if len(data) != width * (height // 8):
+                print('%s: skipping %s, %u bytes is not a %ux%u image' %
+                      (path, name, len(data), width, height),
+                      file=sys.stderr)
+                continue
+            packed = encode(data)
+            if decode(packed) != data:
+                sys.exit('%s: %s does not survive the round trip' %
+                         (path, name))
+            images.append(('IMG_' + name[4:], name, os.path.basename(path),
+                           width, height, data, packed))
+
+    with open(args.output, 'w') as f:
+        f.write('//' + '*' * 77 + '\n')
+        f.write('//\n')
+        f.write('// %s - Run-length compressed images.\n' %
+                os.path.basename(args.output))
+        f.write('//\n')
+        f.write('// This file is generated by tools/rle_image.py from the '
+                'LCD Assistant images\n')
+        f.write('// in this directory:\n')
+        f.write('//\n')
+        f.write('//     python3 tools/rle_image.py -o images/images_rle.c '
+                'images/*.c\n')
+        f.write('//\n')
+        f.write('//' + '*' * 77 + '\n')
+        f.write('#include <stdint.h>\n')
+        f.write('#include "../oled_image.h"\n')
+        for ident, name, source, width, height, data, packed in images:
+            f.write('\n//\n// %s from %s: %u bytes, %u compressed.\n//\n' %
+                    (name, source, len(data), len(packed)))
+            f.write('static const uint8_t g_pui8Image%s[] =\n{\n%s\n};\n\n' %
+                    (ident[4:], c_array(packed)))
+            f.write('const tOLEDImage %s =\n{\n    %u, %u, g_pui8Image%s, '
+                    'sizeof(g_pui8Image%s)\n};\n' %
+                    (ident, width, height, ident[4:], ident[4:]))
+
+    if args.stats:
+        total = sum(len(i[5]) for i in images)
+        packed = sum(len(i[6]) for i in images)
+        for ident, name, source, width, height, data, comp in images:
+            print('%-20s %4ux%-3u %5u -> %4u bytes' %
+                  (ident, width, height, len(data), len(comp)))
+        print('%-28s %5u -> %4u bytes (%u%%)' %
+              ('total', total, packed, (packed * 100) // total))
+
+
+if __name__ == '__main__':
+    main()
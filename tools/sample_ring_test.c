@@ -0,0 +1,393 @@
+//*****************************************************************************
+//
+// sample_ring_test.c - Host test of the sample ring (sample_ring.c).
+//
+// This is not part of the firmware.  Build and run it on the host with:
+//
+//     cc -O2 -I. tools/sample_ring_test.c -lpthread -o sample_ring_test &&
+//         ./sample_ring_test
+//
+// The writer stores a count, so the reader can tell every sample it misses.
+// It must see the samples in order, with a gap reported exactly where
+// samples went missing, and every sample must be either read or counted as
+// lost.
+//
+// First the ring is run step by step, full and empty, and with the indices
+// about to wrap.  Then the writer runs in a signal handler from an interval
+// timer, which interrupts the reader at random points as the capture
+// interrupt does on the target, and then in a thread of its own.  The reader
+// pauses now and then so that the ring fills up and drops samples.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/time.h>
+#include "sample_ring.c"
+
+//*****************************************************************************
+//
+// The ring under test.
+//
+//*****************************************************************************
+#define RING_SIZE               16
+
+static volatile uint32_t g_pui32Slots[RING_SIZE];
+static tSampleRing g_sRing;
+
+//*****************************************************************************
+//
+// The writer's count, and whether it should stop.
+//
+//*****************************************************************************
+static volatile uint32_t g_ui32Written;
+static volatile uint32_t g_ui32ToWrite;
+
+static uint32_t g_ui32Failures;
+
+//*****************************************************************************
+//
+// Check the outcome of a test.
+//
+//*****************************************************************************
+static void
+Check(const char *pcTest, bool bPass)
+{
+    printf("%-56s %s\n", pcTest, bPass ? "ok" : "FAILED");
+    if(!bPass)
+    {
+        g_ui32Failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// The reader's view: the last sample read and the errors seen.
+//
+//*****************************************************************************
+static struct
+{
+    uint32_t ui32Read;
+    uint32_t ui32Last;
+    uint32_t ui32Gaps;
+    uint32_t ui32OutOfOrder;
+    uint32_t ui32MissedGaps;
+    uint32_t ui32FalseGaps;
+}
+g_sReader;
+
+static void
+ReaderReset(void)
+{
+    g_sReader.ui32Read = 0;
+    g_sReader.ui32Last = 0;
+    g_sReader.ui32Gaps = 0;
+    g_sReader.ui32OutOfOrder = 0;
+    g_sReader.ui32MissedGaps = 0;
+    g_sReader.ui32FalseGaps = 0;
+}
+
+//
+// Read one sample if there is one, and check it against the last one.  The
+// writer counts from 1.
+//
+static bool
+Read(void)
+{
+    uint32_t ui32Sample;
+    bool bGap;
+
+    if(!Sample_Ring_Get(&g_sRing, &ui32Sample, &bGap))
+    {
+        return(false);
+    }
+
+    if(ui32Sample <= g_sReader.ui32Last)
+    {
+        g_sReader.ui32OutOfOrder++;
+    }
+    else if(bGap && (ui32Sample == (g_sReader.ui32Last + 1)))
+    {
+        g_sReader.ui32FalseGaps++;
+    }
+    else if(!bGap && (ui32Sample != (g_sReader.ui32Last + 1)))
+    {
+        g_sReader.ui32MissedGaps++;
+    }
+
+    g_sReader.ui32Gaps += bGap ? 1 : 0;
+    g_sReader.ui32Last = ui32Sample;
+    g_sReader.ui32Read++;
+
+    return(true);
+}
+
+static bool
+ReaderClean(void)
+{
+    return(!g_sReader.ui32OutOfOrder && !g_sReader.ui32MissedGaps &&
+           !g_sReader.ui32FalseGaps);
+}
+
+//
+// Write a burst of samples.
+//
+static void
+Write(uint32_t ui32Count)
+{
+    while(ui32Count-- && (g_ui32Written < g_ui32ToWrite))
+    {
+        Sample_Ring_Put(&g_sRing, ++g_ui32Written);
+    }
+}
+
+static void
+Start(uint32_t ui32ToWrite)
+{
+    Sample_Ring_Init(&g_sRing, g_pui32Slots, RING_SIZE);
+    g_ui32Written = 0;
+    g_ui32ToWrite = ui32ToWrite;
+    ReaderReset();
+}
+
+//*****************************************************************************
+//
+// The ring step by step.
+//
+//*****************************************************************************
+static void
+TestSteps(void)
+{
+    uint32_t ui32Idx, ui32Sample;
+    bool bPass, bGap;
+
+    //
+    // Empty, then full, then dropping.
+    //
+    Start(1000);
+    bPass = !Read() && (Sample_Ring_Count(&g_sRing) == 0);
+    Write(RING_SIZE);
+    bPass = bPass && (Sample_Ring_Count(&g_sRing) == RING_SIZE) &&
+            !Sample_Ring_Put(&g_sRing, 99) &&
+            (Sample_Ring_Lost(&g_sRing) == 1);
+    Check("empty and full ring", bPass);
+
+    //
+    // The samples stored before the drop are skipped; the next one stored
+    // is reported after a gap.
+    //
+    g_ui32Written++;
+    bPass = !Read() && (Sample_Ring_Lost(&g_sRing) == (RING_SIZE + 1));
+    Write(3);
+    bPass = bPass && Sample_Ring_Get(&g_sRing, &ui32Sample, &bGap) &&
+            (ui32Sample == (RING_SIZE + 2)) && bGap &&
+            Sample_Ring_Get(&g_sRing, &ui32Sample, &bGap) &&
+            (ui32Sample == (RING_SIZE + 3)) && !bGap;
+    Check("samples before a drop skipped, gap reported after", bPass);
+
+    //
+    // Drops while the reader is part way through the ring: the reader skips
+    // what is left of it, and the writer stores again.
+    //
+    Start(1000);
+    Write(RING_SIZE);
+    for(ui32Idx = 0; ui32Idx < 5; ui32Idx++)
+    {
+        Read();
+    }
+    Write(8);
+    Write(2);
+    bPass = !Read() && (Sample_Ring_Count(&g_sRing) == 0);
+    Write(4);
+    while(Read())
+    {
+    }
+    bPass = bPass && ReaderClean() && (g_sReader.ui32Gaps == 1) &&
+            (g_sReader.ui32Last == g_ui32Written) &&
+            ((g_sReader.ui32Read + Sample_Ring_Lost(&g_sRing)) ==
+             g_ui32Written);
+    Check("drop part way through, all accounted for", bPass);
+
+    //
+    // Around the wrap of the indices.
+    //
+    Start(100000);
+    g_sRing.ui32Head = 0xFFFFFFF8;
+    g_sRing.ui32Tail = 0xFFFFFFF8;
+    g_sRing.ui32GapAt = 0xFFFFFFF7;
+    for(ui32Idx = 0; ui32Idx < 1000; ui32Idx++)
+    {
+        Write(rand() % (RING_SIZE + 4));
+        while((rand() % 8) && Read())
+        {
+        }
+    }
+    while(Read())
+    {
+    }
+    bPass = ReaderClean() && g_sReader.ui32Gaps &&
+            ((g_sReader.ui32Read + Sample_Ring_Lost(&g_sRing)) ==
+             g_ui32Written);
+    Check("indices wrap cleanly", bPass);
+}
+
+//*****************************************************************************
+//
+// The writer in a signal handler, interrupting the reader.
+//
+//*****************************************************************************
+static void
+Interrupt(int iSignal)
+{
+    static uint32_t ui32Seed = 1;
+
+    (void)iSignal;
+
+    //
+    // rand() is not safe in a signal handler.
+    //
+    ui32Seed = (ui32Seed * 1103515245) + 12345;
+    Write(1 + ((ui32Seed >> 16) % 3));
+}
+
+static void
+TestInterrupt(void)
+{
+    struct itimerval sTimer;
+    struct sigaction sAction;
+    uint32_t ui32Spin;
+
+    Start(1000000);
+
+    sAction.sa_handler = Interrupt;
+    sigemptyset(&sAction.sa_mask);
+    sAction.sa_flags = SA_RESTART;
+    sigaction(SIGALRM, &sAction, NULL);
+
+    sTimer.it_interval.tv_sec = 0;
+    sTimer.it_interval.tv_usec = 20;
+    sTimer.it_value = sTimer.it_interval;
+    setitimer(ITIMER_REAL, &sTimer, NULL);
+
+    while(g_ui32Written < g_ui32ToWrite)
+    {
+        Read();
+
+        //
+        // Fall behind now and then.
+        //
+        if(!(rand() % 50000))
+        {
+            for(ui32Spin = rand() % 2000000; ui32Spin; ui32Spin--)
+            {
+                __asm__ volatile("");
+            }
+        }
+    }
+
+    sTimer.it_value.tv_usec = 0;
+    sTimer.it_interval.tv_usec = 0;
+    setitimer(ITIMER_REAL, &sTimer, NULL);
+
+    while(Read())
+    {
+    }
+
+    printf("  %u written, %u read, %u lost in %u gaps\n", g_ui32Written,
+           g_sReader.ui32Read, Sample_Ring_Lost(&g_sRing),
+           g_sReader.ui32Gaps);
+    Check("writer interrupting the reader: in order, gaps exact",
+          ReaderClean() && g_sReader.ui32Gaps);
+    Check("writer interrupting the reader: all accounted for",
+          (g_sReader.ui32Read + Sample_Ring_Lost(&g_sRing)) ==
+          g_ui32Written);
+}
+
+//*****************************************************************************
+//
+// The writer in a thread of its own.
+//
+//*****************************************************************************
+static void *
+Writer(void *pvArg)
+{
+    unsigned int uiSeed = 7;
+    uint32_t ui32Spin;
+
+    (void)pvArg;
+
+    while(g_ui32Written < g_ui32ToWrite)
+    {
+        Write(1 + (rand_r(&uiSeed) % 4));
+        if(!(rand_r(&uiSeed) % 4))
+        {
+            sched_yield();
+        }
+        for(ui32Spin = rand_r(&uiSeed) % 1000; ui32Spin; ui32Spin--)
+        {
+            __asm__ volatile("");
+        }
+    }
+
+    return(NULL);
+}
+
+static void
+TestThreads(void)
+{
+    pthread_t sThread;
+    uint32_t ui32Spin;
+
+    Start(1000000);
+    pthread_create(&sThread, NULL, Writer, NULL);
+
+    while(g_ui32Written < g_ui32ToWrite)
+    {
+        Read();
+        if(!(rand() % 64))
+        {
+            sched_yield();
+        }
+        for(ui32Spin = rand() % 150; ui32Spin; ui32Spin--)
+        {
+            __asm__ volatile("");
+        }
+    }
+
+    pthread_join(sThread, NULL);
+    while(Read())
+    {
+    }
+
+    printf("  %u written, %u read, %u lost in %u gaps\n", g_ui32Written,
+           g_sReader.ui32Read, Sample_Ring_Lost(&g_sRing),
+           g_sReader.ui32Gaps);
+    Check("writer in another thread: in order, gaps exact", ReaderClean());
+    Check("writer in another thread: all accounted for",
+          (g_sReader.ui32Read + Sample_Ring_Lost(&g_sRing)) ==
+          g_ui32Written);
+}
+
+int
+main(void)
+{
+    srand(1);
+
+    TestSteps();
+    TestInterrupt();
+    TestThreads();
+
+    if(g_ui32Failures)
+    {
+        printf("%u failures\n", g_ui32Failures);
+        return(1);
+    }
+
+    printf("all passed\n");
+
+    return(0);
+}
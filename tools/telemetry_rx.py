@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+#
+# telemetry_rx.py - Receive the binary telemetry stream of the board (see
+# telemetry.h) and print rate and loss statistics.
+#
+# Usage:
+#
+#     python3 tools/telemetry_rx.py <board address> [-t 10] [--csv out.csv]
+#
+# The subscription is renewed well within the lease, and cancelled on exit.
+# Loss is counted twice: datagrams missing from the datagram sequence were
+# lost on the network; gaps in the sample sequence that are not explained by
+# a missing datagram were dropped on the board because its buffer was full.
+#
+
+import argparse
+import socket
+import struct
+import sys
+import time
+
+PORT = 5005
+LEASE = 10.0
+CMD_SUBSCRIBE = 0x01
+CMD_UNSUBSCRIBE = 0x02
+MAGIC = 0x4d54
+VERSION = 1
+
+HEADER = struct.Struct('<HBBI')
+SAMPLE = struct.Struct('<IiHHBBH')
+FLAG_AUTOMATIC = 0x01
+FLAG_ONLINE = 0x02
+
+
+class Stats(object):
+    def __init__(self):
+        self.datagrams = 0
+        self.samples = 0
+        self.bytes = 0
+        self.net_lost = 0
+        self.board_lost = 0
+        self.next_datagram = None
+        self.next_sample = None
+
+    def datagram(self, seq, size):
+        gap = False
+        if self.next_datagram is not None and seq != self.next_datagram:
+            self.net_lost += (seq - self.next_datagram) & 0xffffffff
+            gap = True
+        self.next_datagram = (seq + 1) & 0xffffffff
+        self.datagrams += 1
+        self.bytes += size
+        return gap
+
+    def sample(self, seq, after_gap):
+        if self.next_sample is not None and seq != self.next_sample:
+            if not after_gap:
+                self.board_lost += (seq - self.next_sample) & 0xffff
+        self.next_sample = (seq + 1) & 0xffff
+        self.samples += 1
+
+
+def subscribe(sock, addr, period):
+    sock.sendto(struct.pack('<BBH', CMD_SUBSCRIBE, 0, period), addr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='telemetry receiver')
+    parser.add_argument('host', help='address of the board')
+    parser.add_argument('-p', dest='period', type=int, default=10,
+                        help='sample period in milliseconds')
+    parser.add_argument('-t', dest='duration', type=float, default=0,
+                        help='stop after this many seconds (default: never)')
+    parser.add_argument('--csv', help='write the samples to this file')
+    args = parser.parse_args()
+
+    addr = (args.host, PORT)
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.settimeout(0.5)
+    csv = open(args.csv, 'w') if args.csv else None
+    if csv:
+        csv.write('time_ms,frequency,pulse_width,adc,speed,automatic,online,'
+                  'sequence\n')
+
+    stats = Stats()
+    start = last_report = last_renew = time.monotonic()
+    reported = Stats()
+    subscribe(sock, addr, args.period)
+    try:
+        while not args.duration or time.monotonic() - start < args.duration:
+            now = time.monotonic()
+            if now - last_renew >= LEASE / 3:
+                subscribe(sock, addr, args.period)
+                last_renew = now
+            if now - last_report >= 1.0:
+                span = now - last_report
+                sys.stdout.write(
+                    '%7.1f samples/s %6.1f datagrams/s %8.0f B/s '
+                    '%5.1f samples/datagram  lost: %d datagrams, '
+                    '%d samples on board\n' %
+                    ((stats.samples - reported.samples) / span,
+                     (stats.datagrams - reported.datagrams) / span,
+                     (stats.bytes - reported.bytes) / span,
+                     (stats.samples - reported.samples) /
+                     max(1, stats.datagrams - reported.datagrams),
+                     stats.net_lost, stats.board_lost))
+                reported.__dict__.update(stats.__dict__)
+                last_report = now
+
+            try:
+                data, _ = sock.recvfrom(2048)
+            except socket.timeout:
+                continue
+            if len(data) < HEADER.size:
+                continue
+            magic, version, count, seq = HEADER.unpack_from(data)
+            if (magic != MAGIC or version != VERSION or
+                    len(data) != HEADER.size + count * SAMPLE.size):
+                continue
+            gap = stats.datagram(seq, len(data))
+            for i in range(count):
+                (t, freq, pulse, adc, flags, speed,
+                 sseq) = SAMPLE.unpack_from(data, HEADER.size + i * SAMPLE.size)
+                stats.sample(sseq, gap and i == 0)
+                if csv:
+                    csv.write('%d,%d,%d,%d,%d,%d,%d,%d\n' %
+                              (t, freq, pulse, adc, speed,
+                               bool(flags & FLAG_AUTOMATIC),
+                               bool(flags & FLAG_ONLINE), sseq))
+    except KeyboardInterrupt:
+        pass
+    finally:
+        sock.sendto(bytes([CMD_UNSUBSCRIBE]), addr)
+        if csv:
+            csv.close()
+
+    elapsed = time.monotonic() - start
+    sys.stdout.write('total: %d samples in %d datagrams over %.1f s, '
+                     'lost %d datagrams and %d samples on board\n' %
+                     (stats.samples, stats.datagrams, elapsed, stats.net_lost,
+                      stats.board_lost))
+
+
+if __name__ == '__main__':
+    main()
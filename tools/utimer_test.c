@@ -0,0 +1,505 @@
+//*****************************************************************************
+//
+// utimer_test.c - Host test of the microsecond timer service (utimer.c).
+//
+// This is not part of the firmware.  Build and run it on the host with:
+//
+//     cc -O2 -I. -IFreeRTOS/include tools/utimer_test.c -o utimer_test &&
+//         ./utimer_test
+//
+// The service is compiled unchanged against a model of the Timer 5
+// registers driven by a fake clock that counts system clock cycles.  Every
+// read of the counter costs the CPU some cycles, so the waits move the clock
+// on as they spin; a task blocked in vTaskDelay() moves it on to the tick it
+// wakes up at without costing any.  The wrap interrupt is delivered at
+// random points, including between the reads the service makes, or held off
+// while interrupts are masked.
+//
+// The timestamps must follow the fake clock to the microsecond across the
+// wraps of the timer and of the 32-bit timestamps.  The waits must never be
+// early, the spinning ones by at most a couple of microseconds and the
+// sleeping ones by at most two ticks.
+//
+// The test then reports, for a task that waits in a loop for a second, the
+// CPU time spent spinning by the previous SysCtlDelay() waits and by the
+// service, and so the CPU time given back to the other tasks per second.
+// Waits shorter than a tick still spin, and give nothing back.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+//*****************************************************************************
+//
+// The system clock and the CPU cycles taken by a read of the counter and
+// the loop around it.
+//
+//*****************************************************************************
+#define SYS_CLOCK               120000000
+#define READ_CYCLES             12
+#define CYCLES_PER_US           (SYS_CLOCK / 1000000)
+#define CYCLES_PER_TICK         (SYS_CLOCK / 1000)
+
+uint32_t g_ui32SysClock = SYS_CLOCK;
+
+//*****************************************************************************
+//
+// The fake clock, the CPU cycles spent spinning on it and the cycles the
+// CPU was given to other tasks.
+//
+//*****************************************************************************
+static uint64_t g_ui64Cycles;
+static uint64_t g_ui64Busy;
+static uint64_t g_ui64Slept;
+
+//*****************************************************************************
+//
+// The model of Timer 5.  The timer counts from the time it was enabled;
+// ui64Acked is the number of wraps whose interrupt has been cleared.
+//
+//*****************************************************************************
+static struct
+{
+    uint32_t ui32CTL;
+    uint32_t ui32CFG;
+    uint32_t ui32TAMR;
+    uint32_t ui32TAILR;
+    uint32_t ui32IMR;
+    uint32_t ui32ICR;
+    uint32_t ui32RCGC;
+    uint64_t ui64Start;
+    uint64_t ui64Acked;
+    bool bMasked;
+    uint32_t ui32Failures;
+}
+g_sSim;
+
+static uint32_t TimerCount(void);
+static uint32_t TimerRIS(void);
+
+#include "tm4c1294ncpdt.h"
+
+#undef TIMER5_CTL_R
+#undef TIMER5_CFG_R
+#undef TIMER5_TAMR_R
+#undef TIMER5_TAILR_R
+#undef TIMER5_IMR_R
+#undef TIMER5_ICR_R
+#undef TIMER5_RIS_R
+#undef TIMER5_TAR_R
+#undef SYSCTL_RCGCTIMER_R
+#undef SYSCTL_PRTIMER_R
+#define TIMER5_CTL_R            (g_sSim.ui32CTL)
+#define TIMER5_CFG_R            (g_sSim.ui32CFG)
+#define TIMER5_TAMR_R           (g_sSim.ui32TAMR)
+#define TIMER5_TAILR_R          (g_sSim.ui32TAILR)
+#define TIMER5_IMR_R            (g_sSim.ui32IMR)
+#define TIMER5_ICR_R            (g_sSim.ui32ICR)
+#define TIMER5_RIS_R            (TimerRIS())
+#define TIMER5_TAR_R            (TimerCount())
+#define SYSCTL_RCGCTIMER_R      (g_sSim.ui32RCGC)
+#define SYSCTL_PRTIMER_R        (g_sSim.ui32RCGC)
+
+//*****************************************************************************
+//
+// A stand-in for the parts of FreeRTOS used by utimer.c.  A critical section
+// masks the wrap interrupt.
+//
+//*****************************************************************************
+#define INC_FREERTOS_H
+#define INC_TASK_H
+
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define portTICK_PERIOD_MS      1
+#define taskSCHEDULER_NOT_STARTED 1
+#define taskSCHEDULER_RUNNING   2
+
+static int g_iSchedulerState = taskSCHEDULER_NOT_STARTED;
+
+#define xTaskGetSchedulerState()        (g_iSchedulerState)
+
+static UBaseType_t
+taskENTER_CRITICAL_FROM_ISR(void)
+{
+    UBaseType_t uxWasMasked = g_sSim.bMasked;
+
+    g_sSim.bMasked = true;
+
+    return(uxWasMasked);
+}
+
+static void Deliver(void);
+
+static void
+taskEXIT_CRITICAL_FROM_ISR(UBaseType_t uxWasMasked)
+{
+    g_sSim.bMasked = uxWasMasked;
+    Deliver();
+}
+
+//
+// The task sleeps until the xTicks-th tick from now; the first one may be
+// just about to come.
+//
+static void
+vTaskDelay(TickType_t xTicks)
+{
+    uint64_t ui64Wake;
+
+    ui64Wake = ((g_ui64Cycles / CYCLES_PER_TICK) + xTicks) * CYCLES_PER_TICK;
+    g_ui64Slept += ui64Wake - g_ui64Cycles;
+    g_ui64Cycles = ui64Wake;
+    Deliver();
+}
+
+#include "utimer.c"
+
+//*****************************************************************************
+//
+// The model of the counter.  The timer counts up to TAILR and wraps to 0.
+//
+//*****************************************************************************
+static uint64_t
+TimerWraps(void)
+{
+    return((g_ui64Cycles - g_sSim.ui64Start) /
+           ((uint64_t)g_sSim.ui32TAILR + 1));
+}
+
+static void
+Clear(void)
+{
+    if(g_sSim.ui32ICR & TIMER_ICR_TATOCINT)
+    {
+        g_sSim.ui64Acked = TimerWraps();
+    }
+    g_sSim.ui32ICR = 0;
+}
+
+static uint32_t
+TimerRIS(void)
+{
+    Clear();
+
+    return((TimerWraps() > g_sSim.ui64Acked) ? TIMER_RIS_TATORIS : 0);
+}
+
+//
+// Run the interrupt handler if the interrupt is pending and not masked.
+//
+static void
+Deliver(void)
+{
+    if(!g_sSim.bMasked && (g_sSim.ui32IMR & TIMER_IMR_TATOIM) &&
+       TimerRIS())
+    {
+        UTimer_IntHandler();
+        Clear();
+        if(TimerRIS())
+        {
+            printf("  the interrupt handler did not clear the interrupt\n");
+            g_sSim.ui32Failures++;
+        }
+    }
+}
+
+//
+// A read of the counter takes some cycles, before and after which the
+// interrupt may come.
+//
+static uint32_t
+TimerCount(void)
+{
+    uint32_t ui32Count;
+
+    if(rand() & 1)
+    {
+        Deliver();
+    }
+
+    g_ui64Cycles += READ_CYCLES;
+    g_ui64Busy += READ_CYCLES;
+    ui32Count = (g_ui64Cycles - g_sSim.ui64Start) %
+                ((uint64_t)g_sSim.ui32TAILR + 1);
+
+    if(rand() & 1)
+    {
+        Deliver();
+    }
+
+    return(ui32Count);
+}
+
+//*****************************************************************************
+//
+// Check the outcome of a test.
+//
+//*****************************************************************************
+static void
+Check(const char *pcTest, bool bPass)
+{
+    printf("%-48s %s\n", pcTest, bPass ? "ok" : "FAILED");
+    if(!bPass)
+    {
+        g_sSim.ui32Failures++;
+    }
+}
+
+//
+// The time on the fake clock since the timer was started, in microseconds,
+// as the 32-bit timestamps count it.
+//
+static uint32_t
+TrueUs(void)
+{
+    return((uint32_t)((g_ui64Cycles - g_sSim.ui64Start) / CYCLES_PER_US));
+}
+
+//
+// Start the service at the given time on the fake clock.
+//
+static void
+Start(uint64_t ui64Cycles)
+{
+    g_ui64Cycles = ui64Cycles;
+    g_sSim.ui32CTL = 0;
+    g_sSim.bMasked = false;
+    g_iSchedulerState = taskSCHEDULER_NOT_STARTED;
+
+    UTimer_Init();
+
+    g_sSim.ui64Start = g_ui64Cycles;
+    g_sSim.ui64Acked = 0;
+}
+
+//*****************************************************************************
+//
+// The timestamps follow the clock across the wraps of the timer, whether
+// the wrap interrupt comes between the reads of the service or is held off.
+//
+//*****************************************************************************
+static void
+TestTimestamps(void)
+{
+    uint64_t ui64Period, ui64End;
+    uint32_t ui32Now, ui32Before, ui32After;
+    bool bPass, bMonotonic, bSetUp;
+
+    Start(1000);
+    bSetUp = ((g_sSim.ui32CTL & TIMER_CTL_TAEN) &&
+              (g_sSim.ui32TAMR == (TIMER_TAMR_TAMR_PERIOD |
+                                   TIMER_TAMR_TACDIR)) &&
+              (((uint64_t)g_sSim.ui32TAILR + 1) ==
+               ((uint64_t)CYCLES_PER_US << UTIMER_WRAP_SHIFT)));
+    Check("timer set up as a 2^25 us periodic up-counter", bSetUp);
+
+    //
+    // Around each of the first wraps, with the interrupt free to come and
+    // masked for a while on every other wrap.
+    //
+    ui64Period = (uint64_t)g_sSim.ui32TAILR + 1;
+    bPass = true;
+    bMonotonic = true;
+    for(ui64End = 1; ui64End <= 6; ui64End++)
+    {
+        g_ui64Cycles = g_sSim.ui64Start + (ui64End * ui64Period) - 5000;
+        Deliver();
+        g_sSim.bMasked = (ui64End & 1) ? true : false;
+        ui32Before = UTimer_Now();
+        while(g_ui64Cycles < (g_sSim.ui64Start + (ui64End * ui64Period) +
+                              5000))
+        {
+            ui32Before = TrueUs();
+            ui32Now = UTimer_Now();
+            ui32After = TrueUs();
+            if((ui32Now < ui32Before) || (ui32Now > ui32After))
+            {
+                if(bPass)
+                {
+                    printf("  %u us read between %u and %u us\n", ui32Now,
+                           ui32Before, ui32After);
+                }
+                bPass = false;
+            }
+            g_ui64Cycles += rand() % 200;
+        }
+        g_sSim.bMasked = false;
+        Deliver();
+    }
+    Check("timestamps follow the clock across wraps", bPass);
+
+    //
+    // Around the wrap of the 32-bit timestamps, after 2^32 us.
+    //
+    g_ui64Cycles = g_sSim.ui64Start +
+                   ((((uint64_t)1 << 32) - 2000) * CYCLES_PER_US);
+    g_sSim.ui64Acked = TimerWraps();
+    g_ui32Wraps = (uint32_t)g_sSim.ui64Acked;
+    ui32Before = UTimer_Now();
+    for(ui64End = 0; ui64End < 1000; ui64End++)
+    {
+        g_ui64Cycles += rand() % 2000;
+        ui32Now = UTimer_Now();
+        if((ui32Now != TrueUs()) || ((ui32Now - ui32Before) > 0x80000000))
+        {
+            bMonotonic = false;
+        }
+        ui32Before = ui32Now;
+    }
+    Check("timestamps wrap cleanly after 2^32 us", bMonotonic);
+}
+
+//*****************************************************************************
+//
+// The waits are never early and not much late.
+//
+//*****************************************************************************
+static void
+TestWaits(void)
+{
+    static const uint32_t pui32Delays[] =
+    {
+        0, 1, 2, 3, 10, 57, 100, 999, 1000, 1001, 2500, 40000,
+    };
+    uint64_t ui64Start;
+    uint32_t ui32Idx, ui32Try, ui32Elapsed, ui32Worst;
+    bool bPass;
+
+    Start(0);
+
+    //
+    // Spinning waits, over the wraps of the timer too.
+    //
+    bPass = true;
+    ui32Worst = 0;
+    for(ui32Idx = 0; ui32Idx < (sizeof(pui32Delays) / sizeof(uint32_t));
+        ui32Idx++)
+    {
+        for(ui32Try = 0; ui32Try < 200; ui32Try++)
+        {
+            g_ui64Cycles += rand() % (1 << 30);
+            Deliver();
+            ui64Start = g_ui64Cycles;
+            UTimer_Delay_Us(pui32Delays[ui32Idx]);
+            ui32Elapsed = (g_ui64Cycles - ui64Start) / CYCLES_PER_US;
+            if((ui32Elapsed < pui32Delays[ui32Idx]) ||
+               (ui32Elapsed > (pui32Delays[ui32Idx] + 2)))
+            {
+                bPass = false;
+            }
+            if((ui32Elapsed - pui32Delays[ui32Idx]) > ui32Worst)
+            {
+                ui32Worst = ui32Elapsed - pui32Delays[ui32Idx];
+            }
+        }
+    }
+    Check("spinning waits are on time", bPass);
+    printf("  at most %u us late\n", ui32Worst);
+
+    //
+    // Sleeping waits, which spin when they are short or the scheduler has not
+    // started.
+    //
+    bPass = true;
+    for(ui32Idx = 0; ui32Idx < (sizeof(pui32Delays) / sizeof(uint32_t));
+        ui32Idx++)
+    {
+        for(ui32Try = 0; ui32Try < 200; ui32Try++)
+        {
+            g_iSchedulerState = (ui32Try & 1) ? taskSCHEDULER_RUNNING :
+                                                taskSCHEDULER_NOT_STARTED;
+            g_ui64Cycles += rand() % (1 << 30);
+            Deliver();
+            ui64Start = g_ui64Cycles;
+            g_ui64Slept = 0;
+            UTimer_Sleep_Us(pui32Delays[ui32Idx]);
+            ui32Elapsed = (g_ui64Cycles - ui64Start) / CYCLES_PER_US;
+            if((ui32Elapsed < pui32Delays[ui32Idx]) ||
+               (ui32Elapsed >= (pui32Delays[ui32Idx] + (2 * UTIMER_TICK_US))))
+            {
+                bPass = false;
+            }
+            if((g_iSchedulerState != taskSCHEDULER_RUNNING) &&
+               g_ui64Slept)
+            {
+                bPass = false;
+            }
+            if((g_iSchedulerState == taskSCHEDULER_RUNNING) &&
+               (pui32Delays[ui32Idx] >= UTIMER_TICK_US) && !g_ui64Slept)
+            {
+                bPass = false;
+            }
+        }
+    }
+    Check("sleeping waits are on time and block if long", bPass);
+}
+
+//*****************************************************************************
+//
+// Report the CPU time spent spinning by a task that waits in a loop for a
+// second, with SysCtlDelay() and with the service.
+//
+//*****************************************************************************
+static void
+Report(void)
+{
+    static const uint32_t pui32Waits[] =
+    {
+        50, 400, 1000, 2000, 10000, 100000,
+    };
+    tUTimerStats sStats;
+    uint64_t ui64End, ui64Busy;
+    uint32_t ui32Idx;
+
+    Start(0);
+    g_iSchedulerState = taskSCHEDULER_RUNNING;
+
+    printf("\nA task waiting in a loop for 1 s, CPU time spent spinning:\n");
+    printf("%10s %14s %14s %14s\n", "wait", "SysCtlDelay", "service",
+           "reclaimed");
+    for(ui32Idx = 0; ui32Idx < (sizeof(pui32Waits) / sizeof(uint32_t));
+        ui32Idx++)
+    {
+        ui64End = g_ui64Cycles + SYS_CLOCK;
+        g_ui64Busy = 0;
+        UTimer_Take_Stats(&sStats);
+        while(g_ui64Cycles < ui64End)
+        {
+            UTimer_Sleep_Us(pui32Waits[ui32Idx]);
+        }
+        UTimer_Take_Stats(&sStats);
+        ui64Busy = g_ui64Busy / CYCLES_PER_US;
+
+        //
+        // SysCtlDelay() spins for the whole second.
+        //
+        printf("%7u us %11u us %11u us %11d us (%u sleeps, %u spins)\n",
+               pui32Waits[ui32Idx], 1000000, (uint32_t)ui64Busy,
+               1000000 - (int32_t)ui64Busy, sStats.ui32Sleeps,
+               sStats.ui32Delays);
+    }
+}
+
+int
+main(void)
+{
+    srand(1);
+
+    TestTimestamps();
+    TestWaits();
+    Report();
+
+    if(g_sSim.ui32Failures)
+    {
+        printf("%u checks failed\n", g_sSim.ui32Failures);
+        return(1);
+    }
+
+    printf("all checks passed\n");
+
+    return(0);
+}
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+#
+# ws_bench.py - Measure the round-trip time of commands sent to the board
+# over the WebSocket control channel (/ws, see io_ws.h).
+#
+# Each command is sent on its own and the next one only goes out once the
+# board has answered, so the figures are the latency a slider move sees.
+#
+# Usage:
+#
+#     python3 tools/ws_bench.py <board address> [-n 10000] [--echo]
+#
+# By default set-speed commands are sent and timed up to the status message
+# that confirms them.  With --echo, echo commands are sent instead, which
+# measures the network and protocol overhead without touching the motor.
+#
+
+import argparse
+import base64
+import os
+import socket
+import struct
+import sys
+import time
+
+CMD_SET_SPEED = 0x01
+CMD_ECHO = 0x04
+MSG_STATUS = 0x81
+MSG_ECHO = 0x84
+
+OP_BINARY = 0x2
+OP_CLOSE = 0x8
+OP_PING = 0x9
+OP_PONG = 0xa
+
+
+def recv_exact(sock, n):
+    data = b''
+    while len(data) < n:
+        chunk = sock.recv(n - len(data))
+        if not chunk:
+            raise EOFError('connection closed by the board')
+        data += chunk
+    return data
+
+
+def handshake(sock, host):
+    key = base64.b64encode(os.urandom(16)).decode()
+    sock.sendall(('GET /ws HTTP/1.1\r\n'
+                  'Host: %s\r\n'
+                  'Upgrade: websocket\r\n'
+                  'Connection: Upgrade\r\n'
+                  'Sec-WebSocket-Key: %s\r\n'
+                  'Sec-WebSocket-Version: 13\r\n\r\n' % (host, key)).encode())
+    response = b''
+    while b'\r\n\r\n' not in response:
+        response += recv_exact(sock, 1)
+    if not response.startswith(b'HTTP/1.1 101'):
+        raise RuntimeError('upgrade refused: %s' %
+                           response.split(b'\r\n')[0].decode())
+
+
+def send_frame(sock, op, payload):
+    mask = os.urandom(4)
+    masked = bytes(b ^ mask[i & 3] for i, b in enumerate(payload))
+    sock.sendall(struct.pack('BB', 0x80 | op, 0x80 | len(payload)) + mask +
+                 masked)
+
+
+def recv_message(sock):
+    while True:
+        op, length = recv_exact(sock, 2)
+        payload = recv_exact(sock, length & 0x7f)
+        op &= 0x0f
+        if op == OP_PING:
+            send_frame(sock, OP_PONG, payload)
+        elif op == OP_CLOSE:
+            raise EOFError('connection closed by the board')
+        elif op == OP_BINARY:
+            return payload
+
+
+def wait_for(sock, code, check):
+    while True:
+        msg = recv_message(sock)
+        if msg and msg[0] == code and check(msg):
+            return msg
+
+
+def main():
+    parser = argparse.ArgumentParser(description='WebSocket latency benchmark')
+    parser.add_argument('host', help='address of the board')
+    parser.add_argument('-p', dest='port', type=int, default=80,
+                        help='web server port')
+    parser.add_argument('-n', dest='count', type=int, default=10000,
+                        help='number of commands to send')
+    parser.add_argument('--echo', action='store_true',
+                        help='time echo commands instead of set-speed')
+    args = parser.parse_args()
+
+    sock = socket.create_connection((args.host, args.port))
+    sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    handshake(sock, args.host)
+
+    # The board starts with its current state.
+    wait_for(sock, MSG_STATUS, lambda msg: True)
+
+    rtt = []
+    for i in range(args.count):
+        start = time.perf_counter()
+        if args.echo:
+            tag = struct.pack('<I', i)
+            send_frame(sock, OP_BINARY, bytes([CMD_ECHO]) + tag)
+            wait_for(sock, MSG_ECHO, lambda msg: msg[1:5] == tag)
+        else:
+            speed = i % 101
+            send_frame(sock, OP_BINARY, bytes([CMD_SET_SPEED, speed]))
+            wait_for(sock, MSG_STATUS, lambda msg: msg[1] == speed)
+        rtt.append(time.perf_counter() - start)
+
+    send_frame(sock, OP_CLOSE, struct.pack('>H', 1000))
+    sock.close()
+
+    rtt.sort()
+    total = sum(rtt)
+    ms = lambda v: v * 1000.0
+    sys.stdout.write('%d %s commands in %.2f s (%.0f/s)\n' %
+                     (len(rtt), 'echo' if args.echo else 'set-speed', total,
+                      len(rtt) / total))
+    sys.stdout.write('RTT ms: min %.3f  avg %.3f  p50 %.3f  p99 %.3f  '
+                     'max %.3f\n' %
+                     (ms(rtt[0]), ms(total / len(rtt)),
+                      ms(rtt[len(rtt) // 2]), ms(rtt[len(rtt) * 99 // 100]),
+                      ms(rtt[-1])))
+
+
+if __name__ == '__main__':
+    main()
@@ -1,3 +1,5 @@
+#if !defined(__UTILS_H__)
+#define __UTILS_H__
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
@@ -12,3 +14,4 @@ extern void SysTick_Wait1ms(int time_in_ms);
 /* itoa:  convert n to characters in s */
 extern void itoa(int n, char s[]);
 
+#endif // __UTILS_H__
@@ -375,12 +375,18 @@ static uint32_t g_ui32GWAddr;
 
 //*****************************************************************************
 //
-// The stack size for the interrupt task.
+// The stack size and priority of the interrupt task.  Both can be overridden
+// in lwipopts.h.
 //
 //*****************************************************************************
 #if !NO_SYS
+#ifndef STACKSIZE_LWIPINTTASK
 #define STACKSIZE_LWIPINTTASK   128
 #endif
+#ifndef PRIORITY_LWIPINTTASK
+#define PRIORITY_LWIPINTTASK    (tskIDLE_PRIORITY + 1)
+#endif
+#endif
 
 //*****************************************************************************
 //
@@ -725,7 +731,7 @@ lwIPPrivateInit(void *pvArg)
 #if !NO_SYS
 #if RTOS_FREERTOS
     xTaskCreate(lwIPInterruptTask, (signed portCHAR *)"eth_int",
-                STACKSIZE_LWIPINTTASK, 0, tskIDLE_PRIORITY + 1,
+                STACKSIZE_LWIPINTTASK, 0, PRIORITY_LWIPINTTASK,
                 0);
 #endif
 #endif
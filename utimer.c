@@ -0,0 +1,232 @@
+//*****************************************************************************
+//
+// utimer.c - Microsecond timer service on Timer 5.
+//
+// Timer 5 counts system clock cycles up from zero and wraps every
+// 2^UTIMER_WRAP_SHIFT microseconds; its time-out interrupt counts the wraps,
+// which make the upper bits of the timestamps.  The timestamps so do not
+// depend on the clock frequency and, unlike SysCtlDelay(), neither do the
+// waits built on them.  Short waits spin on the timestamps; longer ones block
+// the calling task for whole ticks so that the other tasks get the CPU.
+//
+// The service only touches the Timer 5 registers, so tools/utimer_test.c can
+// run it against a model of the timer and a fake clock on the host.  The
+// interrupt is enabled in the NVIC by the application.
+//
+//*****************************************************************************
+#include <stdbool.h>
+#include <stdint.h>
+#include "tm4c1294ncpdt.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "utimer.h"
+
+//*****************************************************************************
+//
+// The system clock frequency.
+//
+//*****************************************************************************
+extern uint32_t g_ui32SysClock;
+
+//*****************************************************************************
+//
+// The number of cycles in a microsecond, the last count of the timer before
+// it wraps and the number of wraps counted by the interrupt handler.
+//
+//*****************************************************************************
+static uint32_t g_ui32CyclesPerUs;
+static uint32_t g_ui32Last;
+static volatile uint32_t g_ui32Wraps;
+
+//*****************************************************************************
+//
+// The waits since the last call to UTimer_Take_Stats().
+//
+//*****************************************************************************
+static tUTimerStats g_sStats;
+
+//*****************************************************************************
+//
+//! Starts the timer service.
+//!
+//! This must be called once the system clock is set up and before any other
+//! function of the service.  The timer starts counting at once; its
+//! interrupt must then be enabled in the NVIC for the timestamps to run past
+//! the first wrap.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+UTimer_Init(void)
+{
+    g_ui32CyclesPerUs = g_ui32SysClock / 1000000;
+    g_ui32Last = (g_ui32CyclesPerUs << UTIMER_WRAP_SHIFT) - 1;
+    g_ui32Wraps = 0;
+
+    SYSCTL_RCGCTIMER_R |= SYSCTL_RCGCTIMER_R5;
+    while(!(SYSCTL_PRTIMER_R & SYSCTL_PRTIMER_R5))
+    {
+    }
+
+    //
+    // A 32-bit periodic timer counting up.
+    //
+    TIMER5_CTL_R &= ~TIMER_CTL_TAEN;
+    TIMER5_CFG_R = TIMER_CFG_32_BIT_TIMER;
+    TIMER5_TAMR_R = TIMER_TAMR_TAMR_PERIOD | TIMER_TAMR_TACDIR;
+    TIMER5_TAILR_R = g_ui32Last;
+    TIMER5_ICR_R = TIMER_ICR_TATOCINT;
+    TIMER5_IMR_R = TIMER_IMR_TATOIM;
+    TIMER5_CTL_R |= TIMER_CTL_TAEN;
+}
+
+//*****************************************************************************
+//
+//! The Timer 5A interrupt handler, which counts the wraps of the timer.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+UTimer_IntHandler(void)
+{
+    TIMER5_ICR_R = TIMER_ICR_TATOCINT;
+    g_ui32Wraps++;
+}
+
+//*****************************************************************************
+//
+//! Returns the time.
+//!
+//! This may be called from a task or an interrupt handler, with interrupts
+//! masked or not.
+//!
+//! \return The time in microseconds since UTimer_Init(), which wraps after
+//! about 71 minutes.
+//
+//*****************************************************************************
+uint32_t
+UTimer_Now(void)
+{
+    uint32_t ui32Wraps, ui32Count, ui32Pending;
+
+    do
+    {
+        ui32Wraps = g_ui32Wraps;
+        ui32Count = TIMER5_TAR_R;
+
+        //
+        // A wrap that the interrupt handler has not counted yet, because
+        // interrupts are masked or the handler is about to run.  The count
+        // tells whether it came before or after it was read.
+        //
+        ui32Pending = ((TIMER5_RIS_R & TIMER_RIS_TATORIS) &&
+                       (ui32Count < (g_ui32Last / 2))) ? 1 : 0;
+    }
+    while(ui32Wraps != g_ui32Wraps);
+
+    return(((ui32Wraps + ui32Pending) << UTIMER_WRAP_SHIFT) +
+           (ui32Count / g_ui32CyclesPerUs));
+}
+
+//*****************************************************************************
+//
+//! Waits by spinning.
+//!
+//! \param ui32Us is the time to wait in microseconds.
+//!
+//! This never returns early, and returns within a microsecond or so of the
+//! time unless interrupted.  It can be used before the scheduler is started,
+//! from an interrupt handler and by a task holding a lock, but keeps the CPU
+//! busy; tasks should use UTimer_Sleep_Us() for anything but short waits.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+UTimer_Delay_Us(uint32_t ui32Us)
+{
+    uint32_t ui32Start;
+    UBaseType_t uxMask;
+
+    if(!ui32Us)
+    {
+        return;
+    }
+
+    //
+    // The first microsecond may be almost over, so wait one more.
+    //
+    ui32Start = UTimer_Now();
+    while((UTimer_Now() - ui32Start) <= ui32Us)
+    {
+    }
+
+    uxMask = taskENTER_CRITICAL_FROM_ISR();
+    g_sStats.ui32Delays++;
+    g_sStats.ui32SpunUs += ui32Us;
+    taskEXIT_CRITICAL_FROM_ISR(uxMask);
+}
+
+//*****************************************************************************
+//
+//! Waits, letting the other tasks run if the wait is long enough.
+//!
+//! \param ui32Us is the time to wait in microseconds.
+//!
+//! A task waiting UTIMER_TICK_US or more is blocked, and wakes up less than
+//! two ticks after the time.  Shorter waits, and waits before the scheduler is
+//! started or while it is suspended, spin with UTimer_Delay_Us().  This never
+//! returns early.  It must not be called from an interrupt handler.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+UTimer_Sleep_Us(uint32_t ui32Us)
+{
+    uint32_t ui32Start;
+    UBaseType_t uxMask;
+
+    if((ui32Us < UTIMER_TICK_US) ||
+       (xTaskGetSchedulerState() != taskSCHEDULER_RUNNING))
+    {
+        UTimer_Delay_Us(ui32Us);
+        return;
+    }
+
+    //
+    // The first tick may come at once, so block for one more.
+    //
+    ui32Start = UTimer_Now();
+    vTaskDelay(((ui32Us + UTIMER_TICK_US - 1) / UTIMER_TICK_US) + 1);
+
+    uxMask = taskENTER_CRITICAL_FROM_ISR();
+    g_sStats.ui32Sleeps++;
+    g_sStats.ui32SleptUs += UTimer_Now() - ui32Start;
+    taskEXIT_CRITICAL_FROM_ISR(uxMask);
+}
+
+//*****************************************************************************
+//
+//! Reads and clears the statistics of the waits.
+//!
+//! \param psStats receives the statistics collected since the last call.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+UTimer_Take_Stats(tUTimerStats *psStats)
+{
+    UBaseType_t uxMask;
+
+    uxMask = taskENTER_CRITICAL_FROM_ISR();
+    *psStats = g_sStats;
+    g_sStats.ui32Delays = 0;
+    g_sStats.ui32SpunUs = 0;
+    g_sStats.ui32Sleeps = 0;
+    g_sStats.ui32SleptUs = 0;
+    taskEXIT_CRITICAL_FROM_ISR(uxMask);
+}
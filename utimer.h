@@ -0,0 +1,64 @@
+//*****************************************************************************
+//
+// utimer.h - Prototypes for the microsecond timer service.
+//
+//*****************************************************************************
+
+#ifndef __UTIMER_H__
+#define __UTIMER_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The timer wraps every 2^UTIMER_WRAP_SHIFT microseconds (about 33.5 s),
+// which keeps the timestamps continuous across the wraps.  The period in
+// cycles must fit in 32 bits, which it does up to 128 MHz.
+//
+//*****************************************************************************
+#define UTIMER_WRAP_SHIFT       25
+
+//*****************************************************************************
+//
+// The length of a FreeRTOS tick in microseconds.  UTimer_Sleep_Us() spins
+// through waits shorter than this and blocks for longer ones.
+//
+//*****************************************************************************
+#define UTIMER_TICK_US          (1000 * portTICK_PERIOD_MS)
+
+//*****************************************************************************
+//
+// The waits since the last call to UTimer_Take_Stats(): the number of
+// waits that spun and the time spent spinning, and the number of sleeps and
+// the time the calling tasks were blocked, which the other tasks could use.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Delays;
+    uint32_t ui32SpunUs;
+    uint32_t ui32Sleeps;
+    uint32_t ui32SleptUs;
+}
+tUTimerStats;
+
+//*****************************************************************************
+//
+// Prototypes of functions exported by this module.
+//
+//*****************************************************************************
+extern void UTimer_Init(void);
+extern void UTimer_IntHandler(void);
+extern uint32_t UTimer_Now(void);
+extern void UTimer_Delay_Us(uint32_t ui32Us);
+extern void UTimer_Sleep_Us(uint32_t ui32Us);
+extern void UTimer_Take_Stats(tUTimerStats *psStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UTIMER_H__